@@ -0,0 +1,126 @@
+#include "storm-bench/generators/SmgGenerators.h"
+
+#include <sstream>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace bench {
+
+        GeneratedSmg generateGridWorld(uint64_t size) {
+            STORM_LOG_THROW(size >= 2, storm::exceptions::InvalidArgumentException, "The grid needs to have at least two rows and columns.");
+            std::stringstream stream;
+            stream << "smg\n\n";
+            stream << "player robot\n  [e1], [w1], [n1], [s1], [stay1]\nendplayer\n\n";
+            stream << "player adversary\n  [e2], [w2], [n2], [s2], [stay2]\nendplayer\n\n";
+            stream << "const int N = " << (size - 1) << ";\n";
+            stream << "const double slip = 1/10;\n\n";
+            stream << "global move : [0..1] init 0;\n\n";
+            stream << "label \"crash\" = x1=x2 & y1=y2;\n\n";
+            stream << "module robot\n";
+            stream << "  x1 : [0..N] init 0;\n";
+            stream << "  y1 : [0..N] init 0;\n\n";
+            stream << "  [e1] move=0 & x1<N -> (x1'=x1+1) & (move'=1);\n";
+            stream << "  [w1] move=0 & x1>0 -> (x1'=x1-1) & (move'=1);\n";
+            stream << "  [n1] move=0 & y1>0 -> (y1'=y1-1) & (move'=1);\n";
+            stream << "  [s1] move=0 & y1<N -> (y1'=y1+1) & (move'=1);\n";
+            stream << "  [stay1] move=0 -> (move'=1);\n";
+            stream << "endmodule\n\n";
+            stream << "module adversary\n";
+            stream << "  x2 : [0..N] init N;\n";
+            stream << "  y2 : [0..N] init N;\n\n";
+            stream << "  [e2] move=1 & x2<N -> 1-slip : (x2'=x2+1) & (move'=0) + slip : (move'=0);\n";
+            stream << "  [w2] move=1 & x2>0 -> 1-slip : (x2'=x2-1) & (move'=0) + slip : (move'=0);\n";
+            stream << "  [n2] move=1 & y2>0 -> 1-slip : (y2'=y2-1) & (move'=0) + slip : (move'=0);\n";
+            stream << "  [s2] move=1 & y2<N -> 1-slip : (y2'=y2+1) & (move'=0) + slip : (move'=0);\n";
+            stream << "  [stay2] move=1 -> (move'=0);\n";
+            stream << "endmodule\n";
+            return GeneratedSmg{"gridworld/" + std::to_string(size), stream.str(), "crash", "robot"};
+        }
+
+        GeneratedSmg generateMultiRobot(uint64_t numberOfRobots, uint64_t length) {
+            STORM_LOG_THROW(numberOfRobots >= 2, storm::exceptions::InvalidArgumentException, "There need to be at least two robots.");
+            STORM_LOG_THROW(length >= numberOfRobots, storm::exceptions::InvalidArgumentException, "The ring needs to have at least one position per robot.");
+            std::stringstream stream;
+            stream << "smg\n\n";
+            for (uint64_t robot = 1; robot <= numberOfRobots; ++robot) {
+                stream << "player robot" << robot << "\n  [cw" << robot << "], [ccw" << robot << "], [stay" << robot << "]\nendplayer\n\n";
+            }
+            stream << "const int L = " << length << ";\n";
+            stream << "const double fail = 1/20;\n\n";
+            stream << "global turn : [0.." << (numberOfRobots - 1) << "] init 0;\n\n";
+            stream << "label \"collision\" = ";
+            for (uint64_t robot = 2; robot <= numberOfRobots; ++robot) {
+                stream << (robot > 2 ? " | " : "") << "p1=p" << robot;
+            }
+            stream << ";\n\n";
+            for (uint64_t robot = 1; robot <= numberOfRobots; ++robot) {
+                std::string position = "p" + std::to_string(robot);
+                std::string nextTurn = "(turn'=" + std::to_string(robot % numberOfRobots) + ")";
+                stream << "module robot" << robot << "\n";
+                stream << "  " << position << " : [0..L-1] init " << ((robot - 1) * length / numberOfRobots) << ";\n\n";
+                stream << "  [cw" << robot << "] turn=" << (robot - 1) << " -> 1-fail : (" << position << "'=mod(" << position << "+1, L)) & " << nextTurn << " + fail : " << nextTurn << ";\n";
+                stream << "  [ccw" << robot << "] turn=" << (robot - 1) << " -> 1-fail : (" << position << "'=mod(" << position << "+L-1, L)) & " << nextTurn << " + fail : " << nextTurn << ";\n";
+                stream << "  [stay" << robot << "] turn=" << (robot - 1) << " -> " << nextTurn << ";\n";
+                stream << "endmodule\n\n";
+            }
+            return GeneratedSmg{"multirobot/" + std::to_string(numberOfRobots) + "/" + std::to_string(length), stream.str(), "collision", "robot1"};
+        }
+
+        GeneratedSmg generateMessaging(uint64_t numberOfMessages) {
+            STORM_LOG_THROW(numberOfMessages >= 1, storm::exceptions::InvalidArgumentException, "At least one message needs to be sent.");
+            std::stringstream stream;
+            stream << "smg\n\n";
+            stream << "player sender\n  [sendPlain], [sendEncrypted], [waitS]\nendplayer\n\n";
+            stream << "player eve\n  [hack], [waitE]\nendplayer\n\n";
+            stream << "player receiver\n  [receive], [drop], [waitR]\nendplayer\n\n";
+            stream << "const int N = " << numberOfMessages << ";\n";
+            stream << "const double hackPlain = 1/10;\n";
+            stream << "const double hackEncrypted = 1/100;\n";
+            stream << "const double encryptionFailure = 1/5;\n\n";
+            stream << "// 0 sender, 1 eve, 2 receiver\n";
+            stream << "global move : [0..2] init 0;\n";
+            stream << "// 0 no message, 1 plain message, 2 encrypted message\n";
+            stream << "global inTransit : [0..2] init 0;\n";
+            stream << "global hacked : [0..1] init 0;\n\n";
+            stream << "label \"hacked\" = hacked=1;\n\n";
+            stream << "module sender\n";
+            stream << "  sent : [0..N] init 0;\n\n";
+            stream << "  [sendPlain] move=0 & inTransit=0 & sent<N -> (sent'=sent+1) & (inTransit'=1) & (move'=1);\n";
+            stream << "  [sendEncrypted] move=0 & inTransit=0 & sent<N -> 1-encryptionFailure : (sent'=sent+1) & (inTransit'=2) & (move'=1) + encryptionFailure : (move'=1);\n";
+            stream << "  [waitS] move=0 & !(inTransit=0 & sent<N) -> (move'=1);\n";
+            stream << "endmodule\n\n";
+            stream << "module eve\n";
+            stream << "  [hack] move=1 & inTransit>0 & hacked=0 -> (inTransit=1 ? hackPlain : hackEncrypted) : (hacked'=1) & (move'=2) + 1-(inTransit=1 ? hackPlain : hackEncrypted) : (move'=2);\n";
+            stream << "  [waitE] move=1 -> (move'=2);\n";
+            stream << "endmodule\n\n";
+            stream << "module receiver\n";
+            stream << "  delivered : [0..N] init 0;\n\n";
+            stream << "  [receive] move=2 & inTransit>0 -> (delivered'=delivered+1) & (inTransit'=0) & (move'=0);\n";
+            stream << "  [drop] move=2 & inTransit>0 -> (inTransit'=0) & (move'=0);\n";
+            stream << "  [waitR] move=2 & inTransit=0 -> (move'=0);\n";
+            stream << "endmodule\n";
+            return GeneratedSmg{"messaging/" + std::to_string(numberOfMessages), stream.str(), "hacked", "sender"};
+        }
+
+        std::vector<GeneratedSmg> generateBenchmarkSmgs() {
+            std::vector<GeneratedSmg> result;
+            for (uint64_t size : {4, 8, 16}) {
+                result.push_back(generateGridWorld(size));
+            }
+            for (uint64_t length : {8, 16}) {
+                result.push_back(generateMultiRobot(3, length));
+            }
+            result.push_back(generateMultiRobot(4, 10));
+            for (uint64_t numberOfMessages : {16, 64, 256}) {
+                result.push_back(generateMessaging(numberOfMessages));
+            }
+            return result;
+        }
+
+        std::vector<GeneratedSmg> generateSmokeTestSmgs() {
+            return {generateGridWorld(2), generateMultiRobot(2, 2), generateMessaging(1)};
+        }
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace storm {
+    namespace bench {
+
+        /*!
+         * A generated stochastic multiplayer game given as PRISM program, together with the label of the states that
+         * the coalition wants to avoid.
+         */
+        struct GeneratedSmg {
+            // A name of the form family/parameters that identifies the instance.
+            std::string name;
+            std::string program;
+            std::string badLabel;
+            std::string coalitionPlayer;
+        };
+
+        /*!
+         * A robot moves on a size x size grid and tries to avoid an adversary robot that starts in the opposite corner.
+         * The adversary chooses its direction but slips with some probability. The number of states grows with size^4.
+         */
+        GeneratedSmg generateGridWorld(uint64_t size);
+
+        /*!
+         * The given number of robots (each one a player) move in turns on a ring of the given length. The first robot
+         * wants to avoid collisions, all moves fail with some probability. The number of states grows with
+         * length^numberOfRobots.
+         */
+        GeneratedSmg generateMultiRobot(uint64_t numberOfRobots, uint64_t length);
+
+        /*!
+         * A sender transmits the given number of messages (plain or encrypted) to a receiver while an eavesdropper tries
+         * to hack them. The number of states grows quadratically in the number of messages.
+         */
+        GeneratedSmg generateMessaging(uint64_t numberOfMessages);
+
+        /*!
+         * The instances of all families that are used by the benchmarks.
+         */
+        std::vector<GeneratedSmg> generateBenchmarkSmgs();
+
+        /*!
+         * The smallest instance of each family, used to check that the generators and benchmarks still work.
+         */
+        std::vector<GeneratedSmg> generateSmokeTestSmgs();
+    }
+}
@@ -0,0 +1,213 @@
+#include "storm-bench/harness/BenchmarkRunner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <iomanip>
+#include <regex>
+#include <sstream>
+#include <thread>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm-version-info/storm-version.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace bench {
+
+        BenchmarkState::BenchmarkState(uint64_t iterations) : iterations(iterations), completedIterations(0) {
+            // Intentionally left empty.
+        }
+
+        bool BenchmarkState::keepRunning() {
+            if (completedIterations == 0) {
+                stopwatch.start();
+            }
+            if (completedIterations < iterations) {
+                ++completedIterations;
+                return true;
+            }
+            if (!stopwatch.stopped()) {
+                stopwatch.stop();
+            }
+            return false;
+        }
+
+        void BenchmarkState::pauseTiming() {
+            stopwatch.stop();
+        }
+
+        void BenchmarkState::resumeTiming() {
+            stopwatch.start();
+        }
+
+        void BenchmarkState::setCounter(std::string const& name, double value) {
+            counters[name] = value;
+        }
+
+        uint64_t BenchmarkState::getIterations() const {
+            return iterations;
+        }
+
+        storm::utility::Stopwatch const& BenchmarkState::getStopwatch() const {
+            return stopwatch;
+        }
+
+        std::map<std::string, double> const& BenchmarkState::getCounters() const {
+            return counters;
+        }
+
+        double BenchmarkResult::getMean() const {
+            double sum = 0.0;
+            for (auto const& time : times) {
+                sum += time;
+            }
+            return times.empty() ? 0.0 : sum / times.size();
+        }
+
+        double BenchmarkResult::getMedian() const {
+            if (times.empty()) {
+                return 0.0;
+            }
+            std::vector<double> sortedTimes = times;
+            std::sort(sortedTimes.begin(), sortedTimes.end());
+            uint64_t middle = sortedTimes.size() / 2;
+            return sortedTimes.size() % 2 == 1 ? sortedTimes[middle] : (sortedTimes[middle - 1] + sortedTimes[middle]) / 2.0;
+        }
+
+        double BenchmarkResult::getStandardDeviation() const {
+            if (times.size() < 2) {
+                return 0.0;
+            }
+            double mean = getMean();
+            double sum = 0.0;
+            for (auto const& time : times) {
+                sum += (time - mean) * (time - mean);
+            }
+            return std::sqrt(sum / (times.size() - 1));
+        }
+
+        BenchmarkRunner::BenchmarkRunner() : filter(".*"), minimalTime(0.5), repetitions(3) {
+            // Intentionally left empty.
+        }
+
+        void BenchmarkRunner::registerBenchmark(std::string const& name, BenchmarkFunction const& function) {
+            benchmarks.emplace_back(name, function);
+        }
+
+        void BenchmarkRunner::setFilter(std::string const& filter) {
+            this->filter = filter;
+        }
+
+        void BenchmarkRunner::setMinimalTime(double seconds) {
+            STORM_LOG_THROW(seconds >= 0.0, storm::exceptions::InvalidArgumentException, "The minimal time must not be negative.");
+            this->minimalTime = seconds;
+        }
+
+        void BenchmarkRunner::setRepetitions(uint64_t repetitions) {
+            STORM_LOG_THROW(repetitions > 0, storm::exceptions::InvalidArgumentException, "At least one repetition is required.");
+            this->repetitions = repetitions;
+        }
+
+        std::vector<std::string> BenchmarkRunner::getBenchmarkNames() const {
+            std::vector<std::string> result;
+            for (auto const& benchmark : benchmarks) {
+                if (matchesFilter(benchmark.first)) {
+                    result.push_back(benchmark.first);
+                }
+            }
+            return result;
+        }
+
+        std::vector<BenchmarkResult> BenchmarkRunner::run(std::ostream& out) const {
+            std::vector<BenchmarkResult> results;
+            out << std::left << std::setw(50) << "Benchmark" << std::right << std::setw(16) << "Time (mean)" << std::setw(16) << "Time (median)" << std::setw(12) << "Iterations" << std::endl;
+            for (auto const& benchmark : benchmarks) {
+                if (!matchesFilter(benchmark.first)) {
+                    continue;
+                }
+                results.push_back(runBenchmark(benchmark.first, benchmark.second));
+                BenchmarkResult const& result = results.back();
+                out << std::left << std::setw(50) << result.name << std::right << std::setw(13) << std::fixed << std::setprecision(0) << result.getMean() << " ns" << std::setw(13) << result.getMedian() << " ns" << std::setw(12) << result.iterations << std::endl;
+            }
+            return results;
+        }
+
+        bool BenchmarkRunner::matchesFilter(std::string const& name) const {
+            return std::regex_search(name, std::regex(filter));
+        }
+
+        BenchmarkResult BenchmarkRunner::runBenchmark(std::string const& name, BenchmarkFunction const& function) const {
+            // Estimate the time of a single iteration. This also serves as warm-up (and builds cached models).
+            BenchmarkState calibration(1);
+            function(calibration);
+            double singleIterationTime = std::max<double>(1.0, calibration.getStopwatch().getTimeInNanoseconds());
+            uint64_t iterations = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(minimalTime * 1e9 / singleIterationTime)));
+
+            BenchmarkResult result;
+            result.name = name;
+            result.iterations = iterations;
+            for (uint64_t repetition = 0; repetition < repetitions; ++repetition) {
+                BenchmarkState state(iterations);
+                function(state);
+                result.times.push_back(static_cast<double>(state.getStopwatch().getTimeInNanoseconds()) / iterations);
+                result.counters = state.getCounters();
+            }
+            return result;
+        }
+
+        void BenchmarkRunner::exportJson(std::vector<BenchmarkResult> const& results, std::ostream& out) {
+            storm::json<double> json;
+
+            std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+            std::stringstream date;
+            date << std::put_time(std::localtime(&now), "%FT%T%z");
+            json["context"]["date"] = date.str();
+            json["context"]["executable"] = "storm-bench";
+            json["context"]["num_cpus"] = static_cast<uint64_t>(std::thread::hardware_concurrency());
+            json["context"]["storm_version"] = storm::StormVersion::shortVersionString();
+            json["context"]["storm_revision"] = storm::StormVersion::gitRevisionHash;
+            json["context"]["storm_build"] = storm::StormVersion::buildInfo();
+#ifdef NDEBUG
+            json["context"]["library_build_type"] = "release";
+#else
+            json["context"]["library_build_type"] = "debug";
+#endif
+
+            json["benchmarks"] = storm::json<double>::array();
+            auto addRun = [&json](BenchmarkResult const& result, std::string const& runName, std::string const& runType, double time, storm::json<double> const& extra) {
+                storm::json<double> run = extra;
+                run["name"] = runName;
+                run["run_name"] = result.name;
+                run["run_type"] = runType;
+                run["repetitions"] = static_cast<uint64_t>(result.times.size());
+                run["threads"] = 1;
+                run["iterations"] = result.iterations;
+                run["real_time"] = time;
+                run["cpu_time"] = time;
+                run["time_unit"] = "ns";
+                for (auto const& counter : result.counters) {
+                    run[counter.first] = counter.second;
+                }
+                json["benchmarks"].push_back(run);
+            };
+            for (auto const& result : results) {
+                for (uint64_t repetition = 0; repetition < result.times.size(); ++repetition) {
+                    storm::json<double> extra;
+                    extra["repetition_index"] = repetition;
+                    addRun(result, result.name, "iteration", result.times[repetition], extra);
+                }
+                std::vector<std::pair<std::string, double>> aggregates = {{"mean", result.getMean()}, {"median", result.getMedian()}, {"stddev", result.getStandardDeviation()}};
+                for (auto const& aggregate : aggregates) {
+                    storm::json<double> extra;
+                    extra["aggregate_name"] = aggregate.first;
+                    addRun(result, result.name + "_" + aggregate.first, "aggregate", aggregate.second, extra);
+                }
+            }
+            out << json.dump(4) << std::endl;
+        }
+    }
+}
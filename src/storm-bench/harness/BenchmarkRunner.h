@@ -0,0 +1,100 @@
+#pragma once
+
+#include <functional>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "storm/utility/Stopwatch.h"
+
+namespace storm {
+    namespace bench {
+
+        /*!
+         * The state of a running benchmark. The body of a benchmark repeats the measured code while keepRunning() holds.
+         * Work that should not be measured can be enclosed by pauseTiming() and resumeTiming().
+         */
+        class BenchmarkState {
+        public:
+            explicit BenchmarkState(uint64_t iterations);
+
+            bool keepRunning();
+
+            void pauseTiming();
+            void resumeTiming();
+
+            /*!
+             * Reports a value (e.g. the number of states) that is exported together with the measured times.
+             */
+            void setCounter(std::string const& name, double value);
+
+            uint64_t getIterations() const;
+            storm::utility::Stopwatch const& getStopwatch() const;
+            std::map<std::string, double> const& getCounters() const;
+
+        private:
+            uint64_t iterations;
+            uint64_t completedIterations;
+            storm::utility::Stopwatch stopwatch;
+            std::map<std::string, double> counters;
+        };
+
+        /*!
+         * The measurements of one benchmark.
+         */
+        struct BenchmarkResult {
+            std::string name;
+            uint64_t iterations;
+            // The time (in nanoseconds) of a single iteration for each repetition.
+            std::vector<double> times;
+            std::map<std::string, double> counters;
+
+            double getMean() const;
+            double getMedian() const;
+            double getStandardDeviation() const;
+        };
+
+        /*!
+         * Runs registered benchmarks. For each benchmark, the number of iterations is chosen such that a repetition takes
+         * at least the minimal time and all repetitions use the same number of iterations. The results can be written in
+         * the JSON format of Google Benchmark, so that its tools can be used to compare different versions.
+         */
+        class BenchmarkRunner {
+        public:
+            typedef std::function<void(BenchmarkState&)> BenchmarkFunction;
+
+            BenchmarkRunner();
+
+            void registerBenchmark(std::string const& name, BenchmarkFunction const& function);
+
+            /*!
+             * Only the benchmarks whose name matches the given (ECMAScript) regular expression are run or listed.
+             */
+            void setFilter(std::string const& filter);
+            void setMinimalTime(double seconds);
+            void setRepetitions(uint64_t repetitions);
+
+            std::vector<std::string> getBenchmarkNames() const;
+
+            /*!
+             * Runs all benchmarks that match the filter and prints a summary line for each of them.
+             */
+            std::vector<BenchmarkResult> run(std::ostream& out) const;
+
+            /*!
+             * Writes the given results in the JSON format of Google Benchmark.
+             */
+            static void exportJson(std::vector<BenchmarkResult> const& results, std::ostream& out);
+
+        private:
+            bool matchesFilter(std::string const& name) const;
+            BenchmarkResult runBenchmark(std::string const& name, BenchmarkFunction const& function) const;
+
+            std::vector<std::pair<std::string, BenchmarkFunction>> benchmarks;
+            std::string filter;
+            double minimalTime;
+            uint64_t repetitions;
+        };
+    }
+}
@@ -0,0 +1,244 @@
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <sstream>
+
+#include "storm-bench/generators/SmgGenerators.h"
+#include "storm-bench/harness/BenchmarkRunner.h"
+
+#include "storm-parsers/parser/PrismParser.h"
+
+#include "storm/api/builder.h"
+#include "storm/environment/Environment.h"
+#include "storm/logic/PlayerCoalition.h"
+#include "storm/logic/ShieldExpression.h"
+#include "storm/modelchecker/rpatl/helper/internal/GameViHelper.h"
+#include "storm/models/sparse/Smg.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/shields/PreShield.h"
+#include "storm/storage/PreScheduler.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/utility/initialize.h"
+#include "storm/utility/macros.h"
+#include "storm/io/file.h"
+
+#include "storm-cli-utilities/cli.h"
+
+#include "storm/exceptions/BaseException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace bench {
+
+        /*!
+         * A generated game together with the data that the benchmarked routines operate on. The coalition minimizes the
+         * probability to reach the bad states.
+         */
+        struct GameProblem {
+            std::shared_ptr<storm::models::sparse::Smg<double>> model;
+            // The states in which the optimization direction is inverted, i.e. the states not owned by the coalition.
+            storm::storage::BitVector directionOverride;
+            storm::storage::BitVector maybeStates;
+            storm::storage::SparseMatrix<double> submatrix;
+            storm::storage::BitVector clippedDirectionOverride;
+            std::vector<double> b;
+            // The values of all choices of the model (after value iteration).
+            std::vector<double> choiceValues;
+        };
+
+        GameProblem buildProblem(GeneratedSmg const& smg) {
+            storm::prism::Program program = storm::parser::PrismParser::parseFromString(smg.program, smg.name);
+            storm::builder::BuilderOptions options;
+            options.setBuildAllLabels().setBuildChoiceLabels().setBuildStateValuations();
+
+            GameProblem problem;
+            problem.model = storm::api::buildSparseModel<double>(storm::storage::SymbolicModelDescription(program), options)->as<storm::models::sparse::Smg<double>>();
+            auto const& transitionMatrix = problem.model->getTransitionMatrix();
+
+            problem.directionOverride = ~problem.model->computeStatesOfCoalition(storm::logic::PlayerCoalition(std::vector<boost::variant<std::string, storm::storage::PlayerIndex>>({smg.coalitionPlayer})));
+            storm::storage::BitVector const& badStates = problem.model->getStates(smg.badLabel);
+            problem.maybeStates = ~badStates;
+            problem.submatrix = transitionMatrix.getSubmatrix(true, problem.maybeStates, problem.maybeStates, false);
+            problem.clippedDirectionOverride = storm::storage::BitVector(problem.maybeStates.getNumberOfSetBits());
+            problem.clippedDirectionOverride.setClippedStatesOfCoalition(problem.maybeStates, problem.directionOverride);
+            problem.b = transitionMatrix.getConstrainedRowGroupSumVector(problem.maybeStates, badStates);
+
+            storm::Environment env;
+            storm::modelchecker::helper::internal::GameViHelper<double> viHelper(problem.submatrix, problem.clippedDirectionOverride);
+            std::vector<double> x(problem.submatrix.getRowGroupCount(), 0.0);
+            viHelper.performValueIteration(env, x, problem.b, storm::OptimizationDirection::Minimize, problem.choiceValues);
+            viHelper.getChoiceValues(env, x, problem.choiceValues);
+            viHelper.fillChoiceValuesVector(problem.choiceValues, problem.maybeStates, transitionMatrix.getRowGroupIndices());
+            return problem;
+        }
+
+        /*!
+         * Builds the games lazily (building is not measured) and keeps them for all benchmarks on the same instance.
+         */
+        GameProblem const& getProblem(GeneratedSmg const& smg) {
+            static std::map<std::string, std::unique_ptr<GameProblem>> problems;
+            auto problemIt = problems.find(smg.name);
+            if (problemIt == problems.end()) {
+                problemIt = problems.emplace(smg.name, std::make_unique<GameProblem>(buildProblem(smg))).first;
+            }
+            return *problemIt->second;
+        }
+
+        void setModelCounters(BenchmarkState& state, GameProblem const& problem) {
+            state.setCounter("states", problem.model->getNumberOfStates());
+            state.setCounter("choices", problem.model->getNumberOfChoices());
+            state.setCounter("transitions", problem.model->getNumberOfTransitions());
+        }
+
+        std::shared_ptr<storm::logic::ShieldExpression const> createShieldExpression() {
+            return std::make_shared<storm::logic::ShieldExpression>(storm::logic::ShieldingType::PreSafety, "storm-bench", storm::logic::ShieldComparison::Relative, 0.1);
+        }
+
+        void registerBenchmarks(BenchmarkRunner& runner, std::vector<GeneratedSmg> const& smgs) {
+            for (auto const& smg : smgs) {
+                runner.registerBenchmark("MultiplyAndReduce/" + smg.name, [smg] (BenchmarkState& state) {
+                    GameProblem const& problem = getProblem(smg);
+                    storm::storage::SparseMatrix<double> const& matrix = problem.submatrix;
+                    std::mt19937 engine(42);
+                    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+                    std::vector<double> x(matrix.getColumnCount());
+                    for (auto& value : x) {
+                        value = distribution(engine);
+                    }
+                    std::vector<double> result(matrix.getRowGroupCount());
+                    while (state.keepRunning()) {
+                        matrix.multiplyAndReduce(storm::OptimizationDirection::Minimize, matrix.getRowGroupIndices(), x, &problem.b, result, nullptr, &problem.clippedDirectionOverride);
+                    }
+                    setModelCounters(state, problem);
+                });
+
+                runner.registerBenchmark("GameValueIteration/" + smg.name, [smg] (BenchmarkState& state) {
+                    GameProblem const& problem = getProblem(smg);
+                    storm::Environment env;
+                    storm::modelchecker::helper::internal::GameViHelper<double> viHelper(problem.submatrix, problem.clippedDirectionOverride);
+                    std::vector<double> x;
+                    std::vector<double> constrainedChoiceValues;
+                    while (state.keepRunning()) {
+                        state.pauseTiming();
+                        x.assign(problem.submatrix.getRowGroupCount(), 0.0);
+                        state.resumeTiming();
+                        viHelper.performValueIteration(env, x, problem.b, storm::OptimizationDirection::Minimize, constrainedChoiceValues);
+                    }
+                    setModelCounters(state, problem);
+                });
+
+                runner.registerBenchmark("PreShieldConstruction/" + smg.name, [smg] (BenchmarkState& state) {
+                    GameProblem const& problem = getProblem(smg);
+                    auto shieldExpression = createShieldExpression();
+                    storm::storage::BitVector allStates(problem.model->getNumberOfStates(), true);
+                    while (state.keepRunning()) {
+                        tempest::shields::PreShield<double, storm::storage::sparse::state_type> shield(problem.model->getTransitionMatrix().getRowGroupIndices(), problem.choiceValues, shieldExpression, storm::OptimizationDirection::Minimize, allStates, problem.directionOverride);
+                        storm::storage::PreScheduler<double> preScheduler = shield.construct();
+                    }
+                    setModelCounters(state, problem);
+                });
+
+                runner.registerBenchmark("PreShieldExport/" + smg.name, [smg] (BenchmarkState& state) {
+                    GameProblem const& problem = getProblem(smg);
+                    auto shieldExpression = createShieldExpression();
+                    storm::storage::BitVector allStates(problem.model->getNumberOfStates(), true);
+                    tempest::shields::PreShield<double, storm::storage::sparse::state_type> shield(problem.model->getTransitionMatrix().getRowGroupIndices(), problem.choiceValues, shieldExpression, storm::OptimizationDirection::Minimize, allStates, problem.directionOverride);
+                    storm::storage::PreScheduler<double> preScheduler = shield.construct();
+                    uint64_t exportedBytes = 0;
+                    while (state.keepRunning()) {
+                        std::stringstream stream;
+                        preScheduler.printToStream(stream, shieldExpression, problem.model);
+                        exportedBytes = static_cast<uint64_t>(stream.tellp());
+                    }
+                    setModelCounters(state, problem);
+                    state.setCounter("bytes", exportedBytes);
+                });
+            }
+        }
+
+        void printUsage() {
+            std::cout << "Usage: storm-bench [options]" << std::endl;
+            std::cout << "  --filter <regex>      Only runs the benchmarks whose name matches the regular expression." << std::endl;
+            std::cout << "  --list                Lists the (matching) benchmarks without running them." << std::endl;
+            std::cout << "  --min-time <seconds>  The minimal time of a repetition (default: 0.5)." << std::endl;
+            std::cout << "  --repetitions <n>     The number of repetitions of each benchmark (default: 3)." << std::endl;
+            std::cout << "  --json <file>         Writes the results in the JSON format of Google Benchmark to the given file." << std::endl;
+            std::cout << "  --smoke               Runs every benchmark once on the smallest instance of each family." << std::endl;
+            std::cout << "  --help                Prints this message." << std::endl;
+        }
+    }
+}
+
+int main(const int argc, const char** argv) {
+    try {
+        storm::utility::setUp();
+        storm::cli::printHeader("Storm-bench", argc, argv);
+        // The benchmarks use the default settings, the command line options are handled separately.
+        storm::settings::initializeAll("Storm-bench", "storm-bench");
+
+        storm::bench::BenchmarkRunner runner;
+
+        bool listOnly = false;
+        bool smokeTest = false;
+        std::string jsonFile;
+        for (int i = 1; i < argc; ++i) {
+            std::string argument(argv[i]);
+            bool hasValue = i + 1 < argc;
+            if (argument == "--help") {
+                storm::bench::printUsage();
+                return 0;
+            } else if (argument == "--list") {
+                listOnly = true;
+            } else if (argument == "--smoke") {
+                smokeTest = true;
+            } else if (argument == "--filter" && hasValue) {
+                runner.setFilter(argv[++i]);
+            } else if (argument == "--min-time" && hasValue) {
+                runner.setMinimalTime(std::stod(argv[++i]));
+            } else if (argument == "--repetitions" && hasValue) {
+                runner.setRepetitions(std::stoull(argv[++i]));
+            } else if (argument == "--json" && hasValue) {
+                jsonFile = argv[++i];
+            } else {
+                STORM_LOG_ERROR("Unknown or incomplete option '" << argument << "'.");
+                storm::bench::printUsage();
+                return -1;
+            }
+        }
+
+        if (smokeTest) {
+            // The smoke test (run by ctest) only checks that every benchmark runs, so a single short iteration suffices.
+            storm::bench::registerBenchmarks(runner, storm::bench::generateSmokeTestSmgs());
+            runner.setMinimalTime(0.0);
+            runner.setRepetitions(1);
+        } else {
+            storm::bench::registerBenchmarks(runner, storm::bench::generateBenchmarkSmgs());
+        }
+
+        if (listOnly) {
+            for (auto const& name : runner.getBenchmarkNames()) {
+                std::cout << name << std::endl;
+            }
+            return 0;
+        }
+
+        std::vector<storm::bench::BenchmarkResult> results = runner.run(std::cout);
+        if (!jsonFile.empty()) {
+            std::ofstream stream;
+            storm::utility::openFile(jsonFile, stream);
+            storm::bench::BenchmarkRunner::exportJson(results, stream);
+            storm::utility::closeFile(stream);
+        }
+
+        storm::utility::cleanUp();
+        return 0;
+    } catch (storm::exceptions::BaseException const& exception) {
+        STORM_LOG_ERROR("An exception caused Storm-bench to terminate. The message of the exception is: " << exception.what());
+        return 1;
+    } catch (std::exception const& exception) {
+        STORM_LOG_ERROR("An unexpected exception occurred and caused Storm-bench to terminate. The message of this exception is: " << exception.what());
+        return 2;
+    }
+}
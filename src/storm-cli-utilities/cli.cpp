@@ -8,6 +8,7 @@
 #include "storm/utility/initialize.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/Statistics.h"
 
 #include <type_traits>
 #include <ctime>
@@ -55,9 +56,18 @@ namespace storm {
                 return -1;
             }
 
+            auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
+            if (ioSettings.isExportStatisticsSet()) {
+                storm::utility::statistics::StatisticsRecorder::recorder().reset();
+                storm::utility::statistics::StatisticsRecorder::recorder().setEnabled(true);
+            }
+
             processOptions();
 
             totalTimer.stop();
+            if (ioSettings.isExportStatisticsSet()) {
+                storm::utility::statistics::StatisticsRecorder::recorder().exportToFile(ioSettings.getExportStatisticsFilename());
+            }
             if (storm::settings::getModule<storm::settings::modules::ResourceSettings>().isPrintTimeAndMemorySet()) {
                 storm::cli::printTimeAndMemoryStatistics(totalTimer.getTimeInMilliseconds());
             }
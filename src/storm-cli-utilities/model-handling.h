@@ -14,6 +14,7 @@
 
 #include "storm/utility/initialize.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/Statistics.h"
 
 #include <type_traits>
 
@@ -70,6 +71,7 @@ namespace storm {
             auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
             if (ioSettings.isPrismOrJaniInputSet()) {
                 storm::utility::Stopwatch modelParsingWatch(true);
+                storm::utility::statistics::ScopedTimer modelParsingTimer("model-parsing");
                 if (ioSettings.isPrismInputSet()) {
                     input.model = storm::api::parseProgram(ioSettings.getPrismInputFilename(), buildSettings.isPrismCompatibilityEnabled(), !buildSettings.isNoSimplifySet());
                 } else {
@@ -96,6 +98,7 @@ namespace storm {
 
         void parseProperties(storm::settings::modules::IOSettings const& ioSettings, SymbolicInput& input, boost::optional<std::set<std::string>> const& propertyFilter) {
             if (ioSettings.isPropertySet()) {
+                storm::utility::statistics::ScopedTimer propertyParsingTimer("property-parsing");
                 std::vector<storm::jani::Property> newProperties;
                 if (input.model) {
                     newProperties = storm::api::parsePropertiesForSymbolicModelDescription(ioSettings.getProperty(), input.model.get(), propertyFilter);
@@ -449,6 +452,12 @@ namespace storm {
             options.setReservedBitsForUnboundedVariables(buildSettings.getBitsForUnboundedVariables());
 
             options.setAddOutOfBoundsState(buildSettings.isBuildOutOfBoundsStateSet());
+            options.setSymmetryReduction(buildSettings.isSymmetryReductionSet());
+            options.setGuardIndex(!buildSettings.isNoGuardIndexSet());
+            if (buildSettings.isCompileExpressionsSet()) {
+                options.setCompileExpressions();
+                options.setCompiledExpressionsCacheDirectory(buildSettings.getCompiledExpressionsCacheDirectory());
+            }
             if (buildSettings.isBuildFullModelSet()) {
                 options.clearTerminalStates();
                 options.setApplyMaximalProgressAssumption(false);
@@ -482,6 +491,7 @@ namespace storm {
         template <storm::dd::DdType DdType, typename ValueType>
         std::shared_ptr<storm::models::ModelBase> buildModel(SymbolicInput const& input, storm::settings::modules::IOSettings const& ioSettings, ModelProcessingInformation const& mpi) {
             storm::utility::Stopwatch modelBuildingWatch(true);
+            storm::utility::statistics::ScopedTimer modelBuildingTimer("model-building");
 
             auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
             std::shared_ptr<storm::models::ModelBase> result;
@@ -500,6 +510,9 @@ namespace storm {
             modelBuildingWatch.stop();
             if (result) {
                 STORM_PRINT("Time for model construction: " << modelBuildingWatch << "." << std::endl << std::endl);
+                storm::utility::statistics::setCounter("states", result->getNumberOfStates());
+                storm::utility::statistics::setCounter("transitions", result->getNumberOfTransitions());
+                storm::utility::statistics::setCounter("choices", result->getNumberOfChoices());
             }
 
             return result;
@@ -607,6 +620,7 @@ namespace storm {
 
         template <storm::dd::DdType DdType, typename ValueType>
         void exportModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input) {
+            storm::utility::statistics::ScopedTimer modelExportTimer("model-export");
             if (model->isSparseModel()) {
                 exportSparseModel<ValueType>(model->as<storm::models::sparse::Model<ValueType>>(), input);
             } else {
@@ -682,6 +696,7 @@ namespace storm {
         template <storm::dd::DdType DdType, typename BuildValueType, typename ExportValueType = BuildValueType>
         std::pair<std::shared_ptr<storm::models::ModelBase>, bool> preprocessModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
             storm::utility::Stopwatch preprocessingWatch(true);
+            storm::utility::statistics::ScopedTimer preprocessingTimer("preprocessing");
 
             std::pair<std::shared_ptr<storm::models::ModelBase>, bool> result = std::make_pair(model, false);
             if (model->isSparseModel()) {
@@ -872,6 +887,7 @@ namespace storm {
                 printModelCheckingProperty(property);
                 bool ignored = false;
                 storm::utility::Stopwatch watch(true);
+                storm::utility::statistics::ScopedTimer verificationTimer("verification");
                 std::unique_ptr<storm::modelchecker::CheckResult> result;
                 try {
                     auto rawFormula = property.getRawFormula();
@@ -897,6 +913,7 @@ namespace storm {
                     STORM_LOG_WARN("Cannot handle property: " << ex.what());
                 }
                 watch.stop();
+                verificationTimer.stop();
                 if (!ignored) {
                     postprocessingCallback(result);
                     printResult<ValueType>(result, property, &watch);
@@ -996,6 +1013,53 @@ namespace storm {
             });
         }
 
+        template <typename ValueType>
+        void verifyWithStatisticalEngine(SymbolicInput const& input, ModelProcessingInformation const& mpi) {
+            STORM_LOG_ASSERT(input.model, "Expected symbolic model description.");
+            STORM_LOG_THROW((std::is_same<ValueType, double>::value), storm::exceptions::NotSupportedException, "Statistical model checking does not support other data-types than floating points.");
+            verifyProperties<ValueType>(input, [&input,&mpi] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldExpression) {
+                STORM_LOG_THROW(states->isInitialFormula(), storm::exceptions::NotSupportedException, "Statistical model checking can only filter initial states.");
+                STORM_LOG_WARN_COND(!shieldExpression, "Statistical model checking does not create shields.");
+                return storm::api::verifyWithStatisticalEngine<ValueType>(mpi.env, input.model.get(), storm::api::createTask<ValueType>(formula, true));
+            });
+        }
+
+        template <typename ValueType>
+        void computeTimeSeriesWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& sparseModel, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
+            STORM_LOG_THROW(sparseModel->isOfType(storm::models::ModelType::Ctmc), storm::exceptions::NotSupportedException, "Time series can only be computed for CTMCs.");
+            std::vector<double> timePoints = storm::settings::getModule<storm::settings::modules::IOSettings>().getTimeSeriesTimePoints();
+            auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
+            for (auto const& property : properties) {
+                printModelCheckingProperty(property);
+                storm::utility::Stopwatch watch(true);
+                std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results;
+                std::unique_ptr<storm::modelchecker::CheckResult> filter;
+                bool filterForInitialStates = property.getFilter().getStatesFormula()->isInitialFormula();
+                try {
+                    results = storm::api::computeTimeSeriesWithSparseEngine<ValueType>(mpi.env, sparseModel, storm::api::createTask<ValueType>(property.getRawFormula(), filterForInitialStates), timePoints);
+                    if (filterForInitialStates) {
+                        filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(sparseModel->getInitialStates());
+                    } else {
+                        filter = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, storm::api::createTask<ValueType>(property.getFilter().getStatesFormula(), false));
+                    }
+                } catch (storm::exceptions::BaseException const& ex) {
+                    STORM_LOG_WARN("Cannot compute time series for property: " << ex.what());
+                    continue;
+                }
+                watch.stop();
+
+                std::stringstream ss;
+                ss << "'" << *property.getFilter().getStatesFormula() << "'";
+                STORM_PRINT((storm::utility::resources::isTerminate() ? "Time series till abort" : "Time series") << " (for " << (filterForInitialStates ? "initial" : ss.str()) << " states):" << std::endl);
+                for (uint64_t index = 0; index < results.size(); ++index) {
+                    results[index]->filter(filter->asQualitativeCheckResult());
+                    STORM_PRINT(timePoints[index] << ": ");
+                    printFilteredResult<ValueType>(results[index], property.getFilter().getFilterType());
+                }
+                STORM_PRINT("Time for model checking: " << watch << "." << std::endl);
+            }
+        }
+
         template <typename ValueType>
         void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
             auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
@@ -1050,7 +1114,11 @@ namespace storm {
                                             }
                                             ++exportCount;
                                         };
-            verifyProperties<ValueType>(input,verificationCallback, postprocessingCallback);
+            if (ioSettings.isTimeSeriesSet()) {
+                computeTimeSeriesWithSparseEngine<ValueType>(sparseModel, input, mpi);
+            } else {
+                verifyProperties<ValueType>(input,verificationCallback, postprocessingCallback);
+            }
             if (ioSettings.isComputeSteadyStateDistributionSet()) {
                 storm::utility::Stopwatch watch(true);
                 std::unique_ptr<storm::modelchecker::CheckResult> result;
@@ -1189,6 +1257,8 @@ namespace storm {
                 verifyWithAbstractionRefinementEngine<DdType, VerificationValueType>(input, mpi);
             } else if (mpi.engine == storm::utility::Engine::Exploration) {
                 verifyWithExplorationEngine<VerificationValueType>(input, mpi);
+            } else if (mpi.engine == storm::utility::Engine::Statistical) {
+                verifyWithStatisticalEngine<VerificationValueType>(input, mpi);
             } else {
                 std::shared_ptr<storm::models::ModelBase> model = buildPreprocessExportModelWithValueTypeAndDdlib<DdType, BuildValueType, VerificationValueType>(input, mpi);
                 if (model) {
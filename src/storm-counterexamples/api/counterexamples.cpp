@@ -74,5 +74,16 @@ namespace storm {
             return std::make_shared<storm::counterexamples::PathCounterexample<double>>(cex);
         }
 
+        std::shared_ptr<storm::counterexamples::Counterexample> computeBlockedActionExplanationMaxSmt(storm::storage::SymbolicModelDescription const& symbolicModel,
+                                                                                                        storm::counterexamples::BlockedActionExplainer<double> const& explainer, uint64_t state, uint64_t action) {
+            Environment env;
+            return explainer.computeHighLevelExplanation(env, symbolicModel, state, action);
+        }
+
+        std::shared_ptr<storm::counterexamples::Counterexample> computeBlockedActionExplanationKShortestPaths(storm::counterexamples::BlockedActionExplainer<double> const& explainer,
+                                                                                                               uint64_t state, uint64_t action, size_t maxK) {
+            return explainer.computePathExplanation(state, action, maxK);
+        }
+
     }
 }
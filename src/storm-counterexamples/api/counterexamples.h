@@ -3,6 +3,7 @@
 #include "storm-counterexamples/counterexamples/MILPMinimalLabelSetGenerator.h"
 #include "storm-counterexamples/counterexamples/SMTMinimalLabelSetGenerator.h"
 #include "storm-counterexamples/counterexamples/PathCounterexample.h"
+#include "storm-counterexamples/counterexamples/BlockedActionExplainer.h"
 
 namespace storm {
     namespace api {
@@ -13,5 +14,9 @@ namespace storm {
 
         std::shared_ptr<storm::counterexamples::Counterexample> computeKShortestPathCounterexample(std::shared_ptr<storm::models::sparse::Model<double>> model, std::shared_ptr<storm::logic::Formula const> const& formula, size_t maxK);
 
+        std::shared_ptr<storm::counterexamples::Counterexample> computeBlockedActionExplanationMaxSmt(storm::storage::SymbolicModelDescription const& symbolicModel, storm::counterexamples::BlockedActionExplainer<double> const& explainer, uint64_t state, uint64_t action);
+
+        std::shared_ptr<storm::counterexamples::Counterexample> computeBlockedActionExplanationKShortestPaths(storm::counterexamples::BlockedActionExplainer<double> const& explainer, uint64_t state, uint64_t action, size_t maxK);
+
     }
 }
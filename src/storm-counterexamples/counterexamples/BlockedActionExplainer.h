@@ -0,0 +1,273 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "storm-counterexamples/counterexamples/HighLevelCounterexample.h"
+#include "storm-counterexamples/counterexamples/PathCounterexample.h"
+#include "storm-counterexamples/counterexamples/SMTMinimalLabelSetGenerator.h"
+
+#include "storm/logic/ShieldExpression.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StateLabeling.h"
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/Scheduler.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/shortestPaths.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace counterexamples {
+
+        /*!
+         * Explains why a pre-shield blocks an action of a stochastic multiplayer game (or an MDP). The explanation
+         * reuses the choice values and the strategy that were computed for the shield (see SparseSmgRpatlHelper), so the
+         * game is not solved again: the blocked action is taken once and the strategy resolves all choices afterwards.
+         * In the resulting Markov chain, the blocked action violates the shield because a set of violating states is
+         * reached with a too high probability.
+         *
+         * Which states are violating depends on the objective of the shield:
+         *  - For minimal probabilities of phi U psi, reaching psi (via phi) is the violation.
+         *  - For maximal probabilities of phi U psi, reaching a state from which phi U psi can not be satisfied anymore
+         *    is the violation.
+         *  - For maximal probabilities of G psi, reaching a state that does not satisfy psi is the violation.
+         */
+        template<typename ValueType>
+        class BlockedActionExplainer {
+        public:
+            /*!
+             * @param model The model for which the shield was computed. Explanations in terms of commands require choice origins.
+             * @param choiceValues The values of all choices as computed for the shield.
+             * @param scheduler The memoryless deterministic strategy computed together with the choice values.
+             * @param shieldingExpression The shielding expression of the shield.
+             * @param optimizationDirection The optimization direction of the shielded formula.
+             * @param phiStates The phi states of the formula. For globally formulas, these are ignored.
+             * @param psiStates The psi states of the formula.
+             * @param globally True iff the formula is of the form G psi.
+             */
+            BlockedActionExplainer(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::vector<ValueType> const& choiceValues, storm::storage::Scheduler<ValueType> const& scheduler, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool globally) : model(model), choiceValues(choiceValues), scheduler(scheduler), shieldingExpression(shieldingExpression), optimizationDirection(optimizationDirection), phiStates(phiStates), psiStates(psiStates), globally(globally) {
+                STORM_LOG_THROW(choiceValues.size() == model->getNumberOfChoices(), storm::exceptions::InvalidArgumentException, "The number of choice values does not match the number of choices of the model.");
+                STORM_LOG_THROW(scheduler.isMemorylessScheduler() && scheduler.isDeterministicScheduler(), storm::exceptions::InvalidArgumentException, "Blocked actions can only be explained for memoryless deterministic strategies.");
+                STORM_LOG_THROW(!globally || storm::solver::maximize(optimizationDirection), storm::exceptions::NotSupportedException, "Blocked actions can only be explained for maximal probabilities of globally formulas.");
+            }
+
+            /*!
+             * Checks whether the given action is blocked by the shield in the given state.
+             *
+             * @param state The state of the model.
+             * @param action The local index of the action in the given state.
+             */
+            bool isBlocked(uint64_t state, uint64_t action) const {
+                ValueType bound = computeBound(state);
+                ValueType value = choiceValues[getChoice(state, action)];
+                return storm::solver::maximize(optimizationDirection) ? value < bound : value > bound;
+            }
+
+            /*!
+             * Computes a minimal set of commands (or edges) such that the blocked action violates the shield already if
+             * only these commands are available.
+             *
+             * @param symbolicModel The symbolic model description that was used to build the model.
+             * @param state The state of the model.
+             * @param action The local index of the blocked action in the given state.
+             * @return The symbolic model description restricted to the commands that explain the violation.
+             */
+            std::shared_ptr<HighLevelCounterexample> computeHighLevelExplanation(Environment const& env, storm::storage::SymbolicModelDescription const& symbolicModel, uint64_t state, uint64_t action) const {
+                STORM_LOG_THROW(model->hasChoiceOrigins(), storm::exceptions::InvalidArgumentException, "Explanations in terms of commands require a model with choice origins.");
+                InducedChain inducedChain = buildInducedChain(state, action);
+
+                typename SMTMinimalLabelSetGenerator<ValueType>::GeneratorStats stats;
+                typename SMTMinimalLabelSetGenerator<ValueType>::Options options;
+                options.silent = true;
+                std::vector<storm::storage::FlatSet<uint_fast64_t>> labelSets = SMTMinimalLabelSetGenerator<ValueType>::getMinimalLabelSet(env, stats, symbolicModel, *inducedChain.dtmc, inducedChain.constraintStates, inducedChain.violatingStates, {storm::utility::convertNumber<double>(computeViolationThreshold(state))}, boost::none, false, storm::storage::FlatSet<uint_fast64_t>(), options);
+                STORM_LOG_THROW(!labelSets.empty(), storm::exceptions::InvalidArgumentException, "No set of commands explains the blocked action " << action << " in state " << state << ".");
+
+                if (symbolicModel.isPrismProgram()) {
+                    storm::prism::Program program = symbolicModel.asPrismProgram().restrictCommands(labelSets.front());
+                    program.removeRewardModels();
+                    return std::make_shared<HighLevelCounterexample>(program);
+                } else {
+                    STORM_LOG_ASSERT(symbolicModel.isJaniModel(), "Unknown symbolic model description type.");
+                    return std::make_shared<HighLevelCounterexample>(symbolicModel.asJaniModel().restrictEdges(labelSets.front()));
+                }
+            }
+
+            /*!
+             * Computes the most probable paths that start with the blocked action and reach a violating state. Paths are
+             * added until their probability mass suffices for the violation or maxK paths were found.
+             *
+             * @param state The state of the model.
+             * @param action The local index of the blocked action in the given state.
+             * @param maxK The maximal number of paths.
+             * @return The paths in terms of the states of the model.
+             */
+            std::shared_ptr<PathCounterexample<ValueType>> computePathExplanation(uint64_t state, uint64_t action, size_t maxK) const {
+                InducedChain inducedChain = buildInducedChain(state, action);
+                ValueType threshold = computeViolationThreshold(state);
+
+                storm::utility::ksp::ShortestPathsGenerator<ValueType> generator(*inducedChain.dtmc, inducedChain.violatingStates);
+                auto counterexample = std::make_shared<PathCounterexample<ValueType>>(model);
+                ValueType probability = storm::utility::zero<ValueType>();
+                bool thresholdExceeded = false;
+                for (size_t k = 1; k <= maxK; ++k) {
+                    std::vector<storm::storage::sparse::state_type> path;
+                    try {
+                        path = generator.getPathAsList(k);
+                    } catch (std::invalid_argument const&) {
+                        // There are less than k paths.
+                        break;
+                    }
+                    // The copy of the initial state refers to the given state.
+                    for (auto& pathState : path) {
+                        if (pathState == inducedChain.initialState) {
+                            pathState = state;
+                        }
+                    }
+                    counterexample->addPath(path, k);
+                    probability += generator.getDistance(k);
+                    if (probability > threshold) {
+                        thresholdExceeded = true;
+                        break;
+                    }
+                }
+                STORM_LOG_WARN_COND(thresholdExceeded, "The " << maxK << " most probable paths do not suffice to explain the blocked action " << action << " in state " << state << ".");
+                return counterexample;
+            }
+
+        private:
+            /*!
+             * The Markov chain that is induced by the strategy after taking the blocked action once.
+             */
+            struct InducedChain {
+                std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> dtmc;
+                // The state in which the blocked action is taken. It is an additional copy of the original state.
+                uint64_t initialState;
+                storm::storage::BitVector constraintStates;
+                storm::storage::BitVector violatingStates;
+            };
+
+            uint64_t getChoice(uint64_t state, uint64_t action) const {
+                auto const& rowGroupIndices = model->getTransitionMatrix().getRowGroupIndices();
+                STORM_LOG_THROW(state + 1 < rowGroupIndices.size(), storm::exceptions::InvalidArgumentException, "Invalid state " << state << ".");
+                STORM_LOG_THROW(rowGroupIndices[state] + action < rowGroupIndices[state + 1], storm::exceptions::InvalidArgumentException, "Invalid action " << action << " in state " << state << ".");
+                return rowGroupIndices[state] + action;
+            }
+
+            /*!
+             * Computes the bound that the shield compares the values of the choices of the given state against, see PreShield.
+             */
+            ValueType computeBound(uint64_t state) const {
+                auto const& rowGroupIndices = model->getTransitionMatrix().getRowGroupIndices();
+                auto first = choiceValues.begin() + rowGroupIndices[state];
+                auto last = choiceValues.begin() + rowGroupIndices[state + 1];
+                ValueType lambda = storm::utility::convertNumber<ValueType>(shieldingExpression->getValue());
+                if (storm::solver::maximize(optimizationDirection)) {
+                    ValueType optimalValue = *std::max_element(first, last);
+                    return shieldingExpression->isRelative() ? optimalValue * lambda : lambda;
+                } else {
+                    ValueType optimalValue = *std::min_element(first, last);
+                    return shieldingExpression->isRelative() ? optimalValue + optimalValue * lambda : lambda;
+                }
+            }
+
+            /*!
+             * Computes the probability to reach the violating states that a blocked action in the given state exceeds.
+             */
+            ValueType computeViolationThreshold(uint64_t state) const {
+                ValueType bound = computeBound(state);
+                return storm::solver::maximize(optimizationDirection) ? storm::utility::one<ValueType>() - bound : bound;
+            }
+
+            InducedChain buildInducedChain(uint64_t state, uint64_t action) const {
+                STORM_LOG_THROW(isBlocked(state, action), storm::exceptions::InvalidArgumentException, "The action " << action << " is not blocked in state " << state << ".");
+                storm::storage::SparseMatrix<ValueType> const& transitionMatrix = model->getTransitionMatrix();
+                uint64_t numberOfStates = model->getNumberOfStates();
+
+                // Every state takes the choice of the strategy. The copy of the given state takes the blocked action.
+                std::vector<uint_fast64_t> selectedChoices;
+                selectedChoices.reserve(numberOfStates + 1);
+                for (uint64_t currentState = 0; currentState < numberOfStates; ++currentState) {
+                    auto const& schedulerChoice = scheduler.getChoice(currentState);
+                    selectedChoices.push_back(transitionMatrix.getRowGroupIndices()[currentState] + (schedulerChoice.isDefined() ? schedulerChoice.getDeterministicChoice() : 0));
+                }
+                selectedChoices.push_back(getChoice(state, action));
+
+                // For maximal probabilities of phi U psi, the formula is satisfied as soon as a psi state is reached.
+                // Hence, these states are made absorbing so that the paths through them are not counted as violations.
+                bool absorbingPsiStates = !globally && storm::solver::maximize(optimizationDirection);
+
+                InducedChain result;
+                result.initialState = numberOfStates;
+                storm::storage::SparseMatrixBuilder<ValueType> builder(numberOfStates + 1, numberOfStates + 1);
+                for (uint64_t row = 0; row < selectedChoices.size(); ++row) {
+                    if (absorbingPsiStates && row < numberOfStates && psiStates.get(row)) {
+                        builder.addNextValue(row, row, storm::utility::one<ValueType>());
+                        continue;
+                    }
+                    for (auto const& entry : transitionMatrix.getRow(selectedChoices[row])) {
+                        builder.addNextValue(row, entry.getColumn(), entry.getValue());
+                    }
+                }
+
+                storm::models::sparse::StateLabeling stateLabeling(numberOfStates + 1);
+                for (auto const& label : model->getStateLabeling().getLabels()) {
+                    storm::storage::BitVector labeledStates = model->getStateLabeling().getStates(label);
+                    labeledStates.resize(numberOfStates + 1);
+                    labeledStates.set(numberOfStates, labeledStates.get(state));
+                    stateLabeling.addLabel(label, std::move(labeledStates));
+                }
+                storm::storage::BitVector initialStates(numberOfStates + 1);
+                initialStates.set(numberOfStates);
+                if (stateLabeling.containsLabel("init")) {
+                    stateLabeling.setStates("init", initialStates);
+                } else {
+                    stateLabeling.addLabel("init", initialStates);
+                }
+
+                storm::storage::sparse::ModelComponents<ValueType> components(builder.build(), std::move(stateLabeling));
+                if (model->hasChoiceOrigins()) {
+                    components.choiceOrigins = model->getChoiceOrigins()->selectChoices(selectedChoices);
+                }
+                result.dtmc = std::make_shared<storm::models::sparse::Dtmc<ValueType>>(std::move(components));
+
+                // Extend the given states by the copy of the given state.
+                auto extend = [&] (storm::storage::BitVector states) {
+                    states.resize(numberOfStates + 1);
+                    states.set(numberOfStates, states.get(state));
+                    return states;
+                };
+                storm::storage::BitVector allStates(numberOfStates + 1, true);
+                if (globally) {
+                    result.constraintStates = allStates;
+                    result.violatingStates = ~extend(psiStates);
+                } else if (storm::solver::minimize(optimizationDirection)) {
+                    result.constraintStates = extend(phiStates);
+                    result.violatingStates = extend(psiStates);
+                } else {
+                    // The states that can not satisfy phi U psi in the induced chain. Paths must not pass psi states.
+                    result.constraintStates = ~extend(psiStates);
+                    result.violatingStates = ~storm::utility::graph::performProbGreater0(result.dtmc->getBackwardTransitions(), extend(phiStates), extend(psiStates));
+                }
+                return result;
+            }
+
+            std::shared_ptr<storm::models::sparse::Model<ValueType>> model;
+            std::vector<ValueType> choiceValues;
+            storm::storage::Scheduler<ValueType> scheduler;
+            std::shared_ptr<storm::logic::ShieldExpression const> shieldingExpression;
+            storm::OptimizationDirection optimizationDirection;
+            storm::storage::BitVector phiStates;
+            storm::storage::BitVector psiStates;
+            bool globally;
+        };
+
+    }
+}
@@ -18,6 +18,11 @@ namespace storm {
             shortestPaths[k-1] = path;
         }
 
+        template<typename ValueType>
+        std::vector<std::vector<storage::sparse::state_type>> const& PathCounterexample<ValueType>::getPaths() const {
+            return shortestPaths;
+        }
+
         template<typename ValueType>
         void PathCounterexample<ValueType>::writeToStream(std::ostream& out) const {
             out << "Shortest path counterexample with k = " << shortestPaths.size() << " paths: " << std::endl;
@@ -14,6 +14,11 @@ namespace storm {
 
             void addPath(std::vector<storage::sparse::state_type> path, size_t k);
 
+            /*!
+             * Retrieves the paths ordered by their probability. Each path is given from its last to its first state.
+             */
+            std::vector<std::vector<storage::sparse::state_type>> const& getPaths() const;
+
             void writeToStream(std::ostream& out) const override;
 
         private:
@@ -2,6 +2,10 @@
 
 #include <queue>
 #include <chrono>
+#include <atomic>
+#include <exception>
+#include <future>
+#include <mutex>
 
 #include "storm-counterexamples/counterexamples/GuaranteedLabelSet.h"
 #include "storm-counterexamples/counterexamples/HighLevelCounterexample.h"
@@ -1216,7 +1220,8 @@ namespace storm {
 
                 // As long as the constraints are unsatisfiable, we need to relax the last at-most-k constraint and
                 // try with an increased bound.
-                while (solver.checkWithAssumptions({assumption}) == storm::solver::SmtSolver::CheckResult::Unsat) {
+                storm::solver::SmtSolver::CheckResult checkResult;
+                while ((checkResult = solver.checkWithAssumptions({assumption})) == storm::solver::SmtSolver::CheckResult::Unsat) {
                     STORM_LOG_DEBUG("Constraint system is unsatisfiable with at most " << currentBound << " taken commands; increasing bound.");
                     solver.add(variableInformation.auxiliaryVariables.back());
                     variableInformation.auxiliaryVariables.push_back(assertLessOrEqualKRelaxed(solver, variableInformation, ++currentBound));
@@ -1226,6 +1231,11 @@ namespace storm {
                         return boost::none;
                     }
                 }
+                if (checkResult == storm::solver::SmtSolver::CheckResult::Unknown) {
+                    // This happens if the solver was interrupted.
+                    STORM_LOG_DEBUG("Solver returned unknown at bound " << currentBound << ".");
+                    return boost::none;
+                }
                 
                 // At this point we know that the constraint system was satisfiable, so compute the induced label
                 // set and return it.
@@ -1496,6 +1506,226 @@ namespace storm {
                 STORM_LOG_DEBUG("Asserting reachability implications.");
                 assertDisjunction(solver, formulae, *variableInformation.manager);
             }
+
+            /*!
+             * The configuration of a single solver instance of the portfolio mode.
+             */
+            struct PortfolioConfiguration {
+                uint64_t seed;
+                bool addBackwardImplicationCuts;
+                bool encodeReachability;
+                bool useDynamicConstraints;
+            };
+
+            /*!
+             * A solver instance of the portfolio mode together with its constraint system and statistics.
+             */
+            struct PortfolioWorker {
+                PortfolioConfiguration configuration;
+                std::shared_ptr<storm::expressions::ExpressionManager> manager;
+                std::unique_ptr<storm::solver::Z3SmtSolver> solver;
+                VariableInformation variableInformation;
+                uint_fast64_t currentBound = 0;
+
+                // The number of shared insufficient label sets that this worker has already ruled out.
+                uint64_t importedLabelSets = 0;
+
+                uint64_t iterations = 0;
+                uint64_t zeroProbabilityCount = 0;
+                std::chrono::milliseconds cutTime{0};
+                std::chrono::high_resolution_clock::duration solverTime{0};
+                std::chrono::high_resolution_clock::duration modelCheckingTime{0};
+                std::chrono::high_resolution_clock::duration analysisTime{0};
+            };
+
+            /*!
+             * The state that the workers of the portfolio mode share.
+             */
+            struct PortfolioSharedState {
+                std::mutex mutex;
+
+                // The label sets that were found to be insufficient, together with the index of the worker that found them.
+                std::vector<std::pair<uint64_t, storm::storage::FlatSet<uint_fast64_t>>> insufficientLabelSets;
+
+                // Set as soon as one worker found a counterexample.
+                std::atomic<bool> done{false};
+
+                boost::optional<storm::storage::FlatSet<uint_fast64_t>> result;
+                uint64_t winner = 0;
+            };
+
+            /*!
+             * Creates a solver instance for the portfolio mode and asserts the adder and the cuts according to the given
+             * configuration.
+             */
+            static PortfolioWorker createPortfolioWorker(PortfolioConfiguration const& configuration, storm::storage::SymbolicModelDescription const& symbolicModel, storm::models::sparse::Model<T> const& model, std::vector<storm::storage::FlatSet<uint_fast64_t>> const& labelSets, storm::storage::BitVector const& psiStates, RelevancyInformation const& relevancyInformation) {
+                PortfolioWorker worker;
+                worker.configuration = configuration;
+                worker.manager = std::make_shared<storm::expressions::ExpressionManager>();
+                worker.solver = std::make_unique<storm::solver::Z3SmtSolver>(*worker.manager);
+                worker.solver->setRandomSeed(configuration.seed);
+
+                worker.variableInformation = createVariables(worker.manager, model, psiStates, relevancyInformation, configuration.encodeReachability);
+                worker.variableInformation.adderVariables = assertAdder(*worker.solver, worker.variableInformation);
+                worker.variableInformation.auxiliaryVariables.push_back(assertLessOrEqualKRelaxed(*worker.solver, worker.variableInformation, 0));
+
+                worker.cutTime = assertCuts(symbolicModel, model, labelSets, psiStates, worker.variableInformation, relevancyInformation, *worker.solver, configuration.addBackwardImplicationCuts);
+                if (configuration.encodeReachability) {
+                    assertReachabilityCuts(model, labelSets, psiStates, worker.variableInformation, relevancyInformation, *worker.solver);
+                }
+                return worker;
+            }
+
+            /*!
+             * Lets the given worker search for a minimal label set until it finds one, its constraint system is
+             * exhausted or another worker is done. Before every iteration, the label sets that the other workers found
+             * to be insufficient are ruled out.
+             *
+             * @return The label set found by this worker, if any.
+             */
+            static boost::optional<storm::storage::FlatSet<uint_fast64_t>> runPortfolioWorker(Environment const& env, storm::storage::SymbolicModelDescription const& symbolicModel, storm::models::sparse::Model<T> const& model, std::vector<storm::storage::FlatSet<uint_fast64_t>> const& labelSets, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& propertyThreshold, boost::optional<std::vector<std::string>> const& rewardName, bool strictBound, RelevancyInformation const& relevancyInformation, PortfolioWorker& worker, uint64_t workerIndex, PortfolioSharedState& sharedState) {
+                while (!sharedState.done) {
+                    {
+                        std::lock_guard<std::mutex> lock(sharedState.mutex);
+                        for (; worker.importedLabelSets < sharedState.insufficientLabelSets.size(); ++worker.importedLabelSets) {
+                            auto const& insufficientLabelSet = sharedState.insufficientLabelSets[worker.importedLabelSets];
+                            if (insufficientLabelSet.first != workerIndex) {
+                                ruleOutSingleSolution(*worker.solver, insufficientLabelSet.second, worker.variableInformation, relevancyInformation);
+                            }
+                        }
+                    }
+
+                    ++worker.iterations;
+                    auto solverClock = std::chrono::high_resolution_clock::now();
+                    boost::optional<storm::storage::FlatSet<uint_fast64_t>> smallest = findSmallestCommandSet(*worker.solver, worker.variableInformation, worker.currentBound);
+                    worker.solverTime += std::chrono::high_resolution_clock::now() - solverClock;
+                    if (sharedState.done || smallest == boost::none) {
+                        // Either another worker was faster or the constraint system of this worker is exhausted.
+                        return boost::none;
+                    }
+                    storm::storage::FlatSet<uint_fast64_t> commandSet = std::move(smallest.get());
+                    STORM_LOG_DEBUG("Portfolio worker " << workerIndex << " computed minimal command set with bound " << worker.currentBound << ".");
+
+                    commandSet.insert(relevancyInformation.knownLabels.begin(), relevancyInformation.knownLabels.end());
+                    commandSet.insert(relevancyInformation.dontCareLabels.begin(), relevancyInformation.dontCareLabels.end());
+                    if (commandSet.size() == nrCommands(symbolicModel)) {
+                        return commandSet;
+                    }
+
+                    auto modelCheckingClock = std::chrono::high_resolution_clock::now();
+                    auto subChoiceOrigins = restrictModelToLabelSet(model, commandSet, rewardName ? boost::make_optional(psiStates.getNextSetIndex(0)) : boost::none);
+                    std::shared_ptr<storm::models::sparse::Model<T>> const& subModel = subChoiceOrigins.first;
+                    std::vector<storm::storage::FlatSet<uint_fast64_t>> const& subLabelSets = subChoiceOrigins.second;
+                    std::vector<T> maximalPropertyValue = computeMaximalReachabilityProbability(env, *subModel, phiStates, psiStates, rewardName);
+                    worker.modelCheckingTime += std::chrono::high_resolution_clock::now() - modelCheckingClock;
+
+                    auto analysisClock = std::chrono::high_resolution_clock::now();
+                    bool violation = false;
+                    for (uint64_t i = 0; i < maximalPropertyValue.size(); i++) {
+                        violation |= (strictBound && maximalPropertyValue[i] < propertyThreshold[i]) || (!strictBound && maximalPropertyValue[i] <= propertyThreshold[i]);
+                    }
+                    if (!violation) {
+                        STORM_LOG_DEBUG("Portfolio worker " << workerIndex << " found a counterexample.");
+                        worker.analysisTime += std::chrono::high_resolution_clock::now() - analysisClock;
+                        return commandSet;
+                    }
+
+                    if (!rewardName && maximalPropertyValue.front() == storm::utility::zero<T>()) {
+                        ++worker.zeroProbabilityCount;
+                    }
+                    if (worker.configuration.useDynamicConstraints) {
+                        storm::storage::BitVector reachableStates = storm::utility::graph::getReachableStates(subModel->getTransitionMatrix(), subModel->getInitialStates(), phiStates, psiStates);
+                        if (reachableStates.isDisjointFrom(psiStates)) {
+                            analyzeZeroProbabilitySolution(*worker.solver, *subModel, subLabelSets, model, labelSets, phiStates, psiStates, commandSet, worker.variableInformation, relevancyInformation);
+                        } else {
+                            analyzeInsufficientProbabilitySolution(*worker.solver, *subModel, subLabelSets, model, labelSets, phiStates, psiStates, commandSet, worker.variableInformation, relevancyInformation);
+                        }
+                        if (relevancyInformation.dontCareLabels.size() > 0) {
+                            ruleOutSingleSolution(*worker.solver, commandSet, worker.variableInformation, relevancyInformation);
+                        }
+                    } else {
+                        ruleOutSingleSolution(*worker.solver, commandSet, worker.variableInformation, relevancyInformation);
+                    }
+
+                    // Share the insufficient label set, so the other workers do not have to check it again.
+                    {
+                        std::lock_guard<std::mutex> lock(sharedState.mutex);
+                        sharedState.insufficientLabelSets.emplace_back(workerIndex, std::move(commandSet));
+                    }
+                    worker.analysisTime += std::chrono::high_resolution_clock::now() - analysisClock;
+                }
+                return boost::none;
+            }
+
+            /*!
+             * Runs the given workers on separate threads until the first of them finds a counterexample. As every worker
+             * only considers label sets of minimal size with respect to its constraint system, this counterexample is
+             * minimal. All other workers are interrupted then.
+             *
+             * @param winner If a counterexample is found, this is set to the index of the worker that found it.
+             * @return The minimal label set, if there is a counterexample.
+             */
+            static boost::optional<storm::storage::FlatSet<uint_fast64_t>> runPortfolio(Environment const& env, storm::storage::SymbolicModelDescription const& symbolicModel, storm::models::sparse::Model<T> const& model, std::vector<storm::storage::FlatSet<uint_fast64_t>> const& labelSets, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& propertyThreshold, boost::optional<std::vector<std::string>> const& rewardName, bool strictBound, RelevancyInformation const& relevancyInformation, std::vector<PortfolioWorker>& workers, uint64_t& winner) {
+                PortfolioSharedState sharedState;
+                for (auto& worker : workers) {
+                    worker.solver->resetInterrupt();
+                }
+                auto stopAllWorkers = [&] () {
+                    sharedState.done = true;
+                    for (auto& worker : workers) {
+                        worker.solver->interrupt();
+                    }
+                };
+
+                auto runWorker = [&] (uint64_t workerIndex) {
+                    try {
+                        boost::optional<storm::storage::FlatSet<uint_fast64_t>> labelSet = runPortfolioWorker(env, symbolicModel, model, labelSets, phiStates, psiStates, propertyThreshold, rewardName, strictBound, relevancyInformation, workers[workerIndex], workerIndex, sharedState);
+                        if (labelSet) {
+                            {
+                                std::lock_guard<std::mutex> lock(sharedState.mutex);
+                                if (!sharedState.result) {
+                                    sharedState.result = std::move(labelSet);
+                                    sharedState.winner = workerIndex;
+                                }
+                            }
+                            stopAllWorkers();
+                        }
+                    } catch (...) {
+                        stopAllWorkers();
+                        throw;
+                    }
+                };
+
+                // All workers run on separate threads, so the calling thread can re-issue the interrupts: while the
+                // interrupts are sticky (i.e., later checks do not start at all), Z3 might miss an interrupt that arrives
+                // while a check is being started.
+                std::vector<std::future<void>> futures;
+                for (uint64_t workerIndex = 0; workerIndex < workers.size(); ++workerIndex) {
+                    futures.push_back(std::async(std::launch::async, runWorker, workerIndex));
+                }
+                // Wait for all workers before propagating an exception, as they refer to the shared state.
+                std::exception_ptr exception;
+                for (auto& future : futures) {
+                    while (future.wait_for(std::chrono::milliseconds(50)) != std::future_status::ready) {
+                        if (sharedState.done) {
+                            stopAllWorkers();
+                        }
+                    }
+                    try {
+                        future.get();
+                    } catch (...) {
+                        if (!exception) {
+                            exception = std::current_exception();
+                        }
+                    }
+                }
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+
+                winner = sharedState.winner;
+                return sharedState.result;
+            }
 #endif
         
             
@@ -1605,6 +1835,7 @@ namespace storm {
                     
                     encodeReachability = settings.isEncodeReachabilitySet();
                     useDynamicConstraints = settings.isUseDynamicConstraintsSet();
+                    portfolioWorkers = settings.getPortfolioWorkers();
                 }
                 
                 bool checkThresholdFeasible;
@@ -1616,6 +1847,8 @@ namespace storm {
                 uint64_t maximumCounterexamples = 1;
                 uint64_t multipleCounterexampleSizeCap = 100000000;
                 uint64_t maximumExtraIterations = 100000000;
+                // The number of differently configured solvers that search in parallel. Only used if a single counterexample is requested.
+                uint64_t portfolioWorkers;
             };
 
             struct GeneratorStats {
@@ -1696,6 +1929,60 @@ namespace storm {
                 // (2) Identify all states and commands that are relevant, because only these need to be considered later.
                 RelevancyInformation relevancyInformation = determineRelevantStatesAndLabels(model, labelSets, phiStates, psiStates, dontCareLabels);
                 
+                // In the portfolio mode, several differently configured solvers search for the minimal label set in
+                // parallel and share the label sets that they found to be insufficient. The first worker uses the given
+                // options, the other ones vary the seed and the cuts.
+                if (options.portfolioWorkers > 1 && options.maximumCounterexamples == 1 && !relevancyInformation.relevantLabels.empty() && !relevancyInformation.minimalityLabels.empty()) {
+                    std::vector<PortfolioWorker> workers;
+                    for (uint64_t workerIndex = 0; workerIndex < options.portfolioWorkers; ++workerIndex) {
+                        PortfolioConfiguration configuration;
+                        configuration.seed = workerIndex;
+                        configuration.addBackwardImplicationCuts = options.addBackwardImplicationCuts && (workerIndex & 1) == 0;
+                        configuration.encodeReachability = options.encodeReachability != ((workerIndex & 2) != 0);
+                        configuration.useDynamicConstraints = options.useDynamicConstraints != ((workerIndex & 4) != 0);
+                        workers.push_back(createPortfolioWorker(configuration, symbolicModel, model, labelSets, psiStates, relevancyInformation));
+                    }
+                    totalSetupTime = std::chrono::high_resolution_clock::now() - setupTimeClock;
+
+                    uint64_t winner = 0;
+                    boost::optional<storm::storage::FlatSet<uint_fast64_t>> labelSet = runPortfolio(env, symbolicModel, model, labelSets, phiStates, psiStates, propertyThreshold, rewardName, strictBound, relevancyInformation, workers, winner);
+                    if (labelSet) {
+                        result.push_back(std::move(labelSet.get()));
+                    }
+                    totalTime = std::chrono::high_resolution_clock::now() - totalClock;
+
+                    // The solver, model checking and analysis times are summed up over all workers.
+                    stats.setupTime = std::chrono::duration_cast<std::chrono::milliseconds>(totalSetupTime);
+                    stats.cutTime = std::chrono::milliseconds(0);
+                    stats.iterations = 0;
+                    for (auto const& worker : workers) {
+                        stats.cutTime += worker.cutTime;
+                        totalSolverTime += worker.solverTime;
+                        totalModelCheckingTime += worker.modelCheckingTime;
+                        totalAnalysisTime += worker.analysisTime;
+                        stats.iterations += worker.iterations;
+                    }
+                    stats.solverTime = std::chrono::duration_cast<std::chrono::milliseconds>(totalSolverTime);
+                    stats.modelCheckingTime = std::chrono::duration_cast<std::chrono::milliseconds>(totalModelCheckingTime);
+                    stats.analysisTime = std::chrono::duration_cast<std::chrono::milliseconds>(totalAnalysisTime);
+
+                    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+                        std::cout << "Portfolio:" << std::endl;
+                        for (uint64_t workerIndex = 0; workerIndex < workers.size(); ++workerIndex) {
+                            auto const& worker = workers[workerIndex];
+                            std::cout << "    * worker " << workerIndex << (labelSet && workerIndex == winner ? " (found counterexample)" : "") << ": "
+                                      << worker.iterations << " models checked, "
+                                      << worker.zeroProbabilityCount << " could not reach a target state, "
+                                      << "final bound " << worker.currentBound << ", "
+                                      << "solving " << std::chrono::duration_cast<std::chrono::milliseconds>(worker.solverTime).count() << "ms" << std::endl;
+                        }
+                        std::cout << "    * time for setup: " << stats.setupTime.count() << "ms" << std::endl;
+                        std::cout << "    * total time: " << std::chrono::duration_cast<std::chrono::milliseconds>(totalTime).count() << "ms" << std::endl;
+                        std::cout << std::endl;
+                    }
+                    return result;
+                }
+
                 // (3) Create a solver.
                 std::shared_ptr<storm::expressions::ExpressionManager> manager = std::make_shared<storm::expressions::ExpressionManager>();
                 std::unique_ptr<storm::solver::SmtSolver> solver = std::make_unique<storm::solver::Z3SmtSolver>(*manager);
@@ -21,6 +21,7 @@ namespace storm {
             const std::string CounterexampleGeneratorSettings::encodeReachabilityOptionName = "encreach";
             const std::string CounterexampleGeneratorSettings::schedulerCutsOptionName = "schedcuts";
             const std::string CounterexampleGeneratorSettings::noDynamicConstraintsOptionName = "nodyn";
+            const std::string CounterexampleGeneratorSettings::portfolioOptionName = "portfolio";
 
             CounterexampleGeneratorSettings::CounterexampleGeneratorSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, counterexampleOptionName, false, "Generates a counterexample for the given PRCTL formulas if not satisfied by the model.").setShortName(counterexampleOptionShortName).build());
@@ -35,6 +36,8 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, encodeReachabilityOptionName, true, "Sets whether to encode reachability for MAXSAT-based counterexample generation.").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, schedulerCutsOptionName, true, "Sets whether to add the scheduler cuts for MILP-based counterexample generation.").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, noDynamicConstraintsOptionName, true, "Disables the generation of dynamic constraints in the MAXSAT-based counterexample generation.").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, portfolioOptionName, true, "Runs several differently configured solver instances in parallel for MAXSAT-based counterexample generation.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("workers", "The number of solver instances.").setDefaultValueUnsignedInteger(1).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
             }
 
             bool CounterexampleGeneratorSettings::isCounterexampleSet() const {
@@ -77,6 +80,10 @@ namespace storm {
                 return !this->getOption(noDynamicConstraintsOptionName).getHasOptionBeenSet();
             }
 
+            uint64_t CounterexampleGeneratorSettings::getPortfolioWorkers() const {
+                return this->getOption(portfolioOptionName).getArgumentByName("workers").getValueAsUnsignedInteger();
+            }
+
             bool CounterexampleGeneratorSettings::check() const {
                 STORM_LOG_THROW(isCounterexampleSet() || !isCounterexampleTypeSet(), storm::exceptions::InvalidSettingsException, "Counterexample type was set but counterexample flag '-cex' is missing.");
                 // Ensure that the model was given either symbolically or explicitly.
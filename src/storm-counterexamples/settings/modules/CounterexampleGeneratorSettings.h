@@ -90,6 +90,14 @@ namespace storm {
                  * @return True iff dynamic constraints are to be used.
                  */
                 bool isUseDynamicConstraintsSet() const;
+
+                /*!
+                 * Retrieves the number of differently configured solver instances that run in parallel in the
+                 * MAXSAT-based technique.
+                 *
+                 * @return The number of solver instances.
+                 */
+                uint64_t getPortfolioWorkers() const;
                 
                 bool check() const override;
                 
@@ -106,6 +114,7 @@ namespace storm {
                 static const std::string encodeReachabilityOptionName;
                 static const std::string schedulerCutsOptionName;
                 static const std::string noDynamicConstraintsOptionName;
+                static const std::string portfolioOptionName;
             };
             
         } // namespace modules
@@ -1,6 +1,7 @@
 #include "ExplicitDFTModelBuilder.h"
 
 #include <map>
+#include <type_traits>
 
 #include <storm/exceptions/IllegalArgumentException.h>
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -13,6 +14,8 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/vector.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/transformer/NonMarkovianChainTransformer.h"
 
 #include "storm-dft/settings/modules/FaultTreeSettings.h"
@@ -41,6 +44,12 @@ namespace storm {
                 stateStorage(dft.stateBitVectorSize()),
                 explorationQueue(1, 0, 0.9, false)
         {
+            auto const& ftSettings = storm::settings::getModule<storm::settings::modules::FaultTreeSettings>();
+            expansionBatchSize = ftSettings.getExplorationBatchSize();
+            if (ftSettings.isMaxUnexploredStatesSet()) {
+                maxUnexploredStatesInMemory = ftSettings.getMaxUnexploredStates();
+            }
+
             // Set relevant events
             STORM_LOG_DEBUG("Relevant events: " << this->dft.getRelevantEventsString());
             if (dft.getRelevantEvents().size() <= 1) {
@@ -364,36 +373,29 @@ namespace storm {
             size_t nrSkippedStates = 0;
             storm::utility::ProgressMeasurement progress("explored states");
             progress.startNewMeasurement(0);
+            // States taken from the queue together with their prepared expansions
+            std::vector<std::pair<DFTStatePointer, ExplorationHeuristicPointer>> batch;
+            std::vector<PreparedExpansion> expansions;
+            size_t batchIndex = 0;
+            std::vector<StateType> newStates;
             // TODO: do not empty queue every time but break before
-            while (!explorationQueue.empty()) {
-                // Get the first state in the queue
-                ExplorationHeuristicPointer currentExplorationHeuristic = explorationQueue.pop();
-                StateType currentId = currentExplorationHeuristic->getId();
-                auto itFind = statesNotExplored.find(currentId);
-                STORM_LOG_ASSERT(itFind != statesNotExplored.end(), "Id " << currentId << " not found");
-                DFTStatePointer currentState = itFind->second.first;
-                STORM_LOG_ASSERT(currentExplorationHeuristic == itFind->second.second, "Exploration heuristics do not match");
-                STORM_LOG_ASSERT(currentState->getId() == currentId, "Ids do not match");
-                // Remove it from the list of not explored states
-                statesNotExplored.erase(itFind);
-                STORM_LOG_ASSERT(stateStorage.stateToId.contains(currentState->status()), "State is not contained in state storage.");
-                STORM_LOG_ASSERT(stateStorage.stateToId.getValue(currentState->status()) == currentId, "Ids of states do not coincide.");
-
-                // Get concrete state if necessary
-                if (currentState->isPseudoState()) {
-                    // Create concrete state from pseudo state
-                    currentState->construct();
+            while (batchIndex < batch.size() || !explorationQueue.empty()) {
+                if (batchIndex == batch.size()) {
+                    // Get the next states in the queue and generate their successors
+                    takeStatesFromQueue(batch);
+                    prepareExpansions(batch, approximationThreshold, expansions);
+                    batchIndex = 0;
                 }
-                STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
+                DFTStatePointer currentState = batch[batchIndex].first;
+                ExplorationHeuristicPointer currentExplorationHeuristic = batch[batchIndex].second;
+                PreparedExpansion const& expansion = expansions[batchIndex];
+                ++batchIndex;
 
                 // Remember that the current row group was actually filled with the transitions of a different state
-                matrixBuilder.setRemapping(currentId);
+                matrixBuilder.setRemapping(currentState->getId());
 
                 matrixBuilder.newRowGroup();
 
-                // Try to explore the next state
-                generator.load(currentState);
-
                 //if (approximationThreshold > 0.0 && nrExpandedStates > approximationThreshold && !currentExplorationHeuristic->isExpand()) {
                 if (approximationThreshold > 0.0 && currentExplorationHeuristic->isSkip(approximationThreshold)) {
                     // Skip the current state
@@ -410,9 +412,10 @@ namespace storm {
                 } else {
                     // Explore the current state
                     ++nrExpandedStates;
-                    storm::generator::StateBehavior<ValueType, StateType> behavior = generator.expand(std::bind(&ExplicitDFTModelBuilder::getOrAddStateIndex, this, std::placeholders::_1));
+                    storm::generator::StateBehavior<ValueType, StateType> behavior = finishExpansion(expansion);
                     STORM_LOG_ASSERT(!behavior.empty(), "Behavior is empty.");
                     setMarkovian(behavior.begin()->isMarkovian());
+                    newStates.clear();
 
                     // Now add all choices.
                     for (auto const& choice : behavior) {
@@ -465,6 +468,7 @@ namespace storm {
                                     }
 
                                     explorationQueue.push(heuristic);
+                                    newStates.push_back(stateProbabilityPair.first);
                                 } else if (!iter->second.second->isExpand()) {
                                     double oldPriority = iter->second.second->getPriority();
                                     if (iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass())) {
@@ -476,8 +480,11 @@ namespace storm {
                         }
                         matrixBuilder.finishRow();
                     }
+                    // The heuristic values of the new states are known now, so they can be spilled if necessary
+                    spillStates(newStates);
                 }
-                if (storm::utility::resources::isTerminate()) {
+                // States taken from the queue are always added to the state space before stopping
+                if (batchIndex == batch.size() && storm::utility::resources::isTerminate()) {
                     break;
                 }
                 // Output number of currently explored states
@@ -488,9 +495,152 @@ namespace storm {
 
             STORM_LOG_INFO("Expanded " << nrExpandedStates << " states");
             STORM_LOG_INFO("Skipped " << nrSkippedStates << " states");
+            STORM_LOG_INFO_COND(spillFile.getNumberOfStoredStates() == 0, "Spilled " << spillFile.getNumberOfStoredStates() << " states to disk");
             STORM_LOG_ASSERT(nrSkippedStates == skippedStates.size(), "Nr skipped states is wrong");
         }
 
+        template<typename ValueType, typename StateType>
+        void ExplicitDFTModelBuilder<ValueType, StateType>::takeStatesFromQueue(std::vector<std::pair<DFTStatePointer, ExplorationHeuristicPointer>>& batch) {
+            batch.clear();
+            while (batch.size() < expansionBatchSize && !explorationQueue.empty()) {
+                // Get the first state in the queue
+                ExplorationHeuristicPointer currentExplorationHeuristic = explorationQueue.pop();
+                StateType currentId = currentExplorationHeuristic->getId();
+                auto itFind = statesNotExplored.find(currentId);
+                STORM_LOG_ASSERT(itFind != statesNotExplored.end(), "Id " << currentId << " not found");
+                DFTStatePointer currentState = itFind->second.first;
+                STORM_LOG_ASSERT(currentExplorationHeuristic == itFind->second.second, "Exploration heuristics do not match");
+                // Remove it from the list of not explored states
+                statesNotExplored.erase(itFind);
+                if (!currentState) {
+                    // State was spilled
+                    currentState = restoreState(currentId);
+                }
+                STORM_LOG_ASSERT(currentState->getId() == currentId, "Ids do not match");
+                STORM_LOG_ASSERT(stateStorage.stateToId.contains(currentState->status()), "State is not contained in state storage.");
+                STORM_LOG_ASSERT(stateStorage.stateToId.getValue(currentState->status()) == currentId, "Ids of states do not coincide.");
+
+                // Get concrete state if necessary
+                if (currentState->isPseudoState()) {
+                    // Create concrete state from pseudo state
+                    currentState->construct();
+                }
+                STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
+                batch.emplace_back(currentState, currentExplorationHeuristic);
+            }
+        }
+
+        template<typename ValueType, typename StateType>
+        void ExplicitDFTModelBuilder<ValueType, StateType>::prepareExpansions(std::vector<std::pair<DFTStatePointer, ExplorationHeuristicPointer>> const& batch, double approximationThreshold, std::vector<PreparedExpansion>& expansions) {
+            expansions.resize(batch.size());
+            auto prepareExpansion = [&] (storm::generator::DftNextStateGenerator<ValueType, StateType>& stateGenerator, size_t index) {
+                PreparedExpansion& expansion = expansions[index];
+                expansion.successors.clear();
+                if (approximationThreshold > 0.0 && batch[index].second->isSkip(approximationThreshold)) {
+                    expansion.behavior = storm::generator::StateBehavior<ValueType, StateType>();
+                    return;
+                }
+                stateGenerator.load(batch[index].first);
+                // Successors only get a temporary id as the state space must not be changed here
+                expansion.behavior = stateGenerator.expand([&expansion, this] (DFTStatePointer const& successor) {
+                    expansion.successors.push_back(successor);
+                    return static_cast<StateType>(OFFSET_PSEUDO_STATE + expansion.successors.size() - 1);
+                });
+            };
+
+#ifdef STORM_HAVE_INTELTBB
+            if (batch.size() > 1 && parallelize()) {
+                tbb::parallel_for(tbb::blocked_range<size_t>(0, batch.size()), [&] (tbb::blocked_range<size_t> const& range) {
+                    // The generator keeps the loaded state, so each task uses its own copy
+                    storm::generator::DftNextStateGenerator<ValueType, StateType> stateGenerator(generator);
+                    for (size_t index = range.begin(); index < range.end(); ++index) {
+                        prepareExpansion(stateGenerator, index);
+                    }
+                });
+                return;
+            }
+#endif
+            for (size_t index = 0; index < batch.size(); ++index) {
+                prepareExpansion(generator, index);
+            }
+        }
+
+        template<typename ValueType, typename StateType>
+        storm::generator::StateBehavior<ValueType, StateType> ExplicitDFTModelBuilder<ValueType, StateType>::finishExpansion(PreparedExpansion const& expansion) {
+            // Add the successors in the order in which they were generated. This yields the same ids as a sequential exploration.
+            std::vector<StateType> successorIds;
+            successorIds.reserve(expansion.successors.size());
+            for (auto const& successor : expansion.successors) {
+                successorIds.push_back(getOrAddStateIndex(successor));
+            }
+
+            storm::generator::StateBehavior<ValueType, StateType> behavior;
+            for (auto const& preparedChoice : expansion.behavior) {
+                storm::generator::Choice<ValueType, StateType> choice(preparedChoice.getActionIndex(), preparedChoice.isMarkovian());
+                for (auto const& stateProbabilityPair : preparedChoice) {
+                    if (stateProbabilityPair.first >= OFFSET_PSEUDO_STATE) {
+                        // Different successors might coincide, their probabilities are summed up here
+                        choice.addProbability(successorIds[stateProbabilityPair.first - OFFSET_PSEUDO_STATE], stateProbabilityPair.second);
+                    } else {
+                        // Self loop or unique failed state
+                        choice.addProbability(stateProbabilityPair.first, stateProbabilityPair.second);
+                    }
+                }
+                behavior.addChoice(std::move(choice));
+            }
+            behavior.setExpanded(expansion.behavior.wasExpanded());
+            return behavior;
+        }
+
+        template<typename ValueType, typename StateType>
+        void ExplicitDFTModelBuilder<ValueType, StateType>::spillStates(std::vector<StateType> const& candidates) {
+            if (maxUnexploredStatesInMemory == 0) {
+                return;
+            }
+            for (StateType id : candidates) {
+                if (statesNotExplored.size() - spilledStates.size() <= maxUnexploredStatesInMemory) {
+                    break;
+                }
+                auto iter = statesNotExplored.find(id);
+                if (iter == statesNotExplored.end() || !iter->second.first) {
+                    continue;
+                }
+                // The status suffices to restore the state later on
+                spilledStates[id] = spillFile.store(iter->second.first->status());
+                iter->second.first.reset();
+            }
+        }
+
+        template<typename ValueType, typename StateType>
+        typename ExplicitDFTModelBuilder<ValueType, StateType>::DFTStatePointer ExplicitDFTModelBuilder<ValueType, StateType>::restoreState(StateType id) {
+            auto iter = spilledStates.find(id);
+            STORM_LOG_ASSERT(iter != spilledStates.end(), "State " << id << " was not spilled.");
+            storm::storage::BitVector status = spillFile.load(iter->second, dft.stateBitVectorSize());
+            spilledStates.erase(iter);
+            return std::make_shared<storm::storage::DFTState<ValueType>>(status, dft, *stateGenerationInfo, id);
+        }
+
+        template<typename ValueType, typename StateType>
+        void ExplicitDFTModelBuilder<ValueType, StateType>::setExpansionBatchSize(size_t batchSize) {
+            STORM_LOG_THROW(batchSize > 0, storm::exceptions::InvalidArgumentException, "The expansion batch size must be positive.");
+            expansionBatchSize = batchSize;
+        }
+
+        template<typename ValueType, typename StateType>
+        void ExplicitDFTModelBuilder<ValueType, StateType>::setMaxUnexploredStatesInMemory(size_t maxStates) {
+            maxUnexploredStatesInMemory = maxStates;
+        }
+
+        template<typename ValueType, typename StateType>
+        bool ExplicitDFTModelBuilder<ValueType, StateType>::parallelize() const {
+#ifdef STORM_HAVE_INTELTBB
+            // Operations on rational functions are not thread-safe
+            return std::is_same<ValueType, double>::value && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+#else
+            return false;
+#endif
+        }
+
         template<typename ValueType, typename StateType>
         void ExplicitDFTModelBuilder<ValueType, StateType>::buildLabeling() {
             bool isAddLabelsClaiming = storm::settings::getModule<storm::settings::modules::FaultTreeSettings>().isAddLabelsClaiming();
@@ -902,7 +1052,8 @@ namespace storm {
                     // Check if state is pseudo state
                     // If state is explored already the possible pseudo state was already constructed
                     auto iter = statesNotExplored.find(stateId);
-                    if (iter != statesNotExplored.end() && iter->second.first->isPseudoState()) {
+                    // Spilled states are restored as pseudo states anyway
+                    if (iter != statesNotExplored.end() && iter->second.first && iter->second.first->isPseudoState()) {
                         // Create pseudo state now
                         STORM_LOG_ASSERT(iter->second.first->getId() == stateId, "Ids do not match.");
                         STORM_LOG_ASSERT(iter->second.first->status() == state->status(), "Pseudo states do not coincide.");
@@ -944,7 +1095,11 @@ namespace storm {
         void ExplicitDFTModelBuilder<ValueType, StateType>::printNotExplored() const {
             std::cout << "states not explored:" << std::endl;
             for (auto it : statesNotExplored) {
-                std::cout << it.first << " -> " << dft.getStateString(it.second.first) << std::endl;
+                if (it.second.first) {
+                    std::cout << it.first << " -> " << dft.getStateString(it.second.first) << std::endl;
+                } else {
+                    std::cout << it.first << " -> (spilled)" << std::endl;
+                }
             }
         }
 
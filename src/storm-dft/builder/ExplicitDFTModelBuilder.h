@@ -2,6 +2,7 @@
 
 #include <boost/optional/optional.hpp>
 #include <stack>
+#include <unordered_map>
 #include <unordered_set>
 #include <limits>
 
@@ -17,6 +18,7 @@
 #include "storm-dft/storage/dft/DFT.h"
 #include "storm-dft/storage/dft/SymmetricUnits.h"
 #include "storm-dft/storage/BucketPriorityQueue.h"
+#include "storm-dft/storage/StateSpillFile.h"
 
 namespace storm {
     namespace builder {
@@ -184,8 +186,33 @@ namespace storm {
              */
             std::shared_ptr<storm::models::sparse::Model<ValueType>> getModelApproximation(bool lowerBound, bool expectedTime);
 
+            /*!
+             * Set the number of states which are taken from the exploration queue at once. The successors of these
+             * states are generated in parallel (if Intel TBB is available and enabled). The successors are added to
+             * the state space in the order in which the states were taken from the queue, so the built model does not
+             * depend on the number of threads.
+             *
+             * @param batchSize Number of states expanded together. A size of 1 yields the sequential exploration.
+             */
+            void setExpansionBatchSize(size_t batchSize);
+
+            /*!
+             * Set the maximal number of unexplored states which are kept in memory. Further unexplored states are
+             * written to a temporary file and restored from their status vector when they are explored.
+             *
+             * @param maxStates Maximal number of unexplored states in memory. 0 means that there is no limit.
+             */
+            void setMaxUnexploredStatesInMemory(size_t maxStates);
+
         private:
 
+            // The successors of a state which were generated without assigning state ids.
+            struct PreparedExpansion {
+                // Behavior of the state. Successors in the list below have the temporary id OFFSET_PSEUDO_STATE + index.
+                storm::generator::StateBehavior<ValueType, StateType> behavior;
+                std::vector<DFTStatePointer> successors;
+            };
+
             /*!
              * Explore state space of DFT.
              *
@@ -193,6 +220,48 @@ namespace storm {
              */
             void exploreStateSpace(double approximationThreshold);
 
+            /*!
+             * Take the next states from the exploration queue. Spilled states are restored.
+             *
+             * @param batch The states together with their heuristic values (at most the expansion batch size).
+             */
+            void takeStatesFromQueue(std::vector<std::pair<DFTStatePointer, ExplorationHeuristicPointer>>& batch);
+
+            /*!
+             * Generate the successors of the given states (if they are not skipped). The states are not added to
+             * the state space yet.
+             *
+             * @param batch States together with their heuristic values.
+             * @param approximationThreshold Threshold to determine when to skip states.
+             * @param expansions The prepared expansions. The i-th expansion belongs to the i-th state of the batch.
+             */
+            void prepareExpansions(std::vector<std::pair<DFTStatePointer, ExplorationHeuristicPointer>> const& batch, double approximationThreshold, std::vector<PreparedExpansion>& expansions);
+
+            /*!
+             * Add the successors of a prepared expansion to the state space.
+             *
+             * @return Behavior of the state in terms of the actual state ids.
+             */
+            storm::generator::StateBehavior<ValueType, StateType> finishExpansion(PreparedExpansion const& expansion);
+
+            /*!
+             * Write unexplored states to the spill file until the number of unexplored states in memory does not exceed the limit.
+             *
+             * @param candidates Ids of the states which can be spilled.
+             */
+            void spillStates(std::vector<StateType> const& candidates);
+
+            /*!
+             * Restore an unexplored state from the spill file. The restored state is a pseudo state.
+             *
+             * @param id Id of the state.
+             *
+             * @return The restored state.
+             */
+            DFTStatePointer restoreState(StateType id);
+
+            bool parallelize() const;
+
             /*!
              * Initialize the matrix for a refinement iteration.
              */
@@ -279,7 +348,7 @@ namespace storm {
 
             // Initial size of the bitvector.
             const size_t INITIAL_BITVECTOR_SIZE = 20000;
-            // Offset used for pseudo states.
+            // Offset used for temporary state ids, e.g., for successors which were generated but not yet added to the state space.
             const StateType OFFSET_PSEUDO_STATE = std::numeric_limits<StateType>::max() / 2;
 
             // Dft
@@ -318,8 +387,21 @@ namespace storm {
             storm::storage::BucketPriorityQueue<ExplorationHeuristic> explorationQueue;
 
             // A mapping of not yet explored states from the id to the tuple (state object, heuristic values).
+            // The state object is null if the state was spilled.
             std::map<StateType, std::pair<DFTStatePointer, ExplorationHeuristicPointer>> statesNotExplored;
 
+            // Number of states which are expanded together.
+            size_t expansionBatchSize = 1;
+
+            // Maximal number of unexplored states in memory (0 if unlimited).
+            size_t maxUnexploredStatesInMemory = 0;
+
+            // File containing the status of spilled states.
+            storm::storage::StateSpillFile spillFile;
+
+            // A mapping of spilled states to their position in the spill file.
+            std::unordered_map<StateType, uint64_t> spilledStates;
+
             // Holds all skipped states which were not yet expanded. More concretely it is a mapping from matrix indices
             // to the corresponding skipped states.
             // Notice that we need an ordered map here to easily iterate in increasing order over state ids.
@@ -28,6 +28,8 @@ namespace storm {
             const std::string FaultTreeSettings::maxDepthOptionName = "maxdepth";
             const std::string FaultTreeSettings::firstDependencyOptionName = "firstdep";
             const std::string FaultTreeSettings::uniqueFailedBEOptionName = "uniquefailedbe";
+            const std::string FaultTreeSettings::explorationBatchOptionName = "explorationbatch";
+            const std::string FaultTreeSettings::maxUnexploredStatesOptionName = "maxunexplored";
 #ifdef STORM_HAVE_Z3
             const std::string FaultTreeSettings::solveWithSmtOptionName = "smt";
 #endif
@@ -59,6 +61,14 @@ namespace storm {
                         storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("depth", "The maximal depth.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, uniqueFailedBEOptionName, false,
                                                                "Use a unique constantly failed BE.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, explorationBatchOptionName, false,
+                                                               "Generate the successors of several states together (in parallel if Intel TBB is enabled). The built model does not depend on the number of threads.").setIsAdvanced().addArgument(
+                        storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("size", "The number of states expanded together.").setDefaultValueUnsignedInteger(64).addValidatorUnsignedInteger(
+                                ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, maxUnexploredStatesOptionName, false,
+                                                               "Limit the number of unexplored states kept in memory. Further unexplored states are written to a temporary file.").setIsAdvanced().addArgument(
+                        storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("states", "The maximal number of unexplored states in memory.").addValidatorUnsignedInteger(
+                                ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
 #ifdef STORM_HAVE_Z3
                 this->addOption(storm::settings::OptionBuilder(moduleName, solveWithSmtOptionName, true, "Solve the DFT with SMT.").build());
 #endif
@@ -129,6 +139,21 @@ namespace storm {
                 return this->getOption(uniqueFailedBEOptionName).getHasOptionBeenSet();
             }
 
+            uint_fast64_t FaultTreeSettings::getExplorationBatchSize() const {
+                if (!this->getOption(explorationBatchOptionName).getHasOptionBeenSet()) {
+                    return 1;
+                }
+                return this->getOption(explorationBatchOptionName).getArgumentByName("size").getValueAsUnsignedInteger();
+            }
+
+            bool FaultTreeSettings::isMaxUnexploredStatesSet() const {
+                return this->getOption(maxUnexploredStatesOptionName).getHasOptionBeenSet();
+            }
+
+            uint_fast64_t FaultTreeSettings::getMaxUnexploredStates() const {
+                return this->getOption(maxUnexploredStatesOptionName).getArgumentByName("states").getValueAsUnsignedInteger();
+            }
+
 #ifdef STORM_HAVE_Z3
 
             bool FaultTreeSettings::solveWithSMT() const {
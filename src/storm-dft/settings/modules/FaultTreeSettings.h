@@ -117,6 +117,27 @@ namespace storm {
                   */
                 bool isUniqueFailedBE() const;
 
+                /*!
+                 * Retrieves the number of states whose successors are generated together.
+                 *
+                 * @return The batch size (1 if the option was not set).
+                 */
+                uint_fast64_t getExplorationBatchSize() const;
+
+                /*!
+                 * Retrieves whether the number of unexplored states kept in memory is limited.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isMaxUnexploredStatesSet() const;
+
+                /*!
+                 * Retrieves the maximal number of unexplored states kept in memory.
+                 *
+                 * @return The maximal number of unexplored states.
+                 */
+                uint_fast64_t getMaxUnexploredStates() const;
+
 #ifdef STORM_HAVE_Z3
 
                 /*!
@@ -150,6 +171,8 @@ namespace storm {
                 static const std::string maxDepthOptionName;
                 static const std::string firstDependencyOptionName;
                 static const std::string uniqueFailedBEOptionName;
+                static const std::string explorationBatchOptionName;
+                static const std::string maxUnexploredStatesOptionName;
 #ifdef STORM_HAVE_Z3
                 static const std::string solveWithSmtOptionName;
 #endif
@@ -0,0 +1,53 @@
+#include "storm-dft/storage/StateSpillFile.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/FileIoException.h"
+
+namespace storm {
+    namespace storage {
+
+        StateSpillFile::~StateSpillFile() {
+            if (file != nullptr) {
+                std::fclose(file);
+            }
+        }
+
+        uint64_t StateSpillFile::store(storm::storage::BitVector const& state) {
+            if (file == nullptr) {
+                file = std::tmpfile();
+                STORM_LOG_THROW(file != nullptr, storm::exceptions::FileIoException, "Could not create temporary file for spilling states.");
+            }
+            // Write the state as a sequence of 64 bit blocks
+            std::vector<uint64_t> blocks;
+            for (uint64_t index = 0; index < state.size(); index += 64) {
+                blocks.push_back(state.getAsInt(index, std::min<uint64_t>(64, state.size() - index)));
+            }
+            STORM_LOG_THROW(std::fseek(file, endPosition, SEEK_SET) == 0, storm::exceptions::FileIoException, "Could not seek in temporary file for spilling states.");
+            STORM_LOG_THROW(std::fwrite(blocks.data(), sizeof(uint64_t), blocks.size(), file) == blocks.size(), storm::exceptions::FileIoException, "Could not write to temporary file for spilling states.");
+            uint64_t position = endPosition;
+            endPosition += blocks.size() * sizeof(uint64_t);
+            ++numberOfStoredStates;
+            return position;
+        }
+
+        storm::storage::BitVector StateSpillFile::load(uint64_t position, uint64_t size) {
+            STORM_LOG_ASSERT(file != nullptr, "No states were spilled.");
+            std::vector<uint64_t> blocks((size + 63) / 64);
+            STORM_LOG_THROW(std::fseek(file, position, SEEK_SET) == 0, storm::exceptions::FileIoException, "Could not seek in temporary file for spilling states.");
+            STORM_LOG_THROW(std::fread(blocks.data(), sizeof(uint64_t), blocks.size(), file) == blocks.size(), storm::exceptions::FileIoException, "Could not read from temporary file for spilling states.");
+            storm::storage::BitVector state(size);
+            for (uint64_t block = 0; block < blocks.size(); ++block) {
+                state.setFromInt(block * 64, std::min<uint64_t>(64, size - block * 64), blocks[block]);
+            }
+            return state;
+        }
+
+        uint64_t StateSpillFile::getNumberOfStoredStates() const {
+            return numberOfStoredStates;
+        }
+
+    }
+}
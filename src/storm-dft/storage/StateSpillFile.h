@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdio>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * Temporary file to which state vectors can be written in order to reduce the memory consumption during state
+         * space exploration. The file is created on first use and removed automatically when it is closed.
+         */
+        class StateSpillFile {
+        public:
+            StateSpillFile() = default;
+            StateSpillFile(StateSpillFile const&) = delete;
+            StateSpillFile& operator=(StateSpillFile const&) = delete;
+            ~StateSpillFile();
+
+            /*!
+             * Write the given state to the file.
+             *
+             * @param state State vector.
+             * @return Position of the state in the file.
+             */
+            uint64_t store(storm::storage::BitVector const& state);
+
+            /*!
+             * Read a state from the file.
+             *
+             * @param position Position of the state as returned by store.
+             * @param size Number of bits of the state.
+             * @return State vector.
+             */
+            storm::storage::BitVector load(uint64_t position, uint64_t size);
+
+            /*!
+             * Retrieve the number of states written to the file so far.
+             */
+            uint64_t getNumberOfStoredStates() const;
+
+        private:
+            std::FILE* file = nullptr;
+            // Position at which the next state is written.
+            uint64_t endPosition = 0;
+            uint64_t numberOfStoredStates = 0;
+        };
+
+    }
+}
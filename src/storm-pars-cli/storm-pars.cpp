@@ -706,8 +706,12 @@ namespace storm {
                     if (regionSettings.isDepthLimitSet()) {
                         optionalDepthLimit = regionSettings.getDepthLimit();
                     }
+                    boost::optional<uint64_t> optionalPendingCap;
+                    if (regionSettings.isRefinementPendingCapSet()) {
+                        optionalPendingCap = regionSettings.getRefinementPendingCap();
+                    }
                     // TODO @Jip: change allow model simplification when not using monotonicity, for benchmarking purposes simplification is moved forward.
-                    std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> result = storm::api::checkAndRefineRegionWithSparseEngine<ValueType>(model, storm::api::createTask<ValueType>(formula, true), regions.front(), engine, refinementThreshold, optionalDepthLimit, regionSettings.getHypothesis(), false, monotonicitySettings, monThresh);
+                    std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> result = storm::api::checkAndRefineRegionWithSparseEngine<ValueType>(model, storm::api::createTask<ValueType>(formula, true), regions.front(), engine, refinementThreshold, optionalDepthLimit, regionSettings.getHypothesis(), false, monotonicitySettings, monThresh, regionSettings.getNumberOfRefinementWorkers(), optionalPendingCap);
                     return result;
                 };
             } else {
@@ -725,6 +729,24 @@ namespace storm {
             };
 
             verifyProperties<ValueType>(input.properties, verificationCallback, postprocessingCallback);
+
+            // Shields are created for each of the given regions (not for the subregions obtained by refinement).
+            for (auto const& property : input.properties) {
+                if (!property.isShieldingProperty()) {
+                    continue;
+                }
+                for (uint64_t regionIndex = 0; regionIndex < regions.size(); ++regionIndex) {
+                    auto shieldingExpression = std::make_shared<storm::logic::ShieldExpression>(*property.getShieldingExpression());
+                    if (regions.size() > 1) {
+                        // Avoid that the shields of the different regions overwrite each other.
+                        shieldingExpression->setFilename(shieldingExpression->getFilename() + "_region" + std::to_string(regionIndex));
+                    }
+                    STORM_PRINT_AND_LOG("Creating " << shieldingExpression->typeToString() << " shield for " << *property.getRawFormula() << " on parameter region " << regions[regionIndex] << "." << std::endl);
+                    auto task = storm::api::createTask<ValueType>(property.getRawFormula(), true);
+                    task.setShieldingExpression(shieldingExpression);
+                    storm::api::createShieldForRegion<ValueType>(storm::Environment(), model, task, regions[regionIndex]);
+                }
+            }
         }
 
         template <typename ValueType>
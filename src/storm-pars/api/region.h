@@ -11,6 +11,7 @@
 #include "storm-pars/modelchecker/region/RegionCheckEngine.h"
 #include "storm-pars/modelchecker/region/SparseDtmcParameterLiftingModelChecker.h"
 #include "storm-pars/modelchecker/region/SparseMdpParameterLiftingModelChecker.h"
+#include "storm-pars/modelchecker/region/SparseSmgParameterLiftingModelChecker.h"
 #include "storm-pars/modelchecker/region/ValidatingSparseMdpParameterLiftingModelChecker.h"
 #include "storm-pars/modelchecker/region/ValidatingSparseDtmcParameterLiftingModelChecker.h"
 #include "storm-pars/modelchecker/region/RegionResultHypothesis.h"
@@ -18,12 +19,19 @@
 #include "storm-pars/parser/MonotonicityParser.h"
 #include "storm-pars/storage/ParameterRegion.h"
 #include "storm-pars/utility/parameterlifting.h"
+#include "storm-pars/utility/parametric.h"
 
 #include "storm/environment/Environment.h"
 
 #include "storm/api/transformation.h"
 #include "storm/io/file.h"
 #include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Smg.h"
+#include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/exceptions/UnexpectedException.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -146,6 +154,9 @@ namespace storm {
             } else if (consideredModel->isOfType(storm::models::ModelType::Mdp)) {
                 STORM_LOG_WARN_COND(!monotonicitySetting.useMonotonicity, "Usage of monotonicity not supported for this type of model, continuing without montonicity checking");
                 checker = std::make_shared<storm::modelchecker::SparseMdpParameterLiftingModelChecker<storm::models::sparse::Mdp<ParametricType>, ConstantType>>();
+            } else if (consideredModel->isOfType(storm::models::ModelType::Smg)) {
+                STORM_LOG_WARN_COND(!monotonicitySetting.useMonotonicity, "Usage of monotonicity not supported for this type of model, continuing without montonicity checking");
+                checker = std::make_shared<storm::modelchecker::SparseSmgParameterLiftingModelChecker<storm::models::sparse::Smg<ParametricType>, ConstantType>>();
             } else {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Unable to perform parameterLifting on the provided model type.");
             }
@@ -219,6 +230,59 @@ namespace storm {
             return checkRegionsWithSparseEngine(model, task, regions, engine, hypotheses, sampleVerticesOfRegions);
         }
     
+        /*!
+         * Copies the given parametric model such that the functions of the copy are stored in a separate polynomial cache.
+         * The copy can thus be analyzed concurrently to the given model.
+         */
+        template <typename ValueType>
+        std::shared_ptr<storm::models::sparse::Model<ValueType>> copyModelWithSeparatePolynomialCache(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model) {
+            std::shared_ptr<storm::models::sparse::Model<ValueType>> result;
+            auto cache = std::make_shared<storm::RawPolynomialCache>();
+            auto copyFunctions = [&cache] (std::vector<ValueType>& functions) {
+                for (auto& function : functions) {
+                    function = storm::utility::parametric::copyWithCache(function, cache);
+                }
+            };
+            switch (model->getType()) {
+                case storm::models::ModelType::Dtmc:
+                    result = std::make_shared<storm::models::sparse::Dtmc<ValueType>>(*model->template as<storm::models::sparse::Dtmc<ValueType>>());
+                    break;
+                case storm::models::ModelType::Mdp:
+                    result = std::make_shared<storm::models::sparse::Mdp<ValueType>>(*model->template as<storm::models::sparse::Mdp<ValueType>>());
+                    break;
+                case storm::models::ModelType::Smg:
+                    result = std::make_shared<storm::models::sparse::Smg<ValueType>>(*model->template as<storm::models::sparse::Smg<ValueType>>());
+                    break;
+                case storm::models::ModelType::Ctmc:
+                    result = std::make_shared<storm::models::sparse::Ctmc<ValueType>>(*model->template as<storm::models::sparse::Ctmc<ValueType>>());
+                    copyFunctions(result->template as<storm::models::sparse::Ctmc<ValueType>>()->getExitRateVector());
+                    break;
+                case storm::models::ModelType::MarkovAutomaton:
+                    result = std::make_shared<storm::models::sparse::MarkovAutomaton<ValueType>>(*model->template as<storm::models::sparse::MarkovAutomaton<ValueType>>());
+                    copyFunctions(result->template as<storm::models::sparse::MarkovAutomaton<ValueType>>()->getExitRates());
+                    break;
+                default:
+                    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Copying models of type " << model->getType() << " is not supported.");
+            }
+            for (auto& entry : result->getTransitionMatrix()) {
+                entry.setValue(storm::utility::parametric::copyWithCache(entry.getValue(), cache));
+            }
+            for (auto& rewardModel : result->getRewardModels()) {
+                if (rewardModel.second.hasStateRewards()) {
+                    copyFunctions(rewardModel.second.getStateRewardVector());
+                }
+                if (rewardModel.second.hasStateActionRewards()) {
+                    copyFunctions(rewardModel.second.getStateActionRewardVector());
+                }
+                if (rewardModel.second.hasTransitionRewards()) {
+                    for (auto& entry : rewardModel.second.getTransitionRewardMatrix()) {
+                        entry.setValue(storm::utility::parametric::copyWithCache(entry.getValue(), cache));
+                    }
+                }
+            }
+            return result;
+        }
+
         /*!
          * Checks and iteratively refines the given region with the sparse engine
          * @param engine The considered region checking engine
@@ -228,14 +292,37 @@ namespace storm {
          * @param allowModelSimplification
          * @param useMonotonicity
          * @param monThresh if given, determines at which depth to start using monotonicity
+         * @param numberOfWorkers the number of regions that are analyzed in parallel (each with its own region model checker and its own copy of the model)
+         * @param maxNumberOfPendingRegions if given, caps the number of regions that wait for being analyzed (see RegionModelChecker::setMaxNumberOfPendingRegions)
          */
         template <typename ValueType>
-        std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> checkAndRefineRegionWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, storm::storage::ParameterRegion<ValueType> const& region, storm::modelchecker::RegionCheckEngine engine, boost::optional<ValueType> const& coverageThreshold, boost::optional<uint64_t> const& refinementDepthThreshold = boost::none, storm::modelchecker::RegionResultHypothesis hypothesis = storm::modelchecker::RegionResultHypothesis::Unknown, bool allowModelSimplification = true, MonotonicitySetting monotonicitySetting = MonotonicitySetting(), uint64_t monThresh = 0) {
+        std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> checkAndRefineRegionWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, storm::storage::ParameterRegion<ValueType> const& region, storm::modelchecker::RegionCheckEngine engine, boost::optional<ValueType> const& coverageThreshold, boost::optional<uint64_t> const& refinementDepthThreshold = boost::none, storm::modelchecker::RegionResultHypothesis hypothesis = storm::modelchecker::RegionResultHypothesis::Unknown, bool allowModelSimplification = true, MonotonicitySetting monotonicitySetting = MonotonicitySetting(), uint64_t monThresh = 0, uint64_t numberOfWorkers = 1, boost::optional<uint64_t> const& maxNumberOfPendingRegions = boost::none) {
             Environment env;
             auto regionChecker = initializeRegionModelChecker(env, model, task, engine, true, allowModelSimplification, monotonicitySetting);
+            if (numberOfWorkers > 1) {
+                // Each worker operates on its own copy of the model, so the rational functions of different workers can be evaluated concurrently.
+                regionChecker->setParallelRefinement(numberOfWorkers, [&] () { return initializeRegionModelChecker(env, copyModelWithSeparatePolynomialCache(model), task, engine, true, allowModelSimplification, monotonicitySetting); });
+            }
+            regionChecker->setMaxNumberOfPendingRegions(maxNumberOfPendingRegions);
             return regionChecker->performRegionRefinement(env, region, coverageThreshold, refinementDepthThreshold, hypothesis, monThresh);
         }
 
+        /*!
+         * Creates a shield for the game formula of the given task that is sound for every instantiation of the given region.
+         * The shield is written to the file given by the shielding expression of the task.
+         * @param model A parametric SMG
+         * @param task A shielding task with a game formula (currently, only unbounded reachability is supported)
+         */
+        template <typename ParametricType, typename ConstantType = double>
+        void createShieldForRegion(Environment const& env, std::shared_ptr<storm::models::sparse::Model<ParametricType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ParametricType> const& task, storm::storage::ParameterRegion<ParametricType> const& region) {
+            STORM_LOG_THROW(task.isShieldingTask(), storm::exceptions::InvalidOperationException, "Can not create a shield without a shielding expression.");
+            STORM_LOG_THROW(model->isOfType(storm::models::ModelType::Smg), storm::exceptions::NotSupportedException, "Shields for parameter regions can only be created for SMGs.");
+            storm::modelchecker::SparseSmgParameterLiftingModelChecker<storm::models::sparse::Smg<ParametricType>, ConstantType> checker;
+            STORM_LOG_THROW(checker.canHandle(model, task), storm::exceptions::NotSupportedException, "Can not create a shield for the formula " << task.getFormula() << " on a parameter region.");
+            checker.specify(env, model, task, false, false);
+            checker.createShield(env, region, task.getShieldingExpression());
+        }
+
         // TODO: update documentation
         /*!
          * Finds the extremal value in the given region
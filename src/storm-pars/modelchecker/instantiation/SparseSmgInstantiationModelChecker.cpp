@@ -0,0 +1,216 @@
+#include "storm-pars/modelchecker/instantiation/SparseSmgInstantiationModelChecker.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "storm-pars/api/region.h"
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidStateException.h"
+
+namespace storm {
+    namespace modelchecker {
+
+        template <typename SparseModelType, typename ConstantType>
+        SparseSmgInstantiationModelChecker<SparseModelType, ConstantType>::SparseSmgInstantiationModelChecker(SparseModelType const& parametricModel) : SparseInstantiationModelChecker<SparseModelType, ConstantType>(parametricModel), modelInstantiator(parametricModel), produceShieldPerInstantiation(false), numberOfCheckedInstantiations(0) {
+            //Intentionally left empty
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        std::unique_ptr<CheckResult> SparseSmgInstantiationModelChecker<SparseModelType, ConstantType>::check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) {
+            STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
+            boost::optional<uint64_t> shieldIndex;
+            if (produceShieldPerInstantiation) {
+                shieldIndex = numberOfCheckedInstantiations;
+            }
+            ++numberOfCheckedInstantiations;
+            return check(env, modelInstantiator, *this->currentCheckTask, valuation, shieldIndex);
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        std::vector<std::unique_ptr<CheckResult>> SparseSmgInstantiationModelChecker<SparseModelType, ConstantType>::check(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) {
+            STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
+            std::vector<std::unique_ptr<CheckResult>> results(valuations.size());
+            if (valuations.empty()) {
+                return results;
+            }
+
+            // The first valuation is checked sequentially such that the qualitative analysis is done before the workers
+            // are started and all of them can start from its result.
+            uint64_t firstIndex = numberOfCheckedInstantiations;
+            results.front() = check(env, valuations.front());
+            numberOfCheckedInstantiations = firstIndex + valuations.size();
+
+            uint64_t numberOfChunks = std::max<uint64_t>(1, std::min<uint64_t>(valuations.size() - 1, getNumberOfThreads()));
+            uint64_t chunkSize = (valuations.size() - 1 + numberOfChunks - 1) / numberOfChunks;
+
+            // The functions of a model share carl's polynomial cache, which is not thread-safe. Hence, all but the first
+            // chunk work on a copy of the model with a separate cache. The copies are created before the chunks are
+            // started, as copying reads the cache of the given model.
+            std::vector<std::shared_ptr<storm::models::sparse::Model<typename SparseModelType::ValueType>>> chunkModels;
+            if (numberOfChunks > 1) {
+                auto model = std::make_shared<SparseModelType>(this->parametricModel);
+                for (uint64_t chunk = 1; chunk < numberOfChunks; ++chunk) {
+                    chunkModels.push_back(storm::api::copyModelWithSeparatePolynomialCache<typename SparseModelType::ValueType>(model));
+                }
+            }
+
+            // Each chunk gets its own model, instantiator and check task (and hence hint), so the chunks do not share any mutable state.
+            auto checkChunk = [&] (uint64_t chunk) {
+                uint64_t begin = 1 + chunk * chunkSize;
+                uint64_t end = std::min<uint64_t>(valuations.size(), begin + chunkSize);
+                if (begin >= end) {
+                    return;
+                }
+                SparseModelType const& chunkModel = chunk == 0 ? this->parametricModel : *chunkModels[chunk - 1]->template as<SparseModelType>();
+                storm::utility::ModelInstantiator<SparseModelType, ConstantModelType> instantiator(chunkModel);
+                CheckTask<storm::logic::Formula, ConstantType> checkTask = *this->currentCheckTask;
+                if (this->currentCheckTask->getHint().isExplicitModelCheckerHint()) {
+                    checkTask.setHint(std::make_shared<ExplicitModelCheckerHint<ConstantType>>(this->currentCheckTask->getHint().template asExplicitModelCheckerHint<ConstantType>()));
+                } else {
+                    checkTask.setHint(std::make_shared<ModelCheckerHint>());
+                }
+                for (uint64_t index = begin; index < end; ++index) {
+                    boost::optional<uint64_t> shieldIndex;
+                    if (produceShieldPerInstantiation) {
+                        shieldIndex = firstIndex + index;
+                    }
+                    results[index] = check(env, instantiator, checkTask, valuations[index], shieldIndex);
+                }
+            };
+
+            if (numberOfChunks > 1) {
+#ifdef STORM_HAVE_INTELTBB
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfChunks, 1), [&] (tbb::blocked_range<uint64_t> const& range) {
+                    for (uint64_t chunk = range.begin(); chunk < range.end(); ++chunk) {
+                        checkChunk(chunk);
+                    }
+                });
+#else
+                std::vector<std::thread> threads;
+                for (uint64_t chunk = 1; chunk < numberOfChunks; ++chunk) {
+                    threads.emplace_back(checkChunk, chunk);
+                }
+                checkChunk(0);
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+#endif
+            } else {
+                checkChunk(0);
+            }
+            return results;
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        std::unique_ptr<CheckResult> SparseSmgInstantiationModelChecker<SparseModelType, ConstantType>::check(Environment const& env, storm::utility::ModelInstantiator<SparseModelType, ConstantModelType>& instantiator, CheckTask<storm::logic::Formula, ConstantType>& checkTask, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation, boost::optional<uint64_t> const& shieldIndex) {
+            auto const& instantiatedModel = instantiator.instantiate(valuation);
+            STORM_LOG_THROW(instantiatedModel.getTransitionMatrix().isProbabilistic(), storm::exceptions::InvalidArgumentException, "Instantiation point is invalid as the transition matrix becomes non-stochastic.");
+            storm::modelchecker::SparseSmgRpatlModelChecker<ConstantModelType> modelChecker(instantiatedModel);
+
+            bool isReachabilityFormula = isReachabilityGameFormula(checkTask.getFormula());
+            if (isReachabilityFormula && !checkTask.getHint().isExplicitModelCheckerHint()) {
+                checkTask.setHint(std::make_shared<ExplicitModelCheckerHint<ConstantType>>());
+            }
+
+            // The copy of the check task shares the hint with the given one.
+            CheckTask<storm::logic::Formula, ConstantType> instantiationTask = checkTask;
+            if (shieldIndex && checkTask.isShieldingTask()) {
+                auto shieldingExpression = std::make_shared<storm::logic::ShieldExpression>(*checkTask.getShieldingExpression());
+                shieldingExpression->setFilename(shieldingExpression->getFilename() + "_" + std::to_string(shieldIndex.get()));
+                instantiationTask.setShieldingExpression(shieldingExpression);
+            }
+
+            if (!isReachabilityFormula) {
+                return modelChecker.check(env, instantiationTask);
+            }
+
+            ExplicitModelCheckerHint<ConstantType>& hint = checkTask.getHint().template asExplicitModelCheckerHint<ConstantType>();
+            if (this->getInstantiationsAreGraphPreserving() && !hint.hasMaybeStates()) {
+                performQualitativeAnalysis(env, modelChecker, instantiatedModel, hint);
+            }
+
+            std::unique_ptr<CheckResult> result = modelChecker.check(env, instantiationTask);
+            // Store the values as a starting point for the next instantiation.
+            // If the formula has a bound, the result is qualitative and the next instantiation starts from scratch.
+            if (result->isExplicitQuantitativeCheckResult()) {
+                hint.setResultHint(result->template asExplicitQuantitativeCheckResult<ConstantType>().getValueVector());
+            }
+            return result;
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        bool SparseSmgInstantiationModelChecker<SparseModelType, ConstantType>::isReachabilityGameFormula(storm::logic::Formula const& formula) const {
+            if (!formula.isGameFormula() || !formula.asGameFormula().getSubformula().isProbabilityOperatorFormula()) {
+                return false;
+            }
+            storm::logic::Formula const& pathFormula = formula.asGameFormula().getSubformula().asProbabilityOperatorFormula().getSubformula();
+            return pathFormula.isReachabilityProbabilityFormula() || pathFormula.isUntilFormula();
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        void SparseSmgInstantiationModelChecker<SparseModelType, ConstantType>::performQualitativeAnalysis(Environment const& env, storm::modelchecker::SparseSmgRpatlModelChecker<ConstantModelType>& modelChecker, ConstantModelType const& instantiatedModel, ExplicitModelCheckerHint<ConstantType>& hint) const {
+            storm::logic::Formula const& pathFormula = this->currentCheckTask->getFormula().asGameFormula().getSubformula().asProbabilityOperatorFormula().getSubformula();
+            storm::storage::BitVector phiStates(instantiatedModel.getNumberOfStates(), true);
+            storm::storage::BitVector psiStates;
+            if (pathFormula.isUntilFormula()) {
+                phiStates = modelChecker.check(env, pathFormula.asUntilFormula().getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                psiStates = modelChecker.check(env, pathFormula.asUntilFormula().getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            } else {
+                psiStates = modelChecker.check(env, pathFormula.asEventuallyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            }
+
+            // The states that can not reach a psi state have probability zero, no matter what the players do.
+            storm::storage::BitVector maybeStates = storm::utility::graph::performProbGreater0(instantiatedModel.getBackwardTransitions(), phiStates, psiStates) & ~psiStates;
+            hint.setMaybeStates(std::move(maybeStates));
+            hint.setComputeOnlyMaybeStates(true);
+
+            // Without end components within the maybe states, value iteration converges from any starting point.
+            if (storm::utility::graph::performProb1A(instantiatedModel.getTransitionMatrix(), instantiatedModel.getTransitionMatrix().getRowGroupIndices(), instantiatedModel.getBackwardTransitions(), hint.getMaybeStates(), ~hint.getMaybeStates()).full()) {
+                hint.setNoEndComponentsInMaybeStates(true);
+            }
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        void SparseSmgInstantiationModelChecker<SparseModelType, ConstantType>::setProduceShieldPerInstantiation(bool value) {
+            produceShieldPerInstantiation = value;
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        bool SparseSmgInstantiationModelChecker<SparseModelType, ConstantType>::isProduceShieldPerInstantiationSet() const {
+            return produceShieldPerInstantiation;
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        void SparseSmgInstantiationModelChecker<SparseModelType, ConstantType>::setNumberOfThreads(uint64_t value) {
+            STORM_LOG_THROW(value > 0, storm::exceptions::InvalidArgumentException, "The number of threads must be positive.");
+            numberOfThreads = value;
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        uint64_t SparseSmgInstantiationModelChecker<SparseModelType, ConstantType>::getNumberOfThreads() const {
+            if (numberOfThreads) {
+                return numberOfThreads.get();
+            }
+#ifdef STORM_HAVE_INTELTBB
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+                return std::max<uint64_t>(1, std::thread::hardware_concurrency());
+            }
+#endif
+            return 1;
+        }
+
+        template class SparseSmgInstantiationModelChecker<storm::models::sparse::Smg<storm::RationalFunction>, double>;
+        template class SparseSmgInstantiationModelChecker<storm::models::sparse::Smg<storm::RationalFunction>, storm::RationalNumber>;
+
+    }
+}
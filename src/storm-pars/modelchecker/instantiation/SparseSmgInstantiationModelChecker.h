@@ -0,0 +1,85 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm-pars/modelchecker/instantiation/SparseInstantiationModelChecker.h"
+#include "storm-pars/utility/ModelInstantiator.h"
+#include "storm/models/sparse/Smg.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+
+namespace storm {
+    namespace modelchecker {
+
+        /*!
+         * Class to efficiently check a formula on a parametric stochastic multiplayer game with different parameter
+         * instantiations, e.g. to sweep over the parameter space when synthesizing shields.
+         *
+         * The structure of the game and the player indications are shared among all instantiations. If the
+         * instantiations are graph preserving, the qualitative analysis of reachability objectives is performed only
+         * once and the value iteration for an instantiation starts from the result of the previously checked one.
+         */
+        template <typename SparseModelType, typename ConstantType>
+        class SparseSmgInstantiationModelChecker : public SparseInstantiationModelChecker<SparseModelType, ConstantType> {
+        public:
+            SparseSmgInstantiationModelChecker(SparseModelType const& parametricModel);
+
+            virtual std::unique_ptr<CheckResult> check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) override;
+
+            /*!
+             * Checks the specified formula for each of the given valuations. The valuations are split into contiguous
+             * chunks that are processed in parallel (see setNumberOfThreads). Within each chunk, the instantiations
+             * warm-start each other. The results are in the order of the given valuations.
+             */
+            std::vector<std::unique_ptr<CheckResult>> check(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations);
+
+            /*!
+             * If set and the specified formula has a shielding expression, a shield is created for every checked
+             * instantiation. The shield of the i-th checked instantiation is written to a file with the suffix "_i".
+             */
+            void setProduceShieldPerInstantiation(bool value);
+            bool isProduceShieldPerInstantiationSet() const;
+
+            /*!
+             * Sets the number of threads that check the valuations given to a single call of check. If not set, all
+             * hardware threads are used if Intel TBB is enabled and a single thread otherwise.
+             */
+            void setNumberOfThreads(uint64_t value);
+
+        protected:
+            typedef storm::models::sparse::Smg<ConstantType> ConstantModelType;
+
+            /*!
+             * Checks the given valuation using the given instantiator and check task. The hint of the check task is
+             * updated such that it can be used for the next valuation.
+             *
+             * @param shieldIndex If given, the shield (if any) is written to a file with this index as suffix.
+             */
+            std::unique_ptr<CheckResult> check(Environment const& env, storm::utility::ModelInstantiator<SparseModelType, ConstantModelType>& instantiator, CheckTask<storm::logic::Formula, ConstantType>& checkTask, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation, boost::optional<uint64_t> const& shieldIndex);
+
+            /*!
+             * Retrieves whether the formula asks for the probability of a coalition to satisfy an (unbounded) until or
+             * eventually formula, i.e. whether the qualitative analysis and the warm start can be applied.
+             */
+            bool isReachabilityGameFormula(storm::logic::Formula const& formula) const;
+
+            /*!
+             * Computes the maybe states, i.e. the states from which the psi states can be reached while staying in the
+             * phi states. This does neither depend on the strategies of the players nor on the (graph preserving)
+             * instantiation. The result is stored in the given hint.
+             */
+            void performQualitativeAnalysis(Environment const& env, storm::modelchecker::SparseSmgRpatlModelChecker<ConstantModelType>& modelChecker, ConstantModelType const& instantiatedModel, ExplicitModelCheckerHint<ConstantType>& hint) const;
+
+            uint64_t getNumberOfThreads() const;
+
+            storm::utility::ModelInstantiator<SparseModelType, ConstantModelType> modelInstantiator;
+            bool produceShieldPerInstantiation;
+            uint64_t numberOfCheckedInstantiations;
+            boost::optional<uint64_t> numberOfThreads;
+        };
+    }
+}
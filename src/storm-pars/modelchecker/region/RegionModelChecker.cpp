@@ -1,10 +1,12 @@
 #include <sstream>
 #include <queue>
+#include <atomic>
 
 #include "storm-pars/analysis/OrderExtender.cpp"
 #include "storm-pars/modelchecker/region/RegionModelChecker.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/sparse/Dtmc.h"
@@ -61,12 +63,13 @@ namespace storm {
                 // The resulting (sub-)regions
                 std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> result;
                 
-                // FIFO queues storing the data for the regions that we still need to process.
-                std::queue<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> unprocessedRegions;
+                // Queues storing the data for the regions that we still need to process.
+                // Regions are usually processed in FIFO order, but subregions are put in front if the number of pending regions is limited.
+                std::deque<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> unprocessedRegions;
 
-                std::queue<uint64_t> refinementDepths;
-                unprocessedRegions.emplace(region, RegionResult::Unknown);
-                refinementDepths.push(0);
+                std::deque<uint64_t> refinementDepths;
+                unprocessedRegions.emplace_back(region, RegionResult::Unknown);
+                refinementDepths.push_back(0);
 
                 uint_fast64_t numOfAnalyzedRegions = 0;
                 CoefficientType displayedProgress = storm::utility::zero<CoefficientType>();
@@ -85,57 +88,93 @@ namespace storm {
                 }
 
                 // NORMAL WHILE LOOP
+                // The regions are analyzed in batches. Without parallel refinement and without a limit on the pending regions, a batch consists of a single region.
+                // As the regions of a batch are analyzed independently of each other and their results are merged in order, the result does not depend on the batch size (unless subregions are put in front).
+                uint64_t batchSize = (numberOfRefinementWorkers > 1 || maxNumberOfPendingRegions) ? refinementBatchSize : 1;
                 uint64_t currentDepth = refinementDepths.front();
                 while ((!useMonotonicity || currentDepth < monThresh) && fractionOfUndiscoveredArea > thresholdAsCoefficient && !unprocessedRegions.empty()) {
                     assert(unprocessedRegions.size() == refinementDepths.size());
-                    STORM_LOG_INFO("Analyzing region #" << numOfAnalyzedRegions << " (Refinement depth " << currentDepth << "; " << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
-                    auto& currentRegion = unprocessedRegions.front().first;
-                    auto& res = unprocessedRegions.front().second;
-                    std::shared_ptr<storm::analysis::Order> order;
-                    std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult;
-                    res = analyzeRegion(env, currentRegion, hypothesis, res, false);
-
-                    switch (res) {
-                        case RegionResult::AllSat:
-                            fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
-                            fractionOfAllSatArea += currentRegion.area() / areaOfParameterSpace;
-                            result.push_back(std::move(unprocessedRegions.front()));
-                            break;
-                        case RegionResult::AllViolated:
-                            fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
-                            fractionOfAllViolatedArea += currentRegion.area() / areaOfParameterSpace;
-                            result.push_back(std::move(unprocessedRegions.front()));
-                            break;
-                        default:
-                            // Split the region as long as the desired refinement depth is not reached.
-                            if (!depthThreshold || currentDepth < depthThreshold.get()) {
-                                std::vector<storm::storage::ParameterRegion<ParametricType>> newRegions;
-                                RegionResult initResForNewRegions = (res == RegionResult::CenterSat) ? RegionResult::ExistsSat :
-                                                                    ((res == RegionResult::CenterViolated) ? RegionResult::ExistsViolated :
-                                                                     RegionResult::Unknown);
+                    uint64_t numberOfRegionsInBatch = 0;
+                    while (numberOfRegionsInBatch < std::min<uint64_t>(batchSize, unprocessedRegions.size()) && (!useMonotonicity || refinementDepths[numberOfRegionsInBatch] < monThresh)) {
+                        ++numberOfRegionsInBatch;
+                    }
+                    std::vector<RegionResult> batchResults = analyzeRegionBatch(env, unprocessedRegions, numberOfRegionsInBatch, hypothesis);
+
+                    std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> batch(std::make_move_iterator(unprocessedRegions.begin()), std::make_move_iterator(unprocessedRegions.begin() + numberOfRegionsInBatch));
+                    std::vector<uint64_t> batchDepths(refinementDepths.begin(), refinementDepths.begin() + numberOfRegionsInBatch);
+                    unprocessedRegions.erase(unprocessedRegions.begin(), unprocessedRegions.begin() + numberOfRegionsInBatch);
+                    refinementDepths.erase(refinementDepths.begin(), refinementDepths.begin() + numberOfRegionsInBatch);
+
+                    // Subregions that are processed before the other pending regions.
+                    std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> subregionsToProcessFirst;
+                    std::vector<uint64_t> subregionDepthsToProcessFirst;
+
+                    uint64_t batchIndex = 0;
+                    for (; batchIndex < numberOfRegionsInBatch && fractionOfUndiscoveredArea > thresholdAsCoefficient; ++batchIndex) {
+                        currentDepth = batchDepths[batchIndex];
+                        STORM_LOG_INFO("Analyzing region #" << numOfAnalyzedRegions << " (Refinement depth " << currentDepth << "; " << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
+                        auto& currentRegion = batch[batchIndex].first;
+                        auto& res = batch[batchIndex].second;
+                        res = batchResults[batchIndex];
+
+                        switch (res) {
+                            case RegionResult::AllSat:
+                                fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
+                                fractionOfAllSatArea += currentRegion.area() / areaOfParameterSpace;
+                                result.push_back(std::move(batch[batchIndex]));
+                                break;
+                            case RegionResult::AllViolated:
+                                fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
+                                fractionOfAllViolatedArea += currentRegion.area() / areaOfParameterSpace;
+                                result.push_back(std::move(batch[batchIndex]));
+                                break;
+                            default:
+                                // Split the region as long as the desired refinement depth is not reached.
+                                if (!depthThreshold || currentDepth < depthThreshold.get()) {
+                                    std::vector<storm::storage::ParameterRegion<ParametricType>> newRegions;
+                                    RegionResult initResForNewRegions = (res == RegionResult::CenterSat) ? RegionResult::ExistsSat :
+                                                                        ((res == RegionResult::CenterViolated) ? RegionResult::ExistsViolated :
+                                                                         RegionResult::Unknown);
+
+                                    currentRegion.split(currentRegion.getCenterPoint(), newRegions);
+                                    bool processFirst = maxNumberOfPendingRegions && unprocessedRegions.size() + subregionsToProcessFirst.size() + newRegions.size() > maxNumberOfPendingRegions.get();
+                                    for (auto& newRegion : newRegions) {
+                                        if (processFirst) {
+                                            subregionsToProcessFirst.emplace_back(std::move(newRegion), initResForNewRegions);
+                                            subregionDepthsToProcessFirst.push_back(currentDepth + 1);
+                                        } else {
+                                            unprocessedRegions.emplace_back(std::move(newRegion), initResForNewRegions);
+                                            refinementDepths.push_back(currentDepth + 1);
+                                        }
+                                    }
 
-                                currentRegion.split(currentRegion.getCenterPoint(), newRegions);
-                                for (auto& newRegion : newRegions) {
-                                    unprocessedRegions.emplace(std::move(newRegion), initResForNewRegions);
-                                    refinementDepths.push(currentDepth + 1);
+                                } else {
+                                    // If the region is not further refined, it is still added to the result
+                                    result.push_back(std::move(batch[batchIndex]));
                                 }
-
-                            } else {
-                                // If the region is not further refined, it is still added to the result
-                                result.push_back(std::move(unprocessedRegions.front()));
+                                break;
+                        }
+                        ++numOfAnalyzedRegions;
+                        if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+                            while (displayedProgress < storm::utility::one<CoefficientType>() - fractionOfUndiscoveredArea) {
+                                STORM_PRINT_AND_LOG("#");
+                                displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
                             }
-                            break;
-                    }
-                    ++numOfAnalyzedRegions;
-                    unprocessedRegions.pop();
-                    refinementDepths.pop();
-                    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
-                        while (displayedProgress < storm::utility::one<CoefficientType>() - fractionOfUndiscoveredArea) {
-                            STORM_PRINT_AND_LOG("#");
-                            displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
                         }
                     }
-                    currentDepth = refinementDepths.front();
+
+                    // The subregions to process first are put in front of the queue, preceded by the regions of the batch whose result has not been needed.
+                    for (uint64_t index = subregionsToProcessFirst.size(); index > 0; --index) {
+                        unprocessedRegions.push_front(std::move(subregionsToProcessFirst[index - 1]));
+                        refinementDepths.push_front(subregionDepthsToProcessFirst[index - 1]);
+                    }
+                    for (uint64_t index = numberOfRegionsInBatch; index > batchIndex; --index) {
+                        unprocessedRegions.push_front(std::move(batch[index - 1]));
+                        refinementDepths.push_front(batchDepths[index - 1]);
+                    }
+                    if (!unprocessedRegions.empty()) {
+                        currentDepth = refinementDepths.front();
+                    }
                 }
 
                 // FIFO queues for the order and local monotonicity results
@@ -269,8 +308,8 @@ namespace storm {
                                             }
                                         }
                                     }
-                                    unprocessedRegions.emplace(std::move(newRegion), initResForNewRegions);
-                                    refinementDepths.push(currentDepth + 1);
+                                    unprocessedRegions.emplace_back(std::move(newRegion), initResForNewRegions);
+                                    refinementDepths.push_back(currentDepth + 1);
                                 }
                             } else {
                                 // If the region is not further refined, it is still added to the result
@@ -280,8 +319,8 @@ namespace storm {
                     }
 
                     ++numOfAnalyzedRegions;
-                    unprocessedRegions.pop();
-                    refinementDepths.pop();
+                    unprocessedRegions.pop_front();
+                    refinementDepths.pop_front();
                     if (!useSameOrder) {
                         orders.pop();
                     }
@@ -300,7 +339,7 @@ namespace storm {
                 // Add the still unprocessed regions to the result
                 while (!unprocessedRegions.empty()) {
                     result.push_back(std::move(unprocessedRegions.front()));
-                    unprocessedRegions.pop();
+                    unprocessedRegions.pop_front();
                 }
                 
                 if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
@@ -398,6 +437,56 @@ namespace storm {
             this->useOnlyGlobal = global;
         }
 
+        template <typename ParametricType>
+        void RegionModelChecker<ParametricType>::setParallelRefinement(uint64_t numberOfWorkers, std::function<std::shared_ptr<RegionModelChecker<ParametricType>>()> const& workerFactory) {
+            STORM_LOG_THROW(numberOfWorkers > 0, storm::exceptions::InvalidArgumentException, "The number of refinement workers has to be positive.");
+#ifdef STORM_HAVE_INTELTBB
+            this->numberOfRefinementWorkers = numberOfWorkers;
+#else
+            STORM_LOG_WARN_COND(numberOfWorkers == 1, "Parallel region refinement requires Intel TBB. Regions are analyzed sequentially.");
+            this->numberOfRefinementWorkers = 1;
+#endif
+            this->refinementWorkerFactory = workerFactory;
+            this->refinementWorkers.clear();
+        }
+
+        template <typename ParametricType>
+        void RegionModelChecker<ParametricType>::setMaxNumberOfPendingRegions(boost::optional<uint64_t> const& maxNumberOfPendingRegions) {
+            this->maxNumberOfPendingRegions = maxNumberOfPendingRegions;
+        }
+
+        template <typename ParametricType>
+        std::vector<RegionResult> RegionModelChecker<ParametricType>::analyzeRegionBatch(Environment const& env, std::deque<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> const& regions, uint64_t numberOfRegions, RegionResultHypothesis const& hypothesis) {
+            STORM_LOG_ASSERT(numberOfRegions <= regions.size(), "Batch exceeds the number of pending regions.");
+            std::vector<RegionResult> results(numberOfRegions, RegionResult::Unknown);
+#ifdef STORM_HAVE_INTELTBB
+            uint64_t numberOfWorkers = std::min<uint64_t>(numberOfRefinementWorkers, numberOfRegions);
+            if (numberOfWorkers > 1) {
+                // The checkers of the workers are created sequentially since the factory copies the rational functions of the model.
+                while (refinementWorkers.size() + 1 < numberOfWorkers) {
+                    refinementWorkers.push_back(refinementWorkerFactory());
+                    STORM_LOG_THROW(refinementWorkers.back(), storm::exceptions::InvalidArgumentException, "Unable to create a checker for a refinement worker.");
+                }
+
+                // Each worker repeatedly takes the next region that has not been taken yet, so workers that finish early take over the remaining regions.
+                std::atomic<uint64_t> nextRegion(0);
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfWorkers, 1), [&] (tbb::blocked_range<uint64_t> const& range) {
+                    for (uint64_t worker = range.begin(); worker < range.end(); ++worker) {
+                        RegionModelChecker<ParametricType>& checker = (worker == 0) ? *this : *refinementWorkers[worker - 1];
+                        for (uint64_t index = nextRegion++; index < numberOfRegions; index = nextRegion++) {
+                            results[index] = checker.analyzeRegion(env, regions[index].first, hypothesis, regions[index].second, false);
+                        }
+                    }
+                });
+                return results;
+            }
+#endif
+            for (uint64_t index = 0; index < numberOfRegions; ++index) {
+                results[index] = analyzeRegion(env, regions[index].first, hypothesis, regions[index].second, false);
+            }
+            return results;
+        }
+
         template <typename ParametricType>
         void RegionModelChecker<ParametricType>::splitSmart(storm::storage::ParameterRegion<ParametricType> & currentRegion, std::vector<storm::storage::ParameterRegion<ParametricType>> &regionVector, std::shared_ptr<storm::analysis::Order> order, storm::analysis::MonotonicityResult<VariableType> & monRes, bool splitForExtremum) const {
             STORM_LOG_WARN("Smart splitting for this model checker not implemented");
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <deque>
+#include <functional>
 #include <memory>
 
 #include "storm-pars/analysis/Order.h"
@@ -62,6 +64,25 @@ namespace storm {
              */
             std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> performRegionRefinement(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold = boost::none, RegionResultHypothesis const& hypothesis = RegionResultHypothesis::Unknown, uint64_t monThresh = 0);
 
+            /*!
+             * Enables the parallel analysis of regions during region refinement (as long as no monotonicity is used).
+             * The pending regions are analyzed in batches. The regions of a batch are pulled dynamically by the workers
+             * and the results are merged in the order of the regions. Hence, the result of the refinement does not depend
+             * on the number of workers.
+             * @param numberOfWorkers the number of regions that are analyzed concurrently. Values larger than one require Intel TBB.
+             * @param workerFactory creates a region model checker for the same model and property. Every additional worker
+             * analyzes its regions with its own checker, i.e., with its own parameter lifter and solvers.
+             */
+            void setParallelRefinement(uint64_t numberOfWorkers, std::function<std::shared_ptr<RegionModelChecker<ParametricType>>()> const& workerFactory);
+
+            /*!
+             * Caps the number of pending regions (i.e., regions that wait for being analyzed) during region refinement.
+             * If splitting a region would exceed the cap, the subregions are analyzed before all other pending regions,
+             * i.e., the refinement proceeds depth-first until the number of pending regions is below the cap again.
+             * As no subregion is dropped, the cap can be exceeded by the subregions of this depth-first descent.
+             */
+            void setMaxNumberOfPendingRegions(boost::optional<uint64_t> const& maxNumberOfPendingRegions);
+
             // TODO: documentation
             /*!
              * Finds the extremal value within the given region and with the given precision.
@@ -101,6 +122,20 @@ namespace storm {
             bool useOnlyGlobal = false;
             bool useBounds = false;
 
+            /*!
+             * Analyzes the first regions of the given queue (each with its known initial result) and returns the results
+             * in the same order. The regions are distributed among the refinement workers (if any).
+             */
+            std::vector<RegionResult> analyzeRegionBatch(Environment const& env, std::deque<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> const& regions, uint64_t numberOfRegions, RegionResultHypothesis const& hypothesis);
+
+            // The number of regions in a batch if parallel refinement or a limit on the pending regions is used.
+            // It is independent of the number of workers to keep the order of the refinement deterministic.
+            static const uint64_t refinementBatchSize = 64;
+            uint64_t numberOfRefinementWorkers = 1;
+            std::function<std::shared_ptr<RegionModelChecker<ParametricType>>()> refinementWorkerFactory;
+            std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> refinementWorkers;
+            boost::optional<uint64_t> maxNumberOfPendingRegions;
+
         protected:
 
             uint_fast64_t numberOfRegionsKnownThroughMonotonicity;
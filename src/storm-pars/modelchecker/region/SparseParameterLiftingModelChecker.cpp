@@ -11,6 +11,7 @@
 #include "storm/utility/vector.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/Smg.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -590,7 +591,9 @@ namespace storm {
 
         template class SparseParameterLiftingModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double>;
         template class SparseParameterLiftingModelChecker<storm::models::sparse::Mdp<storm::RationalFunction>, double>;
+        template class SparseParameterLiftingModelChecker<storm::models::sparse::Smg<storm::RationalFunction>, double>;
         template class SparseParameterLiftingModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::RationalNumber>;
         template class SparseParameterLiftingModelChecker<storm::models::sparse::Mdp<storm::RationalFunction>, storm::RationalNumber>;
+        template class SparseParameterLiftingModelChecker<storm::models::sparse::Smg<storm::RationalFunction>, storm::RationalNumber>;
     }
 }
@@ -0,0 +1,198 @@
+#include "storm-pars/modelchecker/region/SparseSmgParameterLiftingModelChecker.h"
+
+#include "storm-pars/utility/ModelInstantiator.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/GameSolverEnvironment.h"
+#include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Smg.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/shields/ShieldHandling.h"
+#include "storm/solver/Multiplier.h"
+#include "storm/utility/vector.h"
+#include "storm/utility/graph.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace modelchecker {
+
+        template <typename SparseModelType, typename ConstantType>
+        SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::SparseSmgParameterLiftingModelChecker() : applyPreviousResultAsHint(false) {
+            // Intentionally left empty
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        bool SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::canHandle(std::shared_ptr<storm::models::ModelBase> parametricModel, CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask) const {
+            bool result = parametricModel->isOfType(storm::models::ModelType::Smg);
+            result &= parametricModel->isSparseModel();
+            result &= parametricModel->supportsParameters();
+            auto smg = parametricModel->template as<SparseModelType>();
+            result &= static_cast<bool>(smg);
+            storm::logic::Formula const& formula = checkTask.getFormula();
+            result &= formula.isGameFormula() && formula.asGameFormula().getSubformula().isProbabilityOperatorFormula();
+            if (result) {
+                storm::logic::Formula const& pathFormula = formula.asGameFormula().getSubformula().asProbabilityOperatorFormula().getSubformula();
+                result &= pathFormula.isUntilFormula() || pathFormula.isReachabilityProbabilityFormula();
+            }
+            return result;
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        void SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::specify(Environment const& env, std::shared_ptr<storm::models::ModelBase> parametricModel, CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask, bool generateRegionSplitEstimates, bool allowModelSimplification) {
+            STORM_LOG_ASSERT(this->canHandle(parametricModel, checkTask), "specified model and formula can not be handled by this.");
+            STORM_LOG_INFO_COND(!allowModelSimplification, "Model simplification is not supported for SMGs. Continuing with the original model.");
+
+            reset();
+
+            auto smg = parametricModel->template as<SparseModelType>();
+            this->parametricModel = smg;
+            gameFormula = checkTask.getFormula().asSharedPointer();
+            statesOfCoalition = smg->computeStatesOfCoalition(gameFormula->asGameFormula().getCoalition());
+            this->specifyFormula(env, checkTask.substituteFormula(gameFormula->asGameFormula().getSubformula()));
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        void SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::specifyUntilFormula(Environment const& env, CheckTask<storm::logic::UntilFormula, ConstantType> const& checkTask) {
+
+            // get the results for the subformulas
+            storm::modelchecker::SparsePropositionalModelChecker<SparseModelType> propositionalChecker(*this->parametricModel);
+            STORM_LOG_THROW(propositionalChecker.canHandle(checkTask.getFormula().getLeftSubformula()) && propositionalChecker.canHandle(checkTask.getFormula().getRightSubformula()), storm::exceptions::NotSupportedException, "Parameter lifting with non-propositional subformulas is not supported");
+            storm::storage::BitVector phiStates = std::move(propositionalChecker.check(checkTask.getFormula().getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector());
+            storm::storage::BitVector psiStates = std::move(propositionalChecker.check(checkTask.getFormula().getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector());
+
+            // get the maybeStates. As there are no qualitative algorithms for SMGs (yet), we only exclude the states that can not reach psi at all
+            maybeStates = storm::utility::graph::performProbGreater0(this->parametricModel->getBackwardTransitions(), phiStates, psiStates) & ~psiStates;
+
+            // set the result for all non-maybe states
+            resultsForNonMaybeStates = std::vector<ConstantType>(this->parametricModel->getNumberOfStates(), storm::utility::zero<ConstantType>());
+            storm::utility::vector::setVectorValues(resultsForNonMaybeStates, psiStates, storm::utility::one<ConstantType>());
+
+            // if there are maybestates, create the parameterLifter
+            if (!maybeStates.empty()) {
+                // Create the vector of one-step probabilities to go to target states.
+                std::vector<typename SparseModelType::ValueType> b = this->parametricModel->getTransitionMatrix().getConstrainedRowSumVector(storm::storage::BitVector(this->parametricModel->getTransitionMatrix().getRowCount(), true), psiStates);
+
+                parameterLifter = std::make_unique<storm::transformer::ParameterLifter<typename SparseModelType::ValueType, ConstantType>>(this->parametricModel->getTransitionMatrix(), b, this->parametricModel->getTransitionMatrix().getRowFilter(maybeStates), maybeStates);
+
+                // The row groups of the lifted matrix correspond to the choices of the players. Reducing these choice values
+                // requires the row group indices of the players' choices.
+                maybeStateRowGroupEnds.clear();
+                uint64_t numberOfChoices = 0;
+                for (auto const& maybeState : maybeStates) {
+                    numberOfChoices += this->parametricModel->getTransitionMatrix().getRowGroupSize(maybeState);
+                    maybeStateRowGroupEnds.push_back(numberOfChoices);
+                }
+                maybeStatesOfOpponents = (~statesOfCoalition) % maybeStates;
+
+                // Check whether there is an EC consisting of maybestates
+                applyPreviousResultAsHint = storm::utility::graph::performProb1A(this->parametricModel->getTransitionMatrix(), this->parametricModel->getTransitionMatrix().getRowGroupIndices(), this->parametricModel->getBackwardTransitions(), maybeStates, ~maybeStates).full();
+            }
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>& SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::getInstantiationChecker() {
+            if (!instantiationChecker) {
+                instantiationChecker = std::make_unique<storm::modelchecker::SparseSmgInstantiationModelChecker<SparseModelType, ConstantType>>(*this->parametricModel);
+                instantiationChecker->specifyFormula(this->currentCheckTask->template convertValueType<typename SparseModelType::ValueType>().substituteFormula(*gameFormula));
+                instantiationChecker->setInstantiationsAreGraphPreserving(true);
+            }
+            return *instantiationChecker;
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        std::unique_ptr<CheckResult> SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::computeQuantitativeValues(Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters, std::shared_ptr<storm::analysis::LocalMonotonicityResult<typename RegionModelChecker<typename SparseModelType::ValueType>::VariableType>> localMonotonicityResult) {
+
+            if (maybeStates.empty()) {
+                return std::make_unique<storm::modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>(resultsForNonMaybeStates);
+            }
+
+            parameterLifter->specifyRegion(region, dirForParameters);
+            storm::storage::SparseMatrix<ConstantType> const& liftedMatrix = parameterLifter->getMatrix();
+            auto multiplier = storm::solver::MultiplierFactory<ConstantType>().create(env, liftedMatrix);
+
+            // Without end components, the fixpoint is unique and we can start from the previous result.
+            // Otherwise, we need to start from below to obtain the least fixpoint.
+            if (!applyPreviousResultAsHint || x.size() != maybeStates.getNumberOfSetBits()) {
+                x.assign(maybeStates.getNumberOfSetBits(), storm::utility::zero<ConstantType>());
+            }
+            std::vector<ConstantType> xNew(x.size());
+            choiceValues.resize(liftedMatrix.getRowGroupCount());
+
+            ConstantType precision = storm::utility::convertNumber<ConstantType>(env.solver().game().getPrecision());
+            bool relative = env.solver().game().getRelativeTerminationCriterion();
+            uint64_t maxIter = env.solver().game().getMaximalNumberOfIterations();
+            storm::solver::OptimizationDirection dirForCoalition = this->currentCheckTask->getOptimizationDirection();
+
+            bool converged = false;
+            uint64_t iter = 0;
+            while (!converged && iter < maxIter) {
+                // Nature picks the parameter values for each choice, then the players pick their choices.
+                multiplier->multiplyAndReduce(env, dirForParameters, x, &parameterLifter->getVector(), choiceValues);
+                multiplier->reduce(env, dirForCoalition, maybeStateRowGroupEnds, choiceValues, xNew, nullptr, &maybeStatesOfOpponents);
+                converged = storm::utility::vector::equalModuloPrecision<ConstantType>(x, xNew, precision, relative);
+                std::swap(x, xNew);
+                ++iter;
+            }
+            STORM_LOG_WARN_COND(converged, "Value iteration on the lifted game did not converge within " << iter << " iterations.");
+            STORM_LOG_INFO("Value iteration on the lifted game took " << iter << " iterations.");
+
+            // Get the result for the complete model (including maybestates)
+            std::vector<ConstantType> result = resultsForNonMaybeStates;
+            storm::utility::vector::setVectorValues(result, maybeStates, x);
+
+            return std::make_unique<storm::modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>(std::move(result));
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        void SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::createShield(Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression) {
+            STORM_LOG_THROW(shieldingExpression->isPreSafetyShield() || shieldingExpression->isPostSafetyShield(), storm::exceptions::NotSupportedException, "Only pre- and post-safety shields can be created for parameter regions.");
+            storm::solver::OptimizationDirection dirForCoalition = this->currentCheckTask->getOptimizationDirection();
+            auto stateValues = computeQuantitativeValues(env, region, storm::solver::invert(dirForCoalition))->template asExplicitQuantitativeCheckResult<ConstantType>().getValueVector();
+
+            // The choices of a state that is not a maybe state all have the value of that state.
+            storm::storage::SparseMatrix<typename SparseModelType::ValueType> const& transitionMatrix = this->parametricModel->getTransitionMatrix();
+            std::vector<ConstantType> allChoiceValues(transitionMatrix.getRowCount());
+            auto choiceValueIt = choiceValues.begin();
+            for (uint64_t state = 0; state < transitionMatrix.getRowGroupCount(); ++state) {
+                for (uint64_t row = transitionMatrix.getRowGroupIndices()[state]; row < transitionMatrix.getRowGroupIndices()[state + 1]; ++row) {
+                    if (maybeStates.get(state)) {
+                        allChoiceValues[row] = *choiceValueIt;
+                        ++choiceValueIt;
+                    } else {
+                        allChoiceValues[row] = stateValues[state];
+                    }
+                }
+            }
+
+            // The shield is printed w.r.t. some instantiation of the region. Only the structure and the labels of the model are used.
+            storm::utility::ModelInstantiator<SparseModelType, storm::models::sparse::Smg<ConstantType>> instantiator(*this->parametricModel);
+            auto model = std::make_shared<storm::models::sparse::Smg<ConstantType>>(instantiator.instantiate(region.getCenterPoint()));
+            model->getOptionalStateValuations() = this->parametricModel->getOptionalStateValuations();
+            model->getOptionalChoiceOrigins() = this->parametricModel->getOptionalChoiceOrigins();
+
+            tempest::shields::createShield<ConstantType>(model, allChoiceValues, shieldingExpression, dirForCoalition, storm::storage::BitVector(transitionMatrix.getRowGroupCount(), true), statesOfCoalition);
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        void SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::reset() {
+            gameFormula = nullptr;
+            statesOfCoalition.resize(0);
+            maybeStates.resize(0);
+            resultsForNonMaybeStates.clear();
+            maybeStateRowGroupEnds.clear();
+            maybeStatesOfOpponents.resize(0);
+            instantiationChecker = nullptr;
+            parameterLifter = nullptr;
+            x.clear();
+            choiceValues.clear();
+            applyPreviousResultAsHint = false;
+        }
+
+        template class SparseSmgParameterLiftingModelChecker<storm::models::sparse::Smg<storm::RationalFunction>, double>;
+        template class SparseSmgParameterLiftingModelChecker<storm::models::sparse::Smg<storm::RationalFunction>, storm::RationalNumber>;
+    }
+}
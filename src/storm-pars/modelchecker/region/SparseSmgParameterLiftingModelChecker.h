@@ -0,0 +1,75 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <boost/optional.hpp>
+
+#include "storm-pars/transformer/ParameterLifter.h"
+#include "storm-pars/modelchecker/region/SparseParameterLiftingModelChecker.h"
+#include "storm-pars/modelchecker/instantiation/SparseSmgInstantiationModelChecker.h"
+
+#include "storm/logic/ShieldExpression.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+    namespace modelchecker {
+
+        /*!
+         * Parameter lifting for stochastic multiplayer games. The parameter choices are lifted to the choices of an
+         * additional player ("nature") that resolves the parameters after the players of the game have picked their
+         * actions. The coalition of the (game) formula optimizes in the direction of the formula, all other players in
+         * the opposite direction. The lifted game is solved by value iteration.
+         *
+         * Currently, only (unbounded) reachability probabilities are supported.
+         */
+        template <typename SparseModelType, typename ConstantType>
+        class SparseSmgParameterLiftingModelChecker : public SparseParameterLiftingModelChecker<SparseModelType, ConstantType> {
+        public:
+            SparseSmgParameterLiftingModelChecker();
+            virtual ~SparseSmgParameterLiftingModelChecker() = default;
+
+            virtual bool canHandle(std::shared_ptr<storm::models::ModelBase> parametricModel, CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask) const override;
+            virtual void specify(Environment const& env, std::shared_ptr<storm::models::ModelBase> parametricModel, CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask, bool generateRegionSplitEstimates = false, bool allowModelSimplification = true) override;
+
+            /*!
+             * Creates a shield for the coalition of the specified formula that is sound for all instantiations of the
+             * given region. For this, the parameters are resolved in favour of the opponents of the coalition, i.e. the
+             * values of the actions are lower (or upper) bounds for their values in every instantiation.
+             * For shielding expressions with an absolute threshold, an allowed action thus satisfies the threshold
+             * for every instantiation in the region.
+             */
+            void createShield(Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression);
+
+        protected:
+            virtual void specifyUntilFormula(Environment const& env, CheckTask<storm::logic::UntilFormula, ConstantType> const& checkTask) override;
+
+            virtual storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>& getInstantiationChecker() override;
+
+            virtual std::unique_ptr<CheckResult> computeQuantitativeValues(Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters, std::shared_ptr<storm::analysis::LocalMonotonicityResult<typename RegionModelChecker<typename SparseModelType::ValueType>::VariableType>> localMonotonicityResult = nullptr) override;
+
+            virtual void reset() override;
+
+        private:
+            // The game formula as given by the user. The current check task only refers to its probability operator.
+            std::shared_ptr<storm::logic::Formula const> gameFormula;
+            storm::storage::BitVector statesOfCoalition;
+
+            storm::storage::BitVector maybeStates;
+            std::vector<ConstantType> resultsForNonMaybeStates;
+
+            // For each maybe state, the index of the first choice of the next maybe state (the choices are the row groups of the lifted matrix).
+            std::vector<typename storm::storage::SparseMatrix<ConstantType>::index_type> maybeStateRowGroupEnds;
+            // The maybe states that are not in the coalition, i.e. the states in which the opposite direction is optimized.
+            storm::storage::BitVector maybeStatesOfOpponents;
+
+            std::unique_ptr<storm::modelchecker::SparseSmgInstantiationModelChecker<SparseModelType, ConstantType>> instantiationChecker;
+            std::unique_ptr<storm::transformer::ParameterLifter<typename SparseModelType::ValueType, ConstantType>> parameterLifter;
+
+            // Results from the most recent computation.
+            std::vector<ConstantType> x;
+            std::vector<ConstantType> choiceValues;
+            bool applyPreviousResultAsHint;
+        };
+    }
+}
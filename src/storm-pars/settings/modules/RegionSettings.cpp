@@ -22,6 +22,8 @@ namespace storm {
             const std::string RegionSettings::hypothesisOptionName = "hypothesis";
             const std::string RegionSettings::hypothesisShortOptionName = "hyp";
             const std::string RegionSettings::refineOptionName = "refine";
+            const std::string RegionSettings::refineWorkersOptionName = "refine-workers";
+            const std::string RegionSettings::refinePendingCapOptionName = "refine-pending-cap";
             const std::string RegionSettings::extremumOptionName = "extremum";
             const std::string RegionSettings::extremumSuggestionOptionName = "extremum-init";
             const std::string RegionSettings::splittingThresholdName = "splitting-threshold";
@@ -44,6 +46,12 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("coverage-threshold", "Refinement converges if the fraction of unknown area falls below this threshold.").setDefaultValueDouble(0.05).addValidatorDouble(storm::settings::ArgumentValidatorFactory::createDoubleRangeValidatorIncluding(0.0,1.0)).build())
                                 .addArgument(storm::settings::ArgumentBuilder::createIntegerArgument("depth-limit", "If given, limits the number of times a region is refined.").setDefaultValueInteger(-1).makeOptional().build()).build());
                 
+                this->addOption(storm::settings::OptionBuilder(moduleName, refineWorkersOptionName, false, "Sets the number of regions that are analyzed in parallel during region refinement (requires Intel TBB). The result does not depend on this number.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of workers.").setDefaultValueUnsignedInteger(1).addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+
+                this->addOption(storm::settings::OptionBuilder(moduleName, refinePendingCapOptionName, false, "Caps the number of regions that wait for being analyzed during region refinement. If the cap is exceeded, subregions are refined depth-first before the other pending regions.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("regions", "The maximal number of pending regions.").addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+
                 std::vector<std::string> directions = {"min", "max"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, extremumOptionName, false, "Computes the extremum within the region.")
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("direction", "The optimization direction").addValidatorString(storm::settings::ArgumentValidatorFactory::createMultipleChoiceValidator(directions)).build())
@@ -120,6 +128,18 @@ namespace storm {
                 return (uint64_t) depth;
             }
             
+            uint64_t RegionSettings::getNumberOfRefinementWorkers() const {
+                return this->getOption(refineWorkersOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+
+            bool RegionSettings::isRefinementPendingCapSet() const {
+                return this->getOption(refinePendingCapOptionName).getHasOptionBeenSet();
+            }
+
+            uint64_t RegionSettings::getRefinementPendingCap() const {
+                return this->getOption(refinePendingCapOptionName).getArgumentByName("regions").getValueAsUnsignedInteger();
+            }
+
             bool RegionSettings::isExtremumSet() const {
                 return this->getOption(extremumOptionName).getHasOptionBeenSet();
             }
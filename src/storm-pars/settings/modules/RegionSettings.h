@@ -70,6 +70,21 @@ namespace storm {
                  * Returns the depth threshold (if set). It is illegal to call this method if no depth threshold has been set.
                  */
                 uint64_t getDepthLimit() const;
+
+                /*!
+                 * Retrieves the number of regions that are analyzed in parallel during refinement
+                 */
+                uint64_t getNumberOfRefinementWorkers() const;
+
+                /*!
+                 * Retrieves whether the number of pending regions during refinement is capped
+                 */
+                bool isRefinementPendingCapSet() const;
+
+                /*!
+                 * Retrieves the cap on the number of pending regions during refinement
+                 */
+                uint64_t getRefinementPendingCap() const;
                 
                 /*!
 				 * Retrieves whether an extremal value is to be computed
@@ -120,6 +135,8 @@ namespace storm {
 				const static std::string hypothesisOptionName;
 				const static std::string hypothesisShortOptionName;
 				const static std::string refineOptionName;
+				const static std::string refineWorkersOptionName;
+				const static std::string refinePendingCapOptionName;
 				const static std::string splittingThresholdName;
 				const static std::string extremumOptionName;
 				const static std::string extremumSuggestionOptionName;
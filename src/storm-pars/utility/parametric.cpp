@@ -27,6 +27,15 @@ namespace storm {
                 return function.substitute(valuation);
             }
 
+            template<>
+            typename storm::RationalFunction copyWithCache<storm::RationalFunction>(storm::RationalFunction const& function, std::shared_ptr<storm::RawPolynomialCache> const& cache) {
+                if (function.isConstant()) {
+                    // Constant functions do not refer to a cache.
+                    return storm::RationalFunction(function.constantPart());
+                }
+                return storm::RationalFunction(storm::Polynomial(function.nominator().polynomialWithCoefficient(), cache), storm::Polynomial(function.denominator().polynomialWithCoefficient(), cache));
+            }
+
 
             template<>
             void gatherOccurringVariables<storm::RationalFunction>(storm::RationalFunction const& function, std::set<typename VariableType<storm::RationalFunction>::type>& variableSet){
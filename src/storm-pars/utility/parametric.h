@@ -4,6 +4,7 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include <map>
+#include <memory>
 
 namespace storm {
     namespace utility {
@@ -42,6 +43,13 @@ namespace storm {
             template<typename FunctionType>
             FunctionType substitute(FunctionType const& function, Valuation<FunctionType> const& valuation);
 
+            /*!
+             * Copies the given function such that the copy stores its polynomials in the given cache. Functions whose
+             * polynomials are stored in different caches can be evaluated concurrently.
+             */
+            template<typename FunctionType>
+            FunctionType copyWithCache(FunctionType const& function, std::shared_ptr<storm::RawPolynomialCache> const& cache);
+
             /*!
              *  Add all variables that occur in the given function to the the given set
              */
@@ -153,7 +153,7 @@ namespace storm {
             // Game Formulae
             playerCoalition = (-((identifier[phoenix::push_back(qi::_a, qi::_1)] | qi::uint_[phoenix::push_back(qi::_a, qi::_1)]) % ','))[qi::_val = phoenix::bind(&FormulaParserGrammar::createPlayerCoalition, phoenix::ref(*this), qi::_a)];
             playerCoalition.name("player coalition");
-            gameFormula = (qi::lit("<<") > playerCoalition > qi::lit(">>") > operatorFormula)[qi::_val = phoenix::bind(&FormulaParserGrammar::createGameFormula, phoenix::ref(*this), qi::_1, qi::_2)];
+            gameFormula = (qi::lit("<<") > playerCoalition > qi::lit(">>") > (multiOperatorFormula | operatorFormula))[qi::_val = phoenix::bind(&FormulaParserGrammar::createGameFormula, phoenix::ref(*this), qi::_1, qi::_2)];
             gameFormula.name("game formula");
 
             // Multi-objective, quantiles
@@ -185,6 +185,7 @@ namespace storm {
             shieldExpression.name("shield expression");
 
             shieldingType = (qi::lit("PreSafety")[qi::_val = storm::logic::ShieldingType::PreSafety]      |
+                             qi::lit("PermissivePreSafety")[qi::_val = storm::logic::ShieldingType::PermissivePre]  |
                              qi::lit("PostSafety")[qi::_val = storm::logic::ShieldingType::PostSafety]    |
                              qi::lit("OptimalPre")[qi::_val = storm::logic::ShieldingType::OptimalPre]    |
                              qi::lit("OptimalPost")[qi::_val = storm::logic::ShieldingType::OptimalPost]  |
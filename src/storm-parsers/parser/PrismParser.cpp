@@ -7,6 +7,7 @@
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidTypeException.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/Statistics.h"
 #include "storm/io/file.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/exceptions/UnexpectedException.h"
@@ -45,6 +46,7 @@ namespace storm {
         }
 
         storm::prism::Program PrismParser::parseFromString(std::string const& input, std::string const& filename, bool prismCompatibility) {
+            storm::utility::statistics::ScopedTimer parsingTimer("prism-parser");
             bool hasByteOrderMark = input.size() >= 3 && input[0] == '\xEF' && input[1] == '\xBB' && input[2] == '\xBF';
 
             PositionIteratorType first(hasByteOrderMark ? input.begin() + 3 : input.begin());
@@ -80,6 +82,8 @@ namespace storm {
             }
 
             STORM_LOG_TRACE("Parsed PRISM input: " << result);
+            storm::utility::statistics::setCounter("modules", result.getNumberOfModules());
+            storm::utility::statistics::setCounter("commands", result.getNumberOfCommands());
 
             return result;
         }
@@ -28,6 +28,7 @@ namespace storm {
             const std::string observationThresholdOption = "obs-threshold";
             const std::string numericPrecisionOption = "numeric-precision";
             const std::string triangulationModeOption = "triangulationmode";
+            const std::string parallelOption = "parallel";
 
             BeliefExplorationSettings::BeliefExplorationSettings() : ModuleSettings(moduleName) {
                 
@@ -50,6 +51,9 @@ namespace storm {
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, triangulationModeOption, false,"Sets how to triangulate beliefs when discretizing.").setIsAdvanced().addArgument(
                         storm::settings::ArgumentBuilder::createStringArgument("value","the triangulation mode").setDefaultValueString("dynamic").addValidatorString(storm::settings::ArgumentValidatorFactory::createMultipleChoiceValidator({"dynamic", "static"})).build()).build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, parallelOption, false,"Builds the over- and under-approximation concurrently and computes the successors of the explored beliefs in parallel batches.").setIsAdvanced().addArgument(
+                        storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("batch","The number of beliefs whose successors are computed at once.").setDefaultValueUnsignedInteger(64).makeOptional().addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
             }
 
             bool BeliefExplorationSettings::isRefineSet() const {
@@ -133,6 +137,14 @@ namespace storm {
                 return this->getOption(triangulationModeOption).getArgumentByName("value").getValueAsString() == "static";
             }
             
+            bool BeliefExplorationSettings::isParallelSet() const {
+                return this->getOption(parallelOption).getHasOptionBeenSet();
+            }
+            
+            uint64_t BeliefExplorationSettings::getParallelExpansionBatchSize() const {
+                return this->getOption(parallelOption).getArgumentByName("batch").getValueAsUnsignedInteger();
+            }
+            
             template<typename ValueType>
             void BeliefExplorationSettings::setValuesInOptionsStruct(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) const {
                 options.refine = isRefineSet();
@@ -168,6 +180,8 @@ namespace storm {
                     }
                 }
                 options.dynamicTriangulation = isDynamicTriangulationModeSet();
+                options.parallelApproximations = isParallelSet();
+                options.expansionBatchSize = isParallelSet() ? getParallelExpansionBatchSize() : 1;
             }
             
             template void BeliefExplorationSettings::setValuesInOptionsStruct<double>(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<double>& options) const;
@@ -60,6 +60,10 @@ namespace storm {
                 
                 bool isDynamicTriangulationModeSet() const;
                 bool isStaticTriangulationModeSet() const;
+                
+                /// Controls whether the approximations are built in parallel
+                bool isParallelSet() const;
+                uint64_t getParallelExpansionBatchSize() const;
     
                 template<typename ValueType>
                 void setValuesInOptionsStruct(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) const;
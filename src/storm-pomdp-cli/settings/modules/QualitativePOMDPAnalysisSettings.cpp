@@ -22,6 +22,7 @@ namespace storm {
             const std::string expensiveStatsOption = "allstats";
             const std::string printWinningRegionOption = "printwinningregion";
             const std::string exportWinningRegionOption = "exportwinningregion";
+            const std::string exportBeliefSupportShieldOption = "exportbeliefsupportshield";
             const std::string preventGraphPreprocessing = "nographprocessing";
             const std::string beliefSupportMCOption = "belsupmc";
             const std::string memlessSearchOption = "memlesssearch";
@@ -41,6 +42,7 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, expensiveStatsOption, true, "Compute all stats, even if this is expensive.").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, printWinningRegionOption, false, "Print Winning Region").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, exportWinningRegionOption, false, "Export the winning region.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("path", "The name of the file to which to write the winning region.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, exportBeliefSupportShieldOption, false, "Export a shield that allows the actions keeping the belief support in the winning region.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("path", "The name of the file to which to write the shield.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, preventGraphPreprocessing, true, "Prevent graph preprocessing (for debugging)").setIsAdvanced().build());
             }
 
@@ -91,6 +93,14 @@ namespace storm {
                 return this->getOption(exportWinningRegionOption).getHasOptionBeenSet();
             }
 
+            std::string QualitativePOMDPAnalysisSettings::exportBeliefSupportShieldPath() const {
+                return this->getOption(exportBeliefSupportShieldOption).getArgumentByName("path").getValueAsString();
+            }
+
+            bool QualitativePOMDPAnalysisSettings::isExportBeliefSupportShieldSet() const {
+                return this->getOption(exportBeliefSupportShieldOption).getHasOptionBeenSet();
+            }
+
             bool QualitativePOMDPAnalysisSettings::isPrintWinningRegionSet() const {
                 return this->getOption(printWinningRegionOption).getHasOptionBeenSet();
             }
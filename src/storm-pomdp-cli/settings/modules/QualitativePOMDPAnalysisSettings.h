@@ -33,6 +33,8 @@ namespace storm {
                 bool isPrintWinningRegionSet() const;
                 bool isExportWinningRegionSet() const;
                 std::string exportWinningRegionPath() const;
+                bool isExportBeliefSupportShieldSet() const;
+                std::string exportBeliefSupportShieldPath() const;
                 bool isGraphPreprocessingAllowed() const;
                 bool isMemlessSearchSet() const;
                 std::string getMemlessSearchMethod() const;
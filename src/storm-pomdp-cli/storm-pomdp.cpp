@@ -27,6 +27,8 @@
 #include "storm-pomdp/analysis/IterativePolicySearch.h"
 #include "storm-pomdp/analysis/OneShotPolicySearch.h"
 #include "storm-pomdp/analysis/JaniBeliefSupportMdpGenerator.h"
+#include "storm-pomdp/analysis/WinningRegionQueryInterface.h"
+#include "storm-pomdp/shields/BeliefSupportShield.h"
 
 #include "storm/api/storm.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
@@ -203,6 +205,11 @@ namespace storm {
                             search.getLastWinningRegion().storeToFile(qualSettings.exportWinningRegionPath(),
                                                                       "model hash: " + std::to_string(hash));
                         }
+                        if (qualSettings.isExportBeliefSupportShieldSet()) {
+                            storm::pomdp::WinningRegionQueryInterface<ValueType> queryInterface(pomdp, search.getLastWinningRegion());
+                            tempest::shields::BeliefSupportShield shield = tempest::shields::BeliefSupportShield::create(pomdp, queryInterface);
+                            shield.storeToFile(qualSettings.exportBeliefSupportShieldPath(), "model hash: " + std::to_string(pomdp.hash()));
+                        }
 
                         search.finalizeStatistics();
                         if (pomdp.getInitialStates().getNumberOfSetBits() == 1) {
@@ -144,6 +144,16 @@ namespace storm {
             }
         }
 
+        template<typename ValueType>
+        std::vector<uint64_t> const& WinningRegionQueryInterface<ValueType>::getStatesWithObservation(uint64_t observation) const {
+            return statesPerObservation[observation];
+        }
+
+        template<typename ValueType>
+        WinningRegion const& WinningRegionQueryInterface<ValueType>::getWinningRegion() const {
+            return winningRegion;
+        }
+
         template class WinningRegionQueryInterface<double>;
         template class WinningRegionQueryInterface<storm::RationalNumber>;
     }
@@ -17,6 +17,13 @@ namespace storm {
             void validate(storm::storage::BitVector const& badStates) const;
 
             void validateIsMaximal(storm::storage::BitVector const& badStates) const;
+
+            /*!
+             * The states with the given observation, ordered by their index. The offsets used by the winning region refer to this order.
+             */
+            std::vector<uint64_t> const& getStatesWithObservation(uint64_t observation) const;
+
+            WinningRegion const& getWinningRegion() const;
         private:
             storm::models::sparse::Pomdp<ValueType> const& pomdp;
             WinningRegion const& winningRegion;
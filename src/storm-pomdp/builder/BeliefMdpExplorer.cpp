@@ -151,6 +151,17 @@ namespace storm {
             return mdpStateToBeliefIdMap[currentMdpState];
         }
 
+        template<typename PomdpType, typename BeliefValueType>
+        std::vector<typename BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefId> BeliefMdpExplorer<PomdpType, BeliefValueType>::getNextUnexploredBeliefs(uint64_t maxNumberOfBeliefs) const {
+            STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
+            std::vector<BeliefId> result;
+            result.reserve(std::min<uint64_t>(maxNumberOfBeliefs, mdpStatesToExplore.size()));
+            for (auto stateIt = mdpStatesToExplore.begin(); stateIt != mdpStatesToExplore.end() && result.size() < maxNumberOfBeliefs; ++stateIt) {
+                result.push_back(mdpStateToBeliefIdMap[*stateIt]);
+            }
+            return result;
+        }
+
         template<typename PomdpType, typename BeliefValueType>
         void BeliefMdpExplorer<PomdpType, BeliefValueType>::addTransitionsToExtraStates(uint64_t const &localActionIndex, ValueType const &targetStateValue,
                                                                                         ValueType const &bottomStateValue) {
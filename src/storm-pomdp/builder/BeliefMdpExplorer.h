@@ -58,6 +58,12 @@ namespace storm {
 
             BeliefId exploreNextState();
 
+            /*!
+             * Retrieves the beliefs of (at most) the given number of states that are explored next, in the order in which they are explored.
+             * States that are added to the exploration queue later on are not considered.
+             */
+            std::vector<BeliefId> getNextUnexploredBeliefs(uint64_t maxNumberOfBeliefs) const;
+
             void addTransitionsToExtraStates(uint64_t const &localActionIndex, ValueType const &targetStateValue = storm::utility::zero<ValueType>(),
                                              ValueType const &bottomStateValue = storm::utility::zero<ValueType>());
 
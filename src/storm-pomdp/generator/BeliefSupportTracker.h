@@ -12,6 +12,7 @@ namespace storm {
              */
         public:
             BeliefSupportTracker(storm::models::sparse::Pomdp<ValueType> const& pomdp);
+            virtual ~BeliefSupportTracker() = default;
             /**
              * The current belief support according to the tracker
              * @return
@@ -22,15 +23,17 @@ namespace storm {
              * @param action The action that was taken
              * @param observation The new (state) observation
              */
-            void track(uint64_t action, uint64_t observation);
+            virtual void track(uint64_t action, uint64_t observation);
             /*!
              * Reset to initial state
              */
-            void reset();
+            virtual void reset();
 
-        private:
+        protected:
             storm::models::sparse::Pomdp<ValueType> const& pomdp;
             storm::storage::BitVector currentBeliefSupport;
+            // Buffer for the next belief support, reused in every step to avoid allocations.
+            storm::storage::BitVector nextBeliefSupport;
 
         };
     }
@@ -0,0 +1,70 @@
+#include "storm-pomdp/generator/ShieldedBeliefSupportTracker.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace generator {
+        template<typename ValueType>
+        ShieldedBeliefSupportTracker<ValueType>::ShieldedBeliefSupportTracker(storm::models::sparse::Pomdp<ValueType> const& pomdp, tempest::shields::BeliefSupportShield const& shield) : BeliefSupportTracker<ValueType>(pomdp), shield(shield), stateToOffset(pomdp.getNumberOfStates()) {
+            STORM_LOG_THROW(shield.getNumberOfObservations() == pomdp.getNrObservations(), storm::exceptions::InvalidArgumentException, "The shield does not match the number of observations of the POMDP.");
+            std::vector<uint64_t> observationSizes(pomdp.getNrObservations(), 0);
+            for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
+                stateToOffset[state] = observationSizes[pomdp.getObservation(state)]++;
+            }
+            for (uint64_t observation = 0; observation < pomdp.getNrObservations(); ++observation) {
+                STORM_LOG_THROW(shield.getObservationSize(observation) == observationSizes[observation], storm::exceptions::InvalidArgumentException, "The shield does not match the number of states with observation " << observation << ".");
+            }
+            updateAllowedActions();
+        }
+
+        template<typename ValueType>
+        void ShieldedBeliefSupportTracker<ValueType>::track(uint64_t action, uint64_t observation) {
+            BeliefSupportTracker<ValueType>::track(action, observation);
+            updateAllowedActions();
+        }
+
+        template<typename ValueType>
+        void ShieldedBeliefSupportTracker<ValueType>::reset() {
+            BeliefSupportTracker<ValueType>::reset();
+            updateAllowedActions();
+        }
+
+        template<typename ValueType>
+        uint64_t ShieldedBeliefSupportTracker<ValueType>::getCurrentObservation() const {
+            STORM_LOG_ASSERT(!this->currentBeliefSupport.empty(), "The belief support is empty.");
+            return this->pomdp.getObservation(this->currentBeliefSupport.getNextSetIndex(0));
+        }
+
+        template<typename ValueType>
+        storm::storage::BitVector const& ShieldedBeliefSupportTracker<ValueType>::getAllowedActions() const {
+            return allowedActions;
+        }
+
+        template<typename ValueType>
+        bool ShieldedBeliefSupportTracker<ValueType>::isAllowed(uint64_t action) const {
+            return action < allowedActions.size() && allowedActions.get(action);
+        }
+
+        template<typename ValueType>
+        void ShieldedBeliefSupportTracker<ValueType>::updateAllowedActions() {
+            if (this->currentBeliefSupport.empty()) {
+                allowedActions.clear();
+                return;
+            }
+            uint64_t observation = getCurrentObservation();
+            currentOffsets.resize(shield.getObservationSize(observation));
+            currentOffsets.clear();
+            for (uint64_t state : this->currentBeliefSupport) {
+                STORM_LOG_ASSERT(this->pomdp.getObservation(state) == observation, "Support must be observation-consistent");
+                currentOffsets.set(stateToOffset[state]);
+            }
+            shield.getAllowedActions(observation, currentOffsets, allowedActions);
+        }
+
+        template class ShieldedBeliefSupportTracker<double>;
+        template class ShieldedBeliefSupportTracker<storm::RationalNumber>;
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "storm-pomdp/generator/BeliefSupportTracker.h"
+#include "storm-pomdp/shields/BeliefSupportShield.h"
+
+namespace storm {
+    namespace generator {
+
+        /*!
+         * Tracks the current belief support and the actions that a belief-support shield allows at it.
+         * The allowed actions are updated whenever the belief support changes, such that queries do not require any computation.
+         */
+        template<typename ValueType>
+        class ShieldedBeliefSupportTracker : public BeliefSupportTracker<ValueType> {
+        public:
+            ShieldedBeliefSupportTracker(storm::models::sparse::Pomdp<ValueType> const& pomdp, tempest::shields::BeliefSupportShield const& shield);
+            virtual ~ShieldedBeliefSupportTracker() = default;
+
+            virtual void track(uint64_t action, uint64_t observation) override;
+            virtual void reset() override;
+
+            /*!
+             * The observation of the states in the current belief support.
+             * The belief support must not be empty.
+             */
+            uint64_t getCurrentObservation() const;
+
+            /*!
+             * The actions that the shield allows at the current belief support.
+             * If the belief support is not winning (or empty), no action is allowed.
+             */
+            storm::storage::BitVector const& getAllowedActions() const;
+            bool isAllowed(uint64_t action) const;
+
+        private:
+            void updateAllowedActions();
+
+            tempest::shields::BeliefSupportShield const& shield;
+            // For each state, its offset within the states with the same observation.
+            std::vector<uint64_t> stateToOffset;
+            // The current belief support, given as offsets.
+            storm::storage::BitVector currentOffsets;
+            storm::storage::BitVector allowedActions;
+        };
+    }
+}
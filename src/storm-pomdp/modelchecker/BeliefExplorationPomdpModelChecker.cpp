@@ -1,5 +1,6 @@
 #include "BeliefExplorationPomdpModelChecker.h"
 
+#include <future>
 #include <tuple>
 
 #include <boost/algorithm/string.hpp>
@@ -211,7 +212,7 @@ namespace storm {
             template<typename PomdpModelType, typename BeliefValueType>
             void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::computeReachabilityOTF(std::set<uint32_t> const &targetObservations, bool min, boost::optional<std::string> rewardModelName, storm::pomdp::modelchecker::TrivialPomdpValueBounds<ValueType> const& pomdpValueBounds, Result& result) {
                 
-                if (options.discretize) {
+                auto computeOverApproximation = [&]() {
                     std::vector<BeliefValueType> observationResolutionVector(pomdp().getNrObservations(), storm::utility::convertNumber<BeliefValueType>(options.resolutionInit));
                     auto manager = std::make_shared<BeliefManagerType>(pomdp(), options.numericPrecision, options.dynamicTriangulation ? BeliefManagerType::TriangulationMode::Dynamic : BeliefManagerType::TriangulationMode::Static);
                     if (rewardModelName) {
@@ -236,8 +237,8 @@ namespace storm {
                         ValueType& resultValue = min ? result.lowerBound : result.upperBound;
                         resultValue = approx->getComputedValueAtInitialState();
                     }
-                }
-                if (options.unfold) { // Underapproximation (uses a fresh Belief manager)
+                };
+                auto computeUnderApproximation = [&]() { // Underapproximation (uses a fresh Belief manager)
                     auto manager = std::make_shared<BeliefManagerType>(pomdp(), options.numericPrecision, options.dynamicTriangulation ? BeliefManagerType::TriangulationMode::Dynamic : BeliefManagerType::TriangulationMode::Static);
                     if (rewardModelName) {
                         manager->setRewardModel(rewardModelName);
@@ -267,7 +268,8 @@ namespace storm {
                         ValueType& resultValue = min ? result.upperBound : result.lowerBound;
                         resultValue = approx->getComputedValueAtInitialState();
                     }
-                }
+                };
+                runApproximations(computeOverApproximation, computeUnderApproximation);
             }
             
             template<typename PomdpModelType, typename BeliefValueType>
@@ -279,7 +281,7 @@ namespace storm {
                 std::shared_ptr<BeliefManagerType> overApproxBeliefManager;
                 std::shared_ptr<ExplorerType> overApproximation;
                 HeuristicParameters overApproxHeuristicPar;
-                if (options.discretize) { // Setup and build first OverApproximation
+                if (options.discretize) { // Setup first OverApproximation
                     observationResolutionVector = std::vector<BeliefValueType>(pomdp().getNrObservations(), storm::utility::convertNumber<BeliefValueType>(options.resolutionInit));
                     overApproxBeliefManager = std::make_shared<BeliefManagerType>(pomdp(), options.numericPrecision, options.dynamicTriangulation ? BeliefManagerType::TriangulationMode::Dynamic : BeliefManagerType::TriangulationMode::Static);
                     if (rewardModelName) {
@@ -290,21 +292,12 @@ namespace storm {
                     overApproxHeuristicPar.observationThreshold = options.obsThresholdInit;
                     overApproxHeuristicPar.sizeThreshold = options.sizeThresholdInit == 0 ? std::numeric_limits<uint64_t>::max() : options.sizeThresholdInit;
                     overApproxHeuristicPar.optimalChoiceValueEpsilon = options.optimalChoiceValueThresholdInit;
-                    buildOverApproximation(targetObservations, min, rewardModelName.is_initialized(), false, overApproxHeuristicPar, observationResolutionVector, overApproxBeliefManager, overApproximation);
-                    if (!overApproximation->hasComputedValues() || storm::utility::resources::isTerminate()) {
-                        return;
-                    }
-                    ValueType const& newValue = overApproximation->getComputedValueAtInitialState();
-                    bool betterBound = min ? result.updateLowerBound(newValue) : result.updateUpperBound(newValue);
-                    if (betterBound) {
-                        STORM_LOG_INFO("Over-approx result for refinement improved after " << statistics.totalTime << " seconds in refinement step #" << statistics.refinementSteps.get() << ". New value is '" << newValue << "'." << std::endl);
-                    }
                 }
                 
                 std::shared_ptr<BeliefManagerType> underApproxBeliefManager;
                 std::shared_ptr<ExplorerType> underApproximation;
                 HeuristicParameters underApproxHeuristicPar;
-                if (options.unfold) { // Setup and build first UnderApproximation
+                if (options.unfold) { // Setup first UnderApproximation
                     underApproxBeliefManager = std::make_shared<BeliefManagerType>(pomdp(), options.numericPrecision, options.dynamicTriangulation ? BeliefManagerType::TriangulationMode::Dynamic : BeliefManagerType::TriangulationMode::Static);
                     if (rewardModelName) {
                         underApproxBeliefManager->setRewardModel(rewardModelName);
@@ -317,7 +310,27 @@ namespace storm {
                         // Select a decent value automatically
                         underApproxHeuristicPar.sizeThreshold = pomdp().getNumberOfStates() * pomdp().getMaxNrStatesWithSameObservation();
                     }
-                    buildUnderApproximation(targetObservations, min, rewardModelName.is_initialized(), false, underApproxHeuristicPar, underApproxBeliefManager, underApproximation);
+                }
+
+                // Build the first approximations
+                runApproximations([&]() {
+                    buildOverApproximation(targetObservations, min, rewardModelName.is_initialized(), false, overApproxHeuristicPar, observationResolutionVector, overApproxBeliefManager, overApproximation);
+                }, [&]() {
+                    if (!storm::utility::resources::isTerminate()) {
+                        buildUnderApproximation(targetObservations, min, rewardModelName.is_initialized(), false, underApproxHeuristicPar, underApproxBeliefManager, underApproximation);
+                    }
+                });
+                if (options.discretize) {
+                    if (!overApproximation->hasComputedValues() || storm::utility::resources::isTerminate()) {
+                        return;
+                    }
+                    ValueType const& newValue = overApproximation->getComputedValueAtInitialState();
+                    bool betterBound = min ? result.updateLowerBound(newValue) : result.updateUpperBound(newValue);
+                    if (betterBound) {
+                        STORM_LOG_INFO("Over-approx result for refinement improved after " << statistics.totalTime << " seconds in refinement step #" << statistics.refinementSteps.get() << ". New value is '" << newValue << "'." << std::endl);
+                    }
+                }
+                if (options.unfold) {
                     if (!underApproximation->hasComputedValues() || storm::utility::resources::isTerminate()) {
                         return;
                     }
@@ -557,6 +570,8 @@ namespace storm {
                 }
                 bool timeLimitExceeded = false;
                 std::map<uint32_t, typename ExplorerType::SuccessorObservationInformation> gatheredSuccessorObservations; // Declare here to avoid reallocations
+                boost::optional<std::vector<BeliefValueType>> triangulationResolutions = observationResolutionVector; // The resolutions do not change during the exploration
+                PreparedExpansions preparedExpansions;
                 uint64_t numRewiredOrExploredStates = 0;
                 while (overApproximation->hasUnexploredState()) {
                     if (!timeLimitExceeded && options.explorationTimeLimit && static_cast<uint64_t>(explorationTime.getTimeInSeconds()) > options.explorationTimeLimit.get()) {
@@ -674,7 +689,7 @@ namespace storm {
                                 expandedAtLeastOneAction = true;
                                 if (!truncateAllActions) {
                                     // Cases 1.1, 2.1, or 3.1
-                                    auto successorGridPoints = beliefManager->expandAndTriangulate(currId, action, observationResolutionVector);
+                                    auto successorGridPoints = expandBelief(targetObservations, triangulationResolutions, *beliefManager, *overApproximation, preparedExpansions, currId, action);
                                     for (auto const& successor : successorGridPoints) {
                                         overApproximation->addTransitionToBelief(action, successor.first, successor.second, false);
                                     }
@@ -685,7 +700,7 @@ namespace storm {
                                     // Cases 1.2 or 2.2
                                     ValueType truncationProbability = storm::utility::zero<ValueType>();
                                     ValueType truncationValueBound = storm::utility::zero<ValueType>();
-                                    auto successorGridPoints = beliefManager->expandAndTriangulate(currId, action, observationResolutionVector);
+                                    auto successorGridPoints = expandBelief(targetObservations, triangulationResolutions, *beliefManager, *overApproximation, preparedExpansions, currId, action);
                                     for (auto const& successor : successorGridPoints) {
                                         bool added = overApproximation->addTransitionToBelief(action, successor.first, successor.second, true);
                                         if (!added) {
@@ -711,6 +726,7 @@ namespace storm {
                             ++numRewiredOrExploredStates;
                         }
                     }
+                    preparedExpansions.erase(currId);
                     
                     if (storm::utility::resources::isTerminate()) {
                         break;
@@ -766,6 +782,7 @@ namespace storm {
                     explorationTime.start();
                 }
                 bool timeLimitExceeded = false;
+                PreparedExpansions preparedExpansions;
                 while (underApproximation->hasUnexploredState()) {
                     if (!timeLimitExceeded && options.explorationTimeLimit && static_cast<uint64_t>(explorationTime.getTimeInSeconds()) > options.explorationTimeLimit.get()) {
                         STORM_LOG_INFO("Exploration time limit exceeded.");
@@ -804,7 +821,7 @@ namespace storm {
                             } else {
                                 ValueType truncationProbability = storm::utility::zero<ValueType>();
                                 ValueType truncationValueBound = storm::utility::zero<ValueType>();
-                                auto successors = beliefManager->expand(currId, action);
+                                auto successors = expandBelief(targetObservations, boost::none, *beliefManager, *underApproximation, preparedExpansions, currId, action);
                                 for (auto const& successor : successors) {
                                     bool added = underApproximation->addTransitionToBelief(action, successor.first, successor.second, stopExploration);
                                     if (!added) {
@@ -831,6 +848,7 @@ namespace storm {
                             }
                         }
                     }
+                    preparedExpansions.erase(currId);
                     if (storm::utility::resources::isTerminate()) {
                         break;
                     }
@@ -861,6 +879,59 @@ namespace storm {
 
             }
             
+            template<typename PomdpModelType, typename BeliefValueType>
+            std::vector<std::pair<typename BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::BeliefId, typename BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::ValueType>>
+            BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::expandBelief(std::set<uint32_t> const &targetObservations, boost::optional<std::vector<BeliefValueType>> const& observationResolutions, BeliefManagerType& beliefManager, ExplorerType const& explorer, PreparedExpansions& preparedExpansions, BeliefId const& beliefId, uint64_t action) const {
+                if (options.expansionBatchSize <= 1) {
+                    if (observationResolutions) {
+                        return beliefManager.expandAndTriangulate(beliefId, action, observationResolutions.get());
+                    } else {
+                        return beliefManager.expand(beliefId, action);
+                    }
+                }
+                
+                auto expansionsIt = preparedExpansions.find(beliefId);
+                if (expansionsIt == preparedExpansions.end()) {
+                    // Prepare the expansions of the given belief and of the beliefs that are explored next.
+                    // The successors are only stored when the expansions are finished, i.e., in the order in which the beliefs are explored. Hence, the belief ids do not depend on the batch size.
+                    std::vector<BeliefId> beliefs = explorer.getNextUnexploredBeliefs(options.expansionBatchSize - 1);
+                    beliefs.insert(beliefs.begin(), beliefId);
+                    std::vector<std::pair<BeliefId, uint64_t>> beliefActionPairs;
+                    for (auto const& belief : beliefs) {
+                        // Beliefs with a target observation are not expanded.
+                        if (targetObservations.count(beliefManager.getBeliefObservation(belief)) == 0 && preparedExpansions.emplace(belief, std::vector<typename BeliefManagerType::PreparedBeliefs>()).second) {
+                            for (uint64_t localAction = 0, numActions = beliefManager.getBeliefNumberOfChoices(belief); localAction < numActions; ++localAction) {
+                                beliefActionPairs.emplace_back(belief, localAction);
+                            }
+                        }
+                    }
+                    auto expansions = beliefManager.prepareExpansions(beliefActionPairs, observationResolutions);
+                    for (uint64_t i = 0; i < beliefActionPairs.size(); ++i) {
+                        preparedExpansions[beliefActionPairs[i].first].push_back(std::move(expansions[i]));
+                    }
+                    expansionsIt = preparedExpansions.find(beliefId);
+                }
+                STORM_LOG_ASSERT(action < expansionsIt->second.size(), "No prepared expansion for action " << action << " at belief " << beliefId << ".");
+                return beliefManager.finishExpansion(expansionsIt->second[action]);
+            }
+
+            template<typename PomdpModelType, typename BeliefValueType>
+            void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::runApproximations(std::function<void()> const& computeOverApproximation, std::function<void()> const& computeUnderApproximation) const {
+                if (options.discretize && options.unfold && options.parallelApproximations) {
+                    // Both approximations use their own belief manager and explorer, so they do not share any mutable state.
+                    auto overApproximationFuture = std::async(std::launch::async, computeOverApproximation);
+                    computeUnderApproximation();
+                    overApproximationFuture.get();
+                } else {
+                    if (options.discretize) {
+                        computeOverApproximation();
+                    }
+                    if (options.unfold) {
+                        computeUnderApproximation();
+                    }
+                }
+            }
+
             template<typename PomdpModelType, typename BeliefValueType>
             PomdpModelType const& BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::pomdp() const {
                 if (preprocessedPomdp) {
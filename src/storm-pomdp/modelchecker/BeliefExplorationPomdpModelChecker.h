@@ -1,3 +1,6 @@
+#include <functional>
+#include <unordered_map>
+
 #include "storm/api/storm.h"
 #include "storm/models/sparse/Pomdp.h"
 #include "storm/utility/logging.h"
@@ -27,6 +30,7 @@ namespace storm {
                 typedef storm::storage::BeliefManager<PomdpModelType, BeliefValueType> BeliefManagerType;
                 typedef storm::builder::BeliefMdpExplorer<PomdpModelType, BeliefValueType> ExplorerType;
                 typedef BeliefExplorationPomdpModelCheckerOptions<ValueType> Options;
+                typedef typename BeliefManagerType::BeliefId BeliefId;
                 
                 struct Result {
                     Result(ValueType lower, ValueType upper);
@@ -92,6 +96,21 @@ namespace storm {
                  */
                 bool buildUnderApproximation(std::set<uint32_t> const &targetObservations, bool min, bool computeRewards, bool refine, HeuristicParameters const& heuristicParameters, std::shared_ptr<BeliefManagerType>& beliefManager, std::shared_ptr<ExplorerType>& underApproximation);
 
+                typedef std::unordered_map<BeliefId, std::vector<typename BeliefManagerType::PreparedBeliefs>> PreparedExpansions;
+
+                /**
+                 * Expands the given belief at the given action and triangulates the successors if resolutions are given.
+                 * If the options ask for batched expansions, the successors of the given belief and the beliefs that are explored next are computed in parallel
+                 * and kept in the given map until they are needed. The result does not depend on the batch size.
+                 */
+                std::vector<std::pair<BeliefId, ValueType>> expandBelief(std::set<uint32_t> const &targetObservations, boost::optional<std::vector<BeliefValueType>> const& observationResolutions, BeliefManagerType& beliefManager, ExplorerType const& explorer, PreparedExpansions& preparedExpansions, BeliefId const& beliefId, uint64_t action) const;
+
+                /**
+                 * Runs the given computations of the over- and under-approximation (as far as they are enabled).
+                 * If the options ask for parallel approximations, both are run concurrently.
+                 */
+                void runApproximations(std::function<void()> const& computeOverApproximation, std::function<void()> const& computeUnderApproximation) const;
+
                 BeliefValueType rateObservation(typename ExplorerType::SuccessorObservationInformation const& info, BeliefValueType const& observationResolution, BeliefValueType const& maxResolution);
                 
                 std::vector<BeliefValueType> getObservationRatings(std::shared_ptr<ExplorerType> const& overApproximation, std::vector<BeliefValueType> const& observationResolutionVector);
@@ -39,6 +39,10 @@ namespace storm {
                 
                 ValueType numericPrecision = storm::NumberTraits<ValueType>::IsExact ? storm::utility::zero<ValueType>() : storm::utility::convertNumber<ValueType>(1e-9); /// Used to decide whether two beliefs are equal
                 bool dynamicTriangulation = true; // Sets whether the triangulation is done in a dynamic way (yielding more precise triangulations)
+                
+                // Parallelization
+                bool parallelApproximations = false; // Sets whether the over- and under-approximation are built and checked concurrently
+                uint64_t expansionBatchSize = 1; // The number of beliefs whose successors are computed at once (in parallel if Intel TBB is available). The explored MDPs do not depend on this number.
             };
         }
     }
@@ -0,0 +1,189 @@
+#include "storm-pomdp/shields/BeliefSupportShield.h"
+
+#include <boost/algorithm/string.hpp>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/io/file.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace tempest {
+    namespace shields {
+
+        BeliefSupportShield::BeliefSupportShield(std::vector<uint64_t> const& observationSizes, std::vector<uint64_t> const& numberOfActions) : observationSizes(observationSizes), numberOfActions(numberOfActions), supports(observationSizes.size()), allowedActions(observationSizes.size()) {
+            STORM_LOG_THROW(observationSizes.size() == numberOfActions.size(), storm::exceptions::InvalidArgumentException, "The number of actions has to be given for every observation.");
+        }
+
+        template<typename ValueType>
+        BeliefSupportShield BeliefSupportShield::create(storm::models::sparse::Pomdp<ValueType> const& pomdp, storm::pomdp::WinningRegionQueryInterface<ValueType> const& queryInterface) {
+            std::vector<uint64_t> observationSizes;
+            std::vector<uint64_t> numberOfActions;
+            for (uint64_t observation = 0; observation < pomdp.getNrObservations(); ++observation) {
+                auto const& states = queryInterface.getStatesWithObservation(observation);
+                observationSizes.push_back(states.size());
+                // All states with the same observation have the same number of actions
+                numberOfActions.push_back(states.empty() ? 0 : pomdp.getTransitionMatrix().getRowGroupSize(states.front()));
+            }
+
+            BeliefSupportShield shield(observationSizes, numberOfActions);
+            storm::storage::BitVector beliefSupport(pomdp.getNumberOfStates());
+            for (uint64_t observation = 0; observation < pomdp.getNrObservations(); ++observation) {
+                auto const& states = queryInterface.getStatesWithObservation(observation);
+                for (auto const& support : queryInterface.getWinningRegion().getWinningSetsPerObservation(observation)) {
+                    if (support.empty()) {
+                        continue;
+                    }
+                    beliefSupport.clear();
+                    for (uint64_t offset : support) {
+                        beliefSupport.set(states[offset]);
+                    }
+                    storm::storage::BitVector allowed(numberOfActions[observation]);
+                    for (uint64_t action = 0; action < numberOfActions[observation]; ++action) {
+                        if (queryInterface.staysInWinningRegion(beliefSupport, action)) {
+                            allowed.set(action);
+                        }
+                    }
+                    STORM_LOG_WARN_COND(!allowed.empty(), "No action keeps the winning support " << support << " of observation " << observation << " in the winning region.");
+                    shield.addSupport(observation, support, allowed);
+                }
+            }
+            return shield;
+        }
+
+        void BeliefSupportShield::addSupport(uint64_t observation, storm::storage::BitVector const& support, storm::storage::BitVector const& allowed) {
+            STORM_LOG_THROW(observation < getNumberOfObservations(), storm::exceptions::InvalidArgumentException, "Observation " << observation << " is out of range.");
+            STORM_LOG_THROW(support.size() == observationSizes[observation], storm::exceptions::InvalidArgumentException, "The support does not match the number of states with observation " << observation << ".");
+            STORM_LOG_THROW(allowed.size() == numberOfActions[observation], storm::exceptions::InvalidArgumentException, "The allowed actions do not match the number of actions at observation " << observation << ".");
+            supports[observation].push_back(support);
+            allowedActions[observation].push_back(allowed);
+        }
+
+        void BeliefSupportShield::getAllowedActions(uint64_t observation, storm::storage::BitVector const& support, storm::storage::BitVector& result) const {
+            STORM_LOG_ASSERT(observation < getNumberOfObservations(), "Observation " << observation << " is out of range.");
+            STORM_LOG_ASSERT(support.size() == observationSizes[observation], "The support does not match the number of states with observation " << observation << ".");
+            result.resize(numberOfActions[observation]);
+            result.clear();
+            for (uint64_t i = 0; i < supports[observation].size(); ++i) {
+                if (support.isSubsetOf(supports[observation][i])) {
+                    result |= allowedActions[observation][i];
+                }
+            }
+        }
+
+        storm::storage::BitVector BeliefSupportShield::getAllowedActions(uint64_t observation, storm::storage::BitVector const& support) const {
+            storm::storage::BitVector result;
+            getAllowedActions(observation, support, result);
+            return result;
+        }
+
+        uint64_t BeliefSupportShield::getNumberOfObservations() const {
+            return observationSizes.size();
+        }
+
+        uint64_t BeliefSupportShield::getObservationSize(uint64_t observation) const {
+            return observationSizes[observation];
+        }
+
+        uint64_t BeliefSupportShield::getNumberOfActions(uint64_t observation) const {
+            return numberOfActions[observation];
+        }
+
+        uint64_t BeliefSupportShield::getNumberOfSupports(uint64_t observation) const {
+            return supports[observation].size();
+        }
+
+        void BeliefSupportShield::storeToFile(std::string const& path, std::string const& preamble) const {
+            std::ofstream file;
+            storm::utility::openFile(path, file);
+            file << ":preamble" << std::endl;
+            file << preamble << std::endl;
+            file << ":beliefsupportshield" << std::endl;
+            for (auto const& sizes : {observationSizes, numberOfActions}) {
+                bool first = true;
+                for (auto const& size : sizes) {
+                    if (first) {
+                        first = false;
+                    } else {
+                        file << " ";
+                    }
+                    file << size;
+                }
+                file << std::endl;
+            }
+            // One line per observation. Each support is followed by the actions that are allowed at it.
+            for (uint64_t observation = 0; observation < getNumberOfObservations(); ++observation) {
+                for (uint64_t i = 0; i < supports[observation].size(); ++i) {
+                    supports[observation][i].store(file);
+                    file << ",";
+                    allowedActions[observation][i].store(file);
+                    file << ";";
+                }
+                file << std::endl;
+            }
+            storm::utility::closeFile(file);
+        }
+
+        std::pair<BeliefSupportShield, std::string> BeliefSupportShield::loadFromFile(std::string const& path) {
+            std::ifstream file;
+            storm::utility::openFile(path, file);
+            std::string line;
+            uint64_t state = 0; // 0 = expect preamble
+            uint64_t observation = 0;
+            std::vector<uint64_t> observationSizes;
+            BeliefSupportShield shield;
+            std::stringstream preamblestream;
+            auto parseNumbers = [](std::string const& line) {
+                std::vector<std::string> entries;
+                boost::split(entries, line, boost::is_space(), boost::token_compress_on);
+                std::vector<uint64_t> numbers;
+                for (auto const& entry : entries) {
+                    if (!entry.empty()) {
+                        numbers.push_back(std::stoul(entry));
+                    }
+                }
+                return numbers;
+            };
+            while (std::getline(file, line)) {
+                if (boost::starts_with(line, "#")) {
+                    continue;
+                }
+                if (state == 0) {
+                    STORM_LOG_THROW(line == ":preamble", storm::exceptions::WrongFormatException, "Expected to see :preamble");
+                    state = 1; // state = 1: preamble
+                } else if (state == 1) {
+                    if (line == ":beliefsupportshield") {
+                        state = 2; // get observation sizes
+                    } else {
+                        preamblestream << line << std::endl;
+                    }
+                } else if (state == 2) {
+                    observationSizes = parseNumbers(line);
+                    state = 3; // get number of actions
+                } else if (state == 3) {
+                    shield = BeliefSupportShield(observationSizes, parseNumbers(line));
+                    state = 4;
+                } else if (state == 4) {
+                    STORM_LOG_THROW(observation < shield.getNumberOfObservations(), storm::exceptions::WrongFormatException, "The shield contains more lines than observations.");
+                    std::vector<std::string> entries;
+                    boost::split(entries, line, boost::is_any_of(";"));
+                    entries.pop_back();
+                    for (std::string const& entry : entries) {
+                        std::vector<std::string> supportAndActions;
+                        boost::split(supportAndActions, entry, boost::is_any_of(","));
+                        STORM_LOG_THROW(supportAndActions.size() == 2, storm::exceptions::WrongFormatException, "Expected a support and the allowed actions in '" << entry << "'.");
+                        shield.addSupport(observation, storm::storage::BitVector::load(supportAndActions[0]), storm::storage::BitVector::load(supportAndActions[1]));
+                    }
+                    ++observation;
+                }
+            }
+            storm::utility::closeFile(file);
+            STORM_LOG_THROW(state == 4 && observation == shield.getNumberOfObservations(), storm::exceptions::WrongFormatException, "The shield file is incomplete.");
+            return {shield, preamblestream.str()};
+        }
+
+        template BeliefSupportShield BeliefSupportShield::create<double>(storm::models::sparse::Pomdp<double> const& pomdp, storm::pomdp::WinningRegionQueryInterface<double> const& queryInterface);
+        template BeliefSupportShield BeliefSupportShield::create<storm::RationalNumber>(storm::models::sparse::Pomdp<storm::RationalNumber> const& pomdp, storm::pomdp::WinningRegionQueryInterface<storm::RationalNumber> const& queryInterface);
+    }
+}
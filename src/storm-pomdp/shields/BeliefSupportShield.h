@@ -0,0 +1,67 @@
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/storage/BitVector.h"
+#include "storm-pomdp/analysis/WinningRegionQueryInterface.h"
+
+namespace tempest {
+    namespace shields {
+
+        /*!
+         * A safety shield for POMDPs that works on belief supports. For every observation, the shield stores the
+         * maximal winning belief supports together with the actions that keep each of these supports in the winning
+         * region. Belief supports are given as offsets within the states with the corresponding observation.
+         *
+         * As the winning region is downward closed, an action that is allowed at a support is also safe at each of its
+         * subsets. The actions allowed at a belief support are thus the actions that are allowed at one of the stored
+         * supports containing it. Within the winning region, the shield never blocks all actions.
+         */
+        class BeliefSupportShield {
+        public:
+            /*!
+             * Creates a shield without any winning supports.
+             *
+             * @param observationSizes For each observation, the number of states with that observation.
+             * @param numberOfActions For each observation, the number of actions that are available in its states.
+             */
+            BeliefSupportShield(std::vector<uint64_t> const& observationSizes = {}, std::vector<uint64_t> const& numberOfActions = {});
+
+            /*!
+             * Creates the shield for the winning region of the given query interface.
+             */
+            template<typename ValueType>
+            static BeliefSupportShield create(storm::models::sparse::Pomdp<ValueType> const& pomdp, storm::pomdp::WinningRegionQueryInterface<ValueType> const& queryInterface);
+
+            /*!
+             * Adds a winning support of the given observation together with the actions that are allowed at it.
+             */
+            void addSupport(uint64_t observation, storm::storage::BitVector const& support, storm::storage::BitVector const& allowedActions);
+
+            /*!
+             * Computes the actions that are allowed at the given belief support (given as offsets) of the given observation.
+             * The result is empty if the support is not winning.
+             */
+            void getAllowedActions(uint64_t observation, storm::storage::BitVector const& support, storm::storage::BitVector& result) const;
+            storm::storage::BitVector getAllowedActions(uint64_t observation, storm::storage::BitVector const& support) const;
+
+            uint64_t getNumberOfObservations() const;
+            uint64_t getObservationSize(uint64_t observation) const;
+            uint64_t getNumberOfActions(uint64_t observation) const;
+            uint64_t getNumberOfSupports(uint64_t observation) const;
+
+            void storeToFile(std::string const& path, std::string const& preamble = "") const;
+            static std::pair<BeliefSupportShield, std::string> loadFromFile(std::string const& path);
+
+        private:
+            std::vector<uint64_t> observationSizes;
+            std::vector<uint64_t> numberOfActions;
+            // For each observation, the maximal winning supports and the actions that are allowed at them.
+            std::vector<std::vector<storm::storage::BitVector>> supports;
+            std::vector<std::vector<storm::storage::BitVector>> allowedActions;
+        };
+    }
+}
@@ -1,6 +1,10 @@
 #include "storm-pomdp/storage/BeliefManager.h"
 
+#include <algorithm>
+#include <boost/functional/hash.hpp>
+
 #include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/constants.h"
 #include "storm/models/sparse/Pomdp.h"
@@ -13,6 +17,23 @@ namespace storm {
             return weights.size();
         }
 
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        BeliefManager<PomdpType, BeliefValueType, StateType>::PreparedBeliefs::PreparedBeliefs() : offsets(1, 0) {
+            // Intentionally left empty
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::PreparedBeliefs::size() const {
+            return values.size();
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::PreparedBeliefs::clear() {
+            entries.clear();
+            offsets.resize(1);
+            values.clear();
+        }
+
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         BeliefManager<PomdpType, BeliefValueType, StateType>::FreudenthalDiff::FreudenthalDiff(StateType const &dimension, BeliefValueType diff) : dimension(dimension),
                                                                                                                                                      diff(std::move(diff)) {
@@ -29,21 +50,27 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefHash::operator()(const BeliefType &belief) const {
-            std::size_t seed = 0;
-            // Assumes that beliefs are ordered
-            for (auto const &entry : belief) {
-                boost::hash_combine(seed, entry.first);
-                boost::hash_combine(seed, entry.second);
-            }
-            return seed;
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefEntry const* BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::begin() const {
+            return first;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefEntry const* BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::end() const {
+            return last;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::size() const {
+            return last - first;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefManager(PomdpType const &pomdp, BeliefValueType const &precision, TriangulationMode const &triangulationMode)
                 : pomdp(pomdp), triangulationMode(triangulationMode) {
             cc = storm::utility::ConstantsComparator<ValueType>(precision, false);
-            beliefToIdMap.resize(pomdp.getNrObservations());
+            beliefOffsets.push_back(0);
+            beliefIndex.resize(pomdp.getNrObservations());
+            beliefIndexSizes.resize(pomdp.getNrObservations(), 0);
             initialBeliefId = computeInitialBelief();
         }
 
@@ -133,7 +160,17 @@ namespace storm {
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation
         BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(BeliefId beliefId, BeliefValueType resolution) {
-            return triangulateBelief(getBelief(beliefId), resolution);
+            // The grid points are computed before they are stored, so the view on the stored belief is not invalidated while it is used.
+            PreparedBeliefs gridPoints;
+            triangulateBelief(getBelief(beliefId), resolution, gridPoints);
+            Triangulation result;
+            result.gridPoints.reserve(gridPoints.size());
+            result.weights.reserve(gridPoints.size());
+            for (uint64_t i = 0; i < gridPoints.size(); ++i) {
+                result.gridPoints.push_back(getOrAddBeliefId(getView(gridPoints, i)));
+                result.weights.push_back(gridPoints.values[i]);
+            }
+            return result;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -155,7 +192,7 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getNumberOfBeliefIds() const {
-            return beliefs.size();
+            return beliefHashes.size();
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -172,23 +209,85 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType const &BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(BeliefId const &id) const {
+        std::vector<typename BeliefManager<PomdpType, BeliefValueType, StateType>::PreparedBeliefs>
+        BeliefManager<PomdpType, BeliefValueType, StateType>::prepareExpansions(std::vector<std::pair<BeliefId, uint64_t>> const &beliefActionPairs,
+                                                                                boost::optional<std::vector<BeliefValueType>> const &observationResolutions) const {
+            std::vector<PreparedBeliefs> result(beliefActionPairs.size());
+            // Each range of belief-action pairs gets its own buffers, so the ranges do not share any mutable state.
+            auto prepareRange = [&] (uint64_t begin, uint64_t end) {
+                std::vector<std::pair<uint32_t, BeliefEntry>> successorBuffer;
+                PreparedBeliefs triangulationBuffer;
+                for (uint64_t i = begin; i < end; ++i) {
+                    prepareExpansion(beliefActionPairs[i].first, beliefActionPairs[i].second, observationResolutions, successorBuffer, triangulationBuffer, result[i]);
+                }
+            };
+#ifdef STORM_HAVE_INTELTBB
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, beliefActionPairs.size()), [&] (tbb::blocked_range<uint64_t> const& range) {
+                prepareRange(range.begin(), range.end());
+            });
+#else
+            prepareRange(0, beliefActionPairs.size());
+#endif
+            return result;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId, typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
+        BeliefManager<PomdpType, BeliefValueType, StateType>::finishExpansion(PreparedBeliefs const &expansion) {
+            std::vector<std::pair<BeliefId, ValueType>> destinations;
+            destinations.reserve(expansion.size());
+            for (uint64_t i = 0; i < expansion.size(); ++i) {
+                destinations.emplace_back(getOrAddBeliefId(getView(expansion, i)), expansion.values[i]);
+            }
+            return destinations;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView BeliefManager<PomdpType, BeliefValueType, StateType>::getView(std::vector<BeliefEntry> const &entries) {
+            return BeliefView{entries.data(), entries.data() + entries.size()};
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView BeliefManager<PomdpType, BeliefValueType, StateType>::getView(PreparedBeliefs const &beliefs, uint64_t index) {
+            return BeliefView{beliefs.entries.data() + beliefs.offsets[index], beliefs.entries.data() + beliefs.offsets[index + 1]};
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::addBelief(PreparedBeliefs &beliefs, BeliefView const &belief, ValueType const &value) {
+            beliefs.entries.insert(beliefs.entries.end(), belief.begin(), belief.end());
+            beliefs.offsets.push_back(beliefs.entries.size());
+            beliefs.values.push_back(value);
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::computeHash(BeliefView const &belief) {
+            std::size_t seed = 0;
+            // Assumes that beliefs are ordered
+            for (auto const &entry : belief) {
+                boost::hash_combine(seed, entry.first);
+                boost::hash_combine(seed, entry.second);
+            }
+            return seed;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(BeliefId const &id) const {
             STORM_LOG_ASSERT(id != noId(), "Tried to get a non-existend belief.");
             STORM_LOG_ASSERT(id < getNumberOfBeliefIds(), "Belief index " << id << " is out of range.");
-            return beliefs[id];
+            return BeliefView{beliefEntries.data() + beliefOffsets[id], beliefEntries.data() + beliefOffsets[id + 1]};
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getId(BeliefType const &belief) const {
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getId(BeliefView const &belief) const {
             uint32_t obs = getBeliefObservation(belief);
-            STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-            auto idIt = beliefToIdMap[obs].find(belief);
-            STORM_LOG_ASSERT(idIt != beliefToIdMap[obs].end(), "Unknown Belief.");
-            return idIt->second;
+            STORM_LOG_ASSERT(obs < beliefIndex.size(), "Belief has unknown observation.");
+            BeliefId id = findBeliefId(belief, computeHash(belief), obs);
+            STORM_LOG_ASSERT(id != noId(), "Unknown Belief.");
+            return id;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(BeliefType const &belief) const {
+        std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(BeliefView const &belief) const {
             std::stringstream str;
             str << "{ ";
             bool first = true;
@@ -205,7 +304,7 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqual(BeliefType const &first, BeliefType const &second) const {
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqual(BeliefView const &first, BeliefView const &second) const {
             if (first.size() != second.size()) {
                 return false;
             }
@@ -223,7 +322,7 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertBelief(BeliefType const &belief) const {
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertBelief(BeliefView const &belief) const {
             BeliefValueType sum = storm::utility::zero<ValueType>();
             boost::optional<uint32_t> observation;
             for (auto const &entry : belief) {
@@ -264,8 +363,8 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const {
-            if (triangulation.weights.size() != triangulation.gridPoints.size()) {
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(BeliefView const &belief, PreparedBeliefs const &triangulation) const {
+            if (triangulation.values.size() + 1 != triangulation.offsets.size()) {
                 STORM_LOG_ERROR("Number of weights and points in triangulation does not match.");
                 return false;
             }
@@ -273,50 +372,50 @@ namespace storm {
                 STORM_LOG_ERROR("Empty triangulation.");
                 return false;
             }
-            BeliefType triangulatedBelief;
+            boost::container::flat_map<StateType, BeliefValueType> triangulatedBelief;
             BeliefValueType weightSum = storm::utility::zero<BeliefValueType>();
-            for (uint64_t i = 0; i < triangulation.weights.size(); ++i) {
-                if (cc.isZero(triangulation.weights[i])) {
+            for (uint64_t i = 0; i < triangulation.size(); ++i) {
+                if (cc.isZero(triangulation.values[i])) {
                     STORM_LOG_ERROR("Zero weight in triangulation.");
                     return false;
                 }
-                if (cc.isLess(triangulation.weights[i], storm::utility::zero<BeliefValueType>())) {
+                if (cc.isLess(triangulation.values[i], storm::utility::zero<BeliefValueType>())) {
                     STORM_LOG_ERROR("Negative weight in triangulation.");
                     return false;
                 }
-                if (cc.isLess(storm::utility::one<BeliefValueType>(), triangulation.weights[i])) {
+                if (cc.isLess(storm::utility::one<BeliefValueType>(), triangulation.values[i])) {
                     STORM_LOG_ERROR("Weight greater than one in triangulation.");
                 }
-                weightSum += triangulation.weights[i];
-                BeliefType const &gridPoint = getBelief(triangulation.gridPoints[i]);
-                for (auto const &pointEntry : gridPoint) {
+                weightSum += triangulation.values[i];
+                for (auto const &pointEntry : getView(triangulation, i)) {
                     BeliefValueType &triangulatedValue = triangulatedBelief.emplace(pointEntry.first, storm::utility::zero<ValueType>()).first->second;
-                    triangulatedValue += triangulation.weights[i] * pointEntry.second;
+                    triangulatedValue += triangulation.values[i] * pointEntry.second;
                 }
             }
             if (!cc.isOne(weightSum)) {
                 STORM_LOG_ERROR("Triangulation weights do not sum up to one.");
                 return false;
             }
-            if (!assertBelief(triangulatedBelief)) {
+            std::vector<BeliefEntry> triangulatedEntries(triangulatedBelief.begin(), triangulatedBelief.end());
+            if (!assertBelief(getView(triangulatedEntries))) {
                 STORM_LOG_ERROR("Triangulated belief is not a belief.");
             }
-            if (!isEqual(belief, triangulatedBelief)) {
-                STORM_LOG_ERROR("Belief:\n\t" << toString(belief) << "\ndoes not match triangulated belief:\n\t" << toString(triangulatedBelief) << ".");
+            if (!isEqual(belief, getView(triangulatedEntries))) {
+                STORM_LOG_ERROR("Belief:\n\t" << toString(belief) << "\ndoes not match triangulated belief:\n\t" << toString(getView(triangulatedEntries)) << ".");
                 return false;
             }
             return true;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefType belief) const {
+        uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefView const &belief) const {
             STORM_LOG_ASSERT(assertBelief(belief), "Invalid belief.");
             return pomdp.getObservation(belief.begin()->first);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         void
-        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result) {
+        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreudenthal(BeliefView const &belief, BeliefValueType const &resolution, PreparedBeliefs &result) const {
             STORM_LOG_ASSERT(resolution != 0, "Invalid resolution: 0");
             STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
             StateType numEntries = belief.size();
@@ -340,8 +439,6 @@ namespace storm {
             // Insert a dummy 0 column in the qs matrix so the loops below are a bit simpler
             qsRow.push_back(storm::utility::zero<BeliefValueType>());
 
-            result.weights.reserve(numEntries);
-            result.gridPoints.reserve(numEntries);
             auto currentSortedDiff = sorted_diffs.begin();
             auto previousSortedDiff = sorted_diffs.end();
             --previousSortedDiff;
@@ -356,23 +453,22 @@ namespace storm {
                     qsRow[previousSortedDiff->dimension] += storm::utility::one<BeliefValueType>();
                 }
                 if (!cc.isZero(weight)) {
-                    result.weights.push_back(weight);
-                    // Compute the grid point
-                    BeliefType gridPoint;
+                    // Compute the grid point. As the local indices are ordered like the original states, so are the entries of the grid point.
                     for (StateType j = 0; j < numEntries; ++j) {
                         BeliefValueType gridPointEntry = qsRow[j] - qsRow[j + 1];
                         if (!cc.isZero(gridPointEntry)) {
-                            gridPoint[toOriginalIndicesMap[j]] = gridPointEntry / resolution;
+                            result.entries.emplace_back(toOriginalIndicesMap[j], gridPointEntry / resolution);
                         }
                     }
-                    result.gridPoints.push_back(getOrAddBeliefId(gridPoint));
+                    result.offsets.push_back(result.entries.size());
+                    result.values.push_back(weight);
                 }
                 previousSortedDiff = currentSortedDiff++;
             }
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result) {
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDynamic(BeliefView const &belief, BeliefValueType const &resolution, PreparedBeliefs &result) const {
             // Find the best resolution for this belief, i.e., N such that the largest distance between one of the belief values to a value in {i/N | 0 ≤ i ≤ N} is minimal
             STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
             BeliefValueType finalResolution = resolution;
@@ -409,14 +505,12 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation
-        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution) {
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(BeliefView const &belief, BeliefValueType const &resolution, PreparedBeliefs &result) const {
             STORM_LOG_ASSERT(assertBelief(belief), "Input belief for triangulation is not valid.");
-            Triangulation result;
+            result.clear();
             // Quickly triangulate Dirac beliefs
             if (belief.size() == 1u) {
-                result.weights.push_back(storm::utility::one<BeliefValueType>());
-                result.gridPoints.push_back(getOrAddBeliefId(belief));
+                addBelief(result, belief, storm::utility::one<BeliefValueType>());
             } else {
                 auto ceiledResolution = storm::utility::ceil<BeliefValueType>(resolution);
                 switch (triangulationMode) {
@@ -430,58 +524,72 @@ namespace storm {
                         STORM_LOG_ASSERT(false, "Invalid triangulation mode.");
                 }
             }
-            STORM_LOG_ASSERT(assertTriangulation(belief, result), "Incorrect triangulation: " << toString(result));
-            return result;
+            STORM_LOG_ASSERT(assertTriangulation(belief, result), "Incorrect triangulation of belief " << toString(belief) << ".");
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId, typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
-        BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
-                                                                             boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) {
-            std::vector<std::pair<BeliefId, ValueType>> destinations;
-
-            BeliefType belief = getBelief(beliefId);
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::prepareExpansion(BeliefId const &beliefId, uint64_t actionIndex, boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions,
+                                                                                    std::vector<std::pair<uint32_t, BeliefEntry>> &successorBuffer, PreparedBeliefs &triangulationBuffer, PreparedBeliefs &result) const {
+            result.clear();
 
-            // Find the probability we go to each observation
-            BeliefType successorObs; // This is actually not a belief but has the same type
-            for (auto const &pointEntry : belief) {
+            // Collect the successor states together with their observation and their (unnormalized) probability.
+            successorBuffer.clear();
+            for (auto const &pointEntry : getBelief(beliefId)) {
                 uint64_t state = pointEntry.first;
                 for (auto const &pomdpTransition : pomdp.getTransitionMatrix().getRow(state, actionIndex)) {
                     if (!storm::utility::isZero(pomdpTransition.getValue())) {
-                        auto obs = pomdp.getObservation(pomdpTransition.getColumn());
-                        addToDistribution(successorObs, obs, pointEntry.second * pomdpTransition.getValue());
+                        successorBuffer.emplace_back(pomdp.getObservation(pomdpTransition.getColumn()), BeliefEntry(pomdpTransition.getColumn(), pointEntry.second * pomdpTransition.getValue()));
                     }
                 }
             }
 
+            // Group the successors by observation. The sort is stable so that values are summed up in the order in which they occur.
+            std::stable_sort(successorBuffer.begin(), successorBuffer.end(), [] (std::pair<uint32_t, BeliefEntry> const &lhs, std::pair<uint32_t, BeliefEntry> const &rhs) { return lhs.first < rhs.first; });
+
             // Now for each successor observation we find and potentially triangulate the successor belief
-            for (auto const &successor : successorObs) {
-                BeliefType successorBelief;
-                for (auto const &pointEntry : belief) {
-                    uint64_t state = pointEntry.first;
-                    for (auto const &pomdpTransition : pomdp.getTransitionMatrix().getRow(state, actionIndex)) {
-                        if (pomdp.getObservation(pomdpTransition.getColumn()) == successor.first) {
-                            ValueType prob = pointEntry.second * pomdpTransition.getValue() / successor.second;
-                            addToDistribution(successorBelief, pomdpTransition.getColumn(), prob);
-                        }
+            std::vector<BeliefEntry> successorBelief;
+            auto groupBegin = successorBuffer.begin();
+            while (groupBegin != successorBuffer.end()) {
+                uint32_t successorObservation = groupBegin->first;
+                auto groupEnd = groupBegin;
+                ValueType successorObservationProbability = storm::utility::zero<ValueType>();
+                for (; groupEnd != successorBuffer.end() && groupEnd->first == successorObservation; ++groupEnd) {
+                    successorObservationProbability += groupEnd->second.second;
+                }
+
+                // Order the entries by state and merge the entries of the same state.
+                std::stable_sort(groupBegin, groupEnd, [] (std::pair<uint32_t, BeliefEntry> const &lhs, std::pair<uint32_t, BeliefEntry> const &rhs) { return lhs.second.first < rhs.second.first; });
+                successorBelief.clear();
+                for (auto entryIt = groupBegin; entryIt != groupEnd; ++entryIt) {
+                    BeliefValueType prob = entryIt->second.second / successorObservationProbability;
+                    if (!successorBelief.empty() && successorBelief.back().first == entryIt->second.first) {
+                        successorBelief.back().second += prob;
+                    } else {
+                        successorBelief.emplace_back(entryIt->second.first, prob);
                     }
                 }
-                STORM_LOG_ASSERT(assertBelief(successorBelief), "Invalid successor belief.");
+                STORM_LOG_ASSERT(assertBelief(getView(successorBelief)), "Invalid successor belief.");
 
                 // Insert the destination. We know that destinations have to be disjoined since they have different observations
                 if (observationTriangulationResolutions) {
-                    Triangulation triangulation = triangulateBelief(successorBelief, observationTriangulationResolutions.get()[successor.first]);
-                    for (size_t j = 0; j < triangulation.size(); ++j) {
-                        // Here we additionally assume that triangulation.gridPoints does not contain the same point multiple times
-                        destinations.emplace_back(triangulation.gridPoints[j], triangulation.weights[j] * successor.second);
+                    triangulateBelief(getView(successorBelief), observationTriangulationResolutions.get()[successorObservation], triangulationBuffer);
+                    for (uint64_t j = 0; j < triangulationBuffer.size(); ++j) {
+                        // Here we additionally assume that the triangulation does not contain the same point multiple times
+                        addBelief(result, getView(triangulationBuffer, j), triangulationBuffer.values[j] * successorObservationProbability);
                     }
                 } else {
-                    destinations.emplace_back(getOrAddBeliefId(successorBelief), successor.second);
+                    addBelief(result, getView(successorBelief), successorObservationProbability);
                 }
+                groupBegin = groupEnd;
             }
+        }
 
-            return destinations;
-
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId, typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
+        BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
+                                                                             boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) {
+            prepareExpansion(beliefId, actionIndex, observationTriangulationResolutions, expansionBuffer, triangulationBuffer, preparedExpansion);
+            return finishExpansion(preparedExpansion);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -490,24 +598,76 @@ namespace storm {
                              "POMDP contains more than one initial state");
             STORM_LOG_ASSERT(pomdp.getInitialStates().getNumberOfSetBits() == 1,
                              "POMDP does not contain an initial state");
-            BeliefType belief;
-            belief[*pomdp.getInitialStates().begin()] = storm::utility::one<ValueType>();
+            std::vector<BeliefEntry> belief;
+            belief.emplace_back(*pomdp.getInitialStates().begin(), storm::utility::one<BeliefValueType>());
+
+            STORM_LOG_ASSERT(assertBelief(getView(belief)), "Invalid initial belief.");
+            return getOrAddBeliefId(getView(belief));
+        }
 
-            STORM_LOG_ASSERT(assertBelief(belief), "Invalid initial belief.");
-            return getOrAddBeliefId(belief);
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::findBeliefId(BeliefView const &belief, uint64_t const &hash, uint32_t const &observation) const {
+            auto const &table = beliefIndex[observation];
+            if (table.empty()) {
+                return noId();
+            }
+            uint64_t const mask = table.size() - 1;
+            for (uint64_t slot = hash & mask; table[slot] != noId(); slot = (slot + 1) & mask) {
+                BeliefId const &candidate = table[slot];
+                if (beliefHashes[candidate] == hash) {
+                    // Beliefs are identified if they are exactly equal (without considering the precision)
+                    BeliefView candidateBelief = getBelief(candidate);
+                    if (candidateBelief.size() == belief.size() && std::equal(belief.begin(), belief.end(), candidateBelief.begin())) {
+                        return candidate;
+                    }
+                }
+            }
+            return noId();
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::addToIndex(BeliefId const &id, uint32_t const &observation) {
+            auto &table = beliefIndex[observation];
+            // Keep the load factor below 3/4
+            if (4 * (beliefIndexSizes[observation] + 1) > 3 * table.size()) {
+                std::vector<BeliefId> newTable(std::max<uint64_t>(16, 2 * table.size()), noId());
+                uint64_t const newMask = newTable.size() - 1;
+                for (auto const &storedId : table) {
+                    if (storedId != noId()) {
+                        // The cached hashes avoid touching the entries of the stored beliefs
+                        uint64_t slot = beliefHashes[storedId] & newMask;
+                        while (newTable[slot] != noId()) {
+                            slot = (slot + 1) & newMask;
+                        }
+                        newTable[slot] = storedId;
+                    }
+                }
+                table = std::move(newTable);
+            }
+            uint64_t const mask = table.size() - 1;
+            uint64_t slot = beliefHashes[id] & mask;
+            while (table[slot] != noId()) {
+                slot = (slot + 1) & mask;
+            }
+            table[slot] = id;
+            ++beliefIndexSizes[observation];
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getOrAddBeliefId(BeliefType const &belief) {
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getOrAddBeliefId(BeliefView const &belief) {
             uint32_t obs = getBeliefObservation(belief);
-            STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-            auto insertioRes = beliefToIdMap[obs].emplace(belief, beliefs.size());
-            if (insertioRes.second) {
-                // There actually was an insertion, so add the new belief
-                beliefs.push_back(belief);
-            }
-            // Return the id
-            return insertioRes.first->second;
+            STORM_LOG_ASSERT(obs < beliefIndex.size(), "Belief has unknown observation.");
+            uint64_t hash = computeHash(belief);
+            BeliefId id = findBeliefId(belief, hash, obs);
+            if (id == noId()) {
+                // The belief is new, so copy its entries to the arena
+                id = getNumberOfBeliefIds();
+                beliefEntries.insert(beliefEntries.end(), belief.begin(), belief.end());
+                beliefOffsets.push_back(beliefEntries.size());
+                beliefHashes.push_back(hash);
+                addToIndex(id, obs);
+            }
+            return id;
         }
 
         template class BeliefManager<storm::models::sparse::Pomdp<double>>;
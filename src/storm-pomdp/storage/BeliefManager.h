@@ -1,7 +1,6 @@
 #pragma once
 
 #include <vector>
-#include <unordered_map>
 #include <boost/optional.hpp>
 #include <boost/container/flat_map.hpp>
 #include <boost/container/flat_set.hpp>
@@ -15,7 +14,7 @@ namespace storm {
         class BeliefManager {
         public:
             typedef typename PomdpType::ValueType ValueType;
-            typedef boost::container::flat_map<StateType, BeliefValueType> BeliefType; // iterating over this shall be ordered (for correct hash computation)
+            typedef std::pair<StateType, BeliefValueType> BeliefEntry;
             typedef boost::container::flat_set<StateType> BeliefSupportType;
             typedef uint64_t BeliefId;
 
@@ -36,6 +35,19 @@ namespace storm {
                 uint64_t size() const;
             };
 
+            /*!
+             * Beliefs that are not (necessarily) stored in the manager, each together with a value, e.g., a probability or a triangulation weight.
+             * The entries of the i-th belief are given by the range [offsets[i], offsets[i+1]) of the entries.
+             */
+            struct PreparedBeliefs {
+                PreparedBeliefs();
+                std::vector<BeliefEntry> entries;
+                std::vector<uint64_t> offsets;
+                std::vector<ValueType> values;
+                uint64_t size() const;
+                void clear();
+            };
+
             BeliefId noId() const;
 
             bool isEqual(BeliefId const &first, BeliefId const &second) const;
@@ -69,10 +81,32 @@ namespace storm {
 
             std::vector<std::pair<BeliefId, ValueType>> expand(BeliefId const &beliefId, uint64_t actionIndex);
 
+            /*!
+             * Computes the successors of the given beliefs under the given (local) actions without storing them.
+             * If resolutions are given, the successors are triangulated, i.e., the result contains the grid points instead.
+             * As no beliefs are added, the expansions are computed in parallel if Intel TBB is available.
+             */
+            std::vector<PreparedBeliefs> prepareExpansions(std::vector<std::pair<BeliefId, uint64_t>> const &beliefActionPairs, boost::optional<std::vector<BeliefValueType>> const &observationResolutions) const;
+
+            /*!
+             * Stores the beliefs of the given prepared expansion and retrieves their ids together with their probabilities.
+             * New beliefs get their ids in the order in which the expansions are finished. Hence, finishing the prepared expansions in the
+             * order in which the beliefs would have been expanded yields the same ids as calling expand (or expandAndTriangulate).
+             */
+            std::vector<std::pair<BeliefId, ValueType>> finishExpansion(PreparedBeliefs const &expansion);
+
         private:
 
-            struct BeliefHash {
-                std::size_t operator()(const BeliefType &belief) const;
+            /*!
+             * A view on the entries of a belief, ordered by state.
+             * Views on stored beliefs are invalidated as soon as a new belief is added.
+             */
+            struct BeliefView {
+                BeliefEntry const* first;
+                BeliefEntry const* last;
+                BeliefEntry const* begin() const;
+                BeliefEntry const* end() const;
+                uint64_t size() const;
             };
 
             struct FreudenthalDiff {
@@ -83,39 +117,80 @@ namespace storm {
                 bool operator>(FreudenthalDiff const &other) const;
             };
 
-            BeliefType const &getBelief(BeliefId const &id) const;
+            static BeliefView getView(std::vector<BeliefEntry> const &entries);
+
+            static BeliefView getView(PreparedBeliefs const &beliefs, uint64_t index);
+
+            static void addBelief(PreparedBeliefs &beliefs, BeliefView const &belief, ValueType const &value);
 
-            BeliefId getId(BeliefType const &belief) const;
+            static uint64_t computeHash(BeliefView const &belief);
 
-            std::string toString(BeliefType const &belief) const;
+            BeliefView getBelief(BeliefId const &id) const;
 
-            bool isEqual(BeliefType const &first, BeliefType const &second) const;
+            BeliefId getId(BeliefView const &belief) const;
 
-            bool assertBelief(BeliefType const &belief) const;
+            std::string toString(BeliefView const &belief) const;
 
-            bool assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const;
+            bool isEqual(BeliefView const &first, BeliefView const &second) const;
 
-            uint32_t getBeliefObservation(BeliefType belief) const;
+            bool assertBelief(BeliefView const &belief) const;
 
-            void triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+            bool assertTriangulation(BeliefView const &belief, PreparedBeliefs const &triangulation) const;
 
-            void triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+            uint32_t getBeliefObservation(BeliefView const &belief) const;
 
-            Triangulation triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution);
+            void triangulateBeliefFreudenthal(BeliefView const &belief, BeliefValueType const &resolution, PreparedBeliefs &result) const;
+
+            void triangulateBeliefDynamic(BeliefView const &belief, BeliefValueType const &resolution, PreparedBeliefs &result) const;
+
+            /*!
+             * Computes the grid points of the triangulation of the given belief (without storing them). The values of the result are the weights.
+             */
+            void triangulateBelief(BeliefView const &belief, BeliefValueType const &resolution, PreparedBeliefs &result) const;
+
+            /*!
+             * Computes the successors of the given belief under the given action without storing them. The given buffers are used for intermediate results.
+             */
+            void prepareExpansion(BeliefId const &beliefId, uint64_t actionIndex, boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions,
+                                  std::vector<std::pair<uint32_t, BeliefEntry>> &successorBuffer, PreparedBeliefs &triangulationBuffer, PreparedBeliefs &result) const;
 
             std::vector<std::pair<BeliefId, ValueType>>
             expandInternal(BeliefId const &beliefId, uint64_t actionIndex, boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions = boost::none);
 
             BeliefId computeInitialBelief();
 
-            BeliefId getOrAddBeliefId(BeliefType const &belief);
+            /*!
+             * Retrieves the id of the given belief (with the given hash and observation) or noId() if the belief is not stored.
+             */
+            BeliefId findBeliefId(BeliefView const &belief, uint64_t const &hash, uint32_t const &observation) const;
+
+            /*!
+             * Retrieves the id of the given belief. If the belief is not stored yet, its entries are copied to the arena.
+             * The given belief must not be a view on a stored belief unless it is known to be stored already.
+             */
+            BeliefId getOrAddBeliefId(BeliefView const &belief);
+
+            /*!
+             * Inserts the given (stored) belief into the index of the given observation, growing the index if necessary.
+             */
+            void addToIndex(BeliefId const &id, uint32_t const &observation);
 
             PomdpType const& pomdp;
             std::vector<ValueType> pomdpActionRewardVector;
-            
-            std::vector<BeliefType> beliefs;
-            std::vector<std::unordered_map<BeliefType, BeliefId, BeliefHash>> beliefToIdMap;
+
+            // The entries of all beliefs are stored contiguously. The entries of belief i are given by the range [beliefOffsets[i], beliefOffsets[i+1]).
+            std::vector<BeliefEntry> beliefEntries;
+            std::vector<uint64_t> beliefOffsets;
+            std::vector<uint64_t> beliefHashes;
+            // For each observation, an open addressing hash table (with linear probing) over the ids of the beliefs with that observation. Empty slots hold noId().
+            std::vector<std::vector<BeliefId>> beliefIndex;
+            std::vector<uint64_t> beliefIndexSizes;
             BeliefId initialBeliefId;
+
+            // Buffers for the belief that is currently expanded.
+            std::vector<std::pair<uint32_t, BeliefEntry>> expansionBuffer;
+            PreparedBeliefs triangulationBuffer;
+            PreparedBeliefs preparedExpansion;
             
             storm::utility::ConstantsComparator<ValueType> cc;
             
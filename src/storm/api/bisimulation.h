@@ -2,6 +2,7 @@
 
 #include "storm/storage/bisimulation/DeterministicModelBisimulationDecomposition.h"
 #include "storm/storage/bisimulation/NondeterministicModelBisimulationDecomposition.h"
+#include "storm/models/sparse/Smg.h"
 
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/dd/BisimulationDecomposition.h"
@@ -38,10 +39,45 @@ namespace storm {
             return bisimulationDecomposition.getQuotient();
         }
         
+        /*!
+         * Minimizes the given game. The quotient remembers the original game and the state and choice mappings, so
+         * that shields computed on the quotient are exported for the original game.
+         */
+        template<typename ValueType>
+        std::shared_ptr<storm::models::sparse::Smg<ValueType>> performSmgBisimulationMinimization(std::shared_ptr<storm::models::sparse::Smg<ValueType>> model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, storm::storage::BisimulationType type) {
+            typename storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Smg<ValueType>>::Options options;
+            if (!formulas.empty()) {
+                options = typename storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Smg<ValueType>>::Options(*model, formulas);
+            }
+            options.setType(type);
+
+            storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Smg<ValueType>> bisimulationDecomposition(*model, options);
+            bisimulationDecomposition.computeBisimulationDecomposition();
+            auto quotient = bisimulationDecomposition.getQuotient();
+            typename storm::models::sparse::Smg<ValueType>::QuotientInformation quotientInformation;
+            // If the game is itself a quotient, relate the new quotient directly to the game that was minimized first.
+            if (model->hasQuotientInformation()) {
+                auto const& previousInformation = model->getQuotientInformation();
+                quotientInformation.originalModel = previousInformation.originalModel;
+                for (auto const& state : previousInformation.stateMapping) {
+                    quotientInformation.stateMapping.push_back(bisimulationDecomposition.getQuotientStateMapping()[state]);
+                }
+                for (auto const& choice : previousInformation.choiceMapping) {
+                    quotientInformation.choiceMapping.push_back(bisimulationDecomposition.getQuotientChoiceMapping()[choice]);
+                }
+            } else {
+                quotientInformation.originalModel = model;
+                quotientInformation.stateMapping = bisimulationDecomposition.getQuotientStateMapping();
+                quotientInformation.choiceMapping = bisimulationDecomposition.getQuotientChoiceMapping();
+            }
+            quotient->setQuotientInformation(quotientInformation);
+            return quotient;
+        }
+
         template <typename ValueType>
         std::shared_ptr<storm::models::sparse::Model<ValueType>> performBisimulationMinimization(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, storm::storage::BisimulationType type = storm::storage::BisimulationType::Strong) {
             
-            STORM_LOG_THROW(model->isOfType(storm::models::ModelType::Dtmc) || model->isOfType(storm::models::ModelType::Ctmc) || model->isOfType(storm::models::ModelType::Mdp), storm::exceptions::NotSupportedException, "Bisimulation minimization is currently only available for DTMCs, CTMCs and MDPs.");
+            STORM_LOG_THROW(model->isOfType(storm::models::ModelType::Dtmc) || model->isOfType(storm::models::ModelType::Ctmc) || model->isOfType(storm::models::ModelType::Mdp) || model->isOfType(storm::models::ModelType::Smg), storm::exceptions::NotSupportedException, "Bisimulation minimization is currently only available for DTMCs, CTMCs, MDPs and SMGs.");
 
             // Try to get rid of non state-rewards to easy bisimulation computation.
             model->reduceToStateBasedRewards();
@@ -50,6 +86,8 @@ namespace storm {
                 return performDeterministicSparseBisimulationMinimization<storm::models::sparse::Dtmc<ValueType>>(model->template as<storm::models::sparse::Dtmc<ValueType>>(), formulas, type);
             } else if (model->isOfType(storm::models::ModelType::Ctmc)) {
                 return performDeterministicSparseBisimulationMinimization<storm::models::sparse::Ctmc<ValueType>>(model->template as<storm::models::sparse::Ctmc<ValueType>>(), formulas, type);
+            } else if (model->isOfType(storm::models::ModelType::Smg)) {
+                return performSmgBisimulationMinimization<ValueType>(model->template as<storm::models::sparse::Smg<ValueType>>(), formulas, type);
             } else {
                 return performNondeterministicSparseBisimulationMinimization<storm::models::sparse::Mdp<ValueType>>(model->template as<storm::models::sparse::Mdp<ValueType>>(), formulas, type);
             }
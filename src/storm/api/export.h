@@ -6,6 +6,7 @@
 #include "storm/io/DDEncodingExporter.h"
 #include "storm/io/file.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/Statistics.h"
 #include "storm/storage/Scheduler.h"
 #include "storm/modelchecker/results/CheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
@@ -24,6 +25,7 @@ namespace storm {
 
         template <typename ValueType>
         void exportSparseModelAsDrn(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::string const& filename, std::vector<std::string> const& parameterNames = {}, bool allowPlaceholders=true) {
+            storm::utility::statistics::ScopedTimer exportTimer("drn-export");
             std::ofstream stream;
             storm::utility::openFile(filename, stream);
             storm::exporter::DirectEncodingOptions options;
@@ -39,6 +41,7 @@ namespace storm {
         
         template <typename ValueType>
         void exportSparseModelAsDot(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::string const& filename, size_t maxWidth = 30) {
+            storm::utility::statistics::ScopedTimer exportTimer("dot-export");
             std::ofstream stream;
             storm::utility::openFile(filename, stream);
             model->writeDotToStream(stream, maxWidth);
@@ -52,6 +55,7 @@ namespace storm {
         
         template <typename ValueType>
         void exportScheduler(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::storage::Scheduler<ValueType> const& scheduler, std::string const& filename) {
+            storm::utility::statistics::ScopedTimer exportTimer("scheduler-export");
             std::ofstream stream;
             storm::utility::openFile(filename, stream);
             std::string jsonFileExtension = ".json";
@@ -65,6 +69,7 @@ namespace storm {
         
         template <typename ValueType>
         inline void exportCheckResultToJson(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::unique_ptr<storm::modelchecker::CheckResult> const& checkResult, std::string const& filename) {
+            storm::utility::statistics::ScopedTimer exportTimer("result-export");
             std::ofstream stream;
             storm::utility::openFile(filename, stream);
             if (checkResult->isExplicitQualitativeCheckResult()) {
@@ -17,6 +17,7 @@
 #include "storm/modelchecker/abstraction/GameBasedMdpModelChecker.h"
 #include "storm/modelchecker/abstraction/BisimulationAbstractionRefinementModelChecker.h"
 #include "storm/modelchecker/exploration/SparseExplorationModelChecker.h"
+#include "storm/modelchecker/smc/StatisticalModelChecker.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 #include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
 
@@ -157,6 +158,42 @@ namespace storm {
             return verifyWithExplorationEngine(env, model, task);
         }
 
+        //
+        // Verifying with Statistical engine
+        //
+        template<typename ModelType>
+        std::unique_ptr<storm::modelchecker::CheckResult> verifyWithStatisticalModelChecker(storm::Environment const& env, storm::prism::Program const& program, storm::modelchecker::CheckTask<storm::logic::Formula, typename ModelType::ValueType> const& task) {
+            storm::modelchecker::StatisticalModelChecker<ModelType> checker(program);
+            STORM_LOG_THROW(checker.canHandle(task), storm::exceptions::NotSupportedException, "The statistical model checking engine cannot handle the property '" << task.getFormula() << "'. Only step-bounded probabilities of the initial state are supported.");
+            return checker.check(env, task);
+        }
+
+        template<typename ValueType>
+        typename std::enable_if<std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithStatisticalEngine(storm::Environment const& env, storm::storage::SymbolicModelDescription const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+            STORM_LOG_THROW(model.isPrismProgram(), storm::exceptions::NotSupportedException, "Statistical model checking engine is currently only applicable to PRISM models.");
+            storm::prism::Program const& program = model.asPrismProgram();
+
+            if (program.getModelType() == storm::prism::Program::ModelType::DTMC) {
+                return verifyWithStatisticalModelChecker<storm::models::sparse::Dtmc<ValueType>>(env, program, task);
+            } else if (program.getModelType() == storm::prism::Program::ModelType::MDP) {
+                return verifyWithStatisticalModelChecker<storm::models::sparse::Mdp<ValueType>>(env, program, task);
+            } else if (program.getModelType() == storm::prism::Program::ModelType::SMG) {
+                return verifyWithStatisticalModelChecker<storm::models::sparse::Smg<ValueType>>(env, program, task);
+            }
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The model type " << program.getModelType() << " is not supported by the statistical model checking engine.");
+        }
+
+        template<typename ValueType>
+        typename std::enable_if<!std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithStatisticalEngine(storm::Environment const&, storm::storage::SymbolicModelDescription const&, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const&) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Statistical model checking engine does not support data type.");
+        }
+
+        template<typename ValueType>
+        std::unique_ptr<storm::modelchecker::CheckResult> verifyWithStatisticalEngine(storm::storage::SymbolicModelDescription const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+            Environment env;
+            return verifyWithStatisticalEngine(env, model, task);
+        }
+
         //
         // Verifying with Sparse engine
         //
@@ -327,6 +364,24 @@ namespace storm {
             return result;
         }
 
+        /*!
+         * Computes the values of the given time-bounded formula (P=? [phi U<=t psi] or R=? [I=t]) for each of the given
+         * time points. All time points are handled within a single uniformization of the CTMC.
+         *
+         * @return One result per time point (in the order of the given time points).
+         */
+        template<typename ValueType>
+        std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> computeTimeSeriesWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmc, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::vector<double> const& timePoints) {
+            storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<ValueType>> modelchecker(*ctmc);
+            return modelchecker.computeTimeSeries(env, task, timePoints);
+        }
+
+        template<typename ValueType>
+        std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> computeTimeSeriesWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::vector<double> const& timePoints) {
+            STORM_LOG_THROW(model->getType() == storm::models::ModelType::Ctmc, storm::exceptions::NotSupportedException, "Computing time series for the model type " << model->getType() << " is not supported.");
+            return computeTimeSeriesWithSparseEngine(env, model->template as<storm::models::sparse::Ctmc<ValueType>>(), task, timePoints);
+        }
+
         //
         // Verifying with Hybrid engine
         //
@@ -39,7 +39,7 @@ namespace storm {
         }
         
 
-        BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels) : buildAllRewardModels(buildAllRewardModels), buildAllLabels(buildAllLabels), applyMaximalProgressAssumption(false), buildChoiceLabels(false), buildStateValuations(false), buildChoiceOrigins(false), scaleAndLiftTransitionRewards(true), explorationChecks(false), inferObservationsFromActions(false), addOverlappingGuardsLabel(false), addOutOfBoundsState(false), reservedBitsForUnboundedVariables(32), showProgress(false), showProgressDelay(0) {
+        BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels) : buildAllRewardModels(buildAllRewardModels), buildAllLabels(buildAllLabels), applyMaximalProgressAssumption(false), buildChoiceLabels(false), buildStateValuations(false), buildChoiceOrigins(false), scaleAndLiftTransitionRewards(true), explorationChecks(false), inferObservationsFromActions(false), addOverlappingGuardsLabel(false), addOutOfBoundsState(false), symmetryReduction(false), guardIndex(true), compileExpressions(false), reservedBitsForUnboundedVariables(32), showProgress(false), showProgressDelay(0) {
             // Intentionally left empty.
         }
         
@@ -163,6 +163,22 @@ namespace storm {
             return addOutOfBoundsState;
         }
         
+        bool BuilderOptions::isSymmetryReductionSet() const {
+            return symmetryReduction;
+        }
+
+        bool BuilderOptions::isGuardIndexSet() const {
+            return guardIndex;
+        }
+
+        bool BuilderOptions::isCompileExpressionsSet() const {
+            return compileExpressions;
+        }
+
+        std::string const& BuilderOptions::getCompiledExpressionsCacheDirectory() const {
+            return compiledExpressionsCacheDirectory;
+        }
+
         uint64_t BuilderOptions::getReservedBitsForUnboundedVariables() const {
             return reservedBitsForUnboundedVariables;
         }
@@ -261,6 +277,26 @@ namespace storm {
             addOutOfBoundsState = newValue;
             return *this;
         }
+
+        BuilderOptions& BuilderOptions::setSymmetryReduction(bool newValue) {
+            symmetryReduction = newValue;
+            return *this;
+        }
+
+        BuilderOptions& BuilderOptions::setGuardIndex(bool newValue) {
+            guardIndex = newValue;
+            return *this;
+        }
+
+        BuilderOptions& BuilderOptions::setCompileExpressions(bool newValue) {
+            compileExpressions = newValue;
+            return *this;
+        }
+
+        BuilderOptions& BuilderOptions::setCompiledExpressionsCacheDirectory(std::string const& directory) {
+            compiledExpressionsCacheDirectory = directory;
+            return *this;
+        }
         
         BuilderOptions& BuilderOptions::setReservedBitsForUnboundedVariables(uint64_t newValue) {
             reservedBitsForUnboundedVariables = newValue;
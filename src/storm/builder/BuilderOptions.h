@@ -115,6 +115,10 @@ namespace storm {
             bool isShowProgressSet() const;
             bool isScaleAndLiftTransitionRewardsSet() const;
             bool isAddOutOfBoundsStateSet() const;
+            bool isSymmetryReductionSet() const;
+            bool isGuardIndexSet() const;
+            bool isCompileExpressionsSet() const;
+            std::string const& getCompiledExpressionsCacheDirectory() const;
             uint64_t getReservedBitsForUnboundedVariables() const;
             bool isAddOverlappingGuardLabelSet() const;
             uint64_t getShowProgressDelay() const;
@@ -206,6 +210,33 @@ namespace storm {
              */
             BuilderOptions& setAddOverlappingGuardsLabel(bool newValue = true);
 
+            /**
+             * Should states that only differ in the valuation of symmetric modules be merged during exploration
+             * @param newValue The new value (default true)
+             * @return this
+             */
+            BuilderOptions& setSymmetryReduction(bool newValue = true);
+
+            /**
+             * Should the commands of PRISM programs be indexed by the values their guards require
+             * @param newValue The new value (default true)
+             * @return this
+             */
+            BuilderOptions& setGuardIndex(bool newValue = true);
+
+            /**
+             * Should the guards, update probabilities and assignments of PRISM programs be compiled to native code
+             * @param newValue The new value (default true)
+             * @return this
+             */
+            BuilderOptions& setCompileExpressions(bool newValue = true);
+
+            /**
+             * Sets the directory in which the compiled expressions are cached. If empty, a directory in the system's
+             * temporary directory is used.
+             */
+            BuilderOptions& setCompiledExpressionsCacheDirectory(std::string const& directory);
+
             /**
              * Sets the number of bits that will be reserved for unbounded integer variables.
              */
@@ -268,6 +299,18 @@ namespace storm {
             /// A flag indicating that the an additional state for out of bounds should be created.
             bool addOutOfBoundsState;
 
+            /// A flag indicating whether symmetric modules are detected and exploited during exploration.
+            bool symmetryReduction;
+
+            /// A flag indicating whether the commands of PRISM programs are indexed by their guards.
+            bool guardIndex;
+
+            /// A flag indicating whether the expressions of PRISM programs are compiled to native code.
+            bool compileExpressions;
+
+            /// The directory in which compiled expressions are cached (empty for the default).
+            std::string compiledExpressionsCacheDirectory;
+
             /// Indicates the number of bits that are reserved for the storage of unbounded integer variables.
             uint64_t reservedBitsForUnboundedVariables;
 
@@ -9,6 +9,7 @@
 #include "storm/exceptions/AbortException.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 #include "storm/generator/PrismNextStateGenerator.h"
 #include "storm/generator/JaniNextStateGenerator.h"
@@ -20,6 +21,7 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/settings/modules/BuildSettings.h"
+#include "storm/storage/DiskSparseMatrix.h"
 
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/jani/Model.h"
@@ -31,6 +33,7 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/prism.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/Statistics.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/SignalHandler.h"
 
@@ -40,7 +43,17 @@ namespace storm {
 
         template<typename StateType>
         StateType ExplicitStateLookup<StateType>::lookup(std::map<storm::expressions::Variable, storm::expressions::Expression> const& stateDescription) const {
+            std::vector<std::vector<uint64_t>> permutation;
+            return lookup(stateDescription, permutation);
+        }
+
+        template<typename StateType>
+        StateType ExplicitStateLookup<StateType>::lookup(std::map<storm::expressions::Variable, storm::expressions::Expression> const& stateDescription, std::vector<std::vector<uint64_t>>& permutation) const {
             auto cs = storm::generator::createCompressedState(this->varInfo, stateDescription, true);
+            permutation.clear();
+            if (symmetryReduction) {
+                cs = symmetryReduction->canonicalize(cs, permutation);
+            }
             //TODO search once
             if (!stateToId.contains(cs)) {
                 return static_cast<StateType>(this->size());
@@ -48,6 +61,14 @@ namespace storm {
             return this->stateToId.getValue(cs);
         }
 
+        template<typename StateType>
+        uint64_t ExplicitStateLookup<StateType>::translateActionIndex(uint64_t actionIndex, std::vector<std::vector<uint64_t>> const& permutation) const {
+            if (!symmetryReduction) {
+                return actionIndex;
+            }
+            return symmetryReduction->translateActionIndex(actionIndex, permutation);
+        }
+
         template<typename StateType>
         uint64_t ExplicitStateLookup<StateType>::size() const {
             return this->stateToId.size();
@@ -124,11 +145,16 @@ namespace storm {
 
         template <typename ValueType, typename RewardModelType, typename StateType>
         ExplicitStateLookup<StateType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::exportExplicitStateLookup() const {
-            return ExplicitStateLookup<StateType>(this->generator->getVariableInformation(), this->stateStorage.stateToId);
+            std::shared_ptr<storm::generator::PrismSymmetryReduction const> symmetryReduction;
+            if (auto prismGenerator = std::dynamic_pointer_cast<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(this->generator)) {
+                symmetryReduction = prismGenerator->getSymmetryReduction();
+            }
+            return ExplicitStateLookup<StateType>(this->generator->getVariableInformation(), this->stateStorage.stateToId, symmetryReduction);
         }
 
         template <typename ValueType, typename RewardModelType, typename StateType>
-        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
+        template <typename TransitionMatrixBuilderType>
+        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(TransitionMatrixBuilderType& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
 
             // Initialize building state valuations (if necessary)
             if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
@@ -307,14 +333,11 @@ namespace storm {
                 std::vector<uint_fast64_t> const& remapping = stateRemapping.get();
 
                 // We need to fix the following entities:
-                // (a) the transition matrix
+                // (a) the transition matrix (which is done by the caller)
                 // (b) the initial states
                 // (c) the hash map storing the mapping states -> ids
                 // (d) fix remapping for state-generation labels
 
-                // Fix (a).
-                transitionMatrixBuilder.replaceColumns(remapping, 0);
-
                 // Fix (b).
                 std::vector<StateType> newInitialStateIndices(this->stateStorage.initialStateIndices.size());
                 std::transform(this->stateStorage.initialStateIndices.begin(), this->stateStorage.initialStateIndices.end(), newInitialStateIndices.begin(), [&remapping] (StateType const& state) { return remapping[state]; } );
@@ -348,13 +371,21 @@ namespace storm {
             stateAndChoiceInformationBuilder.setBuildMarkovianStates(generator->getModelType() == storm::generator::ModelType::MA);
             stateAndChoiceInformationBuilder.setBuildStateValuations(generator->getOptions().isBuildStateValuationsSet());
 
+            storm::utility::statistics::ScopedTimer explorationTimer("state-space-exploration");
             buildMatrices(transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+            if (stateRemapping) {
+                transitionMatrixBuilder.replaceColumns(stateRemapping.get(), 0);
+            }
 
             // Initialize the model components with the obtained information.
             storm::storage::sparse::ModelComponents<ValueType, RewardModelType> modelComponents(transitionMatrixBuilder.build(0, transitionMatrixBuilder.getCurrentRowGroupCount()), buildStateLabeling(), std::unordered_map<std::string, RewardModelType>(), !generator->isDiscreteTimeModel());
 
             uint_fast64_t numStates = modelComponents.transitionMatrix.getColumnCount();
             uint_fast64_t numChoices = modelComponents.transitionMatrix.getRowCount();
+            storm::utility::statistics::setCounter("states", numStates);
+            storm::utility::statistics::setCounter("choices", numChoices);
+            storm::utility::statistics::setCounter("nonzeros", modelComponents.transitionMatrix.getEntryCount());
+            explorationTimer.stop();
 
             // Now finalize all reward models.
             for (auto& rewardModelBuilder : rewardModelBuilders) {
@@ -397,6 +428,43 @@ namespace storm {
             return modelComponents;
         }
 
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        OutOfCoreModelComponents ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildOutOfCore(std::string const&, uint64_t) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Out-of-core model building is only supported for double values.");
+        }
+
+        template <>
+        OutOfCoreModelComponents ExplicitModelBuilder<double, storm::models::sparse::StandardRewardModel<double>, uint32_t>::buildOutOfCore(std::string const& transitionMatrixFilename, uint64_t chunkSize) {
+            storm::generator::ModelType modelType = generator->getModelType();
+            STORM_LOG_THROW(modelType == storm::generator::ModelType::DTMC || modelType == storm::generator::ModelType::CTMC || modelType == storm::generator::ModelType::MDP || modelType == storm::generator::ModelType::SMG, storm::exceptions::NotSupportedException, "Out-of-core model building is not supported for this model type.");
+            // As rows are written in the order in which the states are explored, the state ids need to coincide with the exploration order.
+            STORM_LOG_THROW(options.explorationOrder == ExplorationOrder::Bfs, storm::exceptions::IllegalArgumentException, "Out-of-core model building requires a breadth-first exploration order.");
+
+            storm::storage::DiskSparseMatrixWriter<double> transitionMatrixWriter(transitionMatrixFilename, !generator->isDeterministicModel(), chunkSize);
+            std::vector<RewardModelBuilder<double>> rewardModelBuilders;
+            StateAndChoiceInformationBuilder stateAndChoiceInformationBuilder;
+            stateAndChoiceInformationBuilder.setBuildStatePlayerIndications(modelType == storm::generator::ModelType::SMG);
+
+            storm::utility::statistics::ScopedTimer explorationTimer("state-space-exploration");
+            buildMatrices(transitionMatrixWriter, rewardModelBuilders, stateAndChoiceInformationBuilder);
+
+            // Every choice has at least one entry, so the last row that was used is the last choice.
+            uint64_t numStates = stateStorage.getNumberOfStates();
+            uint64_t numChoices = transitionMatrixWriter.getLastRow() + 1;
+            transitionMatrixWriter.finalize(numChoices, numStates, numStates);
+            storm::utility::statistics::setCounter("states", numStates);
+            storm::utility::statistics::setCounter("choices", numChoices);
+            storm::utility::statistics::setCounter("nonzeros", transitionMatrixWriter.getEntryCount());
+            explorationTimer.stop();
+
+            OutOfCoreModelComponents result{transitionMatrixFilename, buildStateLabeling(), boost::none, boost::none};
+            if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications()) {
+                result.statePlayerIndications = stateAndChoiceInformationBuilder.buildStatePlayerIndications(numStates);
+                result.playerNameToIndexMap = generator->getPlayerNameToIndexMap();
+            }
+            return result;
+        }
+
         template <typename ValueType, typename RewardModelType, typename StateType>
         storm::models::sparse::StateLabeling ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildStateLabeling() {
             return generator->label(stateStorage, stateStorage.initialStateIndices, stateStorage.deadlockStateIndices);
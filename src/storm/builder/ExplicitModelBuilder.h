@@ -6,6 +6,8 @@
 #include <vector>
 #include <deque>
 #include <cstdint>
+#include <map>
+#include <string>
 #include <boost/functional/hash.hpp>
 #include <boost/container/flat_map.hpp>
 #include <boost/variant.hpp>
@@ -19,6 +21,7 @@
 #include "storm/models/sparse/StateLabeling.h"
 #include "storm/models/sparse/ChoiceLabeling.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/PlayerIndex.h"
 #include "storm/storage/sparse/ModelComponents.h"
 #include "storm/storage/sparse/StateStorage.h"
 #include "storm/settings/SettingsManager.h"
@@ -30,6 +33,7 @@
 #include "storm/generator/NextStateGenerator.h"
 #include "storm/generator/CompressedState.h"
 #include "storm/generator/VariableInformation.h"
+#include "storm/generator/PrismSymmetryReduction.h"
 
 namespace storm {
     namespace builder {
@@ -45,16 +49,33 @@ namespace storm {
         class ExplicitStateLookup {
         public:
             ExplicitStateLookup(VariableInformation const& varInfo,
-                                storm::storage::BitVectorHashMap<StateType> const& stateToId ) : varInfo(varInfo), stateToId(stateToId) {
+                                storm::storage::BitVectorHashMap<StateType> const& stateToId,
+                                std::shared_ptr<storm::generator::PrismSymmetryReduction const> const& symmetryReduction = nullptr) : varInfo(varInfo), stateToId(stateToId), symmetryReduction(symmetryReduction) {
                 // intentionally left empty.
             }
 
             /**
              * Lookup state
+             * If the model was built with symmetry reduction, the state is mapped to its canonical representative first.
              * @param stateDescription A map describing the state
              * @return The id of the state, or size() when no state is found
              */
             StateType lookup(std::map<storm::expressions::Variable, storm::expressions::Expression> const& stateDescription) const;
+            /**
+             * Lookup state and retrieve how it was permuted to obtain the stored representative
+             * @param stateDescription A map describing the state
+             * @param permutation The permutation that maps the state to its representative (only set with symmetry reduction)
+             * @return The id of the state, or size() when no state is found
+             */
+            StateType lookup(std::map<storm::expressions::Variable, storm::expressions::Expression> const& stateDescription, std::vector<std::vector<uint64_t>>& permutation) const;
+            /**
+             * Translates the action of a choice of a stored state (e.g. an action allowed by a shield computed on the
+             * reduced model) to the action of the corresponding choice in the looked-up state
+             * @param actionIndex The action index of the choice in the stored state
+             * @param permutation The permutation obtained when looking up the state
+             * @return The action index of the choice in the looked-up state
+             */
+            uint64_t translateActionIndex(uint64_t actionIndex, std::vector<std::vector<uint64_t>> const& permutation) const;
             /**
              * How many states have been stored?
              */
@@ -63,6 +84,22 @@ namespace storm {
         private:
             VariableInformation varInfo;
             storm::storage::BitVectorHashMap<StateType>  stateToId;
+            std::shared_ptr<storm::generator::PrismSymmetryReduction const> symmetryReduction;
+        };
+
+        /*!
+         * The components of a model whose transition matrix was written to disk during the exploration.
+         */
+        struct OutOfCoreModelComponents {
+            // The file holding the transition matrix. It can be read with a storm::storage::DiskSparseMatrix.
+            std::string transitionMatrixFilename;
+
+            // The labeling of the states.
+            storm::models::sparse::StateLabeling stateLabeling;
+
+            // The player that owns each state (only for stochastic multiplayer games).
+            boost::optional<std::vector<storm::storage::PlayerIndex>> statePlayerIndications;
+            boost::optional<std::map<std::string, storm::storage::PlayerIndex>> playerNameToIndexMap;
         };
 
         template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>, typename StateType = uint32_t>
@@ -109,6 +146,19 @@ namespace storm {
              */
             std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> build();
 
+            /*!
+             * Explores the model like build, but writes the transition matrix to the given file while exploring instead
+             * of keeping it in memory. The matrix is written in chunks of the given number of entries. Only the state
+             * storage and the state labeling are kept in memory, i.e., neither reward models nor state valuations or
+             * choice labels are built. This requires a breadth-first exploration order and is only supported for
+             * DTMCs, CTMCs, MDPs and SMGs with double values.
+             *
+             * @param transitionMatrixFilename The file to which the transition matrix is written.
+             * @param chunkSize The number of matrix entries that are buffered before they are written to disk.
+             * @return The remaining components of the model.
+             */
+            OutOfCoreModelComponents buildOutOfCore(std::string const& transitionMatrixFilename, uint64_t chunkSize = 1ull << 20);
+
             /*!
              * Export a wrapper that contains (a copy of) the internal information that maps states to ids.
              * This wrapper can be helpful to find states in later stages.
@@ -128,13 +178,15 @@ namespace storm {
             StateType getOrAddStateIndex(CompressedState const& state);
 
             /*!
-             * Builds the transition matrix and the transition reward matrix based for the given program.
+             * Builds the transition matrix and the transition reward matrix based for the given program. If the exploration
+             * order is not breadth-first, the columns of the transition matrix still need to be remapped afterwards.
              *
-             * @param transitionMatrixBuilder The builder of the transition matrix.
+             * @param transitionMatrixBuilder The builder of the transition matrix (a SparseMatrixBuilder or a DiskSparseMatrixWriter).
              * @param rewardModelBuilders The builders for the selected reward models.
              * @param stateAndChoiceInformationBuilder The builder for the requested information of the individual states and choices
              */
-            void buildMatrices(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
+            template<typename TransitionMatrixBuilderType>
+            void buildMatrices(TransitionMatrixBuilderType& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
 
             /*!
              * Explores the state space of the given program and returns the components of the model as a result.
@@ -168,6 +220,9 @@ namespace storm {
 
         };
 
+        template<>
+        OutOfCoreModelComponents ExplicitModelBuilder<double, storm::models::sparse::StandardRewardModel<double>, uint32_t>::buildOutOfCore(std::string const& transitionMatrixFilename, uint64_t chunkSize);
+
     } // namespace adapters
 } // namespace storm
 
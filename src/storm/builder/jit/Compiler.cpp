@@ -0,0 +1,94 @@
+#include "storm/builder/jit/Compiler.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <errno.h>
+#include <memory>
+#include <sstream>
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/JitBuilderSettings.h"
+
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidStateException.h"
+
+namespace storm {
+    namespace builder {
+        namespace jit {
+            
+            std::string const& getDynamicLibraryExtension() {
+#ifdef LINUX
+                static const std::string extension = ".so";
+#endif
+#ifdef MACOSX
+                static const std::string extension = ".dylib";
+#endif
+#ifdef WINDOWS
+                static const std::string extension = ".dll";
+#endif
+                return extension;
+            }
+            
+            boost::optional<std::string> execute(std::string command) {
+                auto start = std::chrono::high_resolution_clock::now();
+                char buffer[128];
+                std::stringstream output;
+                command += " 2>&1";
+                
+                STORM_LOG_TRACE("Executing command: " << command);
+                
+                std::unique_ptr<FILE> pipe(popen(command.c_str(), "r"));
+                STORM_LOG_THROW(pipe, storm::exceptions::InvalidStateException, "Call to popen failed: " << strerror(errno));
+                
+                while (!feof(pipe.get())) {
+                    if (fgets(buffer, 128, pipe.get()) != nullptr)
+                        output << buffer;
+                }
+                int result = pclose(pipe.get());
+                pipe.release();
+                
+                auto end = std::chrono::high_resolution_clock::now();
+                STORM_LOG_TRACE("Executing command took " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
+                
+                if (WEXITSTATUS(result) == 0) {
+                    return boost::none;
+                } else {
+                    return "Executing command failed. Got response: " + output.str();
+                }
+            }
+            
+            void getCompilerAndFlags(std::string& compiler, std::string& compilerFlags) {
+                storm::settings::modules::JitBuilderSettings const& settings = storm::settings::getModule<storm::settings::modules::JitBuilderSettings>();
+                if (settings.isCompilerSet()) {
+                    compiler = settings.getCompiler();
+                } else {
+                    const char* cxxEnv = std::getenv("CXX");
+                    if (cxxEnv != nullptr) {
+                        compiler = std::string(cxxEnv);
+                    }
+                    if (compiler.empty()) {
+                        compiler = "c++";
+                    }
+                }
+                if (settings.isCompilerFlagsSet()) {
+                    compilerFlags = settings.getCompilerFlags();
+                } else {
+                    std::stringstream flagStream;
+#ifdef LINUX
+                    flagStream << "-std=c++14 -fPIC -march=native -shared ";
+#endif
+#ifdef MACOSX
+                    flagStream << "-std=c++14 -stdlib=libc++ -fPIC -march=native -shared -undefined dynamic_lookup ";
+#endif
+                    
+                    flagStream << "-O" << settings.getOptimizationLevel();
+                    compilerFlags = flagStream.str();
+                }
+            }
+            
+        }
+    }
+}
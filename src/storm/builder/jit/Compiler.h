@@ -0,0 +1,33 @@
+#pragma once
+
+#include <string>
+
+#include <boost/optional.hpp>
+
+namespace storm {
+    namespace builder {
+        namespace jit {
+            
+            /*!
+             * Retrieves the file extension of dynamic libraries on the current platform (including the leading dot).
+             */
+            std::string const& getDynamicLibraryExtension();
+            
+            /*!
+             * Executes the given command. If the command fails with a non-zero error code, the error stream content
+             * is returned and boost::none otherwise.
+             */
+            boost::optional<std::string> execute(std::string command);
+            
+            /*!
+             * Retrieves the compiler and the flags used to compile shared libraries. They are taken from the jit builder
+             * settings if given and otherwise default to the CXX environment variable and flags for the current platform.
+             *
+             * @param compiler The compiler binary is written to this string.
+             * @param compilerFlags The compiler flags are written to this string.
+             */
+            void getCompilerAndFlags(std::string& compiler, std::string& compilerFlags);
+            
+        }
+    }
+}
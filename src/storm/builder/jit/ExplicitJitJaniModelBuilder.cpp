@@ -18,6 +18,7 @@
 
 
 #include "storm/builder/RewardModelInformation.h"
+#include "storm/builder/jit/Compiler.h"
 
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -44,15 +45,6 @@ namespace storm {
             
             static const std::string JIT_VARIABLE_EXTENSION = "_jit_";
             
-#ifdef LINUX
-            static const std::string DYLIB_EXTENSION = ".so";
-#endif
-#ifdef MACOSX
-            static const std::string DYLIB_EXTENSION = ".dylib";
-#endif
-#ifdef WINDOWS
-            static const std::string DYLIB_EXTENSION = ".dll";
-#endif
       
             template <typename ValueType, typename RewardModelType>
             storm::jani::ModelFeatures ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::getSupportedJaniFeatures() {
@@ -86,31 +78,7 @@ namespace storm {
                 
                 // Load all options from the settings module.
                 storm::settings::modules::JitBuilderSettings const& settings = storm::settings::getModule<storm::settings::modules::JitBuilderSettings>();
-                if (settings.isCompilerSet()) {
-                    compiler = settings.getCompiler();
-                } else {
-                    const char* cxxEnv = std::getenv("CXX");
-                    if (cxxEnv != nullptr) {
-                        compiler = std::string(cxxEnv);
-                    }
-                    if (compiler.empty()) {
-                        compiler = "c++";
-                    }
-                }
-                if (settings.isCompilerFlagsSet()) {
-                    compilerFlags = settings.getCompilerFlags();
-                } else {
-                    std::stringstream flagStream;
-#ifdef LINUX
-                    flagStream << "-std=c++14 -fPIC -march=native -shared ";
-#endif
-#ifdef MACOSX
-                    flagStream << "-std=c++14 -stdlib=libc++ -fPIC -march=native -shared -undefined dynamic_lookup ";
-#endif
-                    
-                    flagStream << "-O" << settings.getOptimizationLevel();
-                    compilerFlags = flagStream.str();
-                }
+                getCompilerAndFlags(compiler, compilerFlags);
                 if (settings.isBoostIncludeDirectorySet()) {
                     boostIncludeDirectory = settings.getBoostIncludeDirectory();
                 } else {
@@ -195,35 +163,6 @@ namespace storm {
                 // storm::jani::JsonExporter::toStream(this->model, std::vector<std::shared_ptr<storm::logic::Formula const>>(), std::cout, false);
             }
             
-            template <typename ValueType, typename RewardModelType>
-            boost::optional<std::string> ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::execute(std::string command) {
-                auto start = std::chrono::high_resolution_clock::now();
-                char buffer[128];
-                std::stringstream output;
-                command += " 2>&1";
-                
-                STORM_LOG_TRACE("Executing command: " << command);
-                
-                std::unique_ptr<FILE> pipe(popen(command.c_str(), "r"));
-                STORM_LOG_THROW(pipe, storm::exceptions::InvalidStateException, "Call to popen failed: " << strerror(errno));
-                
-                while (!feof(pipe.get())) {
-                    if (fgets(buffer, 128, pipe.get()) != nullptr)
-                        output << buffer;
-                }
-                int result = pclose(pipe.get());
-                pipe.release();
-                
-                auto end = std::chrono::high_resolution_clock::now();
-                STORM_LOG_TRACE("Executing command took " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
-                
-                if (WEXITSTATUS(result) == 0) {
-                    return boost::none;
-                } else {
-                    return "Executing command failed. Got response: " + output.str();
-                }
-            }
-            
             template <typename ValueType, typename RewardModelType>
             boost::filesystem::path ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::writeToTemporaryFile(std::string const& content, std::string const& suffix) {
                 boost::filesystem::path temporaryFile = boost::filesystem::unique_path("%%%%-%%%%-%%%%-%%%%" + suffix);
@@ -2529,7 +2468,7 @@ namespace storm {
             boost::filesystem::path ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::compileToSharedLibrary(boost::filesystem::path const& sourceFile) {
                 std::string sourceFilename = boost::filesystem::absolute(sourceFile).string();
                 auto dynamicLibraryPath = sourceFile;
-                dynamicLibraryPath += DYLIB_EXTENSION;
+                dynamicLibraryPath += getDynamicLibraryExtension();
                 std::string dynamicLibraryFilename = boost::filesystem::absolute(dynamicLibraryPath).string();
                 std::string includes = "";
                 for (std::string const& dir : {stormIncludeDirectory, sparseppIncludeDirectory, boostIncludeDirectory, carlIncludeDirectory, clnIncludeDirectory, gmpIncludeDirectory}) {
@@ -87,12 +87,6 @@ namespace storm {
                 bool checkStormHeadersAvailable() const;
                 bool checkCarlAvailable() const;
                 
-                /*!
-                 * Executes the given command. If the command fails with a non-zero error code, the error stream content
-                 * is returned and boost::none otherwise.
-                 */
-                static boost::optional<std::string> execute(std::string command);
-                
                 /*!
                  * Writes the given content to a temporary file. The temporary file is created to have the provided suffix.
                  */
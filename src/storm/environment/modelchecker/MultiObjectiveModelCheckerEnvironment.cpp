@@ -4,6 +4,7 @@
 #include "storm/settings/modules/MultiObjectiveSettings.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
 
 #include "storm/exceptions/IllegalArgumentException.h"
 namespace storm {
@@ -42,6 +43,9 @@ namespace storm {
         }
         
         printResults = multiobjectiveSettings.isPrintResultsSet();
+        if (multiobjectiveSettings.isShieldWeightVectorSet()) {
+            shieldWeightVector = storm::utility::vector::convertNumericVector<storm::RationalNumber>(multiobjectiveSettings.getShieldWeightVector());
+        }
     }
     
     MultiObjectiveModelCheckerEnvironment::~MultiObjectiveModelCheckerEnvironment() {
@@ -159,4 +163,20 @@ namespace storm {
     void MultiObjectiveModelCheckerEnvironment::setPrintResults(bool value) {
         printResults = value;
     }
-}
\ No newline at end of file
+    
+    bool MultiObjectiveModelCheckerEnvironment::isShieldWeightVectorSet() const {
+        return shieldWeightVector.is_initialized();
+    }
+    
+    std::vector<storm::RationalNumber> const& MultiObjectiveModelCheckerEnvironment::getShieldWeightVector() const {
+        return shieldWeightVector.get();
+    }
+    
+    void MultiObjectiveModelCheckerEnvironment::setShieldWeightVector(std::vector<storm::RationalNumber> const& value) {
+        shieldWeightVector = value;
+    }
+    
+    void MultiObjectiveModelCheckerEnvironment::unsetShieldWeightVector() {
+        shieldWeightVector = boost::none;
+    }
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/modelchecker/multiobjective/MultiObjectiveModelCheckingMethod.h"
@@ -61,6 +62,11 @@ namespace storm {
         bool isPrintResultsSet() const;
         void setPrintResults(bool value);
         
+        bool isShieldWeightVectorSet() const;
+        std::vector<storm::RationalNumber> const& getShieldWeightVector() const;
+        void setShieldWeightVector(std::vector<storm::RationalNumber> const& value);
+        void unsetShieldWeightVector();
+        
     private:
         storm::modelchecker::multiobjective::MultiObjectiveMethod method;
         boost::optional<std::string> plotPathUnderApprox, plotPathOverApprox, plotPathParetoPoints;
@@ -70,6 +76,7 @@ namespace storm {
         boost::optional<uint64_t> maxSteps;
         boost::optional<storm::storage::SchedulerClass> schedulerRestriction;
         bool printResults;
+        boost::optional<std::vector<storm::RationalNumber>> shieldWeightVector;
     };
 }
 
@@ -5,6 +5,8 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
+#include "storm/exceptions/InvalidArgumentException.h"
+
 namespace storm {
     
     GameSolverEnvironment::GameSolverEnvironment() {
@@ -20,6 +22,12 @@ namespace storm {
         precision = storm::utility::convertNumber<storm::RationalNumber>(gameSettings.getPrecision());
         considerRelativeTerminationCriterion = gameSettings.getConvergenceCriterion() == storm::settings::modules::GameSolverSettings::ConvergenceCriterion::Relative;
         STORM_LOG_ASSERT(considerRelativeTerminationCriterion || gameSettings.getConvergenceCriterion() == storm::settings::modules::GameSolverSettings::ConvergenceCriterion::Absolute, "Unknown convergence criterion");
+        if (gameSettings.isTraceSet()) {
+            traceFile = gameSettings.getTraceFilename();
+        }
+        if (gameSettings.isTimeBudgetSet()) {
+            timeBudget = gameSettings.getTimeBudget();
+        }
     }
 
     GameSolverEnvironment::~GameSolverEnvironment() {
@@ -64,5 +72,38 @@ namespace storm {
         considerRelativeTerminationCriterion = value;
     }
 
+    bool GameSolverEnvironment::isTraceFileSet() const {
+        return traceFile.is_initialized();
+    }
 
+    std::string const& GameSolverEnvironment::getTraceFile() const {
+        STORM_LOG_ASSERT(isTraceFileSet(), "Tried to get the trace file but none was set.");
+        return traceFile.get();
+    }
+
+    void GameSolverEnvironment::setTraceFile(std::string const& value) {
+        traceFile = value;
+    }
+
+    void GameSolverEnvironment::unsetTraceFile() {
+        traceFile = boost::none;
+    }
+
+    bool GameSolverEnvironment::isTimeBudgetSet() const {
+        return timeBudget.is_initialized();
+    }
+
+    double GameSolverEnvironment::getTimeBudget() const {
+        STORM_LOG_ASSERT(isTimeBudgetSet(), "Tried to get the time budget but none was set.");
+        return timeBudget.get();
+    }
+
+    void GameSolverEnvironment::setTimeBudget(double seconds) {
+        STORM_LOG_THROW(seconds > 0.0, storm::exceptions::InvalidArgumentException, "The time budget must be positive.");
+        timeBudget = seconds;
+    }
+
+    void GameSolverEnvironment::unsetTimeBudget() {
+        timeBudget = boost::none;
+    }
 }
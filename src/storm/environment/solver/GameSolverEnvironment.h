@@ -1,5 +1,8 @@
 #pragma once
 
+#include <string>
+#include <boost/optional.hpp>
+
 #include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/adapters/RationalNumberAdapter.h"
@@ -25,6 +28,14 @@ namespace storm {
         void setRelativeTerminationCriterion(bool value);
         storm::solver::MultiplicationStyle const& getMultiplicationStyle() const;
         void setMultiplicationStyle(storm::solver::MultiplicationStyle value);
+        bool isTraceFileSet() const;
+        std::string const& getTraceFile() const;
+        void setTraceFile(std::string const& value);
+        void unsetTraceFile();
+        bool isTimeBudgetSet() const;
+        double getTimeBudget() const;
+        void setTimeBudget(double seconds);
+        void unsetTimeBudget();
         
     private:
         storm::solver::GameMethod gameMethod;
@@ -32,6 +43,8 @@ namespace storm {
         uint64_t maxIterationCount;
         storm::RationalNumber precision;
         bool considerRelativeTerminationCriterion;
+        boost::optional<std::string> traceFile;
+        boost::optional<double> timeBudget;
     };
 }
 
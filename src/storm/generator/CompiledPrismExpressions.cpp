@@ -0,0 +1,386 @@
+#include "storm/generator/CompiledPrismExpressions.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <unordered_set>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/optional.hpp>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/storage/expressions/ExpressionVisitor.h"
+#include "storm/storage/expressions/ToCppVisitor.h"
+
+#include "storm/builder/jit/Compiler.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/BaseException.h"
+#include "storm/exceptions/UnexpectedException.h"
+
+namespace storm {
+    namespace generator {
+
+        namespace {
+            typedef CompiledPrismExpressions::GuardFunction GuardFunction;
+            typedef CompiledPrismExpressions::LikelihoodFunction LikelihoodFunction;
+            typedef CompiledPrismExpressions::AssignmentFunction AssignmentFunction;
+
+            /*!
+             * Determines whether an expression can be translated to C++ and whether its arithmetic needs to be carried out
+             * on doubles (like in the expression evaluator) rather than on integers.
+             */
+            class CompilabilityVisitor : public storm::expressions::ExpressionVisitor {
+            public:
+                CompilabilityVisitor(std::unordered_set<storm::expressions::Variable> const& knownVariables) : knownVariables(knownVariables), compilable(true), hasModulo(false), requiresDoubles(false), inCondition(false) {
+                    // Intentionally left empty.
+                }
+
+                void check(storm::expressions::Expression const& expression) {
+                    compilable = true;
+                    hasModulo = false;
+                    requiresDoubles = false;
+                    inCondition = false;
+                    expression.getBaseExpression().accept(*this, boost::none);
+                    // The translation casts either all or no integers to doubles, so integer and floating point
+                    // operations can not be mixed.
+                    if (hasModulo && requiresDoubles) {
+                        compilable = false;
+                    }
+                }
+
+                bool isCompilable() const {
+                    return compilable;
+                }
+
+                bool isDoubleRequired() const {
+                    return requiresDoubles;
+                }
+
+                virtual boost::any visit(storm::expressions::IfThenElseExpression const& expression, boost::any const& data) override {
+                    // Conditions are always translated without casts.
+                    bool previousInCondition = inCondition;
+                    inCondition = true;
+                    expression.getCondition()->accept(*this, data);
+                    inCondition = previousInCondition;
+                    expression.getThenExpression()->accept(*this, data);
+                    expression.getElseExpression()->accept(*this, data);
+                    return boost::none;
+                }
+
+                virtual boost::any visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const& data) override {
+                    expression.getFirstOperand()->accept(*this, data);
+                    expression.getSecondOperand()->accept(*this, data);
+                    return boost::none;
+                }
+
+                virtual boost::any visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const& data) override {
+                    switch (expression.getOperatorType()) {
+                        case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Modulo:
+                            hasModulo = true;
+                            break;
+                        case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Divide:
+                        case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Power:
+                        case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Min:
+                        case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Max:
+                            if (inCondition) {
+                                compilable = false;
+                            }
+                            requiresDoubles = true;
+                            break;
+                        default:
+                            break;
+                    }
+                    expression.getFirstOperand()->accept(*this, data);
+                    expression.getSecondOperand()->accept(*this, data);
+                    return boost::none;
+                }
+
+                virtual boost::any visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const& data) override {
+                    expression.getFirstOperand()->accept(*this, data);
+                    expression.getSecondOperand()->accept(*this, data);
+                    return boost::none;
+                }
+
+                virtual boost::any visit(storm::expressions::VariableExpression const& expression, boost::any const&) override {
+                    if (knownVariables.find(expression.getVariable()) == knownVariables.end()) {
+                        compilable = false;
+                    }
+                    return boost::none;
+                }
+
+                virtual boost::any visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const& data) override {
+                    expression.getOperand()->accept(*this, data);
+                    return boost::none;
+                }
+
+                virtual boost::any visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const& data) override {
+                    expression.getOperand()->accept(*this, data);
+                    return boost::none;
+                }
+
+                virtual boost::any visit(storm::expressions::BooleanLiteralExpression const&, boost::any const&) override {
+                    return boost::none;
+                }
+
+                virtual boost::any visit(storm::expressions::IntegerLiteralExpression const&, boost::any const&) override {
+                    return boost::none;
+                }
+
+                virtual boost::any visit(storm::expressions::RationalLiteralExpression const&, boost::any const&) override {
+                    return boost::none;
+                }
+
+                virtual boost::any visit(storm::expressions::PredicateExpression const&, boost::any const&) override {
+                    compilable = false;
+                    return boost::none;
+                }
+
+            private:
+                std::unordered_set<storm::expressions::Variable> const& knownVariables;
+                bool compilable;
+                bool hasModulo;
+                bool requiresDoubles;
+                bool inCondition;
+            };
+
+            uint64_t computeFnv1aHash(std::string const& content) {
+                uint64_t hash = 14695981039346656037ull;
+                for (char character : content) {
+                    hash ^= static_cast<unsigned char>(character);
+                    hash *= 1099511628211ull;
+                }
+                return hash;
+            }
+
+            /*!
+             * Creates the given directory (accessible only by the current user) if it does not exist and checks that no
+             * other user can place shared objects in it, as these are loaded into the process.
+             */
+            bool preparePrivateDirectory(boost::filesystem::path const& directory) {
+                if (!boost::filesystem::exists(directory)) {
+                    if (directory.has_parent_path()) {
+                        boost::filesystem::create_directories(directory.parent_path());
+                    }
+                    if (mkdir(directory.c_str(), S_IRWXU) != 0 && errno != EEXIST) {
+                        STORM_LOG_WARN("Unable to create the directory '" << directory.string() << "': " << strerror(errno));
+                        return false;
+                    }
+                }
+                // Use lstat so that a symbolic link planted by another user is not followed.
+                struct stat status;
+                if (lstat(directory.c_str(), &status) != 0 || !S_ISDIR(status.st_mode)) {
+                    STORM_LOG_WARN("The path '" << directory.string() << "' is not a directory.");
+                    return false;
+                }
+                if (status.st_uid != geteuid() || (status.st_mode & (S_IWGRP | S_IWOTH)) != 0) {
+                    STORM_LOG_WARN("The directory '" << directory.string() << "' is not owned by the current user or writable by other users.");
+                    return false;
+                }
+                return true;
+            }
+
+            template<typename FunctionType>
+            void loadFunctionTable(boost::dll::shared_library const& library, std::string const& name, uint64_t expectedSize, std::vector<FunctionType>& functions) {
+                FunctionType const* table = library.get<FunctionType const*()>(name)();
+                functions.clear();
+                functions.reserve(expectedSize);
+                for (; *table != nullptr; ++table) {
+                    functions.push_back(*table);
+                }
+                STORM_LOG_THROW(functions.size() == expectedSize, storm::exceptions::UnexpectedException, "The shared object provides " << functions.size() << " functions in '" << name << "' but " << expectedSize << " were expected.");
+            }
+        }
+
+        CompiledPrismExpressions::CompiledPrismExpressions(VariableInformation const& variableInformation) : loadedFromCache(false) {
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                integerBitOffsets.push_back(integerVariable.bitOffset);
+                integerBitWidths.push_back(integerVariable.bitWidth);
+                integerLowerBounds.push_back(integerVariable.lowerBound);
+            }
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                booleanBitOffsets.push_back(booleanVariable.bitOffset);
+            }
+            integerValues.resize(integerBitOffsets.size());
+            booleanValues.resize(booleanBitOffsets.size());
+        }
+
+        std::unique_ptr<CompiledPrismExpressions> CompiledPrismExpressions::create(storm::prism::Program const& program, VariableInformation const& variableInformation, std::string const& cacheDirectory) {
+            // Name the variables by their position in the variable information.
+            std::unordered_map<storm::expressions::Variable, std::string> variableToName;
+            std::unordered_set<storm::expressions::Variable> knownVariables;
+            for (uint64_t index = 0; index < variableInformation.integerVariables.size(); ++index) {
+                variableToName[variableInformation.integerVariables[index].variable] = "i[" + std::to_string(index) + "]";
+                knownVariables.insert(variableInformation.integerVariables[index].variable);
+            }
+            for (uint64_t index = 0; index < variableInformation.booleanVariables.size(); ++index) {
+                variableToName[variableInformation.booleanVariables[index].variable] = "b[" + std::to_string(index) + "]";
+                knownVariables.insert(variableInformation.booleanVariables[index].variable);
+            }
+            std::unordered_map<storm::expressions::Variable, std::string> variablePrefixes;
+
+            CompilabilityVisitor compilabilityVisitor(knownVariables);
+            storm::expressions::ToCppVisitor expressionTranslator;
+            auto translate = [&] (storm::expressions::Expression const& expression, std::string& code) {
+                compilabilityVisitor.check(expression);
+                if (!compilabilityVisitor.isCompilable()) {
+                    STORM_LOG_INFO("Expression '" << expression << "' can not be compiled. Falling back to interpreting all expressions.");
+                    return false;
+                }
+                storm::expressions::ToCppTranslationMode mode = compilabilityVisitor.isDoubleRequired() ? storm::expressions::ToCppTranslationMode::CastDouble : storm::expressions::ToCppTranslationMode::KeepType;
+                code = expressionTranslator.translate(expression, storm::expressions::ToCppTranslationOptions(variablePrefixes, variableToName, mode));
+                return true;
+            };
+
+            // Collect the code of all expressions, indexed by the global indices of the commands and updates.
+            std::vector<std::string> guardCode(program.getNumberOfCommands());
+            std::vector<std::string> likelihoodCode;
+            std::vector<std::vector<std::string>> assignmentCode;
+            for (auto const& module : program.getModules()) {
+                for (auto const& command : module.getCommands()) {
+                    if (!translate(command.getGuardExpression(), guardCode[command.getGlobalIndex()])) {
+                        return nullptr;
+                    }
+                    for (auto const& update : command.getUpdates()) {
+                        if (update.getGlobalIndex() >= likelihoodCode.size()) {
+                            likelihoodCode.resize(update.getGlobalIndex() + 1);
+                            assignmentCode.resize(update.getGlobalIndex() + 1);
+                        }
+                        if (!translate(update.getLikelihoodExpression(), likelihoodCode[update.getGlobalIndex()])) {
+                            return nullptr;
+                        }
+                        for (auto const& assignment : update.getAssignments()) {
+                            std::string code;
+                            if (!translate(assignment.getExpression(), code)) {
+                                return nullptr;
+                            }
+                            if (assignment.getExpression().hasBooleanType()) {
+                                assignmentCode[update.getGlobalIndex()].push_back("(" + code + ") ? 1 : 0");
+                            } else {
+                                assignmentCode[update.getGlobalIndex()].push_back("static_cast<std::int64_t>(" + code + ")");
+                            }
+                        }
+                    }
+                }
+            }
+
+            std::unique_ptr<CompiledPrismExpressions> result(new CompiledPrismExpressions(variableInformation));
+            uint64_t numberOfAssignments = 0;
+            for (auto const& updateAssignments : assignmentCode) {
+                result->assignmentOffsets.push_back(numberOfAssignments);
+                numberOfAssignments += updateAssignments.size();
+            }
+
+            std::stringstream source;
+            source << "#include <algorithm>" << std::endl << "#include <cmath>" << std::endl << "#include <cstdint>" << std::endl << std::endl;
+            source << "typedef bool (*GuardFunction)(std::int64_t const*, unsigned char const*);" << std::endl;
+            source << "typedef double (*LikelihoodFunction)(std::int64_t const*, unsigned char const*);" << std::endl;
+            source << "typedef std::int64_t (*AssignmentFunction)(std::int64_t const*, unsigned char const*);" << std::endl << std::endl;
+            source << "namespace {" << std::endl;
+            for (uint64_t index = 0; index < guardCode.size(); ++index) {
+                source << "bool guard" << index << "(std::int64_t const* i, unsigned char const* b) { return " << guardCode[index] << "; }" << std::endl;
+            }
+            for (uint64_t index = 0; index < likelihoodCode.size(); ++index) {
+                source << "double likelihood" << index << "(std::int64_t const* i, unsigned char const* b) { return " << likelihoodCode[index] << "; }" << std::endl;
+            }
+            uint64_t assignmentIndex = 0;
+            for (auto const& updateAssignments : assignmentCode) {
+                for (auto const& code : updateAssignments) {
+                    source << "std::int64_t assignment" << assignmentIndex << "(std::int64_t const* i, unsigned char const* b) { return " << code << "; }" << std::endl;
+                    ++assignmentIndex;
+                }
+            }
+            source << "}" << std::endl << std::endl;
+
+            // The tables are terminated by a null pointer.
+            auto printTable = [&source] (std::string const& type, std::string const& name, std::string const& functionName, uint64_t size) {
+                source << "extern \"C\" " << type << " const* " << name << "() {" << std::endl << "    static " << type << " const table[] = {";
+                for (uint64_t index = 0; index < size; ++index) {
+                    source << functionName << index << ", ";
+                }
+                source << "nullptr};" << std::endl << "    return table;" << std::endl << "}" << std::endl;
+            };
+            printTable("GuardFunction", "storm_prism_guards", "guard", guardCode.size());
+            printTable("LikelihoodFunction", "storm_prism_likelihoods", "likelihood", likelihoodCode.size());
+            printTable("AssignmentFunction", "storm_prism_assignments", "assignment", numberOfAssignments);
+
+            std::string compiler;
+            std::string compilerFlags;
+            storm::builder::jit::getCompilerAndFlags(compiler, compilerFlags);
+            std::string const& libraryExtension = storm::builder::jit::getDynamicLibraryExtension();
+
+            try {
+                // The default directory is private to the user as the temporary directory is shared by all users.
+                boost::filesystem::path directory = cacheDirectory.empty() ? boost::filesystem::temp_directory_path() / ("storm-prism-expressions-" + std::to_string(geteuid())) : boost::filesystem::path(cacheDirectory);
+                if (!preparePrivateDirectory(directory)) {
+                    STORM_LOG_WARN("Unable to use the cache directory for compiled expressions, the expressions are interpreted instead.");
+                    return nullptr;
+                }
+
+                // The shared object depends on the compiler and its flags as well.
+                std::stringstream hashStream;
+                hashStream << std::hex << std::setw(16) << std::setfill('0') << computeFnv1aHash(compiler + "\n" + compilerFlags + "\n" + source.str());
+                boost::filesystem::path libraryPath = directory / ("storm-prism-" + hashStream.str() + libraryExtension);
+
+                if (boost::filesystem::exists(libraryPath)) {
+                    STORM_LOG_INFO("Loading compiled expressions from '" << libraryPath.string() << "'.");
+                    result->loadedFromCache = true;
+                } else {
+                    boost::filesystem::path sourcePath = directory / boost::filesystem::unique_path("storm-prism-%%%%-%%%%-%%%%.cpp");
+                    boost::filesystem::path temporaryLibraryPath = directory / boost::filesystem::unique_path("storm-prism-%%%%-%%%%-%%%%" + libraryExtension);
+                    {
+                        std::ofstream out(sourcePath.native());
+                        out << source.str();
+                    }
+                    STORM_LOG_INFO("Compiling expressions of the program to '" << libraryPath.string() << "'.");
+                    boost::optional<std::string> error = storm::builder::jit::execute(compiler + " " + compilerFlags + " " + sourcePath.string() + " -o " + temporaryLibraryPath.string());
+                    boost::filesystem::remove(sourcePath);
+                    if (error) {
+                        boost::filesystem::remove(temporaryLibraryPath);
+                        STORM_LOG_WARN("Compiling the expressions of the program failed, the expressions are interpreted instead. " << error.get());
+                        return nullptr;
+                    }
+                    // Moving the finished file into place guarantees that concurrent builds never load a partial file.
+                    boost::filesystem::rename(temporaryLibraryPath, libraryPath);
+                }
+
+                result->libraryPath = libraryPath.string();
+                result->library.load(libraryPath);
+                loadFunctionTable(result->library, "storm_prism_guards", guardCode.size(), result->guards);
+                loadFunctionTable(result->library, "storm_prism_likelihoods", likelihoodCode.size(), result->likelihoods);
+                loadFunctionTable(result->library, "storm_prism_assignments", numberOfAssignments, result->assignments);
+            } catch (boost::system::system_error const& e) {
+                STORM_LOG_WARN("Unable to use compiled expressions, the expressions are interpreted instead: " << e.what());
+                return nullptr;
+            } catch (storm::exceptions::BaseException const& e) {
+                // For example, a stale or corrupt shared object in the cache does not provide the expected functions.
+                STORM_LOG_WARN("Unable to use compiled expressions, the expressions are interpreted instead: " << e.what());
+                return nullptr;
+            }
+            return result;
+        }
+
+        void CompiledPrismExpressions::loadState(CompressedState const& state) {
+            for (uint64_t index = 0; index < integerValues.size(); ++index) {
+                integerValues[index] = static_cast<int64_t>(state.getAsInt(integerBitOffsets[index], integerBitWidths[index])) + integerLowerBounds[index];
+            }
+            for (uint64_t index = 0; index < booleanValues.size(); ++index) {
+                booleanValues[index] = state.get(booleanBitOffsets[index]) ? 1 : 0;
+            }
+        }
+
+        std::string const& CompiledPrismExpressions::getLibraryPath() const {
+            return libraryPath;
+        }
+
+        bool CompiledPrismExpressions::wasLoadedFromCache() const {
+            return loadedFromCache;
+        }
+    }
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/dll/shared_library.hpp>
+
+#include "storm/generator/CompressedState.h"
+
+namespace storm {
+    namespace prism {
+        class Program;
+    }
+
+    namespace generator {
+        struct VariableInformation;
+
+        /*!
+         * Native code for the guards, update likelihoods and assignments of a PRISM program. The expressions are
+         * translated to C++ and compiled with the compiler of the jit builder into a shared object that is cached on disk
+         * under the hash of its source, so repeated builds of the same program skip the compilation.
+         *
+         * The compiled functions operate on the values of the integer and boolean variables of the state that was last
+         * loaded via loadState. Integer variable k (in the order of the variable information) is stored at position k of
+         * the integer values, boolean variable k at position k of the boolean values.
+         */
+        class CompiledPrismExpressions {
+        public:
+            typedef bool (*GuardFunction)(int64_t const*, unsigned char const*);
+            typedef double (*LikelihoodFunction)(int64_t const*, unsigned char const*);
+            typedef int64_t (*AssignmentFunction)(int64_t const*, unsigned char const*);
+
+            /*!
+             * Compiles the expressions of the given program (or loads them from the cache).
+             *
+             * @param program The program whose constants and formulas need to be substituted already.
+             * @param variableInformation The variable information used for encoding the states of the program.
+             * @param cacheDirectory The directory of the cached shared objects. If empty, a directory of the current user
+             * in the system's temporary directory is used. The directory must not be writable by other users.
+             * @return The compiled expressions or a null pointer if the program contains expressions that can not be
+             * compiled or the compilation failed. In this case, the expressions need to be interpreted.
+             */
+            static std::unique_ptr<CompiledPrismExpressions> create(storm::prism::Program const& program, VariableInformation const& variableInformation, std::string const& cacheDirectory = "");
+
+            /*!
+             * Loads the variable values of the given state such that the expressions are evaluated in this state.
+             */
+            void loadState(CompressedState const& state);
+
+            inline bool evaluateGuard(uint64_t globalCommandIndex) const {
+                return guards[globalCommandIndex](integerValues.data(), booleanValues.data());
+            }
+
+            inline double evaluateLikelihood(uint64_t globalUpdateIndex) const {
+                return likelihoods[globalUpdateIndex](integerValues.data(), booleanValues.data());
+            }
+
+            /*!
+             * Evaluates the given assignment (identified by its position within the update). Boolean assignments yield
+             * zero or one.
+             */
+            inline int64_t evaluateAssignment(uint64_t globalUpdateIndex, uint64_t assignmentIndex) const {
+                return assignments[assignmentOffsets[globalUpdateIndex] + assignmentIndex](integerValues.data(), booleanValues.data());
+            }
+
+            /*!
+             * Retrieves the path of the loaded shared object.
+             */
+            std::string const& getLibraryPath() const;
+
+            /*!
+             * Retrieves whether the shared object was found in the cache (rather than compiled).
+             */
+            bool wasLoadedFromCache() const;
+
+        private:
+            CompiledPrismExpressions(VariableInformation const& variableInformation);
+
+            // The library needs to stay loaded as long as its functions are used.
+            boost::dll::shared_library library;
+            std::string libraryPath;
+            bool loadedFromCache;
+
+            std::vector<GuardFunction> guards;
+            std::vector<LikelihoodFunction> likelihoods;
+            std::vector<AssignmentFunction> assignments;
+            // The position of the first assignment of each update in the assignment functions.
+            std::vector<uint64_t> assignmentOffsets;
+
+            // The bit offsets, widths and lower bounds of the variables used for unpacking states.
+            std::vector<uint64_t> integerBitOffsets;
+            std::vector<uint64_t> integerBitWidths;
+            std::vector<int64_t> integerLowerBounds;
+            std::vector<uint64_t> booleanBitOffsets;
+
+            std::vector<int64_t> integerValues;
+            std::vector<unsigned char> booleanValues;
+        };
+    }
+}
@@ -0,0 +1,175 @@
+#include "storm/generator/PrismGuardIndex.h"
+
+#include <unordered_map>
+
+#include <boost/optional.hpp>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/OperatorType.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace generator {
+
+        namespace {
+            // Keys that are encoded with more bits are not used to keep the decision tables small.
+            const uint64_t maximalKeyBitWidth = 12;
+
+            // As the commands that do not fix the key are copied to every entry of the decision table, a key is only
+            // used if it is fixed by at least half of the commands and the copies amount to at most this many times the
+            // number of commands.
+            const uint64_t maximalCopiesPerCommand = 4;
+
+            struct KeyCandidate {
+                bool isBoolean;
+                uint64_t bitOffset;
+                uint64_t bitWidth;
+                int64_t lowerBound;
+                uint64_t numberOfValues;
+            };
+
+            /*!
+             * Collects the values that the top-level conjuncts of the given guard fix for variables.
+             */
+            void collectFixedValues(storm::expressions::Expression const& expression, std::unordered_map<storm::expressions::Variable, int64_t>& fixedValues) {
+                if (expression.isVariable()) {
+                    if (expression.hasBooleanType()) {
+                        fixedValues.emplace(*expression.getVariables().begin(), 1);
+                    }
+                    return;
+                }
+                if (!expression.isFunctionApplication()) {
+                    return;
+                }
+                storm::expressions::OperatorType operatorType = expression.getOperator();
+                if (operatorType == storm::expressions::OperatorType::And) {
+                    collectFixedValues(expression.getOperand(0), fixedValues);
+                    collectFixedValues(expression.getOperand(1), fixedValues);
+                } else if (operatorType == storm::expressions::OperatorType::Not) {
+                    storm::expressions::Expression operand = expression.getOperand(0);
+                    if (operand.isVariable()) {
+                        fixedValues.emplace(*operand.getVariables().begin(), 0);
+                    }
+                } else if (operatorType == storm::expressions::OperatorType::Equal || operatorType == storm::expressions::OperatorType::Iff) {
+                    storm::expressions::Expression variable = expression.getOperand(0);
+                    storm::expressions::Expression value = expression.getOperand(1);
+                    if (!variable.isVariable()) {
+                        std::swap(variable, value);
+                    }
+                    if (!variable.isVariable() || !value.isLiteral()) {
+                        return;
+                    }
+                    if (value.hasBooleanType()) {
+                        fixedValues.emplace(*variable.getVariables().begin(), value.isTrue() ? 1 : 0);
+                    } else if (value.hasIntegerType()) {
+                        fixedValues.emplace(*variable.getVariables().begin(), value.evaluateAsInt());
+                    }
+                }
+            }
+        }
+
+        PrismGuardIndex::PrismGuardIndex(storm::prism::Program const& program, VariableInformation const& variableInformation, bool selectKeys) {
+            std::unordered_map<storm::expressions::Variable, KeyCandidate> keyCandidates;
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                keyCandidates.emplace(booleanVariable.variable, KeyCandidate{true, booleanVariable.bitOffset, 1, 0, 2});
+            }
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                // The table covers all values that can be encoded, so every state is mapped to an entry.
+                if (integerVariable.bitWidth <= maximalKeyBitWidth) {
+                    keyCandidates.emplace(integerVariable.variable, KeyCandidate{false, integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound, 1ull << integerVariable.bitWidth});
+                }
+            }
+
+            for (auto const& module : program.getModules()) {
+                moduleIndices.emplace_back();
+                ModuleIndex& moduleIndex = moduleIndices.back();
+
+                // Select the variable that is fixed by the most commands among those that do not blow up the table.
+                std::vector<std::unordered_map<storm::expressions::Variable, int64_t>> fixedValuesOfCommands(module.getNumberOfCommands());
+                std::unordered_map<storm::expressions::Variable, uint64_t> numberOfFixingCommands;
+                for (uint64_t commandIndex = 0; selectKeys && commandIndex < module.getNumberOfCommands(); ++commandIndex) {
+                    collectFixedValues(module.getCommand(commandIndex).getGuardExpression(), fixedValuesOfCommands[commandIndex]);
+                    for (auto const& fixedValue : fixedValuesOfCommands[commandIndex]) {
+                        if (keyCandidates.count(fixedValue.first) > 0) {
+                            ++numberOfFixingCommands[fixedValue.first];
+                        }
+                    }
+                }
+                boost::optional<storm::expressions::Variable> key;
+                uint64_t maximalNumberOfFixingCommands = 1;
+                for (auto const& variableCount : numberOfFixingCommands) {
+                    uint64_t numberOfUnfixedCommands = module.getNumberOfCommands() - variableCount.second;
+                    if (variableCount.second < numberOfUnfixedCommands || keyCandidates.at(variableCount.first).numberOfValues * numberOfUnfixedCommands > maximalCopiesPerCommand * module.getNumberOfCommands()) {
+                        continue;
+                    }
+                    if (variableCount.second > maximalNumberOfFixingCommands || (key && variableCount.second == maximalNumberOfFixingCommands && variableCount.first < key.get())) {
+                        key = variableCount.first;
+                        maximalNumberOfFixingCommands = variableCount.second;
+                    }
+                }
+
+                uint64_t numberOfEntries = 1;
+                if (key) {
+                    KeyCandidate const& keyCandidate = keyCandidates.at(key.get());
+                    moduleIndex.hasKey = true;
+                    moduleIndex.booleanKey = keyCandidate.isBoolean;
+                    moduleIndex.bitOffset = keyCandidate.bitOffset;
+                    moduleIndex.bitWidth = keyCandidate.bitWidth;
+                    numberOfEntries = keyCandidate.numberOfValues;
+                }
+                moduleIndex.candidates.resize(numberOfEntries);
+
+                // Commands are inserted in ascending order, so the candidates preserve the order of the commands.
+                for (uint64_t commandIndex = 0; commandIndex < module.getNumberOfCommands(); ++commandIndex) {
+                    storm::prism::Command const& command = module.getCommand(commandIndex);
+                    auto addCandidate = [&] (uint64_t entry) {
+                        moduleIndex.candidates[entry].push_back(commandIndex);
+                        if (command.isLabeled()) {
+                            auto& actionCandidates = moduleIndex.candidatesByAction[command.getActionIndex()];
+                            actionCandidates.resize(numberOfEntries);
+                            actionCandidates[entry].push_back(commandIndex);
+                        }
+                    };
+
+                    auto fixedValueIt = key ? fixedValuesOfCommands[commandIndex].find(key.get()) : fixedValuesOfCommands[commandIndex].end();
+                    if (fixedValueIt == fixedValuesOfCommands[commandIndex].end()) {
+                        for (uint64_t entry = 0; entry < numberOfEntries; ++entry) {
+                            addCandidate(entry);
+                        }
+                    } else {
+                        // If the fixed value can not be encoded, the command is never enabled.
+                        int64_t entry = fixedValueIt->second - keyCandidates.at(key.get()).lowerBound;
+                        if (entry >= 0 && static_cast<uint64_t>(entry) < numberOfEntries) {
+                            addCandidate(static_cast<uint64_t>(entry));
+                        }
+                    }
+                }
+
+                if (key) {
+                    STORM_LOG_TRACE("Indexing the commands of module '" << module.getName() << "' by variable '" << key->getName() << "' (fixed by " << maximalNumberOfFixingCommands << " of " << module.getNumberOfCommands() << " commands).");
+                }
+            }
+        }
+
+        void PrismGuardIndex::loadState(CompressedState const& state) {
+            for (auto& moduleIndex : moduleIndices) {
+                if (moduleIndex.hasKey) {
+                    moduleIndex.currentEntry = moduleIndex.booleanKey ? (state.get(moduleIndex.bitOffset) ? 1 : 0) : state.getAsInt(moduleIndex.bitOffset, moduleIndex.bitWidth);
+                }
+            }
+        }
+
+        uint64_t PrismGuardIndex::getNumberOfIndexedModules() const {
+            uint64_t result = 0;
+            for (auto const& moduleIndex : moduleIndices) {
+                if (moduleIndex.hasKey) {
+                    ++result;
+                }
+            }
+            return result;
+        }
+    }
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+
+namespace storm {
+    namespace prism {
+        class Program;
+    }
+
+    namespace generator {
+        struct VariableInformation;
+
+        /*!
+         * A static index over the guards of a PRISM program that allows to skip commands that are certainly disabled in
+         * a state. For every module, the variable that is most often constrained by a top-level conjunct of the form
+         * 'x=c' (or 'b', '!b' for boolean variables) in the guards of the module is selected as the key. The commands of
+         * the module are then partitioned by the value of the key into a decision table: the entry of a value contains
+         * all commands whose guard requires exactly this value plus all commands whose guard does not fix the key.
+         *
+         * The candidates retrieved from the index still need to be checked by evaluating their guards. Modules whose
+         * guards do not (sufficiently often) fix a variable are not indexed, so all of their commands are candidates. This
+         * is also the case if copying the commands that do not fix the variable to every entry would make the table
+         * considerably larger than the module.
+         */
+        class PrismGuardIndex {
+        public:
+            /*!
+             * Builds the index for the given program (whose constants need to be substituted).
+             *
+             * @param selectKeys If not set, no module is indexed, so all commands are candidates in every state.
+             */
+            PrismGuardIndex(storm::prism::Program const& program, VariableInformation const& variableInformation, bool selectKeys = true);
+
+            /*!
+             * Selects the entries of the decision tables that correspond to the given state.
+             */
+            void loadState(CompressedState const& state);
+
+            /*!
+             * Retrieves the (ascending) indices of the commands of the given module that may be enabled in the state that
+             * was loaded last.
+             */
+            inline std::vector<uint64_t> const& getCandidateCommandIndices(uint64_t moduleIndex) const {
+                ModuleIndex const& moduleIndexData = moduleIndices[moduleIndex];
+                return moduleIndexData.candidates[moduleIndexData.currentEntry];
+            }
+
+            /*!
+             * Retrieves the (ascending) indices of the commands of the given module that are labeled with the given
+             * synchronizing action and may be enabled in the state that was loaded last.
+             */
+            inline std::vector<uint64_t> const& getCandidateCommandIndices(uint64_t moduleIndex, uint64_t actionIndex) const {
+                ModuleIndex const& moduleIndexData = moduleIndices[moduleIndex];
+                auto actionIt = moduleIndexData.candidatesByAction.find(actionIndex);
+                if (actionIt == moduleIndexData.candidatesByAction.end()) {
+                    return noCandidates;
+                }
+                return actionIt->second[moduleIndexData.currentEntry];
+            }
+
+            /*!
+             * Retrieves the number of modules whose commands are partitioned by a key variable.
+             */
+            uint64_t getNumberOfIndexedModules() const;
+
+        private:
+            struct ModuleIndex {
+                bool hasKey = false;
+                bool booleanKey = false;
+                uint64_t bitOffset = 0;
+                uint64_t bitWidth = 0;
+
+                // The candidates of all commands and of the commands per synchronizing action for every value of the
+                // key (relative to its lower bound). Modules without a key have a single entry.
+                std::vector<std::vector<uint64_t>> candidates;
+                std::unordered_map<uint64_t, std::vector<std::vector<uint64_t>>> candidatesByAction;
+
+                // The entry that corresponds to the state that was loaded last.
+                uint64_t currentEntry = 0;
+            };
+
+            std::vector<ModuleIndex> moduleIndices;
+            std::vector<uint64_t> noCandidates;
+        };
+    }
+}
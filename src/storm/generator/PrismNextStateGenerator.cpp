@@ -1,4 +1,5 @@
 #include "storm/generator/PrismNextStateGenerator.h"
+#include "storm/generator/CompiledPrismExpressions.h"
 
 #include <boost/container/flat_map.hpp>
 #include <boost/any.hpp>
@@ -85,6 +86,33 @@ namespace storm {
                 moduleIndexToPlayerIndexMap = program.buildModuleIndexToPlayerIndexMap();
                 actionIndexToPlayerIndexMap = program.buildActionIndexToPlayerIndexMap();
             }
+
+            if (this->options.isSymmetryReductionSet()) {
+                // Labels and terminal states that stem from the properties need to be symmetric as well.
+                std::vector<storm::expressions::Expression> symmetricExpressions;
+                for (auto const& expressionLabel : this->options.getExpressionLabels()) {
+                    symmetricExpressions.push_back(expressionLabel.second);
+                }
+                for (auto const& terminalState : this->terminalStates) {
+                    symmetricExpressions.push_back(terminalState.first);
+                }
+                symmetryReduction = std::make_shared<PrismSymmetryReduction>(this->program, this->variableInformation, symmetricExpressions);
+                if (!symmetryReduction->hasSymmetries()) {
+                    STORM_LOG_INFO("No symmetric modules found, exploring the full state space.");
+                    symmetryReduction.reset();
+                }
+            }
+
+            guardIndex = std::make_shared<PrismGuardIndex>(this->program, this->variableInformation, this->options.isGuardIndexSet());
+            STORM_LOG_DEBUG("Indexed the commands of " << guardIndex->getNumberOfIndexedModules() << " of " << this->program.getNumberOfModules() << " modules by their guards.");
+
+            if (this->options.isCompileExpressionsSet()) {
+                if (std::is_same<ValueType, double>::value) {
+                    compiledExpressions = CompiledPrismExpressions::create(this->program, this->variableInformation, this->options.getCompiledExpressionsCacheDirectory());
+                } else {
+                    STORM_LOG_WARN("Compiled expressions are only supported for floating point values, the expressions are interpreted instead.");
+                }
+            }
         }
 
         template<typename ValueType, typename StateType>
@@ -93,6 +121,20 @@ namespace storm {
             return program.getModelType() != storm::prism::Program::ModelType::PTA;
         }
 
+        template<typename ValueType, typename StateType>
+        std::shared_ptr<PrismSymmetryReduction const> PrismNextStateGenerator<ValueType, StateType>::getSymmetryReduction() const {
+            return symmetryReduction;
+        }
+
+        template<typename ValueType, typename StateType>
+        typename PrismNextStateGenerator<ValueType, StateType>::StateToIdCallback PrismNextStateGenerator<ValueType, StateType>::getStateToIdCallback(StateToIdCallback const& stateToIdCallback) const {
+            if (!symmetryReduction) {
+                return stateToIdCallback;
+            }
+            // Only the canonical representatives of the symmetry classes are registered.
+            return [this, &stateToIdCallback] (CompressedState const& state) { return stateToIdCallback(symmetryReduction->canonicalize(state)); };
+        }
+
         template<typename ValueType, typename StateType>
         void PrismNextStateGenerator<ValueType, StateType>::checkValid() const {
             // If the program still contains undefined constants and we are not in a parametric setting, assemble an appropriate error message.
@@ -154,7 +196,8 @@ namespace storm {
         }
 
         template<typename ValueType, typename StateType>
-        std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitialStates(StateToIdCallback const& stateToIdCallback) {
+        std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitialStates(StateToIdCallback const& originalStateToIdCallback) {
+            StateToIdCallback stateToIdCallback = getStateToIdCallback(originalStateToIdCallback);
             std::vector<StateType> initialStateIndices;
 
             // If all states are initial, we can simplify the enumeration substantially.
@@ -263,7 +306,9 @@ namespace storm {
         }
 
         template<typename ValueType, typename StateType>
-        StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& stateToIdCallback) {
+        StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& originalStateToIdCallback) {
+            StateToIdCallback stateToIdCallback = getStateToIdCallback(originalStateToIdCallback);
+
             // Prepare the result, in case we return early.
             StateBehavior<ValueType, StateType> result;
 
@@ -292,6 +337,10 @@ namespace storm {
 
             // Get all choices for the state.
             result.setExpanded();
+            guardIndex->loadState(*this->state);
+            if (compiledExpressions) {
+                compiledExpressions->loadState(*this->state);
+            }
 
             std::vector<Choice<ValueType>> allChoices;
             if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
@@ -397,6 +446,22 @@ namespace storm {
             return result;
         }
 
+        template<typename ValueType, typename StateType>
+        bool PrismNextStateGenerator<ValueType, StateType>::isGuardSatisfied(storm::prism::Command const& command) const {
+            if (compiledExpressions) {
+                return compiledExpressions->evaluateGuard(command.getGlobalIndex());
+            }
+            return this->evaluator->asBool(command.getGuardExpression());
+        }
+
+        template<typename ValueType, typename StateType>
+        ValueType PrismNextStateGenerator<ValueType, StateType>::evaluateLikelihood(storm::prism::Update const& update) const {
+            if (compiledExpressions) {
+                return storm::utility::convertNumber<ValueType>(compiledExpressions->evaluateLikelihood(update.getGlobalIndex()));
+            }
+            return this->evaluator->asRational(update.getLikelihoodExpression());
+        }
+
         template<typename ValueType, typename StateType>
         CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(CompressedState const& state, storm::prism::Update const& update) {
             CompressedState newState(state);
@@ -415,7 +480,11 @@ namespace storm {
                 while (assignmentIt->getVariable() != boolIt->variable) {
                     ++boolIt;
                 }
-                newState.set(boolIt->bitOffset, this->evaluator->asBool(assignmentIt->getExpression()));
+                if (compiledExpressions) {
+                    newState.set(boolIt->bitOffset, compiledExpressions->evaluateAssignment(update.getGlobalIndex(), std::distance(update.getAssignments().begin(), assignmentIt)) != 0);
+                } else {
+                    newState.set(boolIt->bitOffset, this->evaluator->asBool(assignmentIt->getExpression()));
+                }
             }
 
             // Iterate over all integer assignments and carry them out.
@@ -424,7 +493,7 @@ namespace storm {
                 while (assignmentIt->getVariable() != integerIt->variable) {
                     ++integerIt;
                 }
-                int_fast64_t assignedValue = this->evaluator->asInt(assignmentIt->getExpression());
+                int_fast64_t assignedValue = compiledExpressions ? compiledExpressions->evaluateAssignment(update.getGlobalIndex(), std::distance(update.getAssignments().begin(), assignmentIt)) : this->evaluator->asInt(assignmentIt->getExpression());
                 if (this->options.isAddOutOfBoundsStateSet()) {
                     if (assignedValue < integerIt->lowerBound || assignedValue > integerIt->upperBound) {
                         return this->outOfBoundsState;
@@ -444,12 +513,12 @@ namespace storm {
         }
 
         struct ActiveCommandData {
-            ActiveCommandData(storm::prism::Module const* modulePtr, std::set<uint_fast64_t> const* commandIndicesPtr, typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt) : modulePtr(modulePtr), commandIndicesPtr(commandIndicesPtr), currentCommandIndexIt(currentCommandIndexIt) {
+            ActiveCommandData(storm::prism::Module const* modulePtr, std::vector<uint64_t> const* commandIndicesPtr, typename std::vector<uint64_t>::const_iterator currentCommandIndexIt) : modulePtr(modulePtr), commandIndicesPtr(commandIndicesPtr), currentCommandIndexIt(currentCommandIndexIt) {
                 // Intentionally left empty
             }
             storm::prism::Module const* modulePtr;
-            std::set<uint_fast64_t> const* commandIndicesPtr;
-            typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt;
+            std::vector<uint64_t> const* commandIndicesPtr;
+            typename std::vector<uint64_t>::const_iterator currentCommandIndexIt;
         };
 
         template<typename ValueType, typename StateType>
@@ -470,14 +539,15 @@ namespace storm {
                     continue;
                 }
 
-                std::set<uint_fast64_t> const& commandIndices = module.getCommandIndicesByActionIndex(actionIndex);
-
                 // If the module contains the action, but there is no command in the module that is labeled with
                 // this action, we don't have any feasible command combinations.
-                if (commandIndices.empty()) {
+                if (module.getCommandIndicesByActionIndex(actionIndex).empty()) {
                     return boost::none;
                 }
 
+                // Only the commands that the guard index did not rule out for the current state need to be checked.
+                std::vector<uint64_t> const& commandIndices = guardIndex->getCandidateCommandIndices(i, actionIndex);
+
                 // Look up commands by their indices and check if the guard evaluates to true in the given state.
                 bool hasOneEnabledCommand = false;
                 for (auto commandIndexIt = commandIndices.begin(), commandIndexIte = commandIndices.end(); commandIndexIt != commandIndexIte; ++commandIndexIt) {
@@ -491,7 +561,7 @@ namespace storm {
                             continue;
                         }
                     }
-                    if (this->evaluator->asBool(command.getGuardExpression())) {
+                    if (isGuardSatisfied(command)) {
                         // Found the first enabled command for this module.
                         hasOneEnabledCommand = true;
                         activeCommands.emplace_back(&module, &commandIndices, commandIndexIt);
@@ -525,7 +595,7 @@ namespace storm {
                             continue;
                         }
                     }
-                    if (this->evaluator->asBool(command.getGuardExpression())) {
+                    if (isGuardSatisfied(command)) {
                         commands.push_back(command);
                     }
                 }
@@ -545,8 +615,8 @@ namespace storm {
             for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
                 storm::prism::Module const& module = program.getModule(i);
 
-                // Iterate over all commands.
-                for (uint_fast64_t j = 0; j < module.getNumberOfCommands(); ++j) {
+                // Iterate over all commands that the guard index did not rule out for the current state.
+                for (uint_fast64_t j : guardIndex->getCandidateCommandIndices(i)) {
                     storm::prism::Command const& command = module.getCommand(j);
                     // Only consider commands that are not possibly synchronizing.
                     if (isCommandPotentiallySynchronizing(command)) continue;
@@ -564,7 +634,7 @@ namespace storm {
                     }
 
                     // Skip the command, if it is not enabled.
-                    if (!this->evaluator->asBool(command.getGuardExpression())) {
+                    if (!isGuardSatisfied(command)) {
                         continue;
                     }
 
@@ -582,7 +652,7 @@ namespace storm {
                     for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
                         storm::prism::Update const& update = command.getUpdate(k);
 
-                        ValueType probability = this->evaluator->asRational(update.getLikelihoodExpression());
+                        ValueType probability = evaluateLikelihood(update);
                         if (probability != storm::utility::zero<ValueType>()) {
                             // Obtain target state index and add it to the list of known states. If it has not yet been
                             // seen, we also add it to the set of states that have yet to be explored.
@@ -649,7 +719,7 @@ namespace storm {
                 storm::prism::Command const& command = *iteratorList[position];
                 for (uint_fast64_t j = 0; j < command.getNumberOfUpdates(); ++j) {
                     storm::prism::Update const& update = command.getUpdate(j);
-                    generateSynchronizedDistribution(applyUpdate(state, update), probability * this->evaluator->asRational(update.getLikelihoodExpression()), position + 1, iteratorList, distribution, stateToIdCallback);
+                    generateSynchronizedDistribution(applyUpdate(state, update), probability * evaluateLikelihood(update), position + 1, iteratorList, distribution, stateToIdCallback);
                 }
             }
         }
@@ -2,6 +2,8 @@
 #define STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 
 #include "storm/generator/NextStateGenerator.h"
+#include "storm/generator/PrismSymmetryReduction.h"
+#include "storm/generator/PrismGuardIndex.h"
 
 #include "storm/storage/prism/Program.h"
 #include "storm/storage/BoostTypes.h"
@@ -15,7 +17,8 @@ namespace storm {
     }
     
     namespace generator {
-        
+        class CompiledPrismExpressions;
+
         template<typename ValueType, typename StateType = uint32_t>
         class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
         public:
@@ -48,9 +51,23 @@ namespace storm {
 
             virtual std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOrigins(std::vector<boost::any>& dataForChoiceOrigins) const override;
 
+            /*!
+             * Retrieves the symmetry reduction that is applied during exploration (if any). It can be used to map concrete
+             * states of the program (e.g. when querying a shield) to the states of the reduced model.
+             *
+             * @return The symmetry reduction or a null pointer if no symmetries are exploited.
+             */
+            std::shared_ptr<PrismSymmetryReduction const> getSymmetryReduction() const;
+
         private:
             void checkValid() const;
 
+            /*!
+             * Wraps the given callback such that states are replaced by their canonical representative before they are
+             * registered, if symmetry reduction is enabled.
+             */
+            StateToIdCallback getStateToIdCallback(StateToIdCallback const& stateToIdCallback) const;
+
             /*!
              * A delegate constructor that is used to preprocess the program before the constructor of the superclass is
              * being called. The last argument is only present to distinguish the signature of this constructor from the
@@ -66,6 +83,18 @@ namespace storm {
              * @return The resulting state.
              */
             CompressedState applyUpdate(CompressedState const& state, storm::prism::Update const& update);
+
+            /*!
+             * Evaluates the guard of the given command in the state currently loaded into the evaluator (using the
+             * compiled expressions if available).
+             */
+            bool isGuardSatisfied(storm::prism::Command const& command) const;
+
+            /*!
+             * Evaluates the likelihood of the given update in the state currently loaded into the evaluator (using the
+             * compiled expressions if available).
+             */
+            ValueType evaluateLikelihood(storm::prism::Update const& update) const;
             
             /*!
              * Retrieves all commands that are labeled with the given label and enabled in the given state, grouped by
@@ -132,6 +161,15 @@ namespace storm {
             // Mappings from module/action indices to the programs players
             std::vector<storm::storage::PlayerIndex> moduleIndexToPlayerIndexMap;
             std::map<uint_fast64_t, storm::storage::PlayerIndex> actionIndexToPlayerIndexMap;
+
+            // The symmetry reduction that is applied during exploration (if any).
+            std::shared_ptr<PrismSymmetryReduction> symmetryReduction;
+
+            // The index used to skip commands whose guards are certainly not satisfied.
+            std::shared_ptr<PrismGuardIndex> guardIndex;
+
+            // The compiled guards, likelihoods and assignments of the program (if any).
+            std::shared_ptr<CompiledPrismExpressions> compiledExpressions;
         };
 
     }
@@ -0,0 +1,456 @@
+#include "storm/generator/PrismSymmetryReduction.h"
+
+#include <algorithm>
+#include <numeric>
+#include <set>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/storage/expressions/EquivalenceChecker.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/expressions/VariableExpression.h"
+
+#include "storm/utility/solver.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/UnexpectedException.h"
+
+namespace storm {
+    namespace generator {
+
+        namespace detail {
+            std::set<storm::expressions::Variable> getReferencedVariables(storm::prism::Command const& command) {
+                std::set<storm::expressions::Variable> result = command.getGuardExpression().getVariables();
+                for (auto const& update : command.getUpdates()) {
+                    auto likelihoodVariables = update.getLikelihoodExpression().getVariables();
+                    result.insert(likelihoodVariables.begin(), likelihoodVariables.end());
+                    for (auto const& assignment : update.getAssignments()) {
+                        result.insert(assignment.getVariable());
+                        auto assignmentVariables = assignment.getExpression().getVariables();
+                        result.insert(assignmentVariables.begin(), assignmentVariables.end());
+                    }
+                }
+                return result;
+            }
+
+            bool isPrivateAction(storm::prism::Program const& program, uint64_t actionIndex) {
+                return program.getModuleIndicesByActionIndex(actionIndex).size() == 1;
+            }
+        }
+
+        PrismSymmetryReduction::PrismSymmetryReduction(storm::prism::Program const& program, VariableInformation const& variableInformation, std::vector<storm::expressions::Expression> const& additionalSymmetricExpressions) {
+            if (variableInformation.hasOutOfBoundsBit()) {
+                outOfBoundsBit = variableInformation.getOutOfBoundsBit();
+            }
+            if (program.isPartiallyObservable()) {
+                STORM_LOG_WARN("Symmetry reduction is not supported for partially observable models and is therefore disabled.");
+                return;
+            }
+            if (program.getModelType() == storm::prism::Program::ModelType::SMG) {
+                moduleIndexToPlayerIndexMap = program.buildModuleIndexToPlayerIndexMap();
+                actionIndexToPlayerIndexMap = program.buildActionIndexToPlayerIndexMap();
+            }
+
+            std::vector<bool> isGrouped(program.getNumberOfModules(), false);
+            for (uint64_t referenceModuleIndex = 0; referenceModuleIndex < program.getNumberOfModules(); ++referenceModuleIndex) {
+                if (isGrouped[referenceModuleIndex]) {
+                    continue;
+                }
+
+                // Collect all modules that are renamings of the reference module.
+                std::vector<uint64_t> moduleIndices = {referenceModuleIndex};
+                std::vector<std::map<storm::expressions::Variable, storm::expressions::Expression>> variableRenamings(1);
+                std::vector<std::map<uint64_t, uint64_t>> actionRenamings(1);
+                for (uint64_t moduleIndex = referenceModuleIndex + 1; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+                    if (isGrouped[moduleIndex]) {
+                        continue;
+                    }
+                    std::map<storm::expressions::Variable, storm::expressions::Expression> variableRenaming;
+                    std::map<uint64_t, uint64_t> actionRenaming;
+                    if (matchModules(program, referenceModuleIndex, moduleIndex, variableRenaming, actionRenaming)) {
+                        moduleIndices.push_back(moduleIndex);
+                        variableRenamings.push_back(std::move(variableRenaming));
+                        actionRenamings.push_back(std::move(actionRenaming));
+                    }
+                }
+                if (moduleIndices.size() < 2) {
+                    continue;
+                }
+
+                // The reference module maps its renamed actions to themselves.
+                for (auto const& actionPair : actionRenamings[1]) {
+                    actionRenamings[0].emplace(actionPair.first, actionPair.first);
+                }
+
+                if (!isSymmetricGroup(program, moduleIndices, variableRenamings, actionRenamings, additionalSymmetricExpressions)) {
+                    STORM_LOG_INFO("Modules renamed from module '" << program.getModule(referenceModuleIndex).getName() << "' are not exploited for symmetry reduction as the remainder of the program is not symmetric in them.");
+                    continue;
+                }
+
+                // Register the group.
+                SymmetricModuleGroup group;
+                group.moduleIndices = moduleIndices;
+                group.actionIndexMapping = actionRenamings;
+                auto const& referenceModule = program.getModule(referenceModuleIndex);
+                for (uint64_t memberIndex = 0; memberIndex < moduleIndices.size(); ++memberIndex) {
+                    isGrouped[moduleIndices[memberIndex]] = true;
+                    auto getMemberVariable = [&] (storm::expressions::Variable const& referenceVariable) {
+                        if (memberIndex == 0) {
+                            return referenceVariable;
+                        }
+                        return variableRenamings[memberIndex].at(referenceVariable).getBaseExpression().asVariableExpression().getVariable();
+                    };
+
+                    std::vector<std::pair<uint64_t, uint64_t>> bits;
+                    for (auto const& referenceVariable : referenceModule.getBooleanVariables()) {
+                        auto memberVariable = getMemberVariable(referenceVariable.getExpressionVariable());
+                        auto it = std::find_if(variableInformation.booleanVariables.begin(), variableInformation.booleanVariables.end(), [&memberVariable] (BooleanVariableInformation const& info) { return info.variable == memberVariable; });
+                        STORM_LOG_THROW(it != variableInformation.booleanVariables.end(), storm::exceptions::UnexpectedException, "Unable to find variable information for variable '" << memberVariable.getName() << "'.");
+                        bits.emplace_back(it->bitOffset, 1);
+                    }
+                    for (auto const& referenceVariable : referenceModule.getIntegerVariables()) {
+                        auto memberVariable = getMemberVariable(referenceVariable.getExpressionVariable());
+                        auto it = std::find_if(variableInformation.integerVariables.begin(), variableInformation.integerVariables.end(), [&memberVariable] (IntegerVariableInformation const& info) { return info.variable == memberVariable; });
+                        STORM_LOG_THROW(it != variableInformation.integerVariables.end(), storm::exceptions::UnexpectedException, "Unable to find variable information for variable '" << memberVariable.getName() << "'.");
+                        bits.emplace_back(it->bitOffset, it->bitWidth);
+                    }
+                    group.variableBits.push_back(std::move(bits));
+
+                    for (auto const& actionPair : actionRenamings[memberIndex]) {
+                        actionIndexToGroupMember[actionPair.second] = std::make_tuple(groups.size(), memberIndex, actionPair.first);
+                    }
+                }
+                STORM_LOG_INFO("Detected " << moduleIndices.size() << " symmetric modules renamed from module '" << referenceModule.getName() << "'.");
+                groups.push_back(std::move(group));
+            }
+
+            if (hasSymmetries()) {
+                STORM_LOG_WARN("Symmetry reduction is enabled. The checked properties are assumed to be invariant under permutations of symmetric modules.");
+            }
+            // The solver is only needed for the detection.
+            equivalenceChecker.reset();
+        }
+
+        PrismSymmetryReduction::~PrismSymmetryReduction() = default;
+
+        bool PrismSymmetryReduction::hasSymmetries() const {
+            return !groups.empty();
+        }
+
+        std::vector<PrismSymmetryReduction::SymmetricModuleGroup> const& PrismSymmetryReduction::getSymmetricModuleGroups() const {
+            return groups;
+        }
+
+        CompressedState PrismSymmetryReduction::canonicalize(CompressedState const& state) const {
+            std::vector<std::vector<uint64_t>> permutation;
+            return canonicalize(state, permutation);
+        }
+
+        CompressedState PrismSymmetryReduction::canonicalize(CompressedState const& state, std::vector<std::vector<uint64_t>>& permutation) const {
+            permutation.resize(groups.size());
+            for (uint64_t groupIndex = 0; groupIndex < groups.size(); ++groupIndex) {
+                permutation[groupIndex].resize(groups[groupIndex].moduleIndices.size());
+                std::iota(permutation[groupIndex].begin(), permutation[groupIndex].end(), 0);
+            }
+            if (groups.empty() || (outOfBoundsBit && state.get(outOfBoundsBit.get()))) {
+                return state;
+            }
+
+            CompressedState result = state;
+            std::vector<std::vector<uint64_t>> valuations;
+            for (uint64_t groupIndex = 0; groupIndex < groups.size(); ++groupIndex) {
+                auto const& group = groups[groupIndex];
+                auto& groupPermutation = permutation[groupIndex];
+
+                valuations.assign(group.variableBits.size(), std::vector<uint64_t>());
+                for (uint64_t memberIndex = 0; memberIndex < group.variableBits.size(); ++memberIndex) {
+                    for (auto const& offsetAndWidth : group.variableBits[memberIndex]) {
+                        valuations[memberIndex].push_back(state.getAsInt(offsetAndWidth.first, offsetAndWidth.second));
+                    }
+                }
+
+                std::stable_sort(groupPermutation.begin(), groupPermutation.end(), [&valuations] (uint64_t const& first, uint64_t const& second) { return valuations[first] < valuations[second]; });
+
+                for (uint64_t position = 0; position < groupPermutation.size(); ++position) {
+                    if (groupPermutation[position] == position) {
+                        continue;
+                    }
+                    auto const& valuation = valuations[groupPermutation[position]];
+                    auto const& bits = group.variableBits[position];
+                    for (uint64_t variableIndex = 0; variableIndex < bits.size(); ++variableIndex) {
+                        result.setFromInt(bits[variableIndex].first, bits[variableIndex].second, valuation[variableIndex]);
+                    }
+                }
+            }
+            return result;
+        }
+
+        uint64_t PrismSymmetryReduction::translateActionIndex(uint64_t actionIndex, std::vector<std::vector<uint64_t>> const& permutation) const {
+            auto it = actionIndexToGroupMember.find(actionIndex);
+            if (it == actionIndexToGroupMember.end()) {
+                // The action is not renamed, so it is the same in all symmetric states.
+                return actionIndex;
+            }
+            uint64_t groupIndex, memberIndex, referenceActionIndex;
+            std::tie(groupIndex, memberIndex, referenceActionIndex) = it->second;
+            STORM_LOG_ASSERT(groupIndex < permutation.size() && memberIndex < permutation[groupIndex].size(), "Invalid permutation.");
+            // The module at this position of the representative has the valuation of the module of the state given by the permutation.
+            return groups[groupIndex].actionIndexMapping[permutation[groupIndex][memberIndex]].at(referenceActionIndex);
+        }
+
+        bool PrismSymmetryReduction::matchModules(storm::prism::Program const& program, uint64_t referenceModuleIndex, uint64_t moduleIndex, std::map<storm::expressions::Variable, storm::expressions::Expression>& variableRenaming, std::map<uint64_t, uint64_t>& actionRenaming) const {
+            auto const& referenceModule = program.getModule(referenceModuleIndex);
+            auto const& module = program.getModule(moduleIndex);
+
+            if (!moduleIndexToPlayerIndexMap.empty() && moduleIndexToPlayerIndexMap[referenceModuleIndex] != moduleIndexToPlayerIndexMap[moduleIndex]) {
+                return false;
+            }
+            if (referenceModule.getBooleanVariables().size() != module.getBooleanVariables().size() || referenceModule.getIntegerVariables().size() != module.getIntegerVariables().size() || !referenceModule.getClockVariables().empty() || !module.getClockVariables().empty() || referenceModule.getNumberOfCommands() != module.getNumberOfCommands()) {
+                return false;
+            }
+
+            auto haveSameInitialValue = [] (storm::prism::Variable const& first, storm::prism::Variable const& second) {
+                if (first.hasInitialValue() != second.hasInitialValue()) {
+                    return false;
+                }
+                return !first.hasInitialValue() || first.getInitialValueExpression().isSyntacticallyEqual(second.getInitialValueExpression());
+            };
+
+            // Match the local variables positionally.
+            for (uint64_t variableIndex = 0; variableIndex < referenceModule.getBooleanVariables().size(); ++variableIndex) {
+                auto const& referenceVariable = referenceModule.getBooleanVariables()[variableIndex];
+                auto const& variable = module.getBooleanVariables()[variableIndex];
+                if (!haveSameInitialValue(referenceVariable, variable)) {
+                    return false;
+                }
+                variableRenaming.emplace(referenceVariable.getExpressionVariable(), variable.getExpression());
+            }
+            for (uint64_t variableIndex = 0; variableIndex < referenceModule.getIntegerVariables().size(); ++variableIndex) {
+                auto const& referenceVariable = referenceModule.getIntegerVariables()[variableIndex];
+                auto const& variable = module.getIntegerVariables()[variableIndex];
+                if (!haveSameInitialValue(referenceVariable, variable) || !referenceVariable.getLowerBoundExpression().isSyntacticallyEqual(variable.getLowerBoundExpression()) || !referenceVariable.getUpperBoundExpression().isSyntacticallyEqual(variable.getUpperBoundExpression())) {
+                    return false;
+                }
+                variableRenaming.emplace(referenceVariable.getExpressionVariable(), variable.getExpression());
+            }
+
+            // Match the commands.
+            std::map<uint64_t, uint64_t> inverseActionRenaming;
+            for (uint64_t commandIndex = 0; commandIndex < referenceModule.getNumberOfCommands(); ++commandIndex) {
+                auto const& referenceCommand = referenceModule.getCommand(commandIndex);
+                auto const& command = module.getCommand(commandIndex);
+
+                if (referenceCommand.isMarkovian() != command.isMarkovian() || referenceCommand.isLabeled() != command.isLabeled()) {
+                    return false;
+                }
+                if (referenceCommand.getActionIndex() != command.getActionIndex()) {
+                    // Differently named actions are only admissible if they are private to the respective modules and controlled by the same player.
+                    uint64_t referenceActionIndex = referenceCommand.getActionIndex();
+                    uint64_t actionIndex = command.getActionIndex();
+                    if (!detail::isPrivateAction(program, referenceActionIndex) || !detail::isPrivateAction(program, actionIndex)) {
+                        return false;
+                    }
+                    if (!moduleIndexToPlayerIndexMap.empty()) {
+                        auto referencePlayerIt = actionIndexToPlayerIndexMap.find(referenceActionIndex);
+                        auto playerIt = actionIndexToPlayerIndexMap.find(actionIndex);
+                        storm::storage::PlayerIndex referencePlayer = referencePlayerIt == actionIndexToPlayerIndexMap.end() ? storm::storage::INVALID_PLAYER_INDEX : referencePlayerIt->second;
+                        storm::storage::PlayerIndex player = playerIt == actionIndexToPlayerIndexMap.end() ? storm::storage::INVALID_PLAYER_INDEX : playerIt->second;
+                        if (referencePlayer != player) {
+                            return false;
+                        }
+                    }
+                    auto renamingIt = actionRenaming.emplace(referenceActionIndex, actionIndex).first;
+                    auto inverseRenamingIt = inverseActionRenaming.emplace(actionIndex, referenceActionIndex).first;
+                    if (renamingIt->second != actionIndex || inverseRenamingIt->second != referenceActionIndex) {
+                        return false;
+                    }
+                }
+
+                if (!referenceCommand.getGuardExpression().substitute(variableRenaming).isSyntacticallyEqual(command.getGuardExpression())) {
+                    return false;
+                }
+                if (referenceCommand.getNumberOfUpdates() != command.getNumberOfUpdates()) {
+                    return false;
+                }
+                for (uint64_t updateIndex = 0; updateIndex < referenceCommand.getNumberOfUpdates(); ++updateIndex) {
+                    auto const& referenceUpdate = referenceCommand.getUpdate(updateIndex);
+                    auto const& update = command.getUpdate(updateIndex);
+                    if (!referenceUpdate.getLikelihoodExpression().substitute(variableRenaming).isSyntacticallyEqual(update.getLikelihoodExpression())) {
+                        return false;
+                    }
+                    if (referenceUpdate.getNumberOfAssignments() != update.getNumberOfAssignments()) {
+                        return false;
+                    }
+                    // Assignments are ordered by variable names, which is not preserved by renaming.
+                    for (auto const& referenceAssignment : referenceUpdate.getAssignments()) {
+                        storm::expressions::Expression renamedVariable = referenceAssignment.getVariable().getExpression().substitute(variableRenaming);
+                        auto assignmentIt = std::find_if(update.getAssignments().begin(), update.getAssignments().end(), [&renamedVariable] (storm::prism::Assignment const& assignment) { return assignment.getVariable().getExpression().isSyntacticallyEqual(renamedVariable); });
+                        if (assignmentIt == update.getAssignments().end() || !referenceAssignment.getExpression().substitute(variableRenaming).isSyntacticallyEqual(assignmentIt->getExpression())) {
+                            return false;
+                        }
+                    }
+                }
+            }
+            return true;
+        }
+
+        bool PrismSymmetryReduction::isSymmetricGroup(storm::prism::Program const& program, std::vector<uint64_t> const& moduleIndices, std::vector<std::map<storm::expressions::Variable, storm::expressions::Expression>> const& variableRenamings, std::vector<std::map<uint64_t, uint64_t>> const& actionRenamings, std::vector<storm::expressions::Expression> const& additionalSymmetricExpressions) {
+            uint64_t numberOfMembers = moduleIndices.size();
+            auto const& referenceModule = program.getModule(moduleIndices.front());
+
+            // Gather the local variables of each member in the order of the reference module.
+            std::vector<storm::expressions::Variable> referenceVariables;
+            for (auto const& variable : referenceModule.getBooleanVariables()) {
+                referenceVariables.push_back(variable.getExpressionVariable());
+            }
+            for (auto const& variable : referenceModule.getIntegerVariables()) {
+                referenceVariables.push_back(variable.getExpressionVariable());
+            }
+            std::vector<std::vector<storm::expressions::Variable>> memberVariables(numberOfMembers);
+            std::set<storm::expressions::Variable> groupVariables;
+            for (uint64_t memberIndex = 0; memberIndex < numberOfMembers; ++memberIndex) {
+                for (auto const& referenceVariable : referenceVariables) {
+                    memberVariables[memberIndex].push_back(memberIndex == 0 ? referenceVariable : variableRenamings[memberIndex].at(referenceVariable).getBaseExpression().asVariableExpression().getVariable());
+                }
+                groupVariables.insert(memberVariables[memberIndex].begin(), memberVariables[memberIndex].end());
+            }
+
+            // Members may only refer to their own local variables and no other module may refer to them at all.
+            for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+                auto memberIt = std::find(moduleIndices.begin(), moduleIndices.end(), moduleIndex);
+                std::set<storm::expressions::Variable> allowedGroupVariables;
+                if (memberIt != moduleIndices.end()) {
+                    auto const& ownVariables = memberVariables[std::distance(moduleIndices.begin(), memberIt)];
+                    allowedGroupVariables.insert(ownVariables.begin(), ownVariables.end());
+                }
+                for (auto const& command : program.getModule(moduleIndex).getCommands()) {
+                    for (auto const& variable : detail::getReferencedVariables(command)) {
+                        if (groupVariables.count(variable) > 0 && allowedGroupVariables.count(variable) == 0) {
+                            return false;
+                        }
+                    }
+                }
+            }
+
+            // The symmetric group is generated by swapping the first two members and (for more than two members) by
+            // rotating all members, so it suffices to check invariance under these two permutations.
+            std::vector<std::vector<uint64_t>> generators;
+            std::vector<uint64_t> swap(numberOfMembers);
+            std::iota(swap.begin(), swap.end(), 0);
+            std::swap(swap[0], swap[1]);
+            generators.push_back(std::move(swap));
+            if (numberOfMembers > 2) {
+                std::vector<uint64_t> rotation(numberOfMembers);
+                for (uint64_t memberIndex = 0; memberIndex < numberOfMembers; ++memberIndex) {
+                    rotation[memberIndex] = (memberIndex + 1) % numberOfMembers;
+                }
+                generators.push_back(std::move(rotation));
+            }
+
+            for (auto const& generator : generators) {
+                std::map<storm::expressions::Variable, storm::expressions::Expression> substitution;
+                std::map<uint64_t, uint64_t> actionSubstitution;
+                for (uint64_t memberIndex = 0; memberIndex < numberOfMembers; ++memberIndex) {
+                    for (uint64_t variableIndex = 0; variableIndex < referenceVariables.size(); ++variableIndex) {
+                        substitution.emplace(memberVariables[memberIndex][variableIndex], memberVariables[generator[memberIndex]][variableIndex].getExpression());
+                    }
+                    for (auto const& actionPair : actionRenamings[memberIndex]) {
+                        actionSubstitution.emplace(actionPair.second, actionRenamings[generator[memberIndex]].at(actionPair.first));
+                    }
+                }
+                auto permuteAction = [&actionSubstitution] (uint64_t actionIndex) {
+                    auto it = actionSubstitution.find(actionIndex);
+                    return it == actionSubstitution.end() ? actionIndex : it->second;
+                };
+                auto isInvariant = [&] (storm::expressions::Expression const& expression) {
+                    return !expression.containsVariable(groupVariables) || areEquivalent(program, expression.substitute(substitution), expression);
+                };
+
+                for (auto const& label : program.getLabels()) {
+                    if (!isInvariant(label.getStatePredicateExpression())) {
+                        return false;
+                    }
+                }
+                for (auto const& expression : additionalSymmetricExpressions) {
+                    if (!isInvariant(expression)) {
+                        return false;
+                    }
+                }
+                if (program.hasInitialConstruct() && !isInvariant(program.getInitialConstruct().getInitialStatesExpression())) {
+                    return false;
+                }
+
+                // Reward items have to be permuted among each other.
+                for (auto const& rewardModel : program.getRewardModels()) {
+                    std::vector<bool> usedStateRewards(rewardModel.getStateRewards().size(), false);
+                    for (auto const& stateReward : rewardModel.getStateRewards()) {
+                        auto predicate = stateReward.getStatePredicateExpression().substitute(substitution);
+                        auto value = stateReward.getRewardValueExpression().substitute(substitution);
+                        bool found = false;
+                        for (uint64_t rewardIndex = 0; !found && rewardIndex < usedStateRewards.size(); ++rewardIndex) {
+                            auto const& candidate = rewardModel.getStateRewards()[rewardIndex];
+                            if (!usedStateRewards[rewardIndex] && areEquivalent(program, predicate, candidate.getStatePredicateExpression()) && areEquivalent(program, value, candidate.getRewardValueExpression())) {
+                                usedStateRewards[rewardIndex] = found = true;
+                            }
+                        }
+                        if (!found) {
+                            return false;
+                        }
+                    }
+                    std::vector<bool> usedStateActionRewards(rewardModel.getStateActionRewards().size(), false);
+                    for (auto const& stateActionReward : rewardModel.getStateActionRewards()) {
+                        uint64_t actionIndex = permuteAction(stateActionReward.getActionIndex());
+                        auto predicate = stateActionReward.getStatePredicateExpression().substitute(substitution);
+                        auto value = stateActionReward.getRewardValueExpression().substitute(substitution);
+                        bool found = false;
+                        for (uint64_t rewardIndex = 0; !found && rewardIndex < usedStateActionRewards.size(); ++rewardIndex) {
+                            auto const& candidate = rewardModel.getStateActionRewards()[rewardIndex];
+                            if (!usedStateActionRewards[rewardIndex] && candidate.getActionIndex() == actionIndex && areEquivalent(program, predicate, candidate.getStatePredicateExpression()) && areEquivalent(program, value, candidate.getRewardValueExpression())) {
+                                usedStateActionRewards[rewardIndex] = found = true;
+                            }
+                        }
+                        if (!found) {
+                            return false;
+                        }
+                    }
+                    std::vector<bool> usedTransitionRewards(rewardModel.getTransitionRewards().size(), false);
+                    for (auto const& transitionReward : rewardModel.getTransitionRewards()) {
+                        uint64_t actionIndex = permuteAction(transitionReward.getActionIndex());
+                        auto sourcePredicate = transitionReward.getSourceStatePredicateExpression().substitute(substitution);
+                        auto targetPredicate = transitionReward.getTargetStatePredicateExpression().substitute(substitution);
+                        auto value = transitionReward.getRewardValueExpression().substitute(substitution);
+                        bool found = false;
+                        for (uint64_t rewardIndex = 0; !found && rewardIndex < usedTransitionRewards.size(); ++rewardIndex) {
+                            auto const& candidate = rewardModel.getTransitionRewards()[rewardIndex];
+                            if (!usedTransitionRewards[rewardIndex] && candidate.getActionIndex() == actionIndex && areEquivalent(program, sourcePredicate, candidate.getSourceStatePredicateExpression()) && areEquivalent(program, targetPredicate, candidate.getTargetStatePredicateExpression()) && areEquivalent(program, value, candidate.getRewardValueExpression())) {
+                                usedTransitionRewards[rewardIndex] = found = true;
+                            }
+                        }
+                        if (!found) {
+                            return false;
+                        }
+                    }
+                }
+            }
+            return true;
+        }
+
+        bool PrismSymmetryReduction::areEquivalent(storm::prism::Program const& program, storm::expressions::Expression const& first, storm::expressions::Expression const& second) {
+            if (first.isSyntacticallyEqual(second)) {
+                return true;
+            }
+            if (first.hasBooleanType() != second.hasBooleanType()) {
+                return false;
+            }
+            if (!equivalenceChecker) {
+                storm::utility::solver::SmtSolverFactory factory;
+                equivalenceChecker = std::make_unique<storm::expressions::EquivalenceChecker>(factory.create(program.getManager()));
+                equivalenceChecker->addConstraints(program.getAllRangeExpressions());
+            }
+            if (first.hasBooleanType()) {
+                return equivalenceChecker->areEquivalent(first, second);
+            }
+            return equivalenceChecker->areEquivalent(first == second, program.getManager().boolean(true));
+        }
+
+    }
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+#include <boost/optional.hpp>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/PlayerIndex.h"
+
+namespace storm {
+    namespace prism {
+        class Program;
+    }
+
+    namespace expressions {
+        class EquivalenceChecker;
+    }
+
+    namespace generator {
+        struct VariableInformation;
+
+        /*!
+         * Detects groups of fully symmetric modules in a PRISM program and maps compressed states to a canonical
+         * representative of their symmetry class. Two modules are considered symmetric if one is a (positional) renaming
+         * of the other, i.e. the modules have the same local variables with the same ranges and initial values and the
+         * same commands up to the renaming of local variables and module-private actions. In games, all modules of a
+         * group and all of their renamed actions need to be controlled by the same player.
+         *
+         * A group is only accepted if the remainder of the program is invariant under permuting the modules of the
+         * group, that is, if no other module refers to the local variables of the group, the group members only refer
+         * to their own local variables and all labels, reward models, the initial states and the given additional
+         * expressions (e.g. labels or terminal states coming from the properties) are invariant under the permutation.
+         */
+        class PrismSymmetryReduction {
+        public:
+            struct SymmetricModuleGroup {
+                /// The indices of the symmetric modules. The first module serves as the reference module.
+                std::vector<uint64_t> moduleIndices;
+
+                /// For each module of the group, the bit offset and width of its local variables in the order of the
+                /// local variables of the reference module.
+                std::vector<std::vector<std::pair<uint64_t, uint64_t>>> variableBits;
+
+                /// For each module of the group, the mapping from the action indices of the reference module to the
+                /// corresponding action indices of the module. Actions that are shared among the modules are not contained.
+                std::vector<std::map<uint64_t, uint64_t>> actionIndexMapping;
+            };
+
+            /*!
+             * Detects the symmetries of the given program.
+             *
+             * @param program The program whose symmetries to detect. Constants and formulas need to be substituted.
+             * @param variableInformation The variable information that is used to encode the states of the program.
+             * @param additionalSymmetricExpressions Further expressions that need to be invariant under the symmetries.
+             */
+            PrismSymmetryReduction(storm::prism::Program const& program, VariableInformation const& variableInformation, std::vector<storm::expressions::Expression> const& additionalSymmetricExpressions = {});
+
+            ~PrismSymmetryReduction();
+
+            /*!
+             * Retrieves whether at least one group of symmetric modules was detected.
+             */
+            bool hasSymmetries() const;
+
+            /*!
+             * Retrieves the detected groups of symmetric modules.
+             */
+            std::vector<SymmetricModuleGroup> const& getSymmetricModuleGroups() const;
+
+            /*!
+             * Maps the given state to the canonical representative of its symmetry class. The representative is obtained
+             * by sorting the valuations of the local variables of each group of symmetric modules lexicographically.
+             */
+            CompressedState canonicalize(CompressedState const& state) const;
+
+            /*!
+             * Maps the given state to the canonical representative of its symmetry class and stores the applied
+             * permutation. The j-th entry of the g-th vector of the permutation is the index (within group g) of the
+             * module of the given state whose valuation was moved to position j.
+             */
+            CompressedState canonicalize(CompressedState const& state, std::vector<std::vector<uint64_t>>& permutation) const;
+
+            /*!
+             * Translates an action index of a choice of the canonical representative of a state back to the action index
+             * the choice has in the state itself. This is required to query results (e.g. shields) that are computed on
+             * the reduced model for concrete states of the program.
+             *
+             * @param actionIndex The action index of the choice in the canonical state.
+             * @param permutation The permutation that was obtained when canonicalizing the state.
+             * @return The corresponding action index in the original state.
+             */
+            uint64_t translateActionIndex(uint64_t actionIndex, std::vector<std::vector<uint64_t>> const& permutation) const;
+
+        private:
+            /*!
+             * Tries to match the given module against the reference module. If successful, the renaming of local
+             * variables and module-private actions is stored in the given maps.
+             */
+            bool matchModules(storm::prism::Program const& program, uint64_t referenceModuleIndex, uint64_t moduleIndex, std::map<storm::expressions::Variable, storm::expressions::Expression>& variableRenaming, std::map<uint64_t, uint64_t>& actionRenaming) const;
+
+            /*!
+             * Checks whether the given candidate group is a symmetry of the whole program.
+             */
+            bool isSymmetricGroup(storm::prism::Program const& program, std::vector<uint64_t> const& moduleIndices, std::vector<std::map<storm::expressions::Variable, storm::expressions::Expression>> const& variableRenamings, std::vector<std::map<uint64_t, uint64_t>> const& actionRenamings, std::vector<storm::expressions::Expression> const& additionalSymmetricExpressions);
+
+            /*!
+             * Checks whether the two expressions are equivalent, first syntactically and then using an SMT solver.
+             */
+            bool areEquivalent(storm::prism::Program const& program, storm::expressions::Expression const& first, storm::expressions::Expression const& second);
+
+            // The detected groups of symmetric modules.
+            std::vector<SymmetricModuleGroup> groups;
+
+            // Maps renamed actions to their group, the index of their module within the group and the action of the reference module.
+            std::unordered_map<uint64_t, std::tuple<uint64_t, uint64_t, uint64_t>> actionIndexToGroupMember;
+
+            // Mappings from module/action indices to the players of the program (only filled for games).
+            std::vector<storm::storage::PlayerIndex> moduleIndexToPlayerIndexMap;
+            std::map<uint_fast64_t, storm::storage::PlayerIndex> actionIndexToPlayerIndexMap;
+
+            // If set, the bit that marks the out-of-bounds state.
+            boost::optional<uint64_t> outOfBoundsBit;
+
+            // A checker that is used to decide equivalence of expressions that are not syntactically equal. Created lazily.
+            std::unique_ptr<storm::expressions::EquivalenceChecker> equivalenceChecker;
+        };
+
+    }
+}
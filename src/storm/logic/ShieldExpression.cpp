@@ -38,6 +38,10 @@ namespace storm {
             return type == storm::logic::ShieldingType::OptimalPost;
         }
 
+        bool ShieldExpression::isPermissivePreShield() const {
+            return type == storm::logic::ShieldingType::PermissivePre;
+        }
+
         double ShieldExpression::getValue() const {
             return value;
         }
@@ -48,6 +52,7 @@ namespace storm {
                 case storm::logic::ShieldingType::PreSafety:  return "Pre";
                 case storm::logic::ShieldingType::OptimalPre:    return "OptimalPre";
                 case storm::logic::ShieldingType::OptimalPost:    return "OptimalPost";
+                case storm::logic::ShieldingType::PermissivePre:  return "PermissivePre";
             }
         }
 
@@ -70,6 +75,7 @@ namespace storm {
                 case storm::logic::ShieldingType::PreSafety:   prettyString += "Pre-Safety"; break;
                 case storm::logic::ShieldingType::OptimalPre:  prettyString += "Optimal-Pre"; break;
                 case storm::logic::ShieldingType::OptimalPost: prettyString += "Optimal-Post"; break;
+                case storm::logic::ShieldingType::PermissivePre: prettyString += "Permissive-Pre-Safety"; break;
             }
             prettyString += "-Shield ";
             prettyString += "with " + comparisonType + " comparison (" + comparisonToString() + " = " + std::to_string(value) + "):";
@@ -80,6 +86,10 @@ namespace storm {
             return filename;
         }
 
+        void ShieldExpression::setFilename(std::string const& filename) {
+            this->filename = filename;
+        }
+
         std::ostream& operator<<(std::ostream& out, ShieldExpression const& shieldExpression) {
             out << shieldExpression.toString();
             return out;
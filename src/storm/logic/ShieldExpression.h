@@ -10,7 +10,8 @@ namespace storm {
             PostSafety,
             PreSafety,
             OptimalPre,
-            OptimalPost
+            OptimalPost,
+            PermissivePre
         };
 
         enum class ShieldComparison { Absolute, Relative };
@@ -27,6 +28,7 @@ namespace storm {
             bool isOptimalShield() const;
             bool isOptimalPreShield() const;
             bool isOptimalPostShield() const;
+            bool isPermissivePreShield() const;
 
             double getValue() const;
 
@@ -35,6 +37,7 @@ namespace storm {
             std::string toString() const;
             std::string prettify() const;
             std::string getFilename() const;
+            void setFilename(std::string const& filename);
             friend std::ostream& operator<<(std::ostream& stream, ShieldExpression const& shieldExpression);
 
         private:
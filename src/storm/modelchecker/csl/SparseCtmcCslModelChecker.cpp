@@ -236,6 +236,39 @@ namespace storm {
             return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(result)));
         }
 
+        template<typename SparseCtmcModelType>
+        std::vector<std::unique_ptr<CheckResult>> SparseCtmcCslModelChecker<SparseCtmcModelType>::computeTimeSeries(Environment const& env, CheckTask<storm::logic::Formula, ValueType> const& checkTask, std::vector<double> const& timePoints) {
+            storm::logic::Formula const& formula = checkTask.getFormula();
+            STORM_LOG_THROW(formula.isOperatorFormula() && !formula.asOperatorFormula().hasBound(), storm::exceptions::InvalidPropertyException, "Time series can only be computed for quantitative operator formulas.");
+
+            std::vector<std::vector<ValueType>> numericResults;
+            if (formula.isProbabilityOperatorFormula() && formula.asProbabilityOperatorFormula().getSubformula().isBoundedUntilFormula()) {
+                storm::logic::BoundedUntilFormula const& pathFormula = formula.asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula();
+                STORM_LOG_THROW(!pathFormula.isMultiDimensional() && pathFormula.getTimeBoundReference().isTimeBound(), storm::exceptions::NotImplementedException, "Currently step-bounded or reward-bounded properties on CTMCs are not supported.");
+                STORM_LOG_THROW(!pathFormula.hasLowerBound() || storm::utility::isZero(pathFormula.getLowerBound<double>()), storm::exceptions::InvalidPropertyException, "Time series are only supported for time intervals of the form [0, t].");
+                std::unique_ptr<CheckResult> leftResultPointer = this->check(env, pathFormula.getLeftSubformula());
+                std::unique_ptr<CheckResult> rightResultPointer = this->check(env, pathFormula.getRightSubformula());
+                ExplicitQualitativeCheckResult const& leftResult = leftResultPointer->asExplicitQualitativeCheckResult();
+                ExplicitQualitativeCheckResult const& rightResult = rightResultPointer->asExplicitQualitativeCheckResult();
+                numericResults = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimePoints(env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask.substituteFormula(pathFormula)), this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), this->getModel().getExitRateVector(), timePoints);
+            } else if (formula.isRewardOperatorFormula() && formula.asRewardOperatorFormula().getSubformula().isInstantaneousRewardFormula()) {
+                storm::logic::RewardOperatorFormula const& rewardOperatorFormula = formula.asRewardOperatorFormula();
+                storm::logic::InstantaneousRewardFormula const& rewardPathFormula = rewardOperatorFormula.getSubformula().asInstantaneousRewardFormula();
+                STORM_LOG_THROW(!rewardPathFormula.isStepBounded(), storm::exceptions::NotImplementedException, "Currently step-bounded properties on CTMCs are not supported.");
+                std::string rewardModelName = rewardOperatorFormula.hasRewardModelName() ? rewardOperatorFormula.getRewardModelName() : (checkTask.isRewardModelSet() ? checkTask.getRewardModel() : "");
+                numericResults = storm::modelchecker::helper::SparseCtmcCslHelper::computeInstantaneousRewardsForTimePoints(env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask.substituteFormula(rewardPathFormula)), this->getModel().getTransitionMatrix(), this->getModel().getExitRateVector(), this->getModel().getRewardModel(rewardModelName), timePoints);
+            } else {
+                STORM_LOG_THROW(false, storm::exceptions::InvalidPropertyException, "Time series are only supported for formulas of the form P=? [phi U<=t psi] and R=? [I=t], but got " << formula << ".");
+            }
+
+            std::vector<std::unique_ptr<CheckResult>> results;
+            results.reserve(numericResults.size());
+            for (auto& numericResult : numericResults) {
+                results.push_back(std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult))));
+            }
+            return results;
+        }
+
 
         // Explicitly instantiate the model checker.
         template class SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<double>>;
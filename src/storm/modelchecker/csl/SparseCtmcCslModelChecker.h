@@ -53,6 +53,15 @@ namespace storm {
              */
             std::unique_ptr<CheckResult> computeSteadyStateDistribution(Environment const& env);
 
+            /*!
+             * Computes the values of the given formula for each of the given time points, i.e. the upper time bound of
+             * the formula is replaced by each of the time points. The formula has to be of the form P=? [phi U<=t psi]
+             * (or P=? [F<=t psi]) or R=? [I=t]. All time points are handled within a single uniformization.
+             *
+             * @return One result per time point (in the order of the given time points).
+             */
+            std::vector<std::unique_ptr<CheckResult>> computeTimeSeries(Environment const& env, CheckTask<storm::logic::Formula, ValueType> const& checkTask, std::vector<double> const& timePoints);
+
         };
 
     } // namespace modelchecker
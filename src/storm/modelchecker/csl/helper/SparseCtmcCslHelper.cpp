@@ -1,5 +1,7 @@
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 
+#include <boost/optional.hpp>
+
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 
@@ -24,6 +26,7 @@
 #include "storm/utility/numerical.h"
 #include "storm/utility/SignalHandler.h"
 
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
@@ -65,6 +68,35 @@ namespace storm {
                     return false;
                 }
             }
+
+            template <typename ValueType>
+            bool SparseCtmcCslHelper::checkAndUpdateTransientProbabilityEpsilon(storm::Environment const& env, ValueType& epsilon, std::vector<std::vector<ValueType>> const& resultVectors, storm::storage::BitVector const& relevantPositions) {
+                // Take the smallest truncation error that is required by any of the result vectors.
+                ValueType newEpsilon = epsilon;
+                for (auto const& resultVector : resultVectors) {
+                    ValueType epsilonForResultVector = epsilon;
+                    if (checkAndUpdateTransientProbabilityEpsilon(env, epsilonForResultVector, resultVector, relevantPositions)) {
+                        newEpsilon = std::min(newEpsilon, epsilonForResultVector);
+                    }
+                }
+                if (newEpsilon < epsilon) {
+                    epsilon = newEpsilon;
+                    return true;
+                } else {
+                    return false;
+                }
+            }
+            
+            template <typename ValueType>
+            std::vector<ValueType> convertTimePointsToTimeBounds(std::vector<double> const& timePoints) {
+                std::vector<ValueType> timeBounds;
+                timeBounds.reserve(timePoints.size());
+                for (auto const& timePoint : timePoints) {
+                    STORM_LOG_THROW(timePoint >= 0.0 && timePoint != storm::utility::infinity<double>(), storm::exceptions::InvalidArgumentException, "Invalid time point " << timePoint << ". Time points need to be non-negative and finite.");
+                    timeBounds.push_back(storm::utility::convertNumber<ValueType>(timePoint));
+                }
+                return timeBounds;
+            }
             
             
             template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
@@ -258,6 +290,69 @@ namespace storm {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
             }
 
+            template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimePoints(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, std::vector<double> const& timePoints) {
+                STORM_LOG_THROW(!env.solver().isForceExact(), storm::exceptions::InvalidOperationException, "Exact computations not possible for bounded until probabilities.");
+                std::vector<ValueType> timeBounds = convertTimePointsToTimeBounds<ValueType>(timePoints);
+                
+                uint_fast64_t numberOfStates = rateMatrix.getRowCount();
+                
+                // Set the possible (absolute) error allowed for truncation (epsilon for fox-glynn)
+                ValueType epsilon = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision()) / 8.0;
+                
+                // The 'maybe' states are the same for all time points.
+                storm::storage::BitVector statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates);
+                storm::storage::BitVector statesWithProbabilityGreater0NonPsi = statesWithProbabilityGreater0 & ~psiStates;
+                STORM_LOG_INFO("Found " << statesWithProbabilityGreater0NonPsi.getNumberOfSetBits() << " 'maybe' states.");
+                
+                // the positions within the results for which the precision needs to be checked
+                storm::storage::BitVector relevantValues;
+                if (goal.hasRelevantValues()) {
+                    relevantValues = std::move(goal.relevantValues());
+                    relevantValues &= statesWithProbabilityGreater0;
+                } else {
+                    relevantValues = statesWithProbabilityGreater0;
+                }
+                
+                // Outside of the 'maybe' states, the values do not depend on the time point.
+                std::vector<ValueType> initialResult(numberOfStates, storm::utility::zero<ValueType>());
+                storm::utility::vector::setVectorValues<ValueType>(initialResult, psiStates, storm::utility::one<ValueType>());
+                std::vector<std::vector<ValueType>> results(timePoints.size(), initialResult);
+                if (statesWithProbabilityGreater0NonPsi.empty()) {
+                    return results;
+                }
+                
+                // Find the maximal rate of all 'maybe' states to take it as the uniformization rate.
+                ValueType uniformizationRate = 0;
+                for (auto state : statesWithProbabilityGreater0NonPsi) {
+                    uniformizationRate = std::max(uniformizationRate, exitRates[state]);
+                }
+                uniformizationRate *= 1.02;
+                STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+                
+                storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
+                
+                // Compute the vector that is to be added as a compensation for removing the absorbing states.
+                std::vector<ValueType> b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
+                for (auto& element : b) {
+                    element /= uniformizationRate;
+                }
+                
+                std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+                do { // Iterate until the desired precision is reached (only relevant for relative precision criterion)
+                    std::vector<std::vector<ValueType>> subresults = computeTransientProbabilitiesForTimePoints(env, uniformizedMatrix, &b, timeBounds, uniformizationRate, values, epsilon);
+                    for (uint_fast64_t index = 0; index < results.size(); ++index) {
+                        storm::utility::vector::setVectorValues(results[index], statesWithProbabilityGreater0NonPsi, subresults[index]);
+                    }
+                } while (checkAndUpdateTransientProbabilityEpsilon(env, epsilon, results, relevantValues));
+                return results;
+            }
+            
+            template <typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimePoints(Environment const&, storm::solver::SolveGoal<ValueType>&&, storm::storage::SparseMatrix<ValueType> const&, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&, storm::storage::BitVector const&, std::vector<ValueType> const&, std::vector<double> const&) {
+                STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
+            }
+
             template <typename ValueType>
             std::vector<ValueType> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative) {
                 return SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(env, std::move(goal), computeProbabilityMatrix(rateMatrix, exitRateVector), backwardTransitions, phiStates, psiStates, qualitative);
@@ -332,6 +427,61 @@ namespace storm {
             std::vector<ValueType> SparseCtmcCslHelper::computeInstantaneousRewards(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const&, std::vector<ValueType> const&, RewardModelType const&, double) {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing instantaneous rewards is unsupported for this value type.");
             }
+
+            template <typename ValueType, typename RewardModelType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeInstantaneousRewardsForTimePoints(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, std::vector<ValueType> const& exitRateVector, RewardModelType const& rewardModel, std::vector<double> const& timePoints) {
+                // Only compute the result if the model has a state-based reward model.
+                STORM_LOG_THROW(!rewardModel.empty(), storm::exceptions::InvalidPropertyException, "Missing reward model for formula. Skipping formula.");
+                std::vector<ValueType> timeBounds = convertTimePointsToTimeBounds<ValueType>(timePoints);
+                
+                uint_fast64_t numberOfStates = rateMatrix.getRowCount();
+                std::vector<ValueType> const& stateRewards = rewardModel.getStateRewardVector();
+                std::vector<std::vector<ValueType>> results(timePoints.size(), stateRewards);
+                
+                // If all entries are zero, the result is the zero-vector for all time points.
+                ValueType maxValue = storm::utility::vector::maximumElementAbs(stateRewards);
+                if (storm::utility::isZero(maxValue)) {
+                    return results;
+                }
+                
+                ValueType uniformizationRate = 0;
+                for (auto const& rate : exitRateVector) {
+                    uniformizationRate = std::max(uniformizationRate, rate);
+                }
+                uniformizationRate *= 1.02;
+                STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+                
+                storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(rateMatrix, storm::storage::BitVector(numberOfStates, true), uniformizationRate, exitRateVector);
+                
+                // Set the possible error allowed for truncation (epsilon for fox-glynn)
+                ValueType epsilon = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision());
+                if (env.solver().timeBounded().getRelativeTerminationCriterion()) {
+                    // Be more precise, if the maximum value is very small (precision can/has to be refined later)
+                    epsilon *= std::min(storm::utility::one<ValueType>(), maxValue);
+                } else {
+                    // Be more precise, if the maximal possible value is very large
+                    epsilon /= std::max(storm::utility::one<ValueType>(), maxValue);
+                }
+                
+                storm::storage::BitVector relevantValues;
+                if (goal.hasRelevantValues()) {
+                    relevantValues = std::move(goal.relevantValues());
+                } else {
+                    relevantValues = storm::storage::BitVector(numberOfStates, true);
+                }
+                
+                // Loop until the desired precision is reached.
+                do {
+                    results = computeTransientProbabilitiesForTimePoints<ValueType>(env, uniformizedMatrix, nullptr, timeBounds, uniformizationRate, stateRewards, epsilon);
+                } while (checkAndUpdateTransientProbabilityEpsilon(env, epsilon, results, relevantValues));
+                
+                return results;
+            }
+            
+            template <typename ValueType, typename RewardModelType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeInstantaneousRewardsForTimePoints(Environment const&, storm::solver::SolveGoal<ValueType>&&, storm::storage::SparseMatrix<ValueType> const&, std::vector<ValueType> const&, RewardModelType const&, std::vector<double> const&) {
+                STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing instantaneous rewards is unsupported for this value type.");
+            }
             
             template <typename ValueType, typename RewardModelType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
             std::vector<ValueType> SparseCtmcCslHelper::computeCumulativeRewards(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, std::vector<ValueType> const& exitRateVector, RewardModelType const& rewardModel, double timeBound) {
@@ -658,6 +808,61 @@ namespace storm {
                 storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(result, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
                 return result;
             }
+
+            template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeTransientProbabilitiesForTimePoints(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, std::vector<ValueType> const& timeBounds, ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon) {
+                STORM_LOG_WARN_COND(epsilon > storm::utility::convertNumber<ValueType>(1e-20), "Very low truncation error " << epsilon << " requested. Numerical inaccuracies are possible.");
+                std::vector<std::vector<ValueType>> results(timeBounds.size());
+                
+                // Get the truncation points and the weights for each time bound and initialize the results.
+                // Time bounds for which no time can pass do not get any Fox-Glynn result and keep the current values.
+                std::vector<boost::optional<storm::utility::numerical::FoxGlynnResult<ValueType>>> foxGlynnResults(timeBounds.size());
+                uint64_t maximalRightTruncationPoint = 0;
+                for (uint64_t index = 0; index < timeBounds.size(); ++index) {
+                    ValueType lambda = timeBounds[index] * uniformizationRate;
+                    if (storm::utility::isZero(lambda)) {
+                        results[index] = values;
+                        continue;
+                    }
+                    foxGlynnResults[index] = storm::utility::numerical::foxGlynn(lambda, epsilon);
+                    auto const& foxGlynnResult = foxGlynnResults[index].get();
+                    STORM_LOG_DEBUG("Fox-Glynn cutoff points for time bound " << timeBounds[index] << ": left=" << foxGlynnResult.left << ", right=" << foxGlynnResult.right);
+                    maximalRightTruncationPoint = std::max<uint64_t>(maximalRightTruncationPoint, foxGlynnResult.right);
+                    if (foxGlynnResult.left == 0) {
+                        results[index] = values;
+                        storm::utility::vector::scaleVectorInPlace(results[index], foxGlynnResult.weights.front());
+                    } else {
+                        results[index] = std::vector<ValueType>(values.size(), storm::utility::zero<ValueType>());
+                    }
+                }
+                
+                STORM_LOG_DEBUG("Starting " << maximalRightTruncationPoint << " iterations with " << uniformizedMatrix.getRowCount() << " x " << uniformizedMatrix.getColumnCount() << " matrix for " << timeBounds.size() << " time bounds.");
+                
+                // Perform the matrix-vector multiplications once and add the scaled iterate to all results whose
+                // truncation points enclose the current iteration.
+                if (maximalRightTruncationPoint > 0) {
+                    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
+                    ValueType weight = 0;
+                    std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&weight] (ValueType const& a, ValueType const& b) { return a + weight * b; };
+                    for (uint64_t iteration = 1; iteration <= maximalRightTruncationPoint; ++iteration) {
+                        multiplier->multiply(env, values, addVector, values);
+                        for (uint64_t index = 0; index < timeBounds.size(); ++index) {
+                            if (foxGlynnResults[index] && foxGlynnResults[index]->left <= iteration && iteration <= foxGlynnResults[index]->right) {
+                                weight = foxGlynnResults[index]->weights[iteration - foxGlynnResults[index]->left];
+                                storm::utility::vector::applyPointwise(results[index], values, results[index], addAndScale);
+                            }
+                        }
+                    }
+                }
+                
+                // Finally, divide the results by the total weights
+                for (uint64_t index = 0; index < timeBounds.size(); ++index) {
+                    if (foxGlynnResults[index]) {
+                        storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(results[index], storm::utility::one<ValueType>() / foxGlynnResults[index]->totalWeight);
+                    }
+                }
+                return results;
+            }
             
             template <typename ValueType>
             storm::storage::SparseMatrix<ValueType> SparseCtmcCslHelper::computeProbabilityMatrix(storm::storage::SparseMatrix<ValueType> const& rateMatrix, std::vector<ValueType> const& exitRates) {
@@ -697,6 +902,10 @@ namespace storm {
             template std::vector<double> SparseCtmcCslHelper::computeNextProbabilities(Environment const& env, storm::storage::SparseMatrix<double> const& rateMatrix, std::vector<double> const& exitRateVector, storm::storage::BitVector const& nextStates);
             
             template std::vector<double> SparseCtmcCslHelper::computeInstantaneousRewards(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix, std::vector<double> const& exitRateVector, storm::models::sparse::StandardRewardModel<double> const& rewardModel, double timeBound);
+
+            template std::vector<std::vector<double>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimePoints(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& exitRates, std::vector<double> const& timePoints);
+            
+            template std::vector<std::vector<double>> SparseCtmcCslHelper::computeInstantaneousRewardsForTimePoints(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix, std::vector<double> const& exitRateVector, storm::models::sparse::StandardRewardModel<double> const& rewardModel, std::vector<double> const& timePoints);
             
             template std::vector<double> SparseCtmcCslHelper::computeReachabilityTimes(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, std::vector<double> const& exitRateVector, storm::storage::BitVector const& targetStates, bool qualitative);
             
@@ -711,6 +920,8 @@ namespace storm {
             template storm::storage::SparseMatrix<double> SparseCtmcCslHelper::computeUniformizedMatrix(storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::BitVector const& maybeStates, double uniformizationRate, std::vector<double> const& exitRates);
             
             template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector, double timeBound, double uniformizationRate, std::vector<double> values, double epsilon);
+            
+            template std::vector<std::vector<double>> SparseCtmcCslHelper::computeTransientProbabilitiesForTimePoints(Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector, std::vector<double> const& timeBounds, double uniformizationRate, std::vector<double> values, double epsilon);
 
 #ifdef STORM_HAVE_CARL
             template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, bool qualitative, double lowerBound, double upperBound);
@@ -728,6 +939,12 @@ namespace storm {
             template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeInstantaneousRewards(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, std::vector<storm::RationalNumber> const& exitRateVector, storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, double timeBound);
             template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeInstantaneousRewards(Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, std::vector<storm::RationalFunction> const& exitRateVector, storm::models::sparse::StandardRewardModel<storm::RationalFunction> const& rewardModel, double timeBound);
 
+            template std::vector<std::vector<storm::RationalNumber>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimePoints(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, std::vector<double> const& timePoints);
+            template std::vector<std::vector<storm::RationalFunction>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimePoints(Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, std::vector<double> const& timePoints);
+
+            template std::vector<std::vector<storm::RationalNumber>> SparseCtmcCslHelper::computeInstantaneousRewardsForTimePoints(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, std::vector<storm::RationalNumber> const& exitRateVector, storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, std::vector<double> const& timePoints);
+            template std::vector<std::vector<storm::RationalFunction>> SparseCtmcCslHelper::computeInstantaneousRewardsForTimePoints(Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, std::vector<storm::RationalFunction> const& exitRateVector, storm::models::sparse::StandardRewardModel<storm::RationalFunction> const& rewardModel, std::vector<double> const& timePoints);
+
             template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeReachabilityTimes(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& targetStates, bool qualitative);
             template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeReachabilityTimes(Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& exitRateVector, storm::storage::BitVector const& targetStates, bool qualitative);
 
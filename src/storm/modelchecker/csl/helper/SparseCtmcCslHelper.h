@@ -43,6 +43,32 @@ namespace storm {
                 template <typename ValueType, typename RewardModelType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
                 static std::vector<ValueType> computeInstantaneousRewards(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, std::vector<ValueType> const& exitRateVector, RewardModelType const& rewardModel, double timeBound);
 
+                /*!
+                 * Computes the probabilities of phi U[0,t] psi for each of the given time points t. The uniformized matrix
+                 * is built once and the matrix-vector multiplications are shared among all time points.
+                 *
+                 * @param timePoints The (non-negative, finite) upper time bounds.
+                 * @return For each time point (in the given order), the vector of probabilities.
+                 */
+                template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+                static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilitiesForTimePoints(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, std::vector<double> const& timePoints);
+
+                template <typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+                static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilitiesForTimePoints(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, std::vector<double> const& timePoints);
+
+                /*!
+                 * Computes the instantaneous rewards at each of the given time points. The uniformized matrix is built once
+                 * and the matrix-vector multiplications are shared among all time points.
+                 *
+                 * @param timePoints The (non-negative, finite) time points.
+                 * @return For each time point (in the given order), the vector of instantaneous rewards.
+                 */
+                template <typename ValueType, typename RewardModelType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+                static std::vector<std::vector<ValueType>> computeInstantaneousRewardsForTimePoints(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, std::vector<ValueType> const& exitRateVector, RewardModelType const& rewardModel, std::vector<double> const& timePoints);
+
+                template <typename ValueType, typename RewardModelType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+                static std::vector<std::vector<ValueType>> computeInstantaneousRewardsForTimePoints(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, std::vector<ValueType> const& exitRateVector, RewardModelType const& rewardModel, std::vector<double> const& timePoints);
+
                 template <typename ValueType, typename RewardModelType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
                 static std::vector<ValueType> computeCumulativeRewards(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, std::vector<ValueType> const& exitRateVector, RewardModelType const& rewardModel, double timeBound);
 
@@ -91,6 +117,18 @@ namespace storm {
                  */
                 template<typename ValueType, bool useMixedPoissonProbabilities = false, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
                 static std::vector<ValueType> computeTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon);
+
+                /*!
+                 * Computes the transient probabilities for several time bounds at once. The Fox-Glynn weights are computed
+                 * for each time bound and the weighted iterates are accumulated into one result per time bound. Hence, the
+                 * number of matrix-vector multiplications is the largest right truncation point instead of the sum of them.
+                 *
+                 * @param timeBounds The time bounds to use.
+                 * @return For each time bound (in the given order), the vector of transient probabilities.
+                 * @see computeTransientProbabilities
+                 */
+                template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+                static std::vector<std::vector<ValueType>> computeTransientProbabilitiesForTimePoints(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, std::vector<ValueType> const& timeBounds, ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon);
                 
                 /*!
                  * Converts the given rate-matrix into a time-abstract probability matrix.
@@ -121,6 +159,13 @@ namespace storm {
                  */
                 template <typename ValueType>
                 static bool checkAndUpdateTransientProbabilityEpsilon(storm::Environment const& env, ValueType& epsilon, std::vector<ValueType> const& resultVector, storm::storage::BitVector const& relevantPositions);
+
+                /*!
+                 * Checks whether all of the given result vectors are sufficiently precise. If not, epsilon is decreased
+                 * such that each of them is sufficiently precise in the next iteration.
+                 */
+                template <typename ValueType>
+                static bool checkAndUpdateTransientProbabilityEpsilon(storm::Environment const& env, ValueType& epsilon, std::vector<std::vector<ValueType>> const& resultVectors, storm::storage::BitVector const& relevantPositions);
                 
             };
         }
@@ -13,6 +13,7 @@
 #include "storm/modelchecker/results/ExplicitParetoCurveCheckResult.h"
 
 #include "storm/modelchecker/rpatl/helper/SparseSmgRpatlHelper.h"
+#include "storm/modelchecker/rpatl/helper/SparseSmgMultiObjectiveHelper.h"
 #include "storm/modelchecker/helper/infinitehorizon/SparseNondeterministicGameInfiniteHorizonHelper.h"
 #include "storm/modelchecker/helper/utility/SetInformationFromCheckTask.h"
 
@@ -21,6 +22,7 @@
 
 #include "storm/storage/BitVector.h"
 #include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/environment/solver/GameSolverEnvironment.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
 
@@ -31,6 +33,8 @@
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidOperationException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
     namespace modelchecker {
@@ -42,7 +46,18 @@ namespace storm {
         template<typename SparseSmgModelType>
         bool SparseSmgRpatlModelChecker<SparseSmgModelType>::canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask, bool* requiresSingleInitialState) {
             storm::logic::Formula const& formula = checkTask.getFormula();
-            return formula.isInFragment(storm::logic::rpatl());
+            if (formula.isInFragment(storm::logic::rpatl())) {
+                return true;
+            } else if (checkTask.isOnlyInitialStatesRelevantSet() && formula.isGameFormula() && formula.asGameFormula().getSubformula().isMultiObjectiveFormula()) {
+                auto multiObjectiveFragment = storm::logic::multiObjective().setBoundedUntilFormulasAllowed(false).setStepBoundedUntilFormulasAllowed(false).setTimeBoundedUntilFormulasAllowed(false).setLongRunAverageOperatorsAllowed(false).setLongRunAverageRewardFormulasAllowed(false);
+                if (formula.asGameFormula().getSubformula().isInFragment(multiObjectiveFragment)) {
+                    if (requiresSingleInitialState) {
+                        *requiresSingleInitialState = true;
+                    }
+                    return true;
+                }
+            }
+            return false;
         }
 
         template<typename SparseSmgModelType>
@@ -72,6 +87,8 @@ namespace storm {
                 return this->checkLongRunAverageOperatorFormula(solverEnv, checkTask.substituteFormula(subFormula.asLongRunAverageOperatorFormula()));
             } else if (subFormula.isProbabilityOperatorFormula()) {
                 return this->checkProbabilityOperatorFormula(solverEnv, checkTask.substituteFormula(subFormula.asProbabilityOperatorFormula()));
+            } else if (subFormula.isMultiObjectiveFormula()) {
+                return this->checkMultiObjectiveFormula(solverEnv, checkTask.substituteFormula(subFormula.asMultiObjectiveFormula()));
             }
             STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "Cannot check this property (yet).");
         }
@@ -103,6 +120,17 @@ namespace storm {
             return result;
         }
 
+        template<typename ModelType>
+        std::unique_ptr<CheckResult> SparseSmgRpatlModelChecker<ModelType>::checkMultiObjectiveFormula(Environment const& env, CheckTask<storm::logic::MultiObjectiveFormula, ValueType> const& checkTask) {
+            STORM_LOG_THROW(checkTask.isOnlyInitialStatesRelevantSet(), storm::exceptions::InvalidOperationException, "Multi-objective model checking on games is only supported for the initial states of the model.");
+            storm::modelchecker::helper::SparseSmgMultiObjectiveHelper<ValueType> helper(this->getModel(), checkTask.getFormula(), ~statesOfCoalition);
+            std::unique_ptr<CheckResult> result = helper.check(env);
+            if(checkTask.isShieldingTask()) {
+                helper.createShield(env, checkTask.getShieldingExpression());
+            }
+            return result;
+        }
+
         template<typename ModelType>
         std::unique_ptr<CheckResult> SparseSmgRpatlModelChecker<ModelType>::computeProbabilities(Environment const& env, CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
             storm::logic::Formula const& formula = checkTask.getFormula();
@@ -143,9 +171,14 @@ namespace storm {
 
             auto ret = storm::modelchecker::helper::SparseSmgRpatlHelper<ValueType>::computeUntilProbabilities(env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.isQualitativeSet(), statesOfCoalition, checkTask.isProduceSchedulersSet(), checkTask.getHint());
             std::unique_ptr<CheckResult> result(new ExplicitQuantitativeCheckResult<ValueType>(std::move(ret.values)));
-            if(checkTask.isShieldingTask()) {
+            if(checkTask.isShieldingTask() && checkTask.getShieldingExpression()->isPermissivePreShield()) {
+                // Reaching psi states is bad, leaving phi states without reaching a psi state is good.
+                STORM_LOG_THROW(checkTask.getOptimizationDirection() == storm::OptimizationDirection::Minimize, storm::exceptions::NotSupportedException, "Permissive shields are only supported for safety objectives, i.e. minimal reachability probabilities.");
+                storm::storage::BitVector allStatesBv = storm::storage::BitVector(this->getModel().getTransitionMatrix().getRowGroupCount(), true);
+                tempest::shields::createPermissiveShield<ValueType>(std::make_shared<storm::models::sparse::Smg<ValueType>>(this->getModel()), result->asExplicitQuantitativeCheckResult<ValueType>().getValueVector(), ret.choiceValues, rightResult.getTruthValuesVector(), ~(leftResult.getTruthValuesVector() | rightResult.getTruthValuesVector()), checkTask.getShieldingExpression(), checkTask.getOptimizationDirection(), allStatesBv, ~statesOfCoalition, storm::utility::convertNumber<ValueType>(env.solver().game().getPrecision()), ret.approximate);
+            } else if(checkTask.isShieldingTask()) {
                 storm::storage::BitVector allStatesBv = storm::storage::BitVector(this->getModel().getTransitionMatrix().getRowGroupCount(), true);
-                tempest::shields::createShield<ValueType>(std::make_shared<storm::models::sparse::Smg<ValueType>>(this->getModel()), std::move(ret.choiceValues), checkTask.getShieldingExpression(), checkTask.getOptimizationDirection(), allStatesBv, ~statesOfCoalition);
+                tempest::shields::createShield<ValueType>(std::make_shared<storm::models::sparse::Smg<ValueType>>(this->getModel()), std::move(ret.choiceValues), checkTask.getShieldingExpression(), checkTask.getOptimizationDirection(), allStatesBv, ~statesOfCoalition, ret.approximate);
             } else if (checkTask.isProduceSchedulersSet() && ret.scheduler) {
                 result->asExplicitQuantitativeCheckResult<ValueType>().setScheduler(std::move(ret.scheduler));
             }
@@ -160,9 +193,13 @@ namespace storm {
 
             auto ret = storm::modelchecker::helper::SparseSmgRpatlHelper<ValueType>::computeGloballyProbabilities(env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), subResult.getTruthValuesVector(), checkTask.isQualitativeSet(), statesOfCoalition, checkTask.isProduceSchedulersSet(), checkTask.getHint());
             std::unique_ptr<CheckResult> result(new ExplicitQuantitativeCheckResult<ValueType>(std::move(ret.values)));
-            if(checkTask.isShieldingTask()) {
+            if(checkTask.isShieldingTask() && checkTask.getShieldingExpression()->isPermissivePreShield()) {
+                STORM_LOG_THROW(checkTask.getOptimizationDirection() == storm::OptimizationDirection::Maximize, storm::exceptions::NotSupportedException, "Permissive shields are only supported for safety objectives, i.e. maximal probabilities of globally formulas.");
+                storm::storage::BitVector allStatesBv = storm::storage::BitVector(this->getModel().getTransitionMatrix().getRowGroupCount(), true);
+                tempest::shields::createPermissiveShield<ValueType>(std::make_shared<storm::models::sparse::Smg<ValueType>>(this->getModel()), result->asExplicitQuantitativeCheckResult<ValueType>().getValueVector(), ret.choiceValues, ~subResult.getTruthValuesVector(), storm::storage::BitVector(allStatesBv.size(), false), checkTask.getShieldingExpression(), checkTask.getOptimizationDirection(), allStatesBv, ~statesOfCoalition, storm::utility::convertNumber<ValueType>(env.solver().game().getPrecision()), ret.approximate);
+            } else if(checkTask.isShieldingTask()) {
                 storm::storage::BitVector allStatesBv = storm::storage::BitVector(this->getModel().getTransitionMatrix().getRowGroupCount(), true);
-                tempest::shields::createShield<ValueType>(std::make_shared<storm::models::sparse::Smg<ValueType>>(this->getModel()), std::move(ret.choiceValues), checkTask.getShieldingExpression(), checkTask.getOptimizationDirection(), allStatesBv, ~statesOfCoalition);
+                tempest::shields::createShield<ValueType>(std::make_shared<storm::models::sparse::Smg<ValueType>>(this->getModel()), std::move(ret.choiceValues), checkTask.getShieldingExpression(), checkTask.getOptimizationDirection(), allStatesBv, ~statesOfCoalition, ret.approximate);
             } else if (checkTask.isProduceSchedulersSet() && ret.scheduler) {
                 result->asExplicitQuantitativeCheckResult<ValueType>().setScheduler(std::move(ret.scheduler));
             }
@@ -197,7 +234,7 @@ namespace storm {
             std::unique_ptr<CheckResult> result(new ExplicitQuantitativeCheckResult<ValueType>(std::move(ret.values)));
             if(checkTask.isShieldingTask()) {
                 storm::storage::BitVector allStatesBv = storm::storage::BitVector(this->getModel().getTransitionMatrix().getRowGroupCount(), true);
-                tempest::shields::createShield<ValueType>(std::make_shared<storm::models::sparse::Smg<ValueType>>(this->getModel()), std::move(ret.choiceValues), checkTask.getShieldingExpression(), checkTask.getOptimizationDirection(), allStatesBv, ~statesOfCoalition);
+                tempest::shields::createShield<ValueType>(std::make_shared<storm::models::sparse::Smg<ValueType>>(this->getModel()), std::move(ret.choiceValues), checkTask.getShieldingExpression(), checkTask.getOptimizationDirection(), allStatesBv, ~statesOfCoalition, ret.approximate);
             }
             return result;
         }
@@ -219,7 +256,7 @@ namespace storm {
             auto ret = storm::modelchecker::helper::SparseSmgRpatlHelper<ValueType>::computeBoundedUntilProbabilities(env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.isQualitativeSet(), statesOfCoalition, checkTask.isProduceSchedulersSet(), checkTask.getHint(), pathFormula.getNonStrictLowerBound<uint64_t>(), pathFormula.getNonStrictUpperBound<uint64_t>());
             std::unique_ptr<CheckResult> result(new ExplicitQuantitativeCheckResult<ValueType>(std::move(ret.values)));
             if(checkTask.isShieldingTask()) {
-                tempest::shields::createShield<ValueType>(std::make_shared<storm::models::sparse::Smg<ValueType>>(this->getModel()), std::move(ret.choiceValues), checkTask.getShieldingExpression(), checkTask.getOptimizationDirection(), std::move(ret.relevantStates), ~statesOfCoalition);
+                tempest::shields::createShield<ValueType>(std::make_shared<storm::models::sparse::Smg<ValueType>>(this->getModel()), std::move(ret.choiceValues), checkTask.getShieldingExpression(), checkTask.getOptimizationDirection(), std::move(ret.relevantStates), ~statesOfCoalition, ret.approximate);
             }
             return result;
         }
@@ -36,6 +36,9 @@ namespace storm {
 
                 // The values computed for the available choices.
                 std::vector<ValueType> choiceValues;
+
+                // Whether value iteration was stopped before convergence, i.e. the values are only approximations.
+                bool approximate = false;
             };
         }
 
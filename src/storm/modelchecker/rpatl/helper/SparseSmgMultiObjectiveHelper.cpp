@@ -0,0 +1,564 @@
+#include "storm/modelchecker/rpatl/helper/SparseSmgMultiObjectiveHelper.h"
+
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
+#include "storm/environment/solver/GameSolverEnvironment.h"
+#include "storm/modelchecker/multiobjective/MultiObjectivePostprocessing.h"
+#include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitParetoCurveCheckResult.h"
+#include "storm/modelchecker/rpatl/helper/internal/GameViHelper.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/shields/ShieldHandling.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+#include "storm/utility/SignalHandler.h"
+
+#include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidPropertyException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/UnexpectedException.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace helper {
+
+            namespace {
+                storm::logic::OperatorInformation getGameOperatorInformation(storm::logic::OperatorFormula const& formula, bool considerComplementaryEvent) {
+                    storm::logic::OperatorInformation opInfo;
+                    if (formula.hasBound()) {
+                        opInfo.bound = formula.getBound();
+                        if (considerComplementaryEvent) {
+                            opInfo.bound->threshold = opInfo.bound->threshold.getManager().rational(storm::utility::one<storm::RationalNumber>()) - opInfo.bound->threshold;
+                            opInfo.bound->comparisonType = storm::logic::invertPreserveStrictness(opInfo.bound->comparisonType);
+                        }
+                        opInfo.optimalityType = storm::logic::isLowerBound(opInfo.bound->comparisonType) ? storm::solver::OptimizationDirection::Maximize : storm::solver::OptimizationDirection::Minimize;
+                        STORM_LOG_WARN_COND(!formula.hasOptimalityType(), "Optimization direction of formula " << formula << " ignored as the formula also specifies a threshold.");
+                    } else {
+                        STORM_LOG_THROW(formula.hasOptimalityType(), storm::exceptions::InvalidPropertyException, "Objective " << formula << " does not specify whether to minimize or maximize.");
+                        opInfo.optimalityType = formula.getOptimalityType();
+                        if (considerComplementaryEvent) {
+                            opInfo.optimalityType = storm::solver::invert(opInfo.optimalityType.get());
+                        }
+                    }
+                    return opInfo;
+                }
+            }
+
+            template<typename ValueType>
+            SparseSmgMultiObjectiveHelper<ValueType>::SparseSmgMultiObjectiveHelper(storm::models::sparse::Smg<ValueType> const& model, storm::logic::MultiObjectiveFormula const& formula, storm::storage::BitVector const& statesOfCoalition) {
+                initialize(model, formula, statesOfCoalition);
+                this->diracWeightVectorsToBeChecked = storm::storage::BitVector(this->objectives.size(), true);
+                this->overApproximation = storm::storage::geometry::Polytope<GeometryValueType>::createUniversalPolytope();
+                this->underApproximation = storm::storage::geometry::Polytope<GeometryValueType>::createEmptyPolytope();
+            }
+
+            template<typename ValueType>
+            void SparseSmgMultiObjectiveHelper<ValueType>::initialize(storm::models::sparse::Smg<ValueType> const& model, storm::logic::MultiObjectiveFormula const& formula, storm::storage::BitVector const& statesOfCoalition) {
+                STORM_LOG_THROW(model.getInitialStates().getNumberOfSetBits() == 1, storm::exceptions::InvalidArgumentException, "Multi-objective model checking on games is only supported for models with a unique initial state.");
+                originalInitialState = model.getInitialStates().getNextSetIndex(0);
+                uint64_t numObjectives = formula.getNumberOfSubformulas();
+
+                storm::modelchecker::SparsePropositionalModelChecker<storm::models::sparse::Smg<ValueType>> mc(model);
+                auto checkStateFormula = [&mc](storm::logic::Formula const& stateFormula) {
+                    return mc.check(stateFormula)->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                };
+
+                // For each objective, we store the states at which the objective is decided (if it has a decided-flag), the target states and the rewards of the original choices.
+                std::vector<boost::optional<uint64_t>> flagOfObjective(numObjectives);
+                std::vector<storm::storage::BitVector> decidedStatesOfFlag;
+                std::vector<storm::storage::BitVector> targetStates(numObjectives);
+                std::vector<std::vector<ValueType>> originalChoiceRewards(numObjectives);
+
+                for (uint64_t objIndex = 0; objIndex < numObjectives; ++objIndex) {
+                    auto const& subFormula = formula.getSubformulas()[objIndex];
+                    STORM_LOG_THROW(subFormula->isOperatorFormula(), storm::exceptions::InvalidPropertyException, "Could not preprocess the subformula " << *subFormula << " of " << formula << " because it is not supported.");
+                    auto const& opFormula = subFormula->asOperatorFormula();
+                    auto const& pathFormula = opFormula.getSubformula();
+
+                    storm::modelchecker::multiobjective::Objective<ValueType> objective;
+                    objective.originalFormula = subFormula;
+                    objective.considersComplementaryEvent = opFormula.isProbabilityOperatorFormula() && pathFormula.isGloballyFormula();
+                    storm::logic::OperatorInformation opInfo = getGameOperatorInformation(opFormula, objective.considersComplementaryEvent);
+
+                    if (opFormula.isProbabilityOperatorFormula()) {
+                        std::shared_ptr<storm::logic::Formula const> leftSubformula, rightSubformula;
+                        if (pathFormula.isUntilFormula()) {
+                            leftSubformula = pathFormula.asUntilFormula().getLeftSubformula().asSharedPointer();
+                            rightSubformula = pathFormula.asUntilFormula().getRightSubformula().asSharedPointer();
+                        } else if (pathFormula.isEventuallyFormula()) {
+                            leftSubformula = storm::logic::Formula::getTrueFormula();
+                            rightSubformula = pathFormula.asEventuallyFormula().getSubformula().asSharedPointer();
+                        } else if (pathFormula.isGloballyFormula()) {
+                            // The formula is transformed to a reachability formula for the complementary event.
+                            leftSubformula = storm::logic::Formula::getTrueFormula();
+                            rightSubformula = std::make_shared<storm::logic::UnaryBooleanStateFormula>(storm::logic::UnaryBooleanStateFormula::OperatorType::Not, pathFormula.asGloballyFormula().getSubformula().asSharedPointer());
+                        } else {
+                            STORM_LOG_THROW(false, storm::exceptions::InvalidPropertyException, "The subformula of " << opFormula << " is not supported for games.");
+                        }
+                        objective.formula = std::make_shared<storm::logic::ProbabilityOperatorFormula>(std::make_shared<storm::logic::UntilFormula>(leftSubformula, rightSubformula), opInfo);
+                        objective.lowerResultBound = storm::utility::zero<ValueType>();
+                        objective.upperResultBound = storm::utility::one<ValueType>();
+
+                        storm::storage::BitVector phiStates = checkStateFormula(*leftSubformula);
+                        targetStates[objIndex] = checkStateFormula(*rightSubformula);
+                        flagOfObjective[objIndex] = decidedStatesOfFlag.size();
+                        decidedStatesOfFlag.push_back(targetStates[objIndex] | ~phiStates);
+                    } else if (opFormula.isRewardOperatorFormula()) {
+                        auto const& rewardFormula = opFormula.asRewardOperatorFormula();
+                        std::string rewardModelName;
+                        if (rewardFormula.hasRewardModelName()) {
+                            rewardModelName = rewardFormula.getRewardModelName();
+                            STORM_LOG_THROW(model.hasRewardModel(rewardModelName), storm::exceptions::InvalidPropertyException, "The reward model specified by formula " << opFormula << " does not exist in the model.");
+                        } else {
+                            STORM_LOG_THROW(model.hasUniqueRewardModel(), storm::exceptions::InvalidPropertyException, "The formula " << opFormula << " does not specify a reward model name and the reward model is not unique.");
+                            rewardModelName = model.getRewardModels().begin()->first;
+                        }
+                        objective.formula = std::make_shared<storm::logic::RewardOperatorFormula>(pathFormula.asSharedPointer(), rewardModelName, opInfo);
+                        objective.lowerResultBound = storm::utility::zero<ValueType>();
+                        originalChoiceRewards[objIndex] = model.getRewardModel(rewardModelName).getTotalRewardVector(model.getTransitionMatrix());
+
+                        if (pathFormula.isEventuallyFormula()) {
+                            targetStates[objIndex] = checkStateFormula(pathFormula.asEventuallyFormula().getSubformula());
+                            flagOfObjective[objIndex] = decidedStatesOfFlag.size();
+                            decidedStatesOfFlag.push_back(targetStates[objIndex]);
+                        } else {
+                            STORM_LOG_THROW(pathFormula.isTotalRewardFormula(), storm::exceptions::InvalidPropertyException, "The subformula of " << opFormula << " is not supported for games.");
+                        }
+                    } else {
+                        STORM_LOG_THROW(false, storm::exceptions::InvalidPropertyException, "Could not preprocess the objective " << opFormula << " because it is not supported for games.");
+                    }
+                    objectives.push_back(std::move(objective));
+                }
+
+                // Build the product of the game with the decided-flags.
+                uint64_t numFlags = decidedStatesOfFlag.size();
+                STORM_LOG_THROW(numFlags <= 64, storm::exceptions::NotSupportedException, "Multi-objective model checking on games supports at most 64 reachability objectives.");
+                auto const& transitionMatrix = model.getTransitionMatrix();
+                std::vector<std::unordered_map<uint64_t, uint64_t>> productStateIndices(model.getNumberOfStates());
+                std::vector<uint64_t> productFlags;
+                auto getOrAddProductState = [&](uint64_t state, uint64_t flags) {
+                    auto insertionRes = productStateIndices[state].emplace(flags, productToOriginalState.size());
+                    if (insertionRes.second) {
+                        productToOriginalState.push_back(state);
+                        productFlags.push_back(flags);
+                    }
+                    return insertionRes.first->second;
+                };
+                productInitialState = getOrAddProductState(originalInitialState, 0);
+
+                storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true, 0);
+                std::vector<uint64_t> productToOriginalChoice;
+                std::vector<std::pair<uint64_t, ValueType>> rowEntries;
+                uint64_t productRow = 0;
+                // Note that states are added to productToOriginalState while exploring it.
+                for (uint64_t productState = 0; productState < productToOriginalState.size(); ++productState) {
+                    uint64_t state = productToOriginalState[productState];
+                    uint64_t successorFlags = productFlags[productState];
+                    for (uint64_t flag = 0; flag < numFlags; ++flag) {
+                        if (decidedStatesOfFlag[flag].get(state)) {
+                            successorFlags |= (1ull << flag);
+                        }
+                    }
+                    builder.newRowGroup(productRow);
+                    for (uint64_t row = transitionMatrix.getRowGroupIndices()[state]; row < transitionMatrix.getRowGroupIndices()[state + 1]; ++row, ++productRow) {
+                        rowEntries.clear();
+                        for (auto const& entry : transitionMatrix.getRow(row)) {
+                            rowEntries.emplace_back(getOrAddProductState(entry.getColumn(), successorFlags), entry.getValue());
+                        }
+                        std::sort(rowEntries.begin(), rowEntries.end(), [](std::pair<uint64_t, ValueType> const& lhs, std::pair<uint64_t, ValueType> const& rhs) { return lhs.first < rhs.first; });
+                        for (auto const& entry : rowEntries) {
+                            builder.addNextValue(productRow, entry.first, entry.second);
+                        }
+                        productToOriginalChoice.push_back(row);
+                    }
+                }
+                uint64_t numProductStates = productToOriginalState.size();
+                STORM_LOG_INFO("Product of the game with the decided-flags of " << numFlags << " objectives has " << numProductStates << " states.");
+
+                // Compute the rewards of the objectives within the product.
+                objectiveRewards.assign(numObjectives, std::vector<ValueType>(productRow, storm::utility::zero<ValueType>()));
+                storm::storage::SparseMatrix<ValueType> productMatrix = builder.build(productRow, numProductStates, numProductStates);
+                for (uint64_t productState = 0; productState < numProductStates; ++productState) {
+                    uint64_t state = productToOriginalState[productState];
+                    for (uint64_t objIndex = 0; objIndex < numObjectives; ++objIndex) {
+                        bool decided = flagOfObjective[objIndex] && ((productFlags[productState] >> flagOfObjective[objIndex].get()) & 1ull);
+                        bool isTarget = flagOfObjective[objIndex] && targetStates[objIndex].get(state);
+                        for (uint64_t productChoice = productMatrix.getRowGroupIndices()[productState]; productChoice < productMatrix.getRowGroupIndices()[productState + 1]; ++productChoice) {
+                            if (objectives[objIndex].formula->isProbabilityOperatorFormula()) {
+                                // Reaching the target is rewarded once.
+                                if (!decided && isTarget) {
+                                    objectiveRewards[objIndex][productChoice] = storm::utility::one<ValueType>();
+                                }
+                            } else if (!decided && !isTarget) {
+                                // Rewards are collected until the target is reached (if there is a target).
+                                objectiveRewards[objIndex][productChoice] = originalChoiceRewards[objIndex][productToOriginalChoice[productChoice]];
+                            }
+                        }
+                    }
+                }
+
+                // Create the product model.
+                storm::models::sparse::StateLabeling stateLabeling(numProductStates);
+                for (auto const& label : model.getStateLabeling().getLabels()) {
+                    if (label == "init") {
+                        continue;
+                    }
+                    storm::storage::BitVector const& originalLabelStates = model.getStateLabeling().getStates(label);
+                    storm::storage::BitVector labelStates(numProductStates, false);
+                    for (uint64_t productState = 0; productState < numProductStates; ++productState) {
+                        labelStates.set(productState, originalLabelStates.get(productToOriginalState[productState]));
+                    }
+                    stateLabeling.addLabel(label, std::move(labelStates));
+                }
+                storm::storage::BitVector initialStates(numProductStates, false);
+                initialStates.set(productInitialState);
+                stateLabeling.addLabel("init", std::move(initialStates));
+
+                storm::storage::sparse::ModelComponents<ValueType> components(std::move(productMatrix), std::move(stateLabeling));
+                if (model.hasChoiceLabeling()) {
+                    storm::models::sparse::ChoiceLabeling choiceLabeling(productRow);
+                    for (auto const& label : model.getChoiceLabeling().getLabels()) {
+                        storm::storage::BitVector const& originalLabelChoices = model.getChoiceLabeling().getChoices(label);
+                        storm::storage::BitVector labelChoices(productRow, false);
+                        for (uint64_t productChoice = 0; productChoice < productRow; ++productChoice) {
+                            labelChoices.set(productChoice, originalLabelChoices.get(productToOriginalChoice[productChoice]));
+                        }
+                        choiceLabeling.addLabel(label, std::move(labelChoices));
+                    }
+                    components.choiceLabeling = std::move(choiceLabeling);
+                }
+                if (model.hasStateValuations()) {
+                    components.stateValuations = model.getStateValuations().blowup(productToOriginalState);
+                }
+                std::vector<storm::storage::PlayerIndex> statePlayerIndications;
+                statePlayerIndications.reserve(numProductStates);
+                productStatesOfCoalition = storm::storage::BitVector(numProductStates, false);
+                for (uint64_t productState = 0; productState < numProductStates; ++productState) {
+                    statePlayerIndications.push_back(model.getPlayerOfState(productToOriginalState[productState]));
+                    productStatesOfCoalition.set(productState, statesOfCoalition.get(productToOriginalState[productState]));
+                }
+                components.statePlayerIndications = std::move(statePlayerIndications);
+                components.playerNameToIndexMap = model.getPlayerNameToIndexMap();
+                productModel = std::make_shared<storm::models::sparse::Smg<ValueType>>(std::move(components));
+
+                // Gather the thresholds of achievability queries.
+                uint64_t numBoundedObjectives = std::count_if(objectives.begin(), objectives.end(), [](storm::modelchecker::multiobjective::Objective<ValueType> const& obj) { return obj.formula->hasBound(); });
+                STORM_LOG_THROW(numBoundedObjectives == 0 || numBoundedObjectives == numObjectives, storm::exceptions::NotSupportedException, "Multi-objective model checking on games supports either achievability queries (all objectives have thresholds) or Pareto queries (no objective has a threshold).");
+                strictThresholds = storm::storage::BitVector(numObjectives, false);
+                if (numBoundedObjectives > 0) {
+                    for (uint64_t objIndex = 0; objIndex < numObjectives; ++objIndex) {
+                        auto const& objFormula = *objectives[objIndex].formula;
+                        thresholds.push_back(objFormula.template getThresholdAs<GeometryValueType>());
+                        if (storm::solver::minimize(objFormula.getOptimalityType())) {
+                            // Values for minimizing objectives are negated in order to convert them to maximizing objectives.
+                            thresholds.back() *= -storm::utility::one<GeometryValueType>();
+                        }
+                        strictThresholds.set(objIndex, storm::logic::isStrict(objFormula.getBound().comparisonType));
+                    }
+                }
+            }
+
+            template<typename ValueType>
+            bool SparseSmgMultiObjectiveHelper<ValueType>::isAchievabilityQuery() const {
+                return !thresholds.empty();
+            }
+
+            template<typename ValueType>
+            std::unique_ptr<CheckResult> SparseSmgMultiObjectiveHelper<ValueType>::check(Environment const& env) {
+                if (isAchievabilityQuery()) {
+                    bool result = checkAchievability(env);
+                    return std::unique_ptr<CheckResult>(new ExplicitQualitativeCheckResult(originalInitialState, result));
+                }
+
+                exploreSetOfAchievablePoints(env);
+                std::vector<std::vector<ValueType>> paretoOptimalPoints;
+                std::vector<Point> vertices = underApproximation->getVertices();
+                paretoOptimalPoints.reserve(vertices.size());
+                for (auto const& vertex : vertices) {
+                    paretoOptimalPoints.push_back(storm::utility::vector::convertNumericVector<ValueType>(storm::modelchecker::multiobjective::transformObjectiveValuesToOriginal(objectives, vertex)));
+                }
+                return std::unique_ptr<CheckResult>(new ExplicitParetoCurveCheckResult<ValueType>(originalInitialState, std::move(paretoOptimalPoints),
+                                                                                                  storm::modelchecker::multiobjective::transformObjectivePolytopeToOriginal(objectives, underApproximation)->template convertNumberRepresentation<ValueType>(),
+                                                                                                  storm::modelchecker::multiobjective::transformObjectivePolytopeToOriginal(objectives, overApproximation)->template convertNumberRepresentation<ValueType>()));
+            }
+
+            template<typename ValueType>
+            typename SparseSmgMultiObjectiveHelper<ValueType>::WeightedResult SparseSmgMultiObjectiveHelper<ValueType>::solveWeightedGame(Environment const& env, WeightVector const& weightVector) const {
+                auto const& transitionMatrix = productModel->getTransitionMatrix();
+                std::vector<ValueType> weightedRewards(transitionMatrix.getRowCount(), storm::utility::zero<ValueType>());
+                for (uint64_t objIndex = 0; objIndex < objectives.size(); ++objIndex) {
+                    ValueType weight = storm::utility::convertNumber<ValueType>(weightVector[objIndex]);
+                    if (storm::utility::isZero(weight)) {
+                        continue;
+                    }
+                    if (storm::solver::minimize(objectives[objIndex].formula->getOptimalityType())) {
+                        weight = -weight;
+                    }
+                    storm::utility::vector::addScaledVector(weightedRewards, objectiveRewards[objIndex], weight);
+                }
+
+                // The coalition maximizes the weighted sum while the remaining players minimize it.
+                storm::modelchecker::helper::internal::GameViHelper<ValueType> viHelper(transitionMatrix, ~productStatesOfCoalition);
+                viHelper.setProduceScheduler(true);
+                WeightedResult result;
+                result.values.assign(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+                viHelper.performValueIteration(env, result.values, weightedRewards, storm::solver::OptimizationDirection::Maximize, result.choiceValues);
+                viHelper.getChoiceValues(env, result.values, result.choiceValues);
+
+                auto scheduler = viHelper.extractScheduler();
+                result.choices.reserve(transitionMatrix.getRowGroupCount());
+                for (uint64_t state = 0; state < transitionMatrix.getRowGroupCount(); ++state) {
+                    result.choices.push_back(scheduler.getChoice(state).getDeterministicChoice());
+                }
+                return result;
+            }
+
+            template<typename ValueType>
+            ValueType SparseSmgMultiObjectiveHelper<ValueType>::evaluateObjective(Environment const& env, uint64_t objIndex, storm::storage::BitVector const& selectedRows) const {
+                storm::storage::SparseMatrix<ValueType> submatrix = productModel->getTransitionMatrix().restrictRows(selectedRows);
+                std::vector<ValueType> rewards = storm::utility::vector::filterVector(objectiveRewards[objIndex], selectedRows);
+                if (storm::solver::minimize(objectives[objIndex].formula->getOptimalityType())) {
+                    storm::utility::vector::scaleVectorInPlace(rewards, -storm::utility::one<ValueType>());
+                }
+                // The coalition has a single choice in each of its states. The remaining players play against the objective.
+                storm::modelchecker::helper::internal::GameViHelper<ValueType> viHelper(submatrix, ~productStatesOfCoalition);
+                std::vector<ValueType> x(submatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+                std::vector<ValueType> choiceValues;
+                viHelper.performValueIteration(env, x, rewards, storm::solver::OptimizationDirection::Maximize, choiceValues);
+                return x[productInitialState];
+            }
+
+            template<typename ValueType>
+            void SparseSmgMultiObjectiveHelper<ValueType>::performRefinementStep(Environment const& env, WeightVector&& direction) {
+                // Normalize the direction vector so that the entries sum up to one
+                storm::utility::vector::scaleVectorInPlace(direction, storm::utility::one<GeometryValueType>() / std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>()));
+                WeightedResult weightedResult = solveWeightedGame(env, direction);
+
+                // Fix the choices of the coalition
+                auto const& rowGroupIndices = productModel->getTransitionMatrix().getRowGroupIndices();
+                storm::storage::BitVector selectedRows(productModel->getTransitionMatrix().getRowCount(), true);
+                for (auto state : productStatesOfCoalition) {
+                    for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                        selectedRows.set(row, row == rowGroupIndices[state] + weightedResult.choices[state]);
+                    }
+                }
+
+                RefinementStep step;
+                step.weightVector = direction;
+                step.lowerBoundPoint.reserve(objectives.size());
+                for (uint64_t objIndex = 0; objIndex < objectives.size(); ++objIndex) {
+                    step.lowerBoundPoint.push_back(storm::utility::convertNumber<GeometryValueType>(evaluateObjective(env, objIndex, selectedRows)));
+                }
+                // The value of the weighted game bounds the weighted sum of every achievable point. We account for the precision of the value iteration.
+                step.upperBoundOffset = storm::utility::convertNumber<GeometryValueType>(weightedResult.values[productInitialState]) + storm::utility::convertNumber<GeometryValueType>(env.solver().game().getPrecision());
+                STORM_LOG_DEBUG("Weighted game yields point " << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(step.lowerBoundPoint)) << " with weighted value " << storm::utility::convertNumber<double>(step.upperBoundOffset) << ".");
+
+                refinementSteps.push_back(std::move(step));
+                updateOverApproximation();
+                updateUnderApproximation();
+            }
+
+            template<typename ValueType>
+            void SparseSmgMultiObjectiveHelper<ValueType>::updateOverApproximation() {
+                storm::storage::geometry::Halfspace<GeometryValueType> h(refinementSteps.back().weightVector, refinementSteps.back().upperBoundOffset);
+                // Due to numerical issues, the halfspace might not contain the underapproximation. In this case, we shift it.
+                GeometryValueType maximumOffset = h.offset();
+                for (auto const& step : refinementSteps) {
+                    maximumOffset = std::max(maximumOffset, storm::utility::vector::dotProduct(h.normalVector(), step.lowerBoundPoint));
+                }
+                if (maximumOffset > h.offset()) {
+                    STORM_LOG_WARN("Numerical issues: The overapproximation would not contain the underapproximation. Hence, a halfspace is shifted by " << storm::utility::convertNumber<double>(maximumOffset - h.offset()) << ".");
+                    h.offset() = maximumOffset;
+                }
+                overApproximation = overApproximation->intersection(h);
+                STORM_LOG_DEBUG("Updated OverApproximation to " << overApproximation->toString(true));
+            }
+
+            template<typename ValueType>
+            void SparseSmgMultiObjectiveHelper<ValueType>::updateUnderApproximation() {
+                std::vector<Point> paretoPoints;
+                paretoPoints.reserve(refinementSteps.size());
+                for (auto const& step : refinementSteps) {
+                    paretoPoints.push_back(step.lowerBoundPoint);
+                }
+                underApproximation = storm::storage::geometry::Polytope<GeometryValueType>::createDownwardClosure(paretoPoints);
+                STORM_LOG_DEBUG("Updated UnderApproximation to " << underApproximation->toString(true));
+            }
+
+            template<typename ValueType>
+            typename SparseSmgMultiObjectiveHelper<ValueType>::WeightVector SparseSmgMultiObjectiveHelper<ValueType>::findSeparatingVector(Point const& pointToBeSeparated) {
+                if (underApproximation->isEmpty()) {
+                    // In this case, every weight vector is separating
+                    uint64_t objIndex = diracWeightVectorsToBeChecked.getNextSetIndex(0) % pointToBeSeparated.size();
+                    WeightVector result(pointToBeSeparated.size(), storm::utility::zero<GeometryValueType>());
+                    result[objIndex] = storm::utility::one<GeometryValueType>();
+                    diracWeightVectorsToBeChecked.set(objIndex, false);
+                    return result;
+                }
+
+                // The separating vector is the normal vector of one of the halfspaces of the underapproximation. Dirac weight vectors take precedence.
+                std::vector<storm::storage::geometry::Halfspace<GeometryValueType>> halfspaces = underApproximation->getHalfspaces();
+                uint64_t farestHalfspaceIndex = halfspaces.size();
+                GeometryValueType farestDistance = -storm::utility::one<GeometryValueType>();
+                bool foundSeparatingDiracVector = false;
+                for (uint64_t halfspaceIndex = 0; halfspaceIndex < halfspaces.size(); ++halfspaceIndex) {
+                    GeometryValueType distance = halfspaces[halfspaceIndex].euclideanDistance(pointToBeSeparated);
+                    if (!storm::utility::isZero(distance)) {
+                        storm::storage::BitVector nonZeroVectorEntries = ~storm::utility::vector::filterZero<GeometryValueType>(halfspaces[halfspaceIndex].normalVector());
+                        bool isSingleObjectiveVector = nonZeroVectorEntries.getNumberOfSetBits() == 1 && diracWeightVectorsToBeChecked.get(nonZeroVectorEntries.getNextSetIndex(0));
+                        if ((!foundSeparatingDiracVector && isSingleObjectiveVector) || (foundSeparatingDiracVector == isSingleObjectiveVector && distance > farestDistance)) {
+                            foundSeparatingDiracVector = foundSeparatingDiracVector || isSingleObjectiveVector;
+                            farestHalfspaceIndex = halfspaceIndex;
+                            farestDistance = distance;
+                        }
+                    }
+                }
+                STORM_LOG_THROW(farestHalfspaceIndex < halfspaces.size(), storm::exceptions::UnexpectedException, "There is no seperating vector.");
+                if (foundSeparatingDiracVector) {
+                    diracWeightVectorsToBeChecked &= storm::utility::vector::filterZero<GeometryValueType>(halfspaces[farestHalfspaceIndex].normalVector());
+                }
+                return halfspaces[farestHalfspaceIndex].normalVector();
+            }
+
+            template<typename ValueType>
+            bool SparseSmgMultiObjectiveHelper<ValueType>::checkIfThresholdsAreSatisfied(std::shared_ptr<storm::storage::geometry::Polytope<GeometryValueType>> const& polytope) const {
+                for (auto const& h : polytope->getHalfspaces()) {
+                    if (storm::utility::isZero(h.distance(thresholds))) {
+                        // Check if the threshold point is on the boundary of the halfspace and whether this is violates strict thresholds
+                        if (h.isPointOnBoundary(thresholds)) {
+                            for (auto strictThreshold : strictThresholds) {
+                                if (h.normalVector()[strictThreshold] > storm::utility::zero<GeometryValueType>()) {
+                                    return false;
+                                }
+                            }
+                        }
+                    } else {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            template<typename ValueType>
+            bool SparseSmgMultiObjectiveHelper<ValueType>::maxStepsPerformed(Environment const& env) const {
+                return env.modelchecker().multi().isMaxStepsSet() && refinementSteps.size() >= env.modelchecker().multi().getMaxSteps();
+            }
+
+            template<typename ValueType>
+            bool SparseSmgMultiObjectiveHelper<ValueType>::checkAchievability(Environment const& env) {
+                // Repeatedly refine the approximations until the threshold point is either in the under approx. or not in the over approx.
+                while (!maxStepsPerformed(env) && !storm::utility::resources::isTerminate()) {
+                    performRefinementStep(env, findSeparatingVector(thresholds));
+                    if (!checkIfThresholdsAreSatisfied(overApproximation)) {
+                        return false;
+                    }
+                    if (checkIfThresholdsAreSatisfied(underApproximation)) {
+                        return true;
+                    }
+                }
+                STORM_LOG_ERROR("Could not check whether thresholds are achievable: Termination requested or maximum number of refinement steps exceeded.");
+                return false;
+            }
+
+            template<typename ValueType>
+            void SparseSmgMultiObjectiveHelper<ValueType>::exploreSetOfAchievablePoints(Environment const& env) {
+                STORM_LOG_THROW(env.modelchecker().multi().getPrecisionType() == MultiObjectiveModelCheckerEnvironment::PrecisionType::Absolute, storm::exceptions::IllegalArgumentException, "Unhandled multiobjective precision type.");
+
+                // First consider the objectives individually
+                for (uint64_t objIndex = 0; objIndex < objectives.size() && !maxStepsPerformed(env); ++objIndex) {
+                    WeightVector direction(objectives.size(), storm::utility::zero<GeometryValueType>());
+                    direction[objIndex] = storm::utility::one<GeometryValueType>();
+                    performRefinementStep(env, std::move(direction));
+                    if (storm::utility::resources::isTerminate()) {
+                        break;
+                    }
+                }
+
+                while (!maxStepsPerformed(env) && !storm::utility::resources::isTerminate()) {
+                    // Get the halfspace of the underApproximation with maximal distance to a vertex of the overApproximation
+                    std::vector<storm::storage::geometry::Halfspace<GeometryValueType>> underApproxHalfspaces = underApproximation->getHalfspaces();
+                    std::vector<Point> overApproxVertices = overApproximation->getVertices();
+                    uint64_t farestHalfspaceIndex = underApproxHalfspaces.size();
+                    GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
+                    for (uint64_t halfspaceIndex = 0; halfspaceIndex < underApproxHalfspaces.size(); ++halfspaceIndex) {
+                        for (auto const& vertex : overApproxVertices) {
+                            GeometryValueType distance = underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex);
+                            if (distance > farestDistance) {
+                                farestHalfspaceIndex = halfspaceIndex;
+                                farestDistance = distance;
+                            }
+                        }
+                    }
+                    if (farestDistance < env.modelchecker().multi().getPrecision()) {
+                        // Goal precision reached!
+                        return;
+                    }
+                    STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~" << storm::utility::convertNumber<double>(farestDistance));
+                    performRefinementStep(env, underApproxHalfspaces[farestHalfspaceIndex].normalVector());
+                }
+                STORM_LOG_ERROR("Could not reach the desired precision: Termination requested or maximum number of refinement steps exceeded.");
+            }
+
+            template<typename ValueType>
+            void SparseSmgMultiObjectiveHelper<ValueType>::createShield(Environment const& env, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression) {
+                WeightVector weightVector;
+                if (env.modelchecker().multi().isShieldWeightVectorSet()) {
+                    weightVector = env.modelchecker().multi().getShieldWeightVector();
+                    STORM_LOG_THROW(weightVector.size() == objectives.size(), storm::exceptions::InvalidArgumentException, "The shield weight vector has " << weightVector.size() << " entries but the formula has " << objectives.size() << " objectives.");
+                } else if (isAchievabilityQuery()) {
+                    for (auto const& step : refinementSteps) {
+                        if (storm::utility::vector::compareElementWise(step.lowerBoundPoint, thresholds, std::greater_equal<GeometryValueType>())) {
+                            weightVector = step.weightVector;
+                            break;
+                        }
+                    }
+                }
+                if (weightVector.empty()) {
+                    STORM_LOG_WARN("No weight vector for the shield given. Using uniform weights.");
+                    weightVector.assign(objectives.size(), storm::utility::one<GeometryValueType>());
+                }
+                GeometryValueType weightSum = storm::utility::zero<GeometryValueType>();
+                for (auto const& weight : weightVector) {
+                    STORM_LOG_THROW(weight >= storm::utility::zero<GeometryValueType>(), storm::exceptions::InvalidArgumentException, "The shield weight vector must not contain negative entries.");
+                    weightSum += weight;
+                }
+                STORM_LOG_THROW(!storm::utility::isZero(weightSum), storm::exceptions::InvalidArgumentException, "The shield weight vector must contain a positive entry.");
+                storm::utility::vector::scaleVectorInPlace(weightVector, storm::utility::one<GeometryValueType>() / weightSum);
+                if (shieldingExpression->isRelative()) {
+                    // Minimizing objectives enter the weighted sum negatively, for which a relative comparison is meaningless.
+                    for (uint64_t objIndex = 0; objIndex < objectives.size(); ++objIndex) {
+                        STORM_LOG_THROW(storm::utility::isZero(weightVector[objIndex]) || !storm::solver::minimize(objectives[objIndex].formula->getOptimalityType()), storm::exceptions::NotSupportedException, "Shields with relative comparison require zero weights for minimizing objectives. Use an absolute comparison instead.");
+                    }
+                }
+                STORM_LOG_INFO("Synthesizing shield for the Pareto point of weight vector " << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(weightVector)) << ".");
+
+                WeightedResult weightedResult = solveWeightedGame(env, weightVector);
+                storm::storage::BitVector allStatesBv(productModel->getNumberOfStates(), true);
+                tempest::shields::createShield<ValueType>(productModel, std::move(weightedResult.choiceValues), shieldingExpression, storm::OptimizationDirection::Maximize, allStatesBv, productStatesOfCoalition);
+            }
+
+            template<typename ValueType>
+            std::shared_ptr<storm::models::sparse::Smg<ValueType>> const& SparseSmgMultiObjectiveHelper<ValueType>::getProductModel() const {
+                return productModel;
+            }
+
+            template<typename ValueType>
+            std::vector<uint64_t> const& SparseSmgMultiObjectiveHelper<ValueType>::getProductToOriginalStateMapping() const {
+                return productToOriginalState;
+            }
+
+            template class SparseSmgMultiObjectiveHelper<double>;
+#ifdef STORM_HAVE_CARL
+            template class SparseSmgMultiObjectiveHelper<storm::RationalNumber>;
+#endif
+        }
+    }
+}
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <boost/optional.hpp>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/logic/Formulas.h"
+#include "storm/logic/ShieldExpression.h"
+#include "storm/models/sparse/Smg.h"
+#include "storm/modelchecker/multiobjective/Objective.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/geometry/Polytope.h"
+
+namespace storm {
+
+    class Environment;
+
+    namespace modelchecker {
+        class CheckResult;
+
+        namespace helper {
+
+            /*!
+             * Checks multi-objective rPATL formulas of the form <<C>> multi(...) on stochastic multiplayer games.
+             *
+             * The set of achievable points of the coalition is approximated by solving weighted-sum games: For a weight
+             * vector w, the coalition maximizes the weighted sum of the objectives while the remaining players minimize
+             * it. The value of this game yields a halfspace that contains all achievable points (over-approximation).
+             * Fixing the coalition strategy of this game and letting the opponents minimize each objective individually
+             * yields a point that is achievable by the coalition (under-approximation). As in the MDP case, weight
+             * vectors are chosen such that the gap between both approximations is closed.
+             *
+             * Probabilistic reachability objectives are handled on a product of the game with a flag for each objective
+             * that records whether the objective has already been decided. Supported objectives are P[F phi], P[psi U phi],
+             * P[G phi], R[F phi] and R[C]. Expected rewards are assumed to be finite under all strategies.
+             */
+            template<typename ValueType>
+            class SparseSmgMultiObjectiveHelper {
+            public:
+                typedef storm::RationalNumber GeometryValueType;
+                typedef std::vector<GeometryValueType> Point;
+                typedef std::vector<GeometryValueType> WeightVector;
+
+                /*!
+                 * Prepares the given formula for the given game.
+                 *
+                 * @param model The game. It must have a unique initial state.
+                 * @param formula The multi-objective formula.
+                 * @param statesOfCoalition The states that are controlled by the coalition.
+                 */
+                SparseSmgMultiObjectiveHelper(storm::models::sparse::Smg<ValueType> const& model, storm::logic::MultiObjectiveFormula const& formula, storm::storage::BitVector const& statesOfCoalition);
+
+                /*!
+                 * Returns true iff all objectives specify a threshold, i.e., iff the query asks whether the thresholds are achievable.
+                 */
+                bool isAchievabilityQuery() const;
+
+                /*!
+                 * Checks the formula. Achievability queries yield a qualitative result for the initial state, Pareto
+                 * queries yield an approximation of the Pareto curve.
+                 */
+                std::unique_ptr<CheckResult> check(Environment const& env);
+
+                /*!
+                 * Synthesizes a shield that keeps the coalition on a Pareto-optimal point. The point is selected by the
+                 * shield weight vector given in the environment. If no weight vector is given, the weight vector of a
+                 * refinement step whose point achieves the thresholds (achievability queries) or uniform weights are used.
+                 * As the strategies for multiple objectives require memory, the shield is given for the states of the
+                 * product of the game with the decided-flags of the objectives.
+                 *
+                 * The objectives are not shielded individually. Instead, the weights are normalized to sum up to one and
+                 * the threshold of the shielding expression (lambda or gamma) is applied to the choice values of the
+                 * weighted-sum game, i.e. to the weighted sum of the objective values that a choice guarantees against
+                 * the remaining players. Minimizing objectives enter this sum negatively, so relative comparisons are
+                 * only supported if these objectives have weight zero.
+                 *
+                 * @pre check has been invoked before.
+                 */
+                void createShield(Environment const& env, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression);
+
+                /*!
+                 * Retrieves the product of the game with the decided-flags of the objectives.
+                 */
+                std::shared_ptr<storm::models::sparse::Smg<ValueType>> const& getProductModel() const;
+
+                /*!
+                 * Retrieves for each state of the product model the corresponding state of the original game.
+                 */
+                std::vector<uint64_t> const& getProductToOriginalStateMapping() const;
+
+            private:
+                struct RefinementStep {
+                    WeightVector weightVector;
+                    Point lowerBoundPoint;
+                    GeometryValueType upperBoundOffset;
+                };
+
+                struct WeightedResult {
+                    // The value of the weighted game for each product state
+                    std::vector<ValueType> values;
+                    // The values of the weighted game for each choice of the product
+                    std::vector<ValueType> choiceValues;
+                    // The choice of the coalition for each product state (local index)
+                    std::vector<uint64_t> choices;
+                };
+
+                /*!
+                 * Preprocesses the objectives and builds the product model as well as the objective rewards.
+                 */
+                void initialize(storm::models::sparse::Smg<ValueType> const& model, storm::logic::MultiObjectiveFormula const& formula, storm::storage::BitVector const& statesOfCoalition);
+
+                /*!
+                 * Solves the weighted game for the given weight vector.
+                 */
+                WeightedResult solveWeightedGame(Environment const& env, WeightVector const& weightVector) const;
+
+                /*!
+                 * Computes the value of the given objective at the initial state when the coalition plays the given choices.
+                 */
+                ValueType evaluateObjective(Environment const& env, uint64_t objIndex, storm::storage::BitVector const& selectedRows) const;
+
+                void performRefinementStep(Environment const& env, WeightVector&& direction);
+                void updateOverApproximation();
+                void updateUnderApproximation();
+                WeightVector findSeparatingVector(Point const& pointToBeSeparated);
+                bool checkIfThresholdsAreSatisfied(std::shared_ptr<storm::storage::geometry::Polytope<GeometryValueType>> const& polytope) const;
+                bool maxStepsPerformed(Environment const& env) const;
+
+                bool checkAchievability(Environment const& env);
+                void exploreSetOfAchievablePoints(Environment const& env);
+
+                uint64_t originalInitialState;
+
+                // The preprocessed objectives. Their values are given by the expected total reward w.r.t. objectiveRewards
+                std::vector<storm::modelchecker::multiobjective::Objective<ValueType>> objectives;
+                std::vector<std::vector<ValueType>> objectiveRewards;
+
+                // The product model
+                std::shared_ptr<storm::models::sparse::Smg<ValueType>> productModel;
+                std::vector<uint64_t> productToOriginalState;
+                storm::storage::BitVector productStatesOfCoalition;
+                uint64_t productInitialState;
+
+                // Data for the refinement of the approximations
+                Point thresholds;
+                storm::storage::BitVector strictThresholds;
+                storm::storage::BitVector diracWeightVectorsToBeChecked;
+                std::vector<RefinementStep> refinementSteps;
+                std::shared_ptr<storm::storage::geometry::Polytope<GeometryValueType>> overApproximation;
+                std::shared_ptr<storm::storage::geometry::Polytope<GeometryValueType>> underApproximation;
+            };
+        }
+    }
+}
@@ -9,6 +9,7 @@
 #include "storm/utility/vector.h"
 #include "storm/utility/graph.h"
 #include "storm/modelchecker/rpatl/helper/internal/GameViHelper.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
 
 namespace storm {
     namespace modelchecker {
@@ -22,41 +23,61 @@ namespace storm {
                 // Relevant states are those states which are phiStates and not PsiStates.
                 storm::storage::BitVector relevantStates = phiStates & ~psiStates;
 
+                // The hint might restrict the computation to the states that can reach a psi state at all. The values of
+                // the remaining relevant states are zero. Moreover, a result hint can be used as starting point if the
+                // value iteration is guaranteed to converge to the right fixpoint from there, i.e. if there are no end components.
+                storm::storage::BitVector maybeStates = relevantStates;
+                std::vector<ValueType> x;
+                if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().getComputeOnlyMaybeStates()) {
+                    auto const& explicitHint = hint.template asExplicitModelCheckerHint<ValueType>();
+                    STORM_LOG_ASSERT(explicitHint.getMaybeStates().isSubsetOf(relevantStates), "The maybe states of the hint are not a subset of the relevant states.");
+                    maybeStates = explicitHint.getMaybeStates();
+                    if (explicitHint.hasResultHint() && (explicitHint.getNoEndComponentsInMaybeStates() || storm::utility::graph::performProb1A(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, maybeStates, ~maybeStates).full())) {
+                        x = storm::utility::vector::filterVector(explicitHint.getResultHint(), maybeStates);
+                    }
+                }
+
                 // Initialize the x vector and solution vector result.
-                std::vector<ValueType> x = std::vector<ValueType>(relevantStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+                if (x.empty()) {
+                    x = std::vector<ValueType>(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+                }
                 std::vector<ValueType> result = std::vector<ValueType>(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
-                std::vector<ValueType> b = transitionMatrix.getConstrainedRowGroupSumVector(relevantStates, psiStates);
+                std::vector<ValueType> b = transitionMatrix.getConstrainedRowGroupSumVector(maybeStates, psiStates);
                 std::vector<ValueType> constrainedChoiceValues = std::vector<ValueType>(b.size(), storm::utility::zero<ValueType>());
                 std::unique_ptr<storm::storage::Scheduler<ValueType>> scheduler;
 
-                storm::storage::BitVector clippedStatesOfCoalition(relevantStates.getNumberOfSetBits());
-                clippedStatesOfCoalition.setClippedStatesOfCoalition(relevantStates, statesOfCoalition);
+                storm::storage::BitVector clippedStatesOfCoalition(maybeStates.getNumberOfSetBits());
+                clippedStatesOfCoalition.setClippedStatesOfCoalition(maybeStates, statesOfCoalition);
+                bool approximate = false;
 
-                if(!relevantStates.empty()) {
+                if(!maybeStates.empty()) {
                     // Reduce the matrix to relevant states.
-                    storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, relevantStates, relevantStates, false);
+                    storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, false);
                     // Create GameViHelper for computations.
                     storm::modelchecker::helper::internal::GameViHelper<ValueType> viHelper(submatrix, clippedStatesOfCoalition);
                     if (produceScheduler) {
                         viHelper.setProduceScheduler(true);
                     }
                     viHelper.performValueIteration(env, x, b, goal.direction(), constrainedChoiceValues);
+                    approximate = viHelper.isResultApproximate();
                     if(goal.isShieldingTask()) {
                         viHelper.getChoiceValues(env, x, constrainedChoiceValues);
                     }
 
                     // Fill up the constrainedChoice Values to full size.
-                    viHelper.fillChoiceValuesVector(constrainedChoiceValues, relevantStates, transitionMatrix.getRowGroupIndices());
+                    viHelper.fillChoiceValuesVector(constrainedChoiceValues, maybeStates, transitionMatrix.getRowGroupIndices());
 
                     if (produceScheduler) {
-                        scheduler = std::make_unique<storm::storage::Scheduler<ValueType>>(expandScheduler(viHelper.extractScheduler(), psiStates, ~phiStates));
+                        scheduler = std::make_unique<storm::storage::Scheduler<ValueType>>(expandScheduler(viHelper.extractScheduler(), psiStates, ~maybeStates));
                     }
                 }
 
-                // Fill up the result vector with the values of x for the relevant states, with 1s for psi states (0 is default)
-                storm::utility::vector::setVectorValues(result, relevantStates, x);
+                // Fill up the result vector with the values of x for the maybe states, with 1s for psi states (0 is default)
+                storm::utility::vector::setVectorValues(result, maybeStates, x);
                 storm::utility::vector::setVectorValues(result, psiStates, storm::utility::one<ValueType>());
-                return SMGSparseModelCheckingHelperReturnType<ValueType>(std::move(result), std::move(relevantStates), std::move(scheduler), std::move(constrainedChoiceValues));
+                SMGSparseModelCheckingHelperReturnType<ValueType> returnValue(std::move(result), std::move(relevantStates), std::move(scheduler), std::move(constrainedChoiceValues));
+                returnValue.approximate = approximate;
+                return returnValue;
             }
 
             template<typename ValueType>
@@ -86,7 +107,8 @@ namespace storm {
                 storm::storage::BitVector notPsiStates = ~psiStates;
                 statesOfCoalition.complement();
 
-                auto result = computeUntilProbabilities(env, std::move(goal), transitionMatrix, backwardTransitions, storm::storage::BitVector(transitionMatrix.getRowGroupCount(), true), notPsiStates, qualitative, statesOfCoalition, produceScheduler, hint);
+                // The hint refers to the original formula and thus can not be used for the flipped one.
+                auto result = computeUntilProbabilities(env, std::move(goal), transitionMatrix, backwardTransitions, storm::storage::BitVector(transitionMatrix.getRowGroupCount(), true), notPsiStates, qualitative, statesOfCoalition, produceScheduler, ModelCheckerHint());
                 for (auto& element : result.values) {
                     element = storm::utility::one<ValueType>() - element;
                 }
@@ -160,6 +182,7 @@ namespace storm {
 
                 storm::storage::BitVector clippedStatesOfCoalition(relevantStates.getNumberOfSetBits());
                 clippedStatesOfCoalition.setClippedStatesOfCoalition(relevantStates, statesOfCoalition);
+                bool approximate = false;
 
                 // If there are no relevantStates or the upperBound is 0, no computation is needed.
                 if(!relevantStates.empty() && upperBound > 0) {
@@ -170,14 +193,17 @@ namespace storm {
                     if (produceScheduler) {
                         viHelper.setProduceScheduler(true);
                     }
+                    viHelper.setStepBounded(true);
                     // If the lowerBound = 0, value iteration is done until the upperBound.
                     if(lowerBound == 0) {
                         solverEnv.solver().game().setMaximalNumberOfIterations(upperBound);
                         viHelper.performValueIteration(solverEnv, x, b, goal.direction(), constrainedChoiceValues);
+                        approximate = viHelper.isResultApproximate();
                     } else {
                         // The lowerBound != 0, the first computation between the given bound steps is done.
                         solverEnv.solver().game().setMaximalNumberOfIterations(upperBound - lowerBound);
                         viHelper.performValueIteration(solverEnv, x, b, goal.direction(), constrainedChoiceValues);
+                        approximate = viHelper.isResultApproximate();
 
                         // Initialization of subResult, fill it with the result of the first computation and 1s for the psiStates in full range.
                         std::vector<ValueType> subResult = std::vector<ValueType>(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
@@ -203,6 +229,7 @@ namespace storm {
                         // The second computation is done between step 0 and the lowerBound
                         solverEnv.solver().game().setMaximalNumberOfIterations(lowerBound);
                         viHelper.performValueIteration(solverEnv, subResult, b, goal.direction(), constrainedChoiceValues);
+                        approximate = approximate || viHelper.isResultApproximate();
 
                         x = subResult;
                     }
@@ -220,7 +247,9 @@ namespace storm {
                 if(!computeBoundedGlobally){
                     storm::utility::vector::setVectorValues(result, psiStates, storm::utility::one<ValueType>());
                 }
-                return SMGSparseModelCheckingHelperReturnType<ValueType>(std::move(result), std::move(relevantStates), std::move(scheduler), std::move(constrainedChoiceValues));
+                SMGSparseModelCheckingHelperReturnType<ValueType> returnValue(std::move(result), std::move(relevantStates), std::move(scheduler), std::move(constrainedChoiceValues));
+                returnValue.approximate = approximate;
+                return returnValue;
             }
 
             template class SparseSmgRpatlHelper<double>;
@@ -0,0 +1,80 @@
+#include "DiskGameViHelper.h"
+
+#include <boost/optional.hpp>
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/GameSolverEnvironment.h"
+
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/Statistics.h"
+#include "storm/utility/Stopwatch.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace helper {
+            namespace internal {
+
+                template <typename ValueType>
+                DiskGameViHelper<ValueType>::DiskGameViHelper(storm::storage::DiskSparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& statesOfCoalition) : _transitionMatrix(transitionMatrix), _statesOfCoalition(statesOfCoalition), _resultApproximate(false) {
+                    // Intentionally left empty.
+                }
+
+                template <typename ValueType>
+                std::vector<ValueType> DiskGameViHelper<ValueType>::computeUntilProbabilities(Environment const& env, storm::solver::OptimizationDirection const dir, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                    storm::utility::statistics::ScopedTimer valueIterationTimer("game-value-iteration");
+                    storm::utility::statistics::setCounter("states", _transitionMatrix.getRowGroupCount());
+                    storm::utility::statistics::setCounter("nonzeros", _transitionMatrix.getEntryCount());
+                    STORM_LOG_ASSERT(phiStates.size() == _transitionMatrix.getRowGroupCount() && psiStates.size() == _transitionMatrix.getRowGroupCount(), "The state sets do not match the size of the game.");
+
+                    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().game().getPrecision());
+                    bool relative = env.solver().game().getRelativeTerminationCriterion();
+                    uint64_t maxIter = env.solver().game().getMaximalNumberOfIterations();
+                    boost::optional<double> timeBudget;
+                    if (env.solver().game().isTimeBudgetSet()) {
+                        timeBudget = env.solver().game().getTimeBudget();
+                    }
+
+                    // The values of the psi states and the states that are neither phi nor psi states are fixed.
+                    storm::storage::BitVector zeroStates = ~(phiStates | psiStates);
+                    std::vector<ValueType> x(_transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+                    storm::utility::vector::setVectorValues(x, psiStates, storm::utility::one<ValueType>());
+                    std::vector<ValueType> xNew = x;
+
+                    storm::utility::Stopwatch stopwatch(true);
+                    bool converged = false;
+                    uint64_t iter = 0;
+                    while (iter < maxIter) {
+                        _transitionMatrix.multiplyAndReduce(dir, x, nullptr, xNew, nullptr, &_statesOfCoalition);
+                        storm::utility::vector::setVectorValues(xNew, psiStates, storm::utility::one<ValueType>());
+                        storm::utility::vector::setVectorValues(xNew, zeroStates, storm::utility::zero<ValueType>());
+                        ++iter;
+                        converged = storm::utility::vector::equalModuloPrecision(x, xNew, precision, relative);
+                        x.swap(xNew);
+                        if (converged || storm::utility::resources::isTerminate()) {
+                            break;
+                        }
+                        if (timeBudget && stopwatch.getTimeInNanoseconds() * 1e-9 >= timeBudget.get()) {
+                            STORM_LOG_WARN("Value iteration exhausted its time budget of " << timeBudget.get() << "s after " << iter << " iterations.");
+                            break;
+                        }
+                    }
+                    STORM_LOG_WARN_COND(converged || iter < maxIter, "Value iteration did not converge within " << maxIter << " iterations.");
+                    storm::utility::statistics::addToCounter("iterations", iter);
+                    _resultApproximate = !converged;
+                    return x;
+                }
+
+                template <typename ValueType>
+                bool DiskGameViHelper<ValueType>::isResultApproximate() const {
+                    return _resultApproximate;
+                }
+
+                template class DiskGameViHelper<double>;
+            }
+        }
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/DiskSparseMatrix.h"
+
+namespace storm {
+    class Environment;
+
+    namespace modelchecker {
+        namespace helper {
+            namespace internal {
+
+                /*!
+                 * Performs value iteration for games whose transition matrix is stored on disk. In contrast to the
+                 * GameViHelper, the matrix is not restricted to the maybe states (which would require a second copy of
+                 * the matrix), but every iteration traverses the complete matrix once. States whose values are known are
+                 * reset after each iteration instead.
+                 */
+                template <typename ValueType>
+                class DiskGameViHelper {
+                public:
+                    /*!
+                     * @param transitionMatrix The transition matrix of the game.
+                     * @param statesOfCoalition The states that optimize in the direction opposite to the one given for
+                     *        the computations (as for the GameViHelper).
+                     */
+                    DiskGameViHelper(storm::storage::DiskSparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& statesOfCoalition);
+
+                    /*!
+                     * Computes the probabilities to reach a psi state while only visiting phi states. As the iteration
+                     * starts with zero for all states that are not psi states, it converges to the least fixpoint, so no
+                     * graph-based precomputations are needed. The precision, the maximal number of iterations and the
+                     * time budget are taken from the game solver environment.
+                     *
+                     * @return The probability of every state.
+                     */
+                    std::vector<ValueType> computeUntilProbabilities(Environment const& env, storm::solver::OptimizationDirection const dir, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+                    /*!
+                     * @return whether the most recent value iteration was stopped (due to the iteration limit, the time
+                     * budget or an abort signal) before it converged.
+                     */
+                    bool isResultApproximate() const;
+
+                private:
+                    storm::storage::DiskSparseMatrix<ValueType> const& _transitionMatrix;
+                    storm::storage::BitVector _statesOfCoalition;
+                    bool _resultApproximate;
+                };
+            }
+        }
+    }
+}
@@ -1,13 +1,29 @@
 #include "GameViHelper.h"
 
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
 #include "storm/environment/Environment.h"
 #include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/environment/solver/GameSolverEnvironment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+
+#include "storm/solver/TopologicalSimdMinMaxLinearEquationSolver.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/GeneralSettings.h"
 
+#include "storm/io/file.h"
+#include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/Statistics.h"
+#include "storm/utility/Stopwatch.h"
 #include "storm/utility/vector.h"
 
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/UncheckedRequirementException.h"
+
 namespace storm {
     namespace modelchecker {
         namespace helper {
@@ -26,6 +42,9 @@ namespace storm {
 
                 template <typename ValueType>
                 void GameViHelper<ValueType>::performValueIteration(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> b, storm::solver::OptimizationDirection const dir, std::vector<ValueType>& constrainedChoiceValues) {
+                    storm::utility::statistics::ScopedTimer valueIterationTimer("game-value-iteration");
+                    storm::utility::statistics::setCounter("states", _transitionMatrix.getRowGroupCount());
+                    storm::utility::statistics::setCounter("nonzeros", _transitionMatrix.getEntryCount());
                     prepareSolversAndMultipliers(env);
                     // Get precision for convergence check.
                     ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().game().getPrecision());
@@ -43,25 +62,94 @@ namespace storm {
                     }
 
                     uint64_t iter = 0;
+                    _resultApproximate = false;
                     constrainedChoiceValues = std::vector<ValueType>(b.size(), storm::utility::zero<ValueType>());
 
-                    while (iter < maxIter) {
-                        if(iter == maxIter - 1) {
-                            _multiplier->multiply(env, xNew(), &_b, constrainedChoiceValues);
-                            auto rowGroupIndices = this->_transitionMatrix.getRowGroupIndices();
-                            rowGroupIndices.erase(rowGroupIndices.begin());
-                            _multiplier->reduce(env, dir, rowGroupIndices, constrainedChoiceValues, xNew(), nullptr, &_statesOfCoalition);
-                            break;
+                    // The topological method solves the equation system, so it does not compute step-bounded values.
+                    if (env.solver().minMax().getMethod() == storm::solver::MinMaxMethod::TopologicalSimd && !_stepBounded) {
+                        STORM_LOG_THROW(!env.solver().game().isTimeBudgetSet() && !env.solver().game().isTraceFileSet(), storm::exceptions::NotSupportedException, "The time budget and the trace of game value iteration are not supported by the topological SIMD method. Select another method with --minmax:method.");
+                        STORM_LOG_WARN_COND(!storm::settings::getModule<storm::settings::modules::GeneralSettings>().isShowProgressSet(), "The topological SIMD method does not show the progress of game value iteration.");
+                        // Solve the SCCs of the game one after another, letting the coalition states optimize in the opposite direction.
+                        storm::Environment solverEnv = env;
+                        solverEnv.solver().minMax().setPrecision(env.solver().game().getPrecision());
+                        solverEnv.solver().minMax().setMaximalNumberOfIterations(maxIter);
+                        solverEnv.solver().minMax().setRelativeTerminationCriterion(env.solver().game().getRelativeTerminationCriterion());
+                        storm::solver::TopologicalSimdMinMaxLinearEquationSolver<ValueType> solver(_transitionMatrix);
+                        solver.setDirectionOverride(_statesOfCoalition);
+                        storm::solver::MinMaxLinearEquationSolverRequirements requirements = solver.getRequirements(solverEnv, dir);
+                        if (requirements.lowerBounds()) {
+                            // As in the iterative method, the given values are the starting point from which the values are approached from below.
+                            solver.setLowerBounds(_x1);
+                            requirements.clearLowerBounds();
                         }
-                        performIterationStep(env, dir);
-                        if (checkConvergence(precision)) {
-                            _multiplier->multiply(env, xNew(), &_b, constrainedChoiceValues);
-                            break;
+                        STORM_LOG_THROW(!requirements.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException, "Solver requirements " + requirements.getEnabledRequirementsAsString() + " not checked.");
+                        solver.setRequirementsChecked();
+                        _resultApproximate = !solver.solveEquations(solverEnv, dir, _x1, _b);
+                        storm::utility::statistics::addToCounter("iterations", solver.getNumberOfIterations());
+                        _x2 = _x1;
+                        _multiplier->multiply(env, xNew(), &_b, constrainedChoiceValues);
+                    } else {
+                        storm::utility::Stopwatch stopwatch(true);
+                        storm::utility::ProgressMeasurement progress("iterations");
+                        progress.startNewMeasurement(0);
+                        bool const showProgress = storm::settings::getModule<storm::settings::modules::GeneralSettings>().isShowProgressSet();
+                        boost::optional<double> timeBudget;
+                        if (env.solver().game().isTimeBudgetSet()) {
+                            timeBudget = env.solver().game().getTimeBudget();
                         }
-                        if (storm::utility::resources::isTerminate()) {
-                            break;
+                        std::ofstream traceStream;
+                        bool const trace = env.solver().game().isTraceFileSet();
+                        if (trace) {
+                            storm::utility::openFile(env.solver().game().getTraceFile(), traceStream);
+                            traceStream << "iteration,time-s,max-diff,min-diff,changing-states,iterations-per-second" << std::endl;
                         }
-                        ++iter;
+
+                        while (iter < maxIter) {
+                            if(iter == maxIter - 1) {
+                                _multiplier->multiply(env, xNew(), &_b, constrainedChoiceValues);
+                                auto rowGroupIndices = this->_transitionMatrix.getRowGroupIndices();
+                                rowGroupIndices.erase(rowGroupIndices.begin());
+                                _multiplier->reduce(env, dir, rowGroupIndices, constrainedChoiceValues, xNew(), nullptr, &_statesOfCoalition);
+                                // Unless the iterations are the steps of a bounded property, the values did not converge.
+                                _resultApproximate = !_stepBounded;
+                                STORM_LOG_WARN_COND(_stepBounded, "Value iteration did not converge within " << maxIter << " iterations. The current values are used.");
+                                break;
+                            }
+                            performIterationStep(env, dir);
+                            double elapsedSeconds = stopwatch.getTimeInNanoseconds() * 1e-9;
+                            if (trace) {
+                                IterationStatistics statistics = computeIterationStatistics(precision);
+                                traceStream << (iter + 1) << "," << elapsedSeconds << "," << storm::utility::convertNumber<double>(statistics.maxDiff) << "," << storm::utility::convertNumber<double>(statistics.minDiff) << "," << statistics.changingStates << "," << (elapsedSeconds > 0.0 ? (iter + 1) / elapsedSeconds : 0.0) << "\n";
+                            }
+                            if (checkConvergence(precision)) {
+                                _multiplier->multiply(env, xNew(), &_b, constrainedChoiceValues);
+                                break;
+                            }
+                            if (storm::utility::resources::isTerminate()) {
+                                _resultApproximate = true;
+                                _multiplier->multiply(env, xNew(), &_b, constrainedChoiceValues);
+                                break;
+                            }
+                            if (timeBudget && elapsedSeconds >= timeBudget.get()) {
+                                IterationStatistics statistics = computeIterationStatistics(precision);
+                                STORM_LOG_WARN("Value iteration exhausted its time budget of " << timeBudget.get() << "s after " << (iter + 1) << " iterations. The current values are used although the last iteration changed them by up to " << storm::utility::convertNumber<double>(std::max(statistics.maxDiff, -statistics.minDiff)) << ".");
+                                _resultApproximate = true;
+                                _multiplier->multiply(env, xNew(), &_b, constrainedChoiceValues);
+                                break;
+                            }
+                            if (showProgress) {
+                                std::stringstream progressMessage;
+                                if (progress.updateProgress(iter + 1, progressMessage)) {
+                                    IterationStatistics statistics = computeIterationStatistics(precision);
+                                    STORM_PRINT_AND_LOG(progressMessage.str() << "Maximal difference: " << storm::utility::convertNumber<double>(statistics.maxDiff) << ", minimal difference: " << storm::utility::convertNumber<double>(statistics.minDiff) << ", " << statistics.changingStates << " states still changing." << std::endl);
+                                }
+                            }
+                            ++iter;
+                        }
+                        if (trace) {
+                            storm::utility::closeFile(traceStream);
+                        }
+                        storm::utility::statistics::addToCounter("iterations", std::min(iter + 1, maxIter));
                     }
                     x = xNew();
 
@@ -115,6 +203,32 @@ namespace storm {
                     return true;
                 }
 
+                template <typename ValueType>
+                typename GameViHelper<ValueType>::IterationStatistics GameViHelper<ValueType>::computeIterationStatistics(ValueType precision) const {
+                    IterationStatistics statistics{storm::utility::zero<ValueType>(), storm::utility::zero<ValueType>(), 0};
+                    auto x1It = xOld().begin();
+                    auto x1Ite = xOld().end();
+                    auto x2It = xNew().begin();
+                    if (x1It != x1Ite) {
+                        statistics.maxDiff = *x2It - *x1It;
+                        statistics.minDiff = statistics.maxDiff;
+                    }
+                    for (; x1It != x1Ite; ++x1It, ++x2It) {
+                        ValueType diff = (*x2It - *x1It);
+                        statistics.maxDiff = std::max(statistics.maxDiff, diff);
+                        statistics.minDiff = std::min(statistics.minDiff, diff);
+                        if (storm::utility::abs<ValueType>(diff) > precision) {
+                            ++statistics.changingStates;
+                        }
+                    }
+                    return statistics;
+                }
+
+                template <typename ValueType>
+                bool GameViHelper<ValueType>::isResultApproximate() const {
+                    return _resultApproximate;
+                }
+
                 template <typename ValueType>
                 void GameViHelper<ValueType>::setProduceScheduler(bool value) {
                     _produceScheduler = value;
@@ -125,6 +239,11 @@ namespace storm {
                     return _produceScheduler;
                 }
 
+                template <typename ValueType>
+                void GameViHelper<ValueType>::setStepBounded(bool value) {
+                    _stepBounded = value;
+                }
+
                 template <typename ValueType>
                 void GameViHelper<ValueType>::setShieldingTask(bool value) {
                     _shieldingTask = value;
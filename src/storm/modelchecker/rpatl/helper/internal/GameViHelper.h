@@ -24,10 +24,25 @@ namespace storm {
                     void prepareSolversAndMultipliers(const Environment& env);
 
                     /*!
-                     * Perform value iteration until convergence
+                     * Perform value iteration until convergence. If the game solver environment specifies a trace file,
+                     * every iteration is written to it. If it specifies a time budget, the iteration is stopped with the
+                     * current values once the budget is exhausted.
                      */
                     void performValueIteration(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> b, storm::solver::OptimizationDirection const dir, std::vector<ValueType>& constrainedChoiceValues);
 
+                    /*!
+                     * @return whether the most recent value iteration was stopped (due to the iteration limit, the time
+                     * budget or an abort signal) before it converged, i.e. whether the computed values only approximate
+                     * the fixpoint.
+                     */
+                    bool isResultApproximate() const;
+
+                    /*!
+                     * Sets whether the maximal number of iterations is the step bound of a bounded property. In this case,
+                     * the values after the last iteration are the exact result rather than an approximation of the fixpoint.
+                     */
+                    void setStepBounded(bool value);
+
                     /*!
                      * Sets whether an optimal scheduler shall be constructed during the computation
                      */
@@ -68,6 +83,13 @@ namespace storm {
                     void fillChoiceValuesVector(std::vector<ValueType>& choiceValues, storm::storage::BitVector psiStates, std::vector<storm::storage::SparseMatrix<double>::index_type> rowGroupIndices);
 
                 private:
+                    struct IterationStatistics {
+                        ValueType maxDiff;
+                        ValueType minDiff;
+                        // The number of states whose value changed by more than the precision.
+                        uint64_t changingStates;
+                    };
+
                     /*!
                      * Performs one iteration step for value iteration
                      */
@@ -78,6 +100,12 @@ namespace storm {
                      */
                     bool checkConvergence(ValueType precision) const;
 
+                    /*!
+                     * Computes the maximal and minimal difference between the last two iterates. Unlike checkConvergence,
+                     * this always considers all states.
+                     */
+                    IterationStatistics computeIterationStatistics(ValueType precision) const;
+
                     std::vector<ValueType>& xNew();
                     std::vector<ValueType> const& xNew() const;
 
@@ -104,6 +132,8 @@ namespace storm {
 
                     bool _produceScheduler = false;
                     bool _shieldingTask = false;
+                    bool _resultApproximate = false;
+                    bool _stepBounded = false;
                     boost::optional<std::vector<uint64_t>> _producedOptimalChoices;
                 };
             }
@@ -0,0 +1,259 @@
+#include "storm/modelchecker/smc/StatisticalModelChecker.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/Smg.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm/utility/macros.h"
+#include "storm/utility/constants.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidPropertyException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace modelchecker {
+
+        template<typename ModelType>
+        StatisticalModelChecker<ModelType>::Options::Options() {
+            auto const& settings = storm::settings::getModule<storm::settings::modules::StatisticalModelCheckingSettings>();
+            precision = settings.getPrecision();
+            confidence = settings.getConfidence();
+            indifference = settings.getIndifference();
+            strategy = settings.getStrategy();
+            cacheSize = settings.getCacheSize();
+            batchSize = settings.getBatchSize();
+            seed = settings.getSeed();
+        }
+
+        template<typename ModelType>
+        StatisticalModelChecker<ModelType>::StatisticalModelChecker(storm::prism::Program const& program, Options const& options) : program(program.substituteConstantsFormulas()), options(options), generator(options.seed), numberOfSampledPaths(0) {
+            STORM_LOG_THROW(this->program.isDiscreteTimeModel(), storm::exceptions::NotSupportedException, "Statistical model checking is only supported for discrete-time models.");
+            STORM_LOG_THROW(options.batchSize > 0, storm::exceptions::InvalidArgumentException, "The batch size must be positive.");
+
+            uint64_t numberOfThreads = 1;
+#ifdef STORM_HAVE_INTELTBB
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+                numberOfThreads = std::max<uint64_t>(1, std::thread::hardware_concurrency());
+            }
+#endif
+            for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+                simulators.push_back(std::make_unique<storm::simulator::DiscreteTimePrismProgramSimulator<ValueType>>(this->program, storm::generator::NextStateGeneratorOptions()));
+                simulators.back()->setExpansionCacheSize(options.cacheSize);
+            }
+        }
+
+        template<typename ModelType>
+        bool StatisticalModelChecker<ModelType>::canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const {
+            return canHandleStatic(checkTask);
+        }
+
+        template<typename ModelType>
+        std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::checkProbabilityOperatorFormula(Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) {
+            if (!checkTask.isBoundSet()) {
+                return AbstractModelChecker<ModelType>::checkProbabilityOperatorFormula(env, checkTask);
+            }
+            PathProperty property = getPathProperty(checkTask.getFormula().getSubformula());
+            bool satisfied = testHypothesis(property, checkTask.getBoundComparisonType(), checkTask.getBoundThreshold());
+            return std::make_unique<ExplicitQualitativeCheckResult>(0, satisfied);
+        }
+
+        template<typename ModelType>
+        std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeBoundedUntilProbabilities(Environment const&, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) {
+            return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(0, estimateProbability(getPathProperty(checkTask.getFormula())));
+        }
+
+        template<typename ModelType>
+        std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeBoundedGloballyProbabilities(Environment const&, CheckTask<storm::logic::BoundedGloballyFormula, ValueType> const& checkTask) {
+            return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(0, estimateProbability(getPathProperty(checkTask.getFormula())));
+        }
+
+        template<typename ModelType>
+        uint64_t StatisticalModelChecker<ModelType>::getNumberOfSampledPaths() const {
+            return numberOfSampledPaths;
+        }
+
+        template<typename ModelType>
+        typename StatisticalModelChecker<ModelType>::PathProperty StatisticalModelChecker<ModelType>::getPathProperty(storm::logic::Formula const& pathFormula) const {
+            std::map<std::string, storm::expressions::Expression> labelToExpressionMapping = program.getLabelToExpressionMapping();
+            PathProperty property;
+            if (pathFormula.isBoundedUntilFormula()) {
+                storm::logic::BoundedUntilFormula const& untilFormula = pathFormula.asBoundedUntilFormula();
+                STORM_LOG_THROW(!untilFormula.isMultiDimensional() && untilFormula.getTimeBoundReference().isStepBound() && untilFormula.hasUpperBound(), storm::exceptions::InvalidPropertyException, "Statistical model checking requires a single upper step bound.");
+                property.condition = untilFormula.getLeftSubformula().toExpression(program.getManager(), labelToExpressionMapping);
+                property.target = untilFormula.getRightSubformula().toExpression(program.getManager(), labelToExpressionMapping);
+                property.lowerBound = untilFormula.hasLowerBound() ? untilFormula.template getNonStrictLowerBound<uint64_t>() : 0;
+                property.upperBound = untilFormula.template getNonStrictUpperBound<uint64_t>();
+                property.globally = false;
+            } else if (pathFormula.isBoundedGloballyFormula()) {
+                storm::logic::BoundedGloballyFormula const& globallyFormula = pathFormula.asBoundedGloballyFormula();
+                STORM_LOG_THROW(!globallyFormula.isMultiDimensional() && globallyFormula.getTimeBoundReference().isStepBound() && globallyFormula.hasUpperBound(), storm::exceptions::InvalidPropertyException, "Statistical model checking requires a single upper step bound.");
+                property.condition = program.getManager().boolean(true);
+                property.target = globallyFormula.getSubformula().toExpression(program.getManager(), labelToExpressionMapping);
+                property.lowerBound = globallyFormula.hasLowerBound() ? globallyFormula.template getNonStrictLowerBound<uint64_t>() : 0;
+                property.upperBound = globallyFormula.template getNonStrictUpperBound<uint64_t>();
+                property.globally = true;
+            } else {
+                STORM_LOG_THROW(false, storm::exceptions::InvalidPropertyException, "Statistical model checking only supports step-bounded until and globally formulas, but got '" << pathFormula << "'.");
+            }
+            return property;
+        }
+
+        template<typename ModelType>
+        typename StatisticalModelChecker<ModelType>::ValueType StatisticalModelChecker<ModelType>::estimateProbability(PathProperty const& property) {
+            // By the Chernoff-Hoeffding bound, P(|estimate - p| >= precision) <= 2 exp(-2 n precision^2).
+            uint64_t requiredPaths = static_cast<uint64_t>(std::ceil(std::log(2.0 / (1.0 - options.confidence)) / (2.0 * options.precision * options.precision)));
+            STORM_LOG_INFO("Sampling " << requiredPaths << " paths to estimate the probability up to " << options.precision << " with confidence " << options.confidence << ".");
+
+            uint64_t satisfyingPaths = 0;
+            std::vector<uint8_t> outcomes;
+            for (uint64_t firstPath = 0; firstPath < requiredPaths; firstPath += options.batchSize) {
+                samplePaths(property, firstPath, std::min(options.batchSize, requiredPaths - firstPath), outcomes);
+                for (auto const& outcome : outcomes) {
+                    satisfyingPaths += outcome;
+                }
+            }
+            numberOfSampledPaths = requiredPaths;
+            printStatistics();
+            return storm::utility::convertNumber<ValueType>(static_cast<double>(satisfyingPaths) / static_cast<double>(requiredPaths));
+        }
+
+        template<typename ModelType>
+        bool StatisticalModelChecker<ModelType>::testHypothesis(PathProperty const& property, storm::logic::ComparisonType comparisonType, ValueType const& threshold) {
+            // Wald's test of H0: p >= threshold + indifference against H1: p <= threshold - indifference, where the
+            // probability of both errors is bounded by 1 - confidence.
+            double const probabilityThreshold = storm::utility::convertNumber<double>(threshold);
+            double const p0 = std::min(1.0 - 1e-9, probabilityThreshold + options.indifference);
+            double const p1 = std::max(1e-9, probabilityThreshold - options.indifference);
+            double const error = 1.0 - options.confidence;
+            double const acceptH1 = std::log((1.0 - error) / error);
+            double const acceptH0 = std::log(error / (1.0 - error));
+            double const successIncrement = std::log(p1 / p0);
+            double const failureIncrement = std::log((1.0 - p1) / (1.0 - p0));
+
+            double logRatio = 0.0;
+            uint64_t firstPath = 0;
+            std::vector<uint8_t> outcomes;
+            boost::optional<bool> acceptedH0;
+            while (!acceptedH0) {
+                samplePaths(property, firstPath, options.batchSize, outcomes);
+                // The outcomes are processed in the order of the paths, so the decision does not depend on the parallelization.
+                for (uint64_t index = 0; index < outcomes.size(); ++index) {
+                    logRatio += outcomes[index] ? successIncrement : failureIncrement;
+                    if (logRatio >= acceptH1) {
+                        acceptedH0 = false;
+                    } else if (logRatio <= acceptH0) {
+                        acceptedH0 = true;
+                    }
+                    if (acceptedH0) {
+                        numberOfSampledPaths = firstPath + index + 1;
+                        break;
+                    }
+                }
+                firstPath += outcomes.size();
+            }
+            STORM_LOG_INFO("The sequential probability ratio test decided after " << numberOfSampledPaths << " paths.");
+            printStatistics();
+
+            bool lowerBoundHolds = acceptedH0.get();
+            if (comparisonType == storm::logic::ComparisonType::Greater || comparisonType == storm::logic::ComparisonType::GreaterEqual) {
+                return lowerBoundHolds;
+            } else {
+                return !lowerBoundHolds;
+            }
+        }
+
+        template<typename ModelType>
+        void StatisticalModelChecker<ModelType>::samplePaths(PathProperty const& property, uint64_t firstPath, uint64_t numberOfPaths, std::vector<uint8_t>& outcomes) {
+            outcomes.assign(numberOfPaths, 0);
+            uint64_t numberOfChunks = simulators.size();
+            uint64_t chunkSize = (numberOfPaths + numberOfChunks - 1) / numberOfChunks;
+
+            // Each chunk has its own simulator, so the chunks do not share any mutable state.
+            auto sampleChunk = [&] (uint64_t chunk) {
+                uint64_t begin = chunk * chunkSize;
+                uint64_t end = std::min(numberOfPaths, begin + chunkSize);
+                for (uint64_t index = begin; index < end; ++index) {
+                    outcomes[index] = samplePath(*simulators[chunk], property, firstPath + index) ? 1 : 0;
+                }
+            };
+
+#ifdef STORM_HAVE_INTELTBB
+            if (numberOfChunks > 1) {
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfChunks, 1), [&] (tbb::blocked_range<uint64_t> const& range) {
+                    for (uint64_t chunk = range.begin(); chunk < range.end(); ++chunk) {
+                        sampleChunk(chunk);
+                    }
+                });
+                return;
+            }
+#endif
+            sampleChunk(0);
+        }
+
+        template<typename ModelType>
+        bool StatisticalModelChecker<ModelType>::samplePath(storm::simulator::DiscreteTimePrismProgramSimulator<ValueType>& simulator, PathProperty const& property, uint64_t path) const {
+            // The choice and the successor of each step are drawn from the stream of the path, so the simulator does not
+            // need to be reseeded.
+            simulator.resetToInitial();
+            for (uint64_t step = 0; ; ++step) {
+                if (property.globally) {
+                    if (step >= property.lowerBound && !simulator.satisfies(property.target)) {
+                        return false;
+                    }
+                    if (step == property.upperBound) {
+                        return true;
+                    }
+                } else {
+                    if (step >= property.lowerBound && simulator.satisfies(property.target)) {
+                        return true;
+                    }
+                    if (step == property.upperBound || !simulator.satisfies(property.condition)) {
+                        return false;
+                    }
+                }
+
+                auto const& choices = simulator.getChoices();
+                if (choices.empty()) {
+                    // The path stays in this state forever, so the current state decides.
+                    return simulator.satisfies(property.target);
+                }
+                std::array<uint64_t, 2> randomBits = generator.random(path, step);
+                uint64_t choice = 0;
+                if (choices.size() > 1 && options.strategy == storm::settings::modules::StatisticalModelCheckingSettings::Strategy::Uniform) {
+                    choice = ((randomBits[0] & 0xFFFFFFFFull) * choices.size()) >> 32;
+                }
+                // The upper 53 bits give a uniformly distributed double in [0, 1).
+                simulator.step(choice, static_cast<double>(randomBits[1] >> 11) / 9007199254740992.0);
+            }
+        }
+
+        template<typename ModelType>
+        void StatisticalModelChecker<ModelType>::printStatistics() const {
+            uint64_t cacheHits = 0;
+            uint64_t expansions = 0;
+            for (auto const& simulator : simulators) {
+                cacheHits += simulator->getNumberOfCacheHits();
+                expansions += simulator->getNumberOfExpansions();
+            }
+            STORM_LOG_INFO("Sampled " << numberOfSampledPaths << " paths using " << simulators.size() << " thread(s). Expanded " << expansions << " states, " << cacheHits << " states were taken from the cache.");
+        }
+
+        template class StatisticalModelChecker<storm::models::sparse::Dtmc<double>>;
+        template class StatisticalModelChecker<storm::models::sparse::Mdp<double>>;
+        template class StatisticalModelChecker<storm::models::sparse::Smg<double>>;
+    }
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm/logic/FragmentSpecification.h"
+#include "storm/modelchecker/AbstractModelChecker.h"
+#include "storm/settings/modules/StatisticalModelCheckingSettings.h"
+#include "storm/simulator/PrismProgramSimulator.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/random.h"
+
+namespace storm {
+
+    class Environment;
+
+    namespace modelchecker {
+
+        /*!
+         * Estimates step-bounded probabilities of discrete-time PRISM programs (DTMCs, MDPs and SMGs) by sampling paths
+         * with the DiscreteTimePrismProgramSimulator, i.e. without building the model. The nondeterminism is resolved by
+         * a fixed strategy (see StatisticalModelCheckingSettings), so the results refer to this strategy. As the engine
+         * does not search for optimal strategies, formulas that ask for minimal or maximal probabilities (including the
+         * probabilities that a coalition can enforce) are rejected.
+         *
+         * Quantitative queries are answered with an estimate whose precision and confidence follow from the
+         * Chernoff-Hoeffding bound. Queries with a bound are answered with Wald's sequential probability ratio test.
+         * Paths are sampled in batches; each batch is split among several threads (if Intel TBB is available and enabled),
+         * each with its own simulator and expansion cache. The random numbers of a path only depend on the seed and the
+         * index of the path, so the results do not depend on the number of threads.
+         */
+        template<typename ModelType>
+        class StatisticalModelChecker : public AbstractModelChecker<ModelType> {
+        public:
+            typedef typename ModelType::ValueType ValueType;
+
+            struct Options {
+                // Initializes the options from the settings.
+                Options();
+
+                double precision;
+                double confidence;
+                double indifference;
+                storm::settings::modules::StatisticalModelCheckingSettings::Strategy strategy;
+                uint64_t cacheSize;
+                uint64_t batchSize;
+                uint64_t seed;
+            };
+
+            StatisticalModelChecker(storm::prism::Program const& program, Options const& options = Options());
+
+            static bool canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
+                storm::logic::FragmentSpecification fragment = storm::logic::propositional();
+                fragment.setProbabilityOperatorsAllowed(true);
+                fragment.setBoundedUntilFormulasAllowed(true);
+                fragment.setStepBoundedUntilFormulasAllowed(true);
+                fragment.setBoundedGloballyFormulasAllowed(true);
+                fragment.setNestedOperatorsAllowed(false);
+                if (!checkTask.getFormula().isInFragment(fragment) || !checkTask.isOnlyInitialStatesRelevantSet()) {
+                    return false;
+                }
+                // The strategy is fixed, so optimal values cannot be computed.
+                storm::logic::Formula const& formula = checkTask.getFormula();
+                return !checkTask.isOptimizationDirectionSet() && !(formula.isProbabilityOperatorFormula() && formula.asProbabilityOperatorFormula().hasOptimalityType());
+            }
+
+            virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
+
+            virtual std::unique_ptr<CheckResult> checkProbabilityOperatorFormula(Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) override;
+            virtual std::unique_ptr<CheckResult> computeBoundedUntilProbabilities(Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) override;
+            virtual std::unique_ptr<CheckResult> computeBoundedGloballyProbabilities(Environment const& env, CheckTask<storm::logic::BoundedGloballyFormula, ValueType> const& checkTask) override;
+
+            /*!
+             * Retrieves the number of paths that were sampled for the last query.
+             */
+            uint64_t getNumberOfSampledPaths() const;
+
+        private:
+            // A step-bounded path property: condition U[lower,upper] target or G[lower,upper] target.
+            struct PathProperty {
+                storm::expressions::Expression condition;
+                storm::expressions::Expression target;
+                uint64_t lowerBound;
+                uint64_t upperBound;
+                bool globally;
+            };
+
+            PathProperty getPathProperty(storm::logic::Formula const& pathFormula) const;
+
+            ValueType estimateProbability(PathProperty const& property);
+            bool testHypothesis(PathProperty const& property, storm::logic::ComparisonType comparisonType, ValueType const& threshold);
+
+            /*!
+             * Samples the paths with the given indices in parallel and stores whether they satisfy the property.
+             */
+            void samplePaths(PathProperty const& property, uint64_t firstPath, uint64_t numberOfPaths, std::vector<uint8_t>& outcomes);
+            bool samplePath(storm::simulator::DiscreteTimePrismProgramSimulator<ValueType>& simulator, PathProperty const& property, uint64_t path) const;
+
+            void printStatistics() const;
+
+            storm::prism::Program program;
+            Options options;
+            storm::utility::PhiloxGenerator generator;
+
+            // One simulator (with its own expansion cache) for each thread.
+            std::vector<std::unique_ptr<storm::simulator::DiscreteTimePrismProgramSimulator<ValueType>>> simulators;
+
+            uint64_t numberOfSampledPaths;
+        };
+    }
+}
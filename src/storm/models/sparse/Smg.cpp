@@ -1,6 +1,7 @@
 #include "storm/models/sparse/Smg.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidOperationException.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -47,6 +48,11 @@ namespace storm {
                 return findIt->second;
             }
 
+            template <typename ValueType, typename RewardModelType>
+            std::map<std::string, storm::storage::PlayerIndex> const& Smg<ValueType, RewardModelType>::getPlayerNameToIndexMap() const {
+                return playerNameToIndexMap;
+            }
+
             template <typename ValueType, typename RewardModelType>
             storm::storage::BitVector Smg<ValueType, RewardModelType>::computeStatesOfCoalition(storm::logic::PlayerCoalition const& coalition) const {
                 // Create a set and a bit vector encoding the coalition for faster access
@@ -76,6 +82,23 @@ namespace storm {
                 return result;
             }
 
+            template <typename ValueType, typename RewardModelType>
+            void Smg<ValueType, RewardModelType>::setQuotientInformation(QuotientInformation const& information) {
+                STORM_LOG_THROW(information.originalModel && information.stateMapping.size() == information.originalModel->getNumberOfStates() && information.choiceMapping.size() == information.originalModel->getNumberOfChoices(), storm::exceptions::InvalidArgumentException, "The quotient mappings do not match the original game.");
+                quotientInformation = information;
+            }
+
+            template <typename ValueType, typename RewardModelType>
+            bool Smg<ValueType, RewardModelType>::hasQuotientInformation() const {
+                return static_cast<bool>(quotientInformation);
+            }
+
+            template <typename ValueType, typename RewardModelType>
+            typename Smg<ValueType, RewardModelType>::QuotientInformation const& Smg<ValueType, RewardModelType>::getQuotientInformation() const {
+                STORM_LOG_THROW(hasQuotientInformation(), storm::exceptions::InvalidOperationException, "The game is not a bisimulation quotient.");
+                return quotientInformation.get();
+            }
+
             template class Smg<double>;
             template class Smg<storm::RationalNumber>;
 
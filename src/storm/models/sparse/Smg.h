@@ -1,6 +1,8 @@
 #ifndef STORM_MODELS_SPARSE_SMG_H_
 #define STORM_MODELS_SPARSE_SMG_H_
 
+#include <boost/optional.hpp>
+
 #include "storm/models/sparse/NondeterministicModel.h"
 #include "storm/storage/PlayerIndex.h"
 #include "storm/storage/BitVector.h"
@@ -16,6 +18,19 @@ namespace storm {
             template<class ValueType, typename RewardModelType = StandardRewardModel<ValueType>>
             class Smg : public NondeterministicModel<ValueType, RewardModelType> {
             public:
+                /*!
+                 * Relates a game obtained by bisimulation minimization to the game it was obtained from, such that
+                 * strategies and shields computed on the quotient can be mapped back to the original game.
+                 */
+                struct QuotientInformation {
+                    // The game the quotient was obtained from.
+                    std::shared_ptr<Smg<ValueType, RewardModelType> const> originalModel;
+                    // Maps each state of the original game to its state in the quotient.
+                    std::vector<uint_fast64_t> stateMapping;
+                    // Maps each choice (row) of the original game to its choice (row) in the quotient.
+                    std::vector<uint_fast64_t> choiceMapping;
+                };
+
                 /*!
                  * Constructs a model from the given data.
                  *
@@ -33,14 +48,25 @@ namespace storm {
                 std::vector<storm::storage::PlayerIndex> const& getStatePlayerIndications() const;
                 storm::storage::PlayerIndex getPlayerOfState(uint64_t stateIndex) const;
                 storm::storage::PlayerIndex getPlayerIndex(std::string const& playerName) const;
+                std::map<std::string, storm::storage::PlayerIndex> const& getPlayerNameToIndexMap() const;
                 storm::storage::BitVector computeStatesOfCoalition(storm::logic::PlayerCoalition const& coalition) const;
 
+                /*!
+                 * Marks this game as the bisimulation quotient of the game given in the information. Note that this
+                 * keeps the original game alive as long as this game.
+                 */
+                void setQuotientInformation(QuotientInformation const& information);
+                bool hasQuotientInformation() const;
+                QuotientInformation const& getQuotientInformation() const;
+
             private:
                 // Assigns the controlling player to each state.
                 // If a state has storm::storage::INVALID_PLAYER_INDEX, it shall be the case that the choice at that state is unique
                 std::vector<storm::storage::PlayerIndex> statePlayerIndications;
                 // A mapping of player names to player indices.
                 std::map<std::string, storm::storage::PlayerIndex> playerNameToIndexMap;
+                // If this game is a bisimulation quotient, the relation to the original game.
+                boost::optional<QuotientInformation> quotientInformation;
             };
 
         } // namespace sparse
@@ -1,6 +1,12 @@
 #include "storm/settings/ArgumentValidators.h"
 
+#include <cmath>
+#include <stdexcept>
+
 #include <boost/algorithm/string/join.hpp>
+#include <boost/algorithm/string/split.hpp>
+#include <boost/algorithm/string/classification.hpp>
+#include <boost/algorithm/string/trim.hpp>
 
 #include <sys/stat.h>
 
@@ -121,6 +127,46 @@ namespace storm {
             return "in {" + boost::join(legalValues, ", ") + "}";
         }
         
+        NumberListValidator::NumberListValidator(double lowerBound) : lowerBound(lowerBound) {
+            // Intentionally left empty.
+        }
+        
+        bool NumberListValidator::isValid(std::string const& value) {
+            try {
+                for (auto const& number : parse(value)) {
+                    if (number < lowerBound) {
+                        return false;
+                    }
+                }
+            } catch (storm::exceptions::IllegalArgumentValueException const&) {
+                return false;
+            }
+            return true;
+        }
+        
+        std::string NumberListValidator::toString() const {
+            return "comma separated list of numbers >= " + std::to_string(lowerBound);
+        }
+        
+        std::vector<double> NumberListValidator::parse(std::string const& value) {
+            std::vector<double> result;
+            std::vector<std::string> entries;
+            boost::split(entries, value, boost::is_any_of(","));
+            for (auto entry : entries) {
+                boost::trim(entry);
+                std::size_t parsedCharacters = 0;
+                double number = 0.0;
+                try {
+                    number = std::stod(entry, &parsedCharacters);
+                } catch (std::logic_error const&) {
+                    parsedCharacters = 0;
+                }
+                STORM_LOG_THROW(!entry.empty() && parsedCharacters == entry.size() && std::isfinite(number), storm::exceptions::IllegalArgumentValueException, "The entry '" << entry << "' of the list '" << value << "' is not a number.");
+                result.push_back(number);
+            }
+            return result;
+        }
+        
         std::shared_ptr<ArgumentValidator<int64_t>> ArgumentValidatorFactory::createIntegerRangeValidatorExcluding(int_fast64_t lowerBound, int_fast64_t upperBound) {
             return createRangeValidatorExcluding<int64_t>(lowerBound, upperBound);
         }
@@ -177,6 +223,10 @@ namespace storm {
             return std::make_unique<MultipleChoiceValidator>(choices);
         }
         
+        std::shared_ptr<ArgumentValidator<std::string>> ArgumentValidatorFactory::createNonNegativeNumberListValidator() {
+            return std::make_unique<NumberListValidator>(0.0);
+        }
+        
         template <typename ValueType>
         std::shared_ptr<ArgumentValidator<ValueType>> ArgumentValidatorFactory::createRangeValidatorExcluding(ValueType lowerBound, ValueType upperBound) {
             return std::make_unique<RangeArgumentValidator<ValueType>>(lowerBound, upperBound, false, false);
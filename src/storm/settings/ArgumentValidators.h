@@ -66,6 +66,27 @@ namespace storm {
             std::vector<std::string> legalValues;
         };
         
+        /*!
+         * Validates comma separated lists of numbers that are not smaller than a given bound.
+         */
+        class NumberListValidator : public ArgumentValidator<std::string> {
+        public:
+            NumberListValidator(double lowerBound);
+            
+            virtual bool isValid(std::string const& value) override;
+            virtual std::string toString() const override;
+            
+            /*!
+             * Parses the given comma separated list of numbers.
+             *
+             * @throws IllegalArgumentValueException if an entry is not a number.
+             */
+            static std::vector<double> parse(std::string const& value);
+            
+        private:
+            double lowerBound;
+        };
+        
         class ArgumentValidatorFactory {
         public:
             static std::shared_ptr<ArgumentValidator<int64_t>> createIntegerRangeValidatorExcluding(int_fast64_t lowerBound, int_fast64_t upperBound);
@@ -88,6 +109,8 @@ namespace storm {
             
             static std::shared_ptr<ArgumentValidator<std::string>> createMultipleChoiceValidator(std::vector<std::string> const& choices);
             
+            static std::shared_ptr<ArgumentValidator<std::string>> createNonNegativeNumberListValidator();
+            
         private:
             template <typename ValueType>
             static std::shared_ptr<ArgumentValidator<ValueType>> createRangeValidatorExcluding(ValueType lowerBound, ValueType upperBound);
@@ -35,6 +35,9 @@ namespace storm {
             const std::string buildAllLabelsOptionName = "build-all-labels";
             const std::string buildOutOfBoundsStateOptionName = "build-out-of-bounds-state";
             const std::string buildOverlappingGuardsLabelOptionName = "build-overlapping-guards-label";
+            const std::string symmetryReductionOptionName = "symmetry-reduction";
+            const std::string noGuardIndexOptionName = "no-guard-index";
+            const std::string compileExpressionsOptionName = "compile-expressions";
             const std::string noSimplifyOptionName = "no-simplify";
             const std::string bitsForUnboundedVariablesOptionName = "int-bits";
 
@@ -56,6 +59,10 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, explorationChecksOptionName, false, "If set, additional checks (if available) are performed during model exploration to debug the model.").setShortName(explorationChecksOptionShortName).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, buildOutOfBoundsStateOptionName, false, "If set, a state for out-of-bounds valuations is added").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, buildOverlappingGuardsLabelOptionName, false, "For states where multiple guards are enabled, we add a label (for debugging DTMCs)").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, symmetryReductionOptionName, false, "If set, states of PRISM programs that only differ by a permutation of symmetric (renamed) modules are merged during the exploration. Properties are assumed to be symmetric.").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, noGuardIndexOptionName, false, "If set, the commands of PRISM programs are not indexed by the values their guards require, so all guards are evaluated in every state.").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, compileExpressionsOptionName, false, "If set, the guards, update probabilities and assignments of PRISM programs are compiled to native code with the compiler of the jit builder. The shared objects are cached for repeated builds.").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("cache-dir", "The directory of the cached shared objects (default: a directory in the system's temporary directory).").setDefaultValueString("").makeOptional().build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, noSimplifyOptionName, false, "If set, simplification PRISM input is disabled.").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, bitsForUnboundedVariablesOptionName, false, "Sets the number of bits that is used for unbounded integer variables.").setIsAdvanced()
                                         .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of bits.").addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedRangeValidatorExcluding(0,63)).setDefaultValueUnsignedInteger(32).build()).build());
@@ -105,6 +112,22 @@ namespace storm {
                 return this->getOption(buildOutOfBoundsStateOptionName).getHasOptionBeenSet();
             }
 
+            bool BuildSettings::isSymmetryReductionSet() const {
+                return this->getOption(symmetryReductionOptionName).getHasOptionBeenSet();
+            }
+
+            bool BuildSettings::isNoGuardIndexSet() const {
+                return this->getOption(noGuardIndexOptionName).getHasOptionBeenSet();
+            }
+
+            bool BuildSettings::isCompileExpressionsSet() const {
+                return this->getOption(compileExpressionsOptionName).getHasOptionBeenSet();
+            }
+
+            std::string BuildSettings::getCompiledExpressionsCacheDirectory() const {
+                return this->getOption(compileExpressionsOptionName).getArgumentByName("cache-dir").getValueAsString();
+            }
+
             bool BuildSettings::isAddOverlappingGuardsLabelSet() const {
                 return this->getOption(buildOverlappingGuardsLabelOptionName).getHasOptionBeenSet();
             }
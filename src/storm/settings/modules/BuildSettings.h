@@ -100,6 +100,26 @@ namespace storm {
                  */
                 bool isBuildOutOfBoundsStateSet() const;
 
+                /*!
+                 * Retrieves whether symmetric modules should be exploited during the exploration
+                 */
+                bool isSymmetryReductionSet() const;
+
+                /*!
+                 * Retrieves whether indexing the commands of PRISM programs by their guards is disabled
+                 */
+                bool isNoGuardIndexSet() const;
+
+                /*!
+                 * Retrieves whether the expressions of PRISM programs are to be compiled to native code
+                 */
+                bool isCompileExpressionsSet() const;
+
+                /*!
+                 * Retrieves the directory in which compiled expressions are cached (empty for the default directory)
+                 */
+                std::string getCompiledExpressionsCacheDirectory() const;
+
                 /*!
                  * Retrieves whether to build the overlapping label
                  */
@@ -17,6 +17,8 @@ namespace storm {
             const std::string GameSolverSettings::maximalIterationsOptionShortName = "i";
             const std::string GameSolverSettings::precisionOptionName = "precision";
             const std::string GameSolverSettings::absoluteOptionName = "absolute";
+            const std::string GameSolverSettings::traceOptionName = "trace";
+            const std::string GameSolverSettings::timeBudgetOptionName = "timebudget";
 
             GameSolverSettings::GameSolverSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> gameSolvingTechniques = {"vi", "value-iteration", "pi", "policy-iteration"};
@@ -28,6 +30,12 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, false, "The precision used for detecting convergence of iterative methods.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The precision to achieve.").setDefaultValueDouble(1e-06).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).build());
 
                 this->addOption(storm::settings::OptionBuilder(moduleName, absoluteOptionName, false, "Sets whether the relative or the absolute error is considered for detecting convergence.").setIsAdvanced().build());
+
+                this->addOption(storm::settings::OptionBuilder(moduleName, traceOptionName, false, "Writes the maximal and minimal difference, the number of changing states and the iterations per second of every value iteration step to a CSV file.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the trace file.").build()).build());
+
+                this->addOption(storm::settings::OptionBuilder(moduleName, timeBudgetOptionName, false, "Stops value iteration after the given wall-clock time and continues with the current (approximate) values.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("seconds", "The time budget in seconds.").addValidatorDouble(ArgumentValidatorFactory::createDoubleGreaterValidator(0.0)).build()).build());
             }
             
             storm::solver::GameMethod GameSolverSettings::getGameSolvingMethod() const {
@@ -71,6 +79,22 @@ namespace storm {
             GameSolverSettings::ConvergenceCriterion GameSolverSettings::getConvergenceCriterion() const {
                 return this->getOption(absoluteOptionName).getHasOptionBeenSet() ? GameSolverSettings::ConvergenceCriterion::Absolute : GameSolverSettings::ConvergenceCriterion::Relative;
             }
+
+            bool GameSolverSettings::isTraceSet() const {
+                return this->getOption(traceOptionName).getHasOptionBeenSet();
+            }
+
+            std::string GameSolverSettings::getTraceFilename() const {
+                return this->getOption(traceOptionName).getArgumentByName("filename").getValueAsString();
+            }
+
+            bool GameSolverSettings::isTimeBudgetSet() const {
+                return this->getOption(timeBudgetOptionName).getHasOptionBeenSet();
+            }
+
+            double GameSolverSettings::getTimeBudget() const {
+                return this->getOption(timeBudgetOptionName).getArgumentByName("seconds").getValueAsDouble();
+            }
             
         }
     }
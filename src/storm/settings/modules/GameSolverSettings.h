@@ -81,6 +81,34 @@ namespace storm {
                  * @return The selected convergence criterion.
                  */
                 ConvergenceCriterion getConvergenceCriterion() const;
+
+                /*!
+                 * Retrieves whether a file has been set to which the convergence of value iteration is traced.
+                 *
+                 * @return True iff the trace file has been set.
+                 */
+                bool isTraceSet() const;
+
+                /*!
+                 * Retrieves the name of the file to which the convergence of value iteration is traced (as CSV).
+                 *
+                 * @return The name of the trace file.
+                 */
+                std::string getTraceFilename() const;
+
+                /*!
+                 * Retrieves whether a time budget for value iteration has been set.
+                 *
+                 * @return True iff the time budget has been set.
+                 */
+                bool isTimeBudgetSet() const;
+
+                /*!
+                 * Retrieves the wall-clock time (in seconds) after which value iteration is stopped with the current values.
+                 *
+                 * @return The time budget in seconds.
+                 */
+                double getTimeBudget() const;
                 
                 // The name of the module.
                 static const std::string moduleName;
@@ -91,6 +119,8 @@ namespace storm {
                 static const std::string maximalIterationsOptionShortName;
                 static const std::string precisionOptionName;
                 static const std::string absoluteOptionName;
+                static const std::string traceOptionName;
+                static const std::string timeBudgetOptionName;
             };
             
         }
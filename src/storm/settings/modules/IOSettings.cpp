@@ -1,5 +1,8 @@
 #include "storm/settings/modules/IOSettings.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/Option.h"
@@ -26,6 +29,7 @@ namespace storm {
             const std::string IOSettings::exportCdfOptionShortName = "cdf";
             const std::string IOSettings::exportSchedulerOptionName = "exportscheduler";
             const std::string IOSettings::exportCheckResultOptionName = "exportresult";
+            const std::string IOSettings::exportStatisticsOptionName = "export-stats";
             const std::string IOSettings::explicitOptionName = "explicit";
             const std::string IOSettings::explicitOptionShortName = "exp";
             const std::string IOSettings::explicitDrnOptionName = "explicit-drn";
@@ -47,6 +51,7 @@ namespace storm {
             const std::string IOSettings::propertyOptionName = "prop";
             const std::string IOSettings::propertyOptionShortName = "prop";
             const std::string IOSettings::steadyStateDistrOptionName = "steadystate";
+            const std::string IOSettings::timeSeriesOptionName = "timeseries";
             
             const std::string IOSettings::qvbsInputOptionName = "qvbs";
             const std::string IOSettings::qvbsInputOptionShortName = "qvbs";
@@ -65,6 +70,7 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, exportCdfOptionName, false, "Exports the cumulative density function for reward bounded properties into a .csv file.").setIsAdvanced().setShortName(exportCdfOptionShortName).addArgument(storm::settings::ArgumentBuilder::createStringArgument("directory", "A path to an existing directory where the cdf files will be stored.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, exportSchedulerOptionName, false, "Exports the choices of an optimal scheduler to the given file (if supported by engine).").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The output file. Use file extension '.json' to export in json.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, exportCheckResultOptionName, false, "Exports the result to a given file (if supported by engine). The export will be in json.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The output file.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, exportStatisticsOptionName, false, "Exports the time, peak memory and counters (e.g. iterations, states, allowed actions) of all phases to the given file in json.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The output file.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, exportExplicitOptionName, "", "If given, the loaded model will be written to the specified file in the drn format.")
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "the name of the file to which the model is to be writen.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName,  preventDRNPlaceholderOptionName, true, "If given, the exported DRN contains no placeholders").setIsAdvanced().build());
@@ -100,6 +106,10 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, janiPropertyOptionName, false, "Specifies the properties from the jani model (given by --" + janiInputOptionName + ") to be checked.").setShortName(janiPropertyOptionShortName)
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("values", "A comma separated list of properties to be checked").setDefaultValueString("").makeOptional().build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName,  steadyStateDistrOptionName, false, "Computes the steady state distribution. Result can be exported using --" + exportCheckResultOptionName +".").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, timeSeriesOptionName, false, "Computes the values of the time-bounded CTMC properties (P=? [F<=t phi] or R=? [I=t]) for a series of time points t. The time bound in the property is ignored.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("start", "The first time point.").addValidatorDouble(ArgumentValidatorFactory::createDoubleGreaterEqualValidator(0.0)).build())
+                                .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("end", "The last time point.").addValidatorDouble(ArgumentValidatorFactory::createDoubleGreaterEqualValidator(0.0)).build())
+                                .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("step", "The distance between two consecutive time points.").addValidatorDouble(ArgumentValidatorFactory::createDoubleGreaterValidator(0.0)).build()).build());
 
                 this->addOption(storm::settings::OptionBuilder(moduleName, qvbsInputOptionName, false, "Selects a model from the Quantitative Verification Benchmark Set.").setShortName(qvbsInputOptionShortName)
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("model", "The short model name as in the benchmark set.").build())
@@ -186,6 +196,14 @@ namespace storm {
                 return this->getOption(exportCheckResultOptionName).getArgumentByName("filename").getValueAsString();
             }
 
+            bool IOSettings::isExportStatisticsSet() const {
+                return this->getOption(exportStatisticsOptionName).getHasOptionBeenSet();
+            }
+
+            std::string IOSettings::getExportStatisticsFilename() const {
+                return this->getOption(exportStatisticsOptionName).getArgumentByName("filename").getValueAsString();
+            }
+
             bool IOSettings::isExplicitSet() const {
                 return this->getOption(explicitOptionName).getHasOptionBeenSet();
             }
@@ -298,6 +316,31 @@ namespace storm {
                 return this->getOption(steadyStateDistrOptionName).getHasOptionBeenSet();
             }
             
+            bool IOSettings::isTimeSeriesSet() const {
+                return this->getOption(timeSeriesOptionName).getHasOptionBeenSet();
+            }
+            
+            std::vector<double> IOSettings::getTimeSeriesTimePoints() const {
+                double start = this->getOption(timeSeriesOptionName).getArgumentByName("start").getValueAsDouble();
+                double end = this->getOption(timeSeriesOptionName).getArgumentByName("end").getValueAsDouble();
+                double step = this->getOption(timeSeriesOptionName).getArgumentByName("step").getValueAsDouble();
+                // Compute the time points from their index to avoid accumulating rounding errors. The tolerance makes sure
+                // that the end point is not missed if (end - start) / step is slightly below an integer due to rounding.
+                uint64_t numberOfSteps = static_cast<uint64_t>(std::floor((end - start) / step + 1e-9));
+                std::vector<double> timePoints;
+                timePoints.reserve(numberOfSteps + 2);
+                for (uint64_t index = 0; index <= numberOfSteps; ++index) {
+                    timePoints.push_back(std::min(start + index * step, end));
+                }
+                // The end point is always included, even if it is not a multiple of the step away from the start.
+                if (end - timePoints.back() > 1e-9 * step) {
+                    timePoints.push_back(end);
+                } else {
+                    timePoints.back() = end;
+                }
+                return timePoints;
+            }
+            
             bool IOSettings::isQvbsInputSet() const {
                 return this->getOption(qvbsInputOptionName).getHasOptionBeenSet();
             }
@@ -359,6 +402,8 @@ namespace storm {
                 // Make sure PRISM-to-JANI conversion is only set if the actual input is in PRISM format.
                 STORM_LOG_THROW(!isPrismToJaniSet() || isPrismInputSet(), storm::exceptions::InvalidSettingsException, "For the transformation from PRISM to JANI, the input model must be given in the prism format.");
                 
+                STORM_LOG_THROW(!isTimeSeriesSet() || this->getOption(timeSeriesOptionName).getArgumentByName("start").getValueAsDouble() <= this->getOption(timeSeriesOptionName).getArgumentByName("end").getValueAsDouble(), storm::exceptions::InvalidSettingsException, "The first time point of the time series must not exceed the last one.");
+                
                 return true;
             }
 
@@ -1,6 +1,7 @@
 #ifndef STORM_SETTINGS_MODULES_IOSETTINGS_H_
 #define STORM_SETTINGS_MODULES_IOSETTINGS_H_
 
+#include <vector>
 #include <boost/optional.hpp>
 
 #include "storm-config.h"
@@ -116,6 +117,16 @@ namespace storm {
                  */
                  std::string getExportCheckResultFilename() const;
 
+                /*!
+                 * Retrieves whether the statistics (timings, counters and memory of all phases) should be exported.
+                 */
+                bool isExportStatisticsSet() const;
+
+                /*!
+                 * Retrieves a filename to which the statistics should be exported.
+                 */
+                std::string getExportStatisticsFilename() const;
+
                 /*!
                  * Retrieves whether the explicit option was set.
                  *
@@ -319,6 +330,17 @@ namespace storm {
                  */
                 bool isComputeSteadyStateDistributionSet() const;
                 
+                /*!
+                 * Retrieves whether the values of the properties are to be computed for a series of time points.
+                 */
+                bool isTimeSeriesSet() const;
+                
+                /*!
+                 * Retrieves the time points for which the values of the properties are to be computed, i.e. all
+                 * multiples of the step size (added to the start) that do not exceed the end, followed by the end.
+                 */
+                std::vector<double> getTimeSeriesTimePoints() const;
+                
                 /*!
                  * Retrieves whether the input model is to be read from the quantitative verification benchmark set (QVBS)
                  */
@@ -366,6 +388,7 @@ namespace storm {
                 static const std::string exportCdfOptionShortName;
                 static const std::string exportSchedulerOptionName;
                 static const std::string exportCheckResultOptionName;
+                static const std::string exportStatisticsOptionName;
                 static const std::string explicitOptionName;
                 static const std::string explicitOptionShortName;
                 static const std::string explicitDrnOptionName;
@@ -385,6 +408,7 @@ namespace storm {
                 static const std::string propertyOptionName;
                 static const std::string propertyOptionShortName;
                 static const std::string steadyStateDistrOptionName;
+                static const std::string timeSeriesOptionName;
                 static const std::string qvbsInputOptionName;
                 static const std::string qvbsInputOptionShortName;
                 static const std::string qvbsRootOptionName;
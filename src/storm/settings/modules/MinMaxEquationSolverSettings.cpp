@@ -21,7 +21,7 @@ namespace storm {
             const std::string MinMaxEquationSolverSettings::intervalIterationSymmetricUpdatesOptionName = "symmetricupdates";
 
             MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(moduleName) {
-                std::vector<std::string> minMaxSolvingTechniques = {"vi", "value-iteration", "pi", "policy-iteration", "lp", "linear-programming", "rs", "ratsearch", "ii", "interval-iteration", "svi", "sound-value-iteration", "ovi", "optimistic-value-iteration", "topological", "vi-to-pi", "acyclic"};
+                std::vector<std::string> minMaxSolvingTechniques = {"vi", "value-iteration", "pi", "policy-iteration", "lp", "linear-programming", "rs", "ratsearch", "ii", "interval-iteration", "svi", "sound-value-iteration", "ovi", "optimistic-value-iteration", "topological", "topological-simd", "vi-to-pi", "acyclic"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, solvingMethodOptionName, false, "Sets which min/max linear equation solving technique is preferred.").setIsAdvanced()
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a min/max linear equation solving technique.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(minMaxSolvingTechniques)).setDefaultValueString("topological").build()).build());
                 
@@ -57,6 +57,8 @@ namespace storm {
                     return storm::solver::MinMaxMethod::OptimisticValueIteration;
                 } else if (minMaxEquationSolvingTechnique == "topological") {
                     return storm::solver::MinMaxMethod::Topological;
+                } else if (minMaxEquationSolvingTechnique == "topological-simd") {
+                    return storm::solver::MinMaxMethod::TopologicalSimd;
                 } else if (minMaxEquationSolvingTechnique == "vi-to-pi") {
                     return storm::solver::MinMaxMethod::ViToPi;
                 } else if (minMaxEquationSolvingTechnique == "acyclic") {
@@ -19,6 +19,7 @@ namespace storm {
             const std::string MultiObjectiveSettings::schedulerRestrictionOptionName = "purescheds";
             const std::string MultiObjectiveSettings::printResultsOptionName = "printres";
             const std::string MultiObjectiveSettings::encodingOptionName = "encoding";
+            const std::string MultiObjectiveSettings::shieldWeightsOptionName = "shieldweights";
             
             MultiObjectiveSettings::MultiObjectiveSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> methods = {"pcaa", "constraintbased"};
@@ -39,6 +40,8 @@ namespace storm {
                 std::vector<std::string> encodingTypes = {"auto", "classic", "flow"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, encodingOptionName, true, "The preferred type of encoding for constraint-based methods.").setIsAdvanced()
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("type", "The type.").setDefaultValueString("auto").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(encodingTypes)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, shieldWeightsOptionName, true, "Selects the Pareto point for which multi-objective shields are synthesized by a weight vector over the objectives. The shield thresholds are applied to the weighted sum of the objective values.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("weights", "A comma separated list of non-negative weights, one for each objective.").addValidatorString(ArgumentValidatorFactory::createNonNegativeNumberListValidator()).build()).build());
             }
             
             storm::modelchecker::multiobjective::MultiObjectiveMethod MultiObjectiveSettings::getMultiObjectiveMethod() const {
@@ -129,6 +132,14 @@ namespace storm {
                 return this->getOption(encodingOptionName).getArgumentByName("type").getValueAsString() == "auto";
             }
             
+            bool MultiObjectiveSettings::isShieldWeightVectorSet() const {
+                return this->getOption(shieldWeightsOptionName).getHasOptionBeenSet();
+            }
+            
+            std::vector<double> MultiObjectiveSettings::getShieldWeightVector() const {
+                return NumberListValidator::parse(this->getOption(shieldWeightsOptionName).getArgumentByName("weights").getValueAsString());
+            }
+            
             bool MultiObjectiveSettings::check() const {
                 std::shared_ptr<storm::settings::ArgumentValidator<std::string>> validator = ArgumentValidatorFactory::createWritableFileValidator();
                 
@@ -145,6 +156,12 @@ namespace storm {
                     getSchedulerRestriction();
                 }
                 
+                if (isShieldWeightVectorSet()) {
+                    for (auto const& weight : getShieldWeightVector()) {
+                        STORM_LOG_THROW(weight >= 0.0, storm::exceptions::IllegalArgumentException, "Shield weights must be non-negative.");
+                    }
+                }
+                
                 return true;
             }
 
@@ -99,6 +99,16 @@ namespace storm {
 				 */
                 bool isAutoEncodingSet() const;
                 
+                /*!
+                 * Retrieves whether a weight vector for selecting the Pareto point of multi-objective shields has been set.
+                 */
+                bool isShieldWeightVectorSet() const;
+                
+                /*!
+                 * Retrieves the weight vector for selecting the Pareto point of multi-objective shields.
+                 */
+                std::vector<double> getShieldWeightVector() const;
+                
                 /*!
                  * Checks whether the settings are consistent. If they are inconsistent, an exception is thrown.
                  *
@@ -117,6 +127,7 @@ namespace storm {
 				const static std::string schedulerRestrictionOptionName;
 				const static std::string printResultsOptionName;
 				const static std::string encodingOptionName;
+				const static std::string shieldWeightsOptionName;
             };
             
         } // namespace modules
@@ -0,0 +1,91 @@
+#include "storm/settings/modules/StatisticalModelCheckingSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/Argument.h"
+#include "storm/settings/SettingsManager.h"
+
+#include "storm/utility/macros.h"
+#include "storm/utility/Engine.h"
+#include "storm/exceptions/IllegalArgumentValueException.h"
+
+namespace storm {
+    namespace settings {
+        namespace modules {
+
+            const std::string StatisticalModelCheckingSettings::moduleName = "smc";
+            const std::string StatisticalModelCheckingSettings::precisionOptionName = "precision";
+            const std::string StatisticalModelCheckingSettings::confidenceOptionName = "confidence";
+            const std::string StatisticalModelCheckingSettings::indifferenceOptionName = "indifference";
+            const std::string StatisticalModelCheckingSettings::strategyOptionName = "strategy";
+            const std::string StatisticalModelCheckingSettings::cacheSizeOptionName = "cachesize";
+            const std::string StatisticalModelCheckingSettings::batchSizeOptionName = "batch";
+            const std::string StatisticalModelCheckingSettings::seedOptionName = "seed";
+
+            StatisticalModelCheckingSettings::StatisticalModelCheckingSettings() : ModuleSettings(moduleName) {
+                this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, true, "The maximal distance between the estimated and the actual probability.")
+                                .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The precision.").setDefaultValueDouble(0.01).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, confidenceOptionName, true, "The confidence in the estimate or in the outcome of the hypothesis test.")
+                                .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The confidence.").setDefaultValueDouble(0.95).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, indifferenceOptionName, true, "The half-width of the indifference region around the bound of a property, used by the sequential probability ratio test.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The half-width.").setDefaultValueDouble(0.01).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 0.5)).build()).build());
+                std::vector<std::string> strategies = {"uniform", "first"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, strategyOptionName, true, "Sets the strategy that resolves the choices of the scheduler of an MDP and of the players of an SMG.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "'uniform' samples the choices uniformly, 'first' always takes the first choice.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(strategies)).setDefaultValueString("uniform").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, cacheSizeOptionName, true, "Sets the number of expanded states each sampling thread keeps.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of states (0 disables the cache).").setDefaultValueUnsignedInteger(100000).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, batchSizeOptionName, true, "Sets the number of paths that are sampled in parallel before the statistics are updated.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of paths.").setDefaultValueUnsignedInteger(1000).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, seedOptionName, true, "Sets the seed of the random numbers.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The seed.").setDefaultValueUnsignedInteger(0).build()).build());
+            }
+
+            double StatisticalModelCheckingSettings::getPrecision() const {
+                return this->getOption(precisionOptionName).getArgumentByName("value").getValueAsDouble();
+            }
+
+            double StatisticalModelCheckingSettings::getConfidence() const {
+                return this->getOption(confidenceOptionName).getArgumentByName("value").getValueAsDouble();
+            }
+
+            double StatisticalModelCheckingSettings::getIndifference() const {
+                return this->getOption(indifferenceOptionName).getArgumentByName("value").getValueAsDouble();
+            }
+
+            StatisticalModelCheckingSettings::Strategy StatisticalModelCheckingSettings::getStrategy() const {
+                std::string strategyAsString = this->getOption(strategyOptionName).getArgumentByName("name").getValueAsString();
+                if (strategyAsString == "uniform") {
+                    return StatisticalModelCheckingSettings::Strategy::Uniform;
+                } else if (strategyAsString == "first") {
+                    return StatisticalModelCheckingSettings::Strategy::First;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown strategy '" << strategyAsString << "'.");
+            }
+
+            uint_fast64_t StatisticalModelCheckingSettings::getCacheSize() const {
+                return this->getOption(cacheSizeOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+
+            uint_fast64_t StatisticalModelCheckingSettings::getBatchSize() const {
+                return this->getOption(batchSizeOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+
+            uint_fast64_t StatisticalModelCheckingSettings::getSeed() const {
+                return this->getOption(seedOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+            }
+
+            bool StatisticalModelCheckingSettings::check() const {
+                bool optionsSet = this->getOption(precisionOptionName).getHasOptionBeenSet() ||
+                                    this->getOption(confidenceOptionName).getHasOptionBeenSet() ||
+                                    this->getOption(indifferenceOptionName).getHasOptionBeenSet() ||
+                                    this->getOption(strategyOptionName).getHasOptionBeenSet() ||
+                                    this->getOption(cacheSizeOptionName).getHasOptionBeenSet() ||
+                                    this->getOption(batchSizeOptionName).getHasOptionBeenSet() ||
+                                    this->getOption(seedOptionName).getHasOptionBeenSet();
+                STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::CoreSettings>().getEngine() == storm::utility::Engine::Statistical || !optionsSet, "Statistical model checking engine is not selected, so setting options for it has no effect.");
+                return true;
+            }
+        } // namespace modules
+    } // namespace settings
+} // namespace storm
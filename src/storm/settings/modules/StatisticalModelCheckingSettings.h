@@ -0,0 +1,74 @@
+#pragma once
+
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm {
+    namespace settings {
+        namespace modules {
+
+            /*!
+             * This class represents the settings of the statistical model checking engine.
+             */
+            class StatisticalModelCheckingSettings : public ModuleSettings {
+            public:
+                // The strategies that resolve the nondeterministic choices.
+                enum class Strategy { Uniform, First };
+
+                /*!
+                 * Creates a new set of statistical model checking settings.
+                 */
+                StatisticalModelCheckingSettings();
+
+                /*!
+                 * Retrieves the maximal distance between the estimated and the actual probability.
+                 */
+                double getPrecision() const;
+
+                /*!
+                 * Retrieves the confidence with which the estimate is within the precision (or the hypothesis test is correct).
+                 */
+                double getConfidence() const;
+
+                /*!
+                 * Retrieves the half-width of the indifference region around the bound of the sequential probability ratio test.
+                 */
+                double getIndifference() const;
+
+                /*!
+                 * Retrieves the strategy that resolves the choices of the scheduler of an MDP and of the players of an SMG.
+                 */
+                Strategy getStrategy() const;
+
+                /*!
+                 * Retrieves the number of expanded states each sampling thread keeps.
+                 */
+                uint_fast64_t getCacheSize() const;
+
+                /*!
+                 * Retrieves the number of paths that are sampled (in parallel) before the statistics are updated.
+                 */
+                uint_fast64_t getBatchSize() const;
+
+                /*!
+                 * Retrieves the seed of the random numbers.
+                 */
+                uint_fast64_t getSeed() const;
+
+                virtual bool check() const override;
+
+                // The name of the module.
+                static const std::string moduleName;
+
+            private:
+                // Define the string names of the options as constants.
+                static const std::string precisionOptionName;
+                static const std::string confidenceOptionName;
+                static const std::string indifferenceOptionName;
+                static const std::string strategyOptionName;
+                static const std::string cacheSizeOptionName;
+                static const std::string batchSizeOptionName;
+                static const std::string seedOptionName;
+            };
+        } // namespace modules
+    } // namespace settings
+} // namespace storm
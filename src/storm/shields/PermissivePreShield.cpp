@@ -0,0 +1,168 @@
+#include "storm/shields/PermissivePreShield.h"
+
+#include "storm/solver/LpSolver.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/utility/solver.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/UnexpectedException.h"
+
+namespace tempest {
+    namespace shields {
+
+        template<typename ValueType, typename IndexType>
+        PermissivePreShield<ValueType, IndexType>::PermissivePreShield(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& stateValues, std::vector<ValueType> const& choiceValues, storm::storage::BitVector const& badStates, storm::storage::BitVector const& goodStates, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates, ValueType const& precision) : AbstractShield<ValueType, IndexType>(transitionMatrix.getRowGroupIndices(), shieldingExpression, optimizationDirection, relevantStates, coalitionStates), transitionMatrix(transitionMatrix), stateValues(stateValues), choiceValues(choiceValues), badStates(badStates), goodStates(goodStates), precision(precision) {
+            // Intentionally left empty.
+        }
+
+        template<typename ValueType, typename IndexType>
+        ValueType PermissivePreShield<ValueType, IndexType>::toSafetyValue(ValueType const& value) const {
+            if(this->optimizationDirection == storm::OptimizationDirection::Maximize) {
+                return value;
+            } else {
+                return storm::utility::one<ValueType>() - value;
+            }
+        }
+
+        template<typename ValueType, typename IndexType>
+        boost::optional<ValueType> PermissivePreShield<ValueType, IndexType>::computeSafetyBound(uint64_t state) const {
+            ValueType shieldValue = storm::utility::convertNumber<ValueType>(this->shieldingExpression->getValue());
+            ValueType const& optValue = stateValues[state];
+            // The bounds correspond to the ones of the ChoiceFilter that is used by the (non-permissive) pre-shield.
+            if(this->optimizationDirection == storm::OptimizationDirection::Maximize) {
+                ValueType bound = this->shieldingExpression->isRelative() ? optValue * shieldValue : shieldValue;
+                if(optValue + precision < bound) {
+                    return boost::none;
+                }
+                return bound;
+            } else {
+                ValueType bound = this->shieldingExpression->isRelative() ? optValue + optValue * shieldValue : shieldValue;
+                if(optValue > bound + precision) {
+                    return boost::none;
+                }
+                return storm::utility::one<ValueType>() - bound;
+            }
+        }
+
+        template<typename ValueType, typename IndexType>
+        storm::storage::PreScheduler<ValueType> PermissivePreShield<ValueType, IndexType>::construct() {
+            uint64_t numberOfStates = this->rowGroupIndices.size() - 1;
+            storm::storage::BitVector shieldedStates(numberOfStates, true);
+            if(this->coalitionStates.is_initialized()) {
+                shieldedStates &= ~this->coalitionStates.get();
+            }
+            storm::storage::BitVector maybeStates = ~(badStates | goodStates);
+
+            auto solver = storm::utility::solver::getLpSolver<ValueType>("permissiveshield");
+            solver->setOptimizationDirection(storm::OptimizationDirection::Maximize);
+            auto zero = solver->getConstant(storm::utility::zero<ValueType>());
+            auto one = solver->getConstant(storm::utility::one<ValueType>());
+
+            // Create a variable for the guaranteed probability to stay safe of each maybe state.
+            // Since the shield can only restrict the coalition, the optimal values are upper bounds for these probabilities.
+            std::vector<storm::expressions::Variable> stateVariables(numberOfStates);
+            std::vector<storm::expressions::Expression> stateExpressions(numberOfStates);
+            for(uint64_t state = 0; state < numberOfStates; state++) {
+                if(badStates.get(state)) {
+                    stateExpressions[state] = zero;
+                } else if(goodStates.get(state)) {
+                    stateExpressions[state] = one;
+                } else {
+                    ValueType upperBound = std::min<ValueType>(storm::utility::one<ValueType>(), toSafetyValue(stateValues[state]) + precision);
+                    stateVariables[state] = solver->addBoundedContinuousVariable("x" + std::to_string(state), storm::utility::zero<ValueType>(), upperBound);
+                    stateExpressions[state] = stateVariables[state].getExpression();
+                }
+            }
+
+            // Create a binary variable for each candidate choice of the coalition, i.e. for each choice that satisfies the bound locally.
+            // All other choices can not be part of a sound multi-strategy as their values are upper bounds on what the shield can guarantee.
+            std::vector<storm::expressions::Variable> choiceVariables(transitionMatrix.getRowCount());
+            storm::storage::BitVector candidateChoices(transitionMatrix.getRowCount(), false);
+            for(auto state : maybeStates) {
+                boost::optional<ValueType> bound;
+                if(shieldedStates.get(state)) {
+                    bound = computeSafetyBound(state);
+                }
+                std::vector<storm::expressions::Expression> localChoiceVariables;
+                for(uint64_t row = this->rowGroupIndices[state]; row < this->rowGroupIndices[state + 1]; row++) {
+                    std::vector<storm::expressions::Expression> summands;
+                    for(auto const& entry : transitionMatrix.getRow(row)) {
+                        summands.push_back(solver->getConstant(entry.getValue()) * stateExpressions[entry.getColumn()]);
+                    }
+                    storm::expressions::Expression choiceExpression = storm::expressions::sum(summands);
+                    if(!shieldedStates.get(state)) {
+                        // The other players may pick any of their choices.
+                        solver->addConstraint("", stateExpressions[state] <= choiceExpression);
+                    } else if(!bound || toSafetyValue(choiceValues[row]) + precision >= bound.get()) {
+                        candidateChoices.set(row, true);
+                        choiceVariables[row] = solver->addBinaryVariable("y" + std::to_string(row), storm::utility::one<ValueType>());
+                        localChoiceVariables.push_back(choiceVariables[row].getExpression());
+                        solver->addConstraint("", stateExpressions[state] <= choiceExpression + one - choiceVariables[row].getExpression());
+                    }
+                }
+                if(shieldedStates.get(state)) {
+                    // The optimal value of the state is the value of one of its choices, so there has to be a candidate unless the given values are inconsistent.
+                    STORM_LOG_THROW(!localChoiceVariables.empty(), storm::exceptions::InvalidArgumentException, "No choice of state " << state << " satisfies the shielding bound, but its value does. The state and choice values are inconsistent.");
+                    solver->addConstraint("", storm::expressions::sum(localChoiceVariables) >= one);
+                    if(bound) {
+                        solver->addConstraint("", stateExpressions[state] >= solver->getConstant(bound.get() - precision));
+                    }
+                }
+            }
+            solver->update();
+
+            // First check whether allowing all candidates is sound. In this case, this multi-strategy is maximally permissive.
+            solver->push();
+            for(auto row : candidateChoices) {
+                solver->addConstraint("", choiceVariables[row].getExpression() == one);
+            }
+            solver->update();
+            solver->optimize();
+            if(solver->isInfeasible()) {
+                STORM_LOG_INFO("Allowing all locally safe choices is not sound. Solving the MILP for a maximally permissive shield.");
+                solver->pop();
+                solver->update();
+                solver->optimize();
+            }
+            STORM_LOG_THROW(!solver->isInfeasible(), storm::exceptions::UnexpectedException, "No sound permissive shield found. The precision of the computed values might be insufficient.");
+
+            std::vector<ValueType> safetyValues(numberOfStates, storm::utility::zero<ValueType>());
+            for(uint64_t state = 0; state < numberOfStates; state++) {
+                if(goodStates.get(state)) {
+                    safetyValues[state] = storm::utility::one<ValueType>();
+                } else if(maybeStates.get(state)) {
+                    safetyValues[state] = solver->getContinuousValue(stateVariables[state]);
+                }
+            }
+
+            storm::storage::PreScheduler<ValueType> shield(numberOfStates);
+            uint64_t numberOfRemovedChoices = 0;
+            for(uint64_t state = 0; state < numberOfStates; state++) {
+                storm::storage::PreSchedulerChoice<ValueType> enabledChoices;
+                if(shieldedStates.get(state) && this->relevantStates.get(state)) {
+                    for(uint64_t row = this->rowGroupIndices[state]; row < this->rowGroupIndices[state + 1]; row++) {
+                        if(!maybeStates.get(state) || (candidateChoices.get(row) && solver->getBinaryValue(choiceVariables[row]))) {
+                            ValueType choiceValue = storm::utility::zero<ValueType>();
+                            for(auto const& entry : transitionMatrix.getRow(row)) {
+                                choiceValue += entry.getValue() * safetyValues[entry.getColumn()];
+                            }
+                            enabledChoices.addChoice(row - this->rowGroupIndices[state], toSafetyValue(choiceValue));
+                        } else {
+                            numberOfRemovedChoices++;
+                        }
+                    }
+                }
+                shield.setChoice(enabledChoices, state, 0);
+            }
+            STORM_LOG_INFO("Permissive shield blocks " << numberOfRemovedChoices << " choices.");
+            return shield;
+        }
+
+        // Explicitly instantiate appropriate classes
+        template class PermissivePreShield<double, typename storm::storage::SparseMatrix<double>::index_type>;
+#ifdef STORM_HAVE_CARL
+        template class PermissivePreShield<storm::RationalNumber, typename storm::storage::SparseMatrix<storm::RationalNumber>::index_type>;
+#endif
+    }
+}
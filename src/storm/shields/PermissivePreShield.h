@@ -0,0 +1,58 @@
+#pragma once
+
+#include "storm/shields/AbstractShield.h"
+#include "storm/storage/PreScheduler.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace tempest {
+    namespace shields {
+
+        /*!
+         * A pre-shield whose sets of allowed actions are globally consistent: every strategy of the shielded coalition
+         * that only picks allowed actions satisfies the shielding bound in every state that is able to satisfy it, no
+         * matter how the other players behave. The shield is computed for safety objectives, i.e. for keeping the
+         * probability of reaching the bad states low, and is maximally permissive w.r.t. the number of allowed actions.
+         *
+         * The multi-strategy is obtained from a MILP with a binary variable for each choice of the coalition. The choice
+         * values of the preceding value iteration are used to warm-start it: Only choices that satisfy the bound locally
+         * are considered, and if allowing all of them is already sound, the MILP does not need to be solved.
+         */
+        template<typename ValueType, typename IndexType>
+        class PermissivePreShield : public AbstractShield<ValueType, IndexType> {
+        public:
+            /*!
+             * @param transitionMatrix The transition matrix of the game.
+             * @param stateValues The optimal values of the states as computed by value iteration.
+             * @param choiceValues The values of the choices as computed by value iteration.
+             * @param badStates The states that violate the safety objective.
+             * @param goodStates The states from which the safety objective can not be violated anymore.
+             * @param precision The precision of the values. Bounds are relaxed by this precision.
+             *
+             * If the optimization direction is Maximize, the values are the probabilities to stay safe. Otherwise, they are
+             * the probabilities to reach a bad state.
+             */
+            PermissivePreShield(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& stateValues, std::vector<ValueType> const& choiceValues, storm::storage::BitVector const& badStates, storm::storage::BitVector const& goodStates, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates, ValueType const& precision);
+
+            storm::storage::PreScheduler<ValueType> construct();
+
+        private:
+            /*!
+             * Converts the given value to the probability to stay safe (and back).
+             */
+            ValueType toSafetyValue(ValueType const& value) const;
+
+            /*!
+             * Computes the lower bound on the probability to stay safe that the shield guarantees for the given state.
+             * Returns none if the state can not satisfy the shielding bound.
+             */
+            boost::optional<ValueType> computeSafetyBound(uint64_t state) const;
+
+            storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
+            std::vector<ValueType> stateValues;
+            std::vector<ValueType> choiceValues;
+            storm::storage::BitVector badStates;
+            storm::storage::BitVector goodStates;
+            ValueType precision;
+        };
+    }
+}
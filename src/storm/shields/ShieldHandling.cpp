@@ -1,22 +1,109 @@
 #include "ShieldHandling.h"
 
+#include <algorithm>
+#include <cstdio>
+
+#include "storm/models/sparse/Smg.h"
+#include "storm/utility/Statistics.h"
+
 namespace tempest {
     namespace shields {
+        namespace {
+            template<typename ValueType>
+            void recordShieldStatistics(storm::storage::PreScheduler<ValueType> const& shield) {
+                uint64_t shieldedStates = 0;
+                uint64_t allowedActions = 0;
+                for(uint64_t state = 0; state < shield.getNumberOfModelStates(); ++state) {
+                    auto const& choice = shield.getChoice(state);
+                    if(!choice.isEmpty()) {
+                        ++shieldedStates;
+                        allowedActions += choice.getChoiceMap().size();
+                    }
+                }
+                storm::utility::statistics::setCounter("shielded-states", shieldedStates);
+                storm::utility::statistics::setCounter("allowed-actions", allowedActions);
+                storm::utility::statistics::setCounter("allowed-actions-per-state", shieldedStates == 0 ? 0.0 : static_cast<double>(allowedActions) / shieldedStates);
+            }
+
+            template<typename ValueType>
+            void recordShieldStatistics(storm::storage::PostScheduler<ValueType> const& shield) {
+                uint64_t shieldedStates = 0;
+                uint64_t correctedActions = 0;
+                for(uint64_t state = 0; state < shield.getNumberOfModelStates(); ++state) {
+                    auto const& choice = shield.getChoice(state);
+                    if(!choice.isEmpty()) {
+                        ++shieldedStates;
+                        for(auto const& choicePair : choice.getChoiceMap()) {
+                            if(std::get<0>(choicePair) != std::get<1>(choicePair)) {
+                                ++correctedActions;
+                            }
+                        }
+                    }
+                }
+                storm::utility::statistics::setCounter("shielded-states", shieldedStates);
+                storm::utility::statistics::setCounter("corrected-actions", correctedActions);
+            }
+
+            // Constructs the given shield and records the time and the size of the result.
+            template<typename ShieldType>
+            auto constructShield(ShieldType& shield) -> decltype(shield.construct()) {
+                storm::utility::statistics::ScopedTimer constructionTimer("shield-construction");
+                auto result = shield.construct();
+                if(storm::utility::statistics::isEnabled()) {
+                    recordShieldStatistics(result);
+                }
+                return result;
+            }
+
+            // Exports the given shield. Shields computed on a bisimulation quotient are exported for the original game.
+            template<typename SchedulerType, typename ValueType>
+            void exportShield(SchedulerType const& shield, std::ofstream& stream, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model) {
+                storm::utility::statistics::ScopedTimer exportTimer("shield-export");
+                if(model->isOfType(storm::models::ModelType::Smg)) {
+                    auto smg = model->template as<storm::models::sparse::Smg<ValueType>>();
+                    if(smg->hasQuotientInformation()) {
+                        auto const& quotientInformation = smg->getQuotientInformation();
+                        auto originalModel = std::const_pointer_cast<storm::models::sparse::Smg<ValueType>>(quotientInformation.originalModel);
+                        auto originalShield = mapQuotientShieldToOriginalModel(shield, originalModel->getTransitionMatrix().getRowGroupIndices(), model->getTransitionMatrix().getRowGroupIndices(), quotientInformation.stateMapping, quotientInformation.choiceMapping);
+                        originalShield.printToStream(stream, shieldingExpression, originalModel);
+                        return;
+                    }
+                }
+                shield.printToStream(stream, shieldingExpression, model);
+            }
+
+            // The shield file format has no room for annotations, so approximate shields are marked by a separate file.
+            void markApproximation(std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, bool approximate) {
+                std::string markerFilename = shieldFilename(shieldingExpression) + ".approximate";
+                if(approximate) {
+                    STORM_LOG_WARN("The shield is computed from values of a value iteration that was stopped before convergence and is thus only approximate. This is noted in '" << markerFilename << "'.");
+                    std::ofstream stream;
+                    storm::utility::openFile(markerFilename, stream);
+                    stream << "Approximate shield: value iteration was stopped before convergence." << std::endl;
+                    storm::utility::closeFile(stream);
+                } else {
+                    // Remove the marker of a previous run.
+                    std::remove(markerFilename.c_str());
+                }
+            }
+        }
+
         std::string shieldFilename(std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression) {
             return shieldingExpression->getFilename() + ".shield";
         }
 
         template<typename ValueType, typename IndexType>
-        void createShield(std::shared_ptr<storm::models::sparse::Model<ValueType>> model, std::vector<ValueType> const& choiceValues, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates) {
+        void createShield(std::shared_ptr<storm::models::sparse::Model<ValueType>> model, std::vector<ValueType> const& choiceValues, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates, bool approximate) {
             std::ofstream stream;
             storm::utility::openFile(shieldFilename(shieldingExpression), stream);
+            markApproximation(shieldingExpression, approximate);
             if(coalitionStates.is_initialized()) coalitionStates.get().complement();
             if(shieldingExpression->isPreSafetyShield()) {
                 PreShield<ValueType, IndexType> shield(model->getTransitionMatrix().getRowGroupIndices(), choiceValues, shieldingExpression, optimizationDirection, relevantStates, coalitionStates);
-                shield.construct().printToStream(stream, shieldingExpression, model);
+                exportShield(constructShield(shield), stream, shieldingExpression, model);
             } else if(shieldingExpression->isPostSafetyShield()) {
                 PostShield<ValueType, IndexType> shield(model->getTransitionMatrix().getRowGroupIndices(), choiceValues, shieldingExpression, optimizationDirection, relevantStates, coalitionStates);
-                shield.construct().printToStream(stream, shieldingExpression, model);
+                exportShield(constructShield(shield), stream, shieldingExpression, model);
             } else {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Unknown Shielding Type: " + shieldingExpression->typeToString());
                 storm::utility::closeFile(stream);
@@ -24,6 +111,18 @@ namespace tempest {
             storm::utility::closeFile(stream);
         }
 
+        template<typename ValueType, typename IndexType>
+        void createPermissiveShield(std::shared_ptr<storm::models::sparse::Model<ValueType>> model, std::vector<ValueType> const& stateValues, std::vector<ValueType> const& choiceValues, storm::storage::BitVector const& badStates, storm::storage::BitVector const& goodStates, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates, ValueType const& precision, bool approximate) {
+            STORM_LOG_THROW(shieldingExpression->isPermissivePreShield(), storm::exceptions::InvalidArgumentException, "Unknown Shielding Type: " + shieldingExpression->typeToString());
+            std::ofstream stream;
+            storm::utility::openFile(shieldFilename(shieldingExpression), stream);
+            markApproximation(shieldingExpression, approximate);
+            if(coalitionStates.is_initialized()) coalitionStates.get().complement();
+            PermissivePreShield<ValueType, IndexType> shield(model->getTransitionMatrix(), stateValues, choiceValues, badStates, goodStates, shieldingExpression, optimizationDirection, relevantStates, coalitionStates, precision);
+            exportShield(constructShield(shield), stream, shieldingExpression, model);
+            storm::utility::closeFile(stream);
+        }
+
         template<typename ValueType, typename IndexType>
         void createQuantitativeShield(std::shared_ptr<storm::models::sparse::Model<ValueType>> model, std::vector<ValueType> const& choiceValues, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates) {
             std::ofstream stream;
@@ -31,21 +130,87 @@ namespace tempest {
             if(coalitionStates.is_initialized()) coalitionStates.get().complement(); // TODO CHECK THIS!!!
             if(shieldingExpression->isOptimalPreShield()) {
                 PreShield<ValueType, IndexType> shield(model->getTransitionMatrix().getRowGroupIndices(), choiceValues, shieldingExpression, optimizationDirection, relevantStates, coalitionStates);
-                shield.construct().printToStream(stream, shieldingExpression, model);
+                exportShield(constructShield(shield), stream, shieldingExpression, model);
             } else if(shieldingExpression->isOptimalPostShield()) {
                 PostShield<ValueType, IndexType> shield(model->getTransitionMatrix().getRowGroupIndices(), choiceValues, shieldingExpression, optimizationDirection, relevantStates, coalitionStates);
-                shield.construct().printToStream(stream, shieldingExpression, model);
+                exportShield(constructShield(shield), stream, shieldingExpression, model);
             } else {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Unknown Shielding Type: " + shieldingExpression->typeToString());
                 storm::utility::closeFile(stream);
             }
             storm::utility::closeFile(stream);
         }
+        template<typename ValueType, typename IndexType>
+        storm::storage::PreScheduler<ValueType> mapQuotientShieldToOriginalModel(storm::storage::PreScheduler<ValueType> const& quotientShield, std::vector<IndexType> const& originalRowGroupIndices, std::vector<IndexType> const& quotientRowGroupIndices, std::vector<uint_fast64_t> const& quotientStateMapping, std::vector<uint_fast64_t> const& quotientChoiceMapping) {
+            STORM_LOG_THROW(quotientStateMapping.size() == originalRowGroupIndices.size() - 1, storm::exceptions::InvalidArgumentException, "The quotient state mapping does not match the original model.");
+            storm::storage::PreScheduler<ValueType> shield(originalRowGroupIndices.size() - 1);
+            for(uint_fast64_t state = 0; state < originalRowGroupIndices.size() - 1; state++) {
+                uint_fast64_t quotientState = quotientStateMapping[state];
+                auto const& quotientChoices = quotientShield.getChoice(quotientState);
+                storm::storage::PreSchedulerChoice<ValueType> enabledChoices;
+                if(!quotientChoices.isEmpty()) {
+                    for(IndexType choice = 0; choice < originalRowGroupIndices[state + 1] - originalRowGroupIndices[state]; choice++) {
+                        IndexType quotientChoice = quotientChoiceMapping[originalRowGroupIndices[state] + choice] - quotientRowGroupIndices[quotientState];
+                        for(auto const& choiceValuePair : quotientChoices.getChoiceMap()) {
+                            if(std::get<1>(choiceValuePair) == quotientChoice) {
+                                enabledChoices.addChoice(choice, std::get<0>(choiceValuePair));
+                                break;
+                            }
+                        }
+                    }
+                }
+                shield.setChoice(enabledChoices, state, 0);
+            }
+            return shield;
+        }
+
+        template<typename ValueType, typename IndexType>
+        storm::storage::PostScheduler<ValueType> mapQuotientShieldToOriginalModel(storm::storage::PostScheduler<ValueType> const& quotientShield, std::vector<IndexType> const& originalRowGroupIndices, std::vector<IndexType> const& quotientRowGroupIndices, std::vector<uint_fast64_t> const& quotientStateMapping, std::vector<uint_fast64_t> const& quotientChoiceMapping) {
+            STORM_LOG_THROW(quotientStateMapping.size() == originalRowGroupIndices.size() - 1, storm::exceptions::InvalidArgumentException, "The quotient state mapping does not match the original model.");
+            std::vector<IndexType> rowGroupSizes(originalRowGroupIndices.size() - 1);
+            for(uint_fast64_t state = 0; state < rowGroupSizes.size(); state++) {
+                rowGroupSizes[state] = originalRowGroupIndices[state + 1] - originalRowGroupIndices[state];
+            }
+            storm::storage::PostScheduler<ValueType> shield(rowGroupSizes.size(), rowGroupSizes);
+            for(uint_fast64_t state = 0; state < rowGroupSizes.size(); state++) {
+                uint_fast64_t quotientState = quotientStateMapping[state];
+                auto const& quotientChoices = quotientShield.getChoice(quotientState);
+                storm::storage::PostSchedulerChoice<ValueType> choiceMapping;
+                if(!quotientChoices.isEmpty()) {
+                    // The quotient choice that each original choice was merged into.
+                    std::vector<IndexType> quotientChoiceOfChoice(rowGroupSizes[state]);
+                    for(IndexType choice = 0; choice < rowGroupSizes[state]; choice++) {
+                        quotientChoiceOfChoice[choice] = quotientChoiceMapping[originalRowGroupIndices[state] + choice] - quotientRowGroupIndices[quotientState];
+                    }
+                    for(IndexType choice = 0; choice < rowGroupSizes[state]; choice++) {
+                        IndexType correctedQuotientChoice = quotientChoiceOfChoice[choice];
+                        for(auto const& choicePair : quotientChoices.getChoiceMap()) {
+                            if(std::get<0>(choicePair) == quotientChoiceOfChoice[choice]) {
+                                correctedQuotientChoice = std::get<1>(choicePair);
+                                break;
+                            }
+                        }
+                        auto correctedChoiceIt = std::find(quotientChoiceOfChoice.begin(), quotientChoiceOfChoice.end(), correctedQuotientChoice);
+                        STORM_LOG_ASSERT(correctedChoiceIt != quotientChoiceOfChoice.end(), "No choice of state " << state << " corresponds to quotient choice " << correctedQuotientChoice << ".");
+                        choiceMapping.addChoice(choice, std::distance(quotientChoiceOfChoice.begin(), correctedChoiceIt));
+                    }
+                }
+                shield.setChoice(choiceMapping, state, 0);
+            }
+            return shield;
+        }
+
         // Explicitly instantiate appropriate
-        template void createShield<double, typename storm::storage::SparseMatrix<double>::index_type>(std::shared_ptr<storm::models::sparse::Model<double>> model, std::vector<double> const& choiceValues, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates);
+        template void createShield<double, typename storm::storage::SparseMatrix<double>::index_type>(std::shared_ptr<storm::models::sparse::Model<double>> model, std::vector<double> const& choiceValues, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates, bool approximate);
+        template void createPermissiveShield<double, typename storm::storage::SparseMatrix<double>::index_type>(std::shared_ptr<storm::models::sparse::Model<double>> model, std::vector<double> const& stateValues, std::vector<double> const& choiceValues, storm::storage::BitVector const& badStates, storm::storage::BitVector const& goodStates, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates, double const& precision, bool approximate);
         template void createQuantitativeShield<double, typename storm::storage::SparseMatrix<double>::index_type>(std::shared_ptr<storm::models::sparse::Model<double>> model, std::vector<double> const& choiceValues, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates);
+        template storm::storage::PreScheduler<double> mapQuotientShieldToOriginalModel<double, typename storm::storage::SparseMatrix<double>::index_type>(storm::storage::PreScheduler<double> const& quotientShield, std::vector<typename storm::storage::SparseMatrix<double>::index_type> const& originalRowGroupIndices, std::vector<typename storm::storage::SparseMatrix<double>::index_type> const& quotientRowGroupIndices, std::vector<uint_fast64_t> const& quotientStateMapping, std::vector<uint_fast64_t> const& quotientChoiceMapping);
+        template storm::storage::PostScheduler<double> mapQuotientShieldToOriginalModel<double, typename storm::storage::SparseMatrix<double>::index_type>(storm::storage::PostScheduler<double> const& quotientShield, std::vector<typename storm::storage::SparseMatrix<double>::index_type> const& originalRowGroupIndices, std::vector<typename storm::storage::SparseMatrix<double>::index_type> const& quotientRowGroupIndices, std::vector<uint_fast64_t> const& quotientStateMapping, std::vector<uint_fast64_t> const& quotientChoiceMapping);
 #ifdef STORM_HAVE_CARL
-        template void createShield<storm::RationalNumber, typename storm::storage::SparseMatrix<storm::RationalNumber>::index_type>(std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> model, std::vector<storm::RationalNumber> const& choiceValues, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates);
+        template storm::storage::PreScheduler<storm::RationalNumber> mapQuotientShieldToOriginalModel<storm::RationalNumber, typename storm::storage::SparseMatrix<storm::RationalNumber>::index_type>(storm::storage::PreScheduler<storm::RationalNumber> const& quotientShield, std::vector<typename storm::storage::SparseMatrix<storm::RationalNumber>::index_type> const& originalRowGroupIndices, std::vector<typename storm::storage::SparseMatrix<storm::RationalNumber>::index_type> const& quotientRowGroupIndices, std::vector<uint_fast64_t> const& quotientStateMapping, std::vector<uint_fast64_t> const& quotientChoiceMapping);
+        template storm::storage::PostScheduler<storm::RationalNumber> mapQuotientShieldToOriginalModel<storm::RationalNumber, typename storm::storage::SparseMatrix<storm::RationalNumber>::index_type>(storm::storage::PostScheduler<storm::RationalNumber> const& quotientShield, std::vector<typename storm::storage::SparseMatrix<storm::RationalNumber>::index_type> const& originalRowGroupIndices, std::vector<typename storm::storage::SparseMatrix<storm::RationalNumber>::index_type> const& quotientRowGroupIndices, std::vector<uint_fast64_t> const& quotientStateMapping, std::vector<uint_fast64_t> const& quotientChoiceMapping);
+        template void createShield<storm::RationalNumber, typename storm::storage::SparseMatrix<storm::RationalNumber>::index_type>(std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> model, std::vector<storm::RationalNumber> const& choiceValues, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates, bool approximate);
+        template void createPermissiveShield<storm::RationalNumber, typename storm::storage::SparseMatrix<storm::RationalNumber>::index_type>(std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> model, std::vector<storm::RationalNumber> const& stateValues, std::vector<storm::RationalNumber> const& choiceValues, storm::storage::BitVector const& badStates, storm::storage::BitVector const& goodStates, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates, storm::RationalNumber const& precision, bool approximate);
         template void createQuantitativeShield<storm::RationalNumber, typename storm::storage::SparseMatrix<storm::RationalNumber>::index_type>(std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> model, std::vector<storm::RationalNumber> const& choiceValues, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates);
 #endif
     }
@@ -13,6 +13,7 @@
 #include "storm/shields/PreShield.h"
 #include "storm/shields/PostShield.h"
 #include "storm/shields/OptimalShield.h"
+#include "storm/shields/PermissivePreShield.h"
 
 #include "storm/io/file.h"
 #include "storm/utility/macros.h"
@@ -23,8 +24,47 @@ namespace tempest {
     namespace shields {
         std::string shieldFilename(std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression);
 
+        /*!
+         * Creates a pre- or post-shield for a safety objective and writes it to the shield file.
+         *
+         * @param approximate Whether the choice values stem from a value iteration that was stopped before convergence.
+         * For such shields, a warning is logged and a file named like the shield file with the suffix '.approximate' is written.
+         */
         template<typename ValueType, typename IndexType = storm::storage::sparse::state_type>
-        void createShield(std::shared_ptr<storm::models::sparse::Model<ValueType>> model, std::vector<ValueType> const& choiceValues, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates);
+        void createShield(std::shared_ptr<storm::models::sparse::Model<ValueType>> model, std::vector<ValueType> const& choiceValues, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates, bool approximate = false);
+
+        /*!
+         * Creates a permissive pre-shield for a safety objective and writes it to the shield file.
+         *
+         * @param stateValues The optimal values of the states.
+         * @param choiceValues The values of the choices.
+         * @param badStates The states that violate the safety objective.
+         * @param goodStates The states from which the safety objective can not be violated anymore.
+         * @param precision The precision of the given values.
+         * @param approximate Whether the given values stem from a value iteration that was stopped before convergence.
+         */
+        template<typename ValueType, typename IndexType = storm::storage::sparse::state_type>
+        void createPermissiveShield(std::shared_ptr<storm::models::sparse::Model<ValueType>> model, std::vector<ValueType> const& stateValues, std::vector<ValueType> const& choiceValues, storm::storage::BitVector const& badStates, storm::storage::BitVector const& goodStates, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates, ValueType const& precision, bool approximate = false);
+
+        /*!
+         * Maps a pre-shield computed on a bisimulation quotient back onto the original model. A choice of an original
+         * state is allowed iff the quotient choice it was merged into is allowed.
+         *
+         * @param quotientShield The shield computed on the quotient.
+         * @param originalRowGroupIndices The row group indices of the original model.
+         * @param quotientRowGroupIndices The row group indices of the quotient.
+         * @param quotientStateMapping Maps each original state to its quotient state.
+         * @param quotientChoiceMapping Maps each original choice (row) to its quotient choice (row).
+         */
+        template<typename ValueType, typename IndexType = storm::storage::sparse::state_type>
+        storm::storage::PreScheduler<ValueType> mapQuotientShieldToOriginalModel(storm::storage::PreScheduler<ValueType> const& quotientShield, std::vector<IndexType> const& originalRowGroupIndices, std::vector<IndexType> const& quotientRowGroupIndices, std::vector<uint_fast64_t> const& quotientStateMapping, std::vector<uint_fast64_t> const& quotientChoiceMapping);
+
+        /*!
+         * Maps a post-shield computed on a bisimulation quotient back onto the original model. A corrected quotient
+         * choice is replaced by the first choice of the original state that was merged into it.
+         */
+        template<typename ValueType, typename IndexType = storm::storage::sparse::state_type>
+        storm::storage::PostScheduler<ValueType> mapQuotientShieldToOriginalModel(storm::storage::PostScheduler<ValueType> const& quotientShield, std::vector<IndexType> const& originalRowGroupIndices, std::vector<IndexType> const& quotientRowGroupIndices, std::vector<uint_fast64_t> const& quotientStateMapping, std::vector<uint_fast64_t> const& quotientChoiceMapping);
 
         template<typename ValueType, typename IndexType = storm::storage::sparse::state_type>
         void createQuantitativeShield(std::shared_ptr<storm::models::sparse::Model<ValueType>> model, std::vector<ValueType> const& choiceValues, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates);
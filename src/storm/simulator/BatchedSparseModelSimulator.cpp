@@ -0,0 +1,345 @@
+#include "storm/simulator/BatchedSparseModelSimulator.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace simulator {
+
+        void AliasTables::addDistribution(std::vector<double> const& weights) {
+            STORM_LOG_ASSERT(!weights.empty(), "Cannot sample from an empty distribution.");
+            uint64_t const size = weights.size();
+            uint64_t const offset = offsets.back();
+            thresholds.resize(offset + size);
+            aliases.resize(offset + size);
+
+            double total = 0.0;
+            for (auto const& weight : weights) {
+                total += weight;
+            }
+            STORM_LOG_THROW(total > 0.0, storm::exceptions::InvalidArgumentException, "Cannot sample from a distribution without positive weights.");
+
+            // Vose's method: Entries with less than the average weight are filled up with the weight of larger entries.
+            std::vector<double> scaled(size);
+            std::vector<uint64_t> small, large;
+            for (uint64_t entry = 0; entry < size; ++entry) {
+                scaled[entry] = weights[entry] * static_cast<double>(size) / total;
+                if (scaled[entry] < 1.0) {
+                    small.push_back(entry);
+                } else {
+                    large.push_back(entry);
+                }
+            }
+            auto toThreshold = [] (double probability) {
+                return static_cast<uint64_t>(std::min(std::round(probability * 4294967296.0), 4294967296.0));
+            };
+            while (!small.empty() && !large.empty()) {
+                uint64_t smallEntry = small.back();
+                small.pop_back();
+                uint64_t largeEntry = large.back();
+                thresholds[offset + smallEntry] = toThreshold(scaled[smallEntry]);
+                aliases[offset + smallEntry] = static_cast<uint32_t>(largeEntry);
+                scaled[largeEntry] -= 1.0 - scaled[smallEntry];
+                if (scaled[largeEntry] < 1.0) {
+                    large.pop_back();
+                    small.push_back(largeEntry);
+                }
+            }
+            // The remaining entries have the average weight (up to rounding errors).
+            for (auto const& entry : large) {
+                thresholds[offset + entry] = toThreshold(1.0);
+                aliases[offset + entry] = static_cast<uint32_t>(entry);
+            }
+            for (auto const& entry : small) {
+                thresholds[offset + entry] = toThreshold(1.0);
+                aliases[offset + entry] = static_cast<uint32_t>(entry);
+            }
+            offsets.push_back(offset + size);
+        }
+
+        uint64_t AliasTables::getNumberOfDistributions() const {
+            return offsets.size() - 1;
+        }
+
+        template<typename ValueType>
+        void BatchedSimulationResult<ValueType>::add(BatchedSimulationResult<ValueType> const& other) {
+            numberOfPaths += other.numberOfPaths;
+            terminatedPaths += other.terminatedPaths;
+            totalSteps += other.totalSteps;
+            filteredChoices += other.filteredChoices;
+            changedChoices += other.changedChoices;
+            rewardSums.resize(other.rewardSums.size(), storm::utility::zero<ValueType>());
+            rewardSquareSums.resize(other.rewardSquareSums.size(), storm::utility::zero<ValueType>());
+            labelHits.resize(other.labelHits.size(), 0);
+            for (uint64_t index = 0; index < other.rewardSums.size(); ++index) {
+                rewardSums[index] += other.rewardSums[index];
+                rewardSquareSums[index] += other.rewardSquareSums[index];
+            }
+            for (uint64_t index = 0; index < other.labelHits.size(); ++index) {
+                labelHits[index] += other.labelHits[index];
+            }
+        }
+
+        template<typename ValueType>
+        ValueType BatchedSimulationResult<ValueType>::getAverageReward(uint64_t rewardModelIndex) const {
+            STORM_LOG_THROW(numberOfPaths > 0, storm::exceptions::InvalidArgumentException, "No paths were simulated.");
+            return rewardSums[rewardModelIndex] / storm::utility::convertNumber<ValueType>(numberOfPaths);
+        }
+
+        template<typename ValueType>
+        double BatchedSimulationResult<ValueType>::getLabelFrequency(uint64_t labelIndex) const {
+            STORM_LOG_THROW(numberOfPaths > 0, storm::exceptions::InvalidArgumentException, "No paths were simulated.");
+            return static_cast<double>(labelHits[labelIndex]) / static_cast<double>(numberOfPaths);
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        BatchedSparseModelSimulator<ValueType, RewardModelType>::BatchedSparseModelSimulator(storm::models::sparse::Model<ValueType, RewardModelType> const& model) : model(model), initialState(*model.getInitialStates().begin()), generator(0), batchSize(1024), filteredStates(model.getNumberOfStates(), false), terminalStates(model.getNumberOfStates(), false) {
+            STORM_LOG_WARN_COND(model.getInitialStates().getNumberOfSetBits() == 1, "The model has multiple initial states. This simulator assumes it starts from the initial state with the lowest index.");
+            auto const& transitionMatrix = model.getTransitionMatrix();
+
+            successors.reserve(transitionMatrix.getEntryCount());
+            std::vector<double> weights;
+            for (uint64_t row = 0; row < transitionMatrix.getRowCount(); ++row) {
+                weights.clear();
+                for (auto const& entry : transitionMatrix.getRow(row)) {
+                    weights.push_back(storm::utility::convertNumber<double>(entry.getValue()));
+                    successors.push_back(entry.getColumn());
+                }
+                successorTables.addDistribution(weights);
+            }
+
+            for (auto const& rewardModel : model.getRewardModels()) {
+                STORM_LOG_THROW(!rewardModel.second.hasTransitionRewards(), storm::exceptions::NotSupportedException, "The batched simulator does not support transition rewards.");
+                stateRewards.push_back(rewardModel.second.hasStateRewards() ? rewardModel.second.getStateRewardVector() : std::vector<ValueType>(model.getNumberOfStates(), storm::utility::zero<ValueType>()));
+                stateActionRewards.push_back(rewardModel.second.hasStateActionRewards() ? rewardModel.second.getStateActionRewardVector() : std::vector<ValueType>(transitionMatrix.getRowCount(), storm::utility::zero<ValueType>()));
+            }
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void BatchedSparseModelSimulator<ValueType, RewardModelType>::setSeed(uint64_t seed) {
+            generator = storm::utility::PhiloxGenerator(seed);
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void BatchedSparseModelSimulator<ValueType, RewardModelType>::setBatchSize(uint64_t newBatchSize) {
+            STORM_LOG_THROW(newBatchSize > 0, storm::exceptions::InvalidArgumentException, "The batch size must be positive.");
+            batchSize = newBatchSize;
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void BatchedSparseModelSimulator<ValueType, RewardModelType>::setScheduler(storm::storage::Scheduler<ValueType> const& scheduler) {
+            STORM_LOG_THROW(scheduler.isMemorylessScheduler(), storm::exceptions::NotSupportedException, "The batched simulator only supports memoryless schedulers.");
+            auto const& rowGroupIndices = model.getTransitionMatrix().getRowGroupIndices();
+            schedulerTables = AliasTables();
+            std::vector<double> weights;
+            for (uint64_t state = 0; state < model.getNumberOfStates(); ++state) {
+                uint64_t numberOfChoices = rowGroupIndices[state + 1] - rowGroupIndices[state];
+                auto const& choice = scheduler.getChoice(state);
+                if (numberOfChoices == 0) {
+                    // Deadlock states get a dummy distribution, they are never left.
+                    weights.assign(1, 1.0);
+                } else if (choice.isDefined()) {
+                    weights.assign(numberOfChoices, 0.0);
+                    for (auto const& entry : choice.getChoiceAsDistribution()) {
+                        weights[entry.first] = storm::utility::convertNumber<double>(entry.second);
+                    }
+                } else {
+                    weights.assign(numberOfChoices, 1.0);
+                }
+                schedulerTables->addDistribution(weights);
+            }
+            policy = nullptr;
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void BatchedSparseModelSimulator<ValueType, RewardModelType>::setPolicy(Policy const& newPolicy) {
+            policy = newPolicy;
+            schedulerTables = boost::none;
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void BatchedSparseModelSimulator<ValueType, RewardModelType>::setChoiceFilter(ChoiceFilter const& filter, storm::storage::BitVector const& newFilteredStates) {
+            STORM_LOG_THROW(newFilteredStates.size() == model.getNumberOfStates(), storm::exceptions::InvalidArgumentException, "The number of filtered states does not match the number of states.");
+            choiceFilter = filter;
+            filteredStates = newFilteredStates;
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void BatchedSparseModelSimulator<ValueType, RewardModelType>::clearChoiceFilter() {
+            choiceFilter = nullptr;
+            filteredStates.clear();
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void BatchedSparseModelSimulator<ValueType, RewardModelType>::setTerminalStates(storm::storage::BitVector const& newTerminalStates) {
+            STORM_LOG_THROW(newTerminalStates.size() == model.getNumberOfStates(), storm::exceptions::InvalidArgumentException, "The number of terminal states does not match the number of states.");
+            terminalStates = newTerminalStates;
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void BatchedSparseModelSimulator<ValueType, RewardModelType>::setObservedLabels(std::vector<std::string> const& labels) {
+            observedLabelStates.clear();
+            for (auto const& label : labels) {
+                STORM_LOG_THROW(model.getStateLabeling().containsLabel(label), storm::exceptions::InvalidArgumentException, "The model has no label '" << label << "'.");
+                observedLabelStates.push_back(model.getStates(label));
+            }
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void BatchedSparseModelSimulator<ValueType, RewardModelType>::setObservedStates(std::vector<storm::storage::BitVector> const& states) {
+            for (auto const& observedStates : states) {
+                STORM_LOG_THROW(observedStates.size() == model.getNumberOfStates(), storm::exceptions::InvalidArgumentException, "The number of observed states does not match the number of states.");
+            }
+            observedLabelStates = states;
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        BatchedSimulationResult<ValueType> BatchedSparseModelSimulator<ValueType, RewardModelType>::simulate(uint64_t numberOfPaths, uint64_t maximalSteps) const {
+            uint64_t numberOfBatches = (numberOfPaths + batchSize - 1) / batchSize;
+            std::vector<BatchedSimulationResult<ValueType>> batchResults(numberOfBatches);
+            auto simulateBatches = [&] (uint64_t firstBatch, uint64_t lastBatch) {
+                for (uint64_t batch = firstBatch; batch < lastBatch; ++batch) {
+                    uint64_t firstPath = batch * batchSize;
+                    batchResults[batch] = simulateBatch(firstPath, std::min(batchSize, numberOfPaths - firstPath), maximalSteps);
+                }
+            };
+
+#ifdef STORM_HAVE_INTELTBB
+            if (numberOfBatches > 1 && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfBatches), [&] (tbb::blocked_range<uint64_t> const& range) {
+                    simulateBatches(range.begin(), range.end());
+                });
+            } else {
+                simulateBatches(0, numberOfBatches);
+            }
+#else
+            simulateBatches(0, numberOfBatches);
+#endif
+
+            // Combine the results in the order of the batches, so the sums do not depend on the scheduling of the threads.
+            BatchedSimulationResult<ValueType> result;
+            result.rewardSums.assign(stateRewards.size(), storm::utility::zero<ValueType>());
+            result.rewardSquareSums.assign(stateRewards.size(), storm::utility::zero<ValueType>());
+            result.labelHits.assign(observedLabelStates.size(), 0);
+            for (auto const& batchResult : batchResults) {
+                result.add(batchResult);
+            }
+            return result;
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        BatchedSimulationResult<ValueType> BatchedSparseModelSimulator<ValueType, RewardModelType>::simulateBatch(uint64_t firstPath, uint64_t numberOfPaths, uint64_t maximalSteps) const {
+            auto const& rowGroupIndices = model.getTransitionMatrix().getRowGroupIndices();
+            uint64_t const numberOfRewardModels = stateRewards.size();
+            uint64_t const numberOfLabels = observedLabelStates.size();
+
+            BatchedSimulationResult<ValueType> result;
+            result.numberOfPaths = numberOfPaths;
+
+            // The state of the paths, stored as one array per component.
+            std::vector<uint64_t> states(numberOfPaths, initialState);
+            std::vector<uint8_t> active(numberOfPaths, 1);
+            std::vector<ValueType> rewards(numberOfRewardModels * numberOfPaths, storm::utility::zero<ValueType>());
+            std::vector<uint8_t> visited(numberOfLabels * numberOfPaths, 0);
+
+            auto isFinal = [&] (uint64_t state) {
+                return terminalStates.get(state) || rowGroupIndices[state] == rowGroupIndices[state + 1];
+            };
+            auto observe = [&] (uint64_t path) {
+                for (uint64_t label = 0; label < numberOfLabels; ++label) {
+                    if (observedLabelStates[label].get(states[path])) {
+                        visited[label * numberOfPaths + path] = 1;
+                    }
+                }
+            };
+
+            uint64_t activePaths = numberOfPaths;
+            bool initialStateIsFinal = isFinal(initialState);
+            for (uint64_t path = 0; path < numberOfPaths; ++path) {
+                observe(path);
+                if (initialStateIsFinal) {
+                    active[path] = 0;
+                }
+            }
+            if (initialStateIsFinal) {
+                activePaths = 0;
+                result.terminatedPaths = numberOfPaths;
+            }
+
+            for (uint64_t step = 0; step < maximalSteps && activePaths > 0; ++step) {
+                for (uint64_t path = 0; path < numberOfPaths; ++path) {
+                    if (!active[path]) {
+                        continue;
+                    }
+                    std::array<uint64_t, 2> randomBits = generator.random(firstPath + path, step);
+                    uint64_t state = states[path];
+                    uint64_t numberOfChoices = rowGroupIndices[state + 1] - rowGroupIndices[state];
+                    uint64_t action;
+                    if (schedulerTables) {
+                        action = schedulerTables->sample(state, randomBits[0]) - schedulerTables->getOffset(state);
+                    } else if (policy) {
+                        action = policy(state, numberOfChoices, randomBits[0]);
+                        STORM_LOG_THROW(action < numberOfChoices, storm::exceptions::InvalidArgumentException, "The policy selected choice " << action << " in state " << state << ", which only has " << numberOfChoices << " choices.");
+                    } else {
+                        action = ((randomBits[0] & 0xFFFFFFFFull) * numberOfChoices) >> 32;
+                    }
+                    if (choiceFilter && filteredStates.get(state)) {
+                        // The filter draws from a separate part of the stream of the path, so the remaining random
+                        // numbers do not depend on whether a filter is set.
+                        uint64_t filteredAction = choiceFilter(state, action, generator.random(firstPath + path, step | (1ull << 63))[0]);
+                        STORM_LOG_ASSERT(filteredAction < numberOfChoices, "The choice filter selected an invalid choice.");
+                        ++result.filteredChoices;
+                        if (filteredAction != action) {
+                            ++result.changedChoices;
+                            action = filteredAction;
+                        }
+                    }
+                    uint64_t row = rowGroupIndices[state] + action;
+                    for (uint64_t rewardModel = 0; rewardModel < numberOfRewardModels; ++rewardModel) {
+                        rewards[rewardModel * numberOfPaths + path] += stateRewards[rewardModel][state] + stateActionRewards[rewardModel][row];
+                    }
+
+                    state = successors[successorTables.sample(row, randomBits[1])];
+                    states[path] = state;
+                    ++result.totalSteps;
+                    observe(path);
+                    if (isFinal(state)) {
+                        active[path] = 0;
+                        ++result.terminatedPaths;
+                        --activePaths;
+                    }
+                }
+            }
+
+            result.rewardSums.assign(numberOfRewardModels, storm::utility::zero<ValueType>());
+            result.rewardSquareSums.assign(numberOfRewardModels, storm::utility::zero<ValueType>());
+            for (uint64_t rewardModel = 0; rewardModel < numberOfRewardModels; ++rewardModel) {
+                for (uint64_t path = 0; path < numberOfPaths; ++path) {
+                    ValueType const& reward = rewards[rewardModel * numberOfPaths + path];
+                    result.rewardSums[rewardModel] += reward;
+                    result.rewardSquareSums[rewardModel] += reward * reward;
+                }
+            }
+            result.labelHits.assign(numberOfLabels, 0);
+            for (uint64_t label = 0; label < numberOfLabels; ++label) {
+                for (uint64_t path = 0; path < numberOfPaths; ++path) {
+                    result.labelHits[label] += visited[label * numberOfPaths + path];
+                }
+            }
+            return result;
+        }
+
+        template struct BatchedSimulationResult<double>;
+        template class BatchedSparseModelSimulator<double>;
+
+    }
+}
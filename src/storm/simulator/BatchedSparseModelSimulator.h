@@ -0,0 +1,192 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/Scheduler.h"
+#include "storm/utility/random.h"
+
+namespace storm {
+    namespace simulator {
+
+        /*!
+         * Walker alias tables for a sequence of discrete distributions, e.g. one for each row of a transition matrix.
+         * Sampling from a distribution then takes constant time instead of a linear walk over its support.
+         */
+        class AliasTables {
+        public:
+            /*!
+             * Adds the table for the distribution with the given (not necessarily normalized) weights.
+             */
+            void addDistribution(std::vector<double> const& weights);
+
+            /*!
+             * Samples an entry of the given distribution.
+             *
+             * @param distribution The index of the distribution.
+             * @param randomBits 64 uniformly distributed random bits.
+             * @return The index of the sampled entry among the entries of all distributions (see getOffset).
+             */
+            uint64_t sample(uint64_t distribution, uint64_t randomBits) const {
+                uint64_t offset = offsets[distribution];
+                uint64_t size = offsets[distribution + 1] - offset;
+                uint64_t column = ((randomBits & 0xFFFFFFFFull) * size) >> 32;
+                return offset + ((randomBits >> 32) < thresholds[offset + column] ? column : aliases[offset + column]);
+            }
+
+            /*!
+             * Retrieves the index of the first entry of the given distribution.
+             */
+            uint64_t getOffset(uint64_t distribution) const {
+                return offsets[distribution];
+            }
+
+            uint64_t getNumberOfDistributions() const;
+
+        private:
+            // The first entry of each distribution.
+            std::vector<uint64_t> offsets = {0};
+            // For each entry, the probability (scaled to 2^32) to keep the entry instead of using its alias.
+            std::vector<uint64_t> thresholds;
+            std::vector<uint32_t> aliases;
+        };
+
+        /*!
+         * Aggregated statistics of a set of simulated paths.
+         */
+        template<typename ValueType>
+        struct BatchedSimulationResult {
+            uint64_t numberOfPaths = 0;
+            // The number of paths that reached a terminal state or a deadlock within the step bound.
+            uint64_t terminatedPaths = 0;
+            uint64_t totalSteps = 0;
+            // For each reward model, the sum and the sum of squares of the rewards that the paths accumulated.
+            std::vector<ValueType> rewardSums;
+            std::vector<ValueType> rewardSquareSums;
+            // For each observed label, the number of paths that visited a state with this label.
+            std::vector<uint64_t> labelHits;
+            // The number of choices that were passed to the choice filter and the number of these choices it changed.
+            uint64_t filteredChoices = 0;
+            uint64_t changedChoices = 0;
+
+            void add(BatchedSimulationResult<ValueType> const& other);
+            ValueType getAverageReward(uint64_t rewardModelIndex) const;
+            double getLabelFrequency(uint64_t labelIndex) const;
+        };
+
+        /*!
+         * Simulates many independent paths of a discrete-time model stored as sparse model at once. In contrast to
+         * DiscreteTimeSparseModelSimulator, the successors are sampled from precomputed alias tables in constant time,
+         * the paths are stored as arrays (one entry per path) and advanced step by step, and batches of paths are
+         * simulated in parallel (if Intel TBB is available and enabled).
+         * The random numbers of a path are drawn from a counter-based generator (Philox) keyed by the seed and indexed by
+         * the path and the step. The simulated paths thus only depend on the seed, and the results do not depend on the
+         * number of threads.
+         *
+         * The nondeterminism is resolved by a memoryless scheduler, by a policy callback or, if neither is given, uniformly
+         * at random. Optionally, a choice filter may replace the resolved choice in a given set of states, e.g. to apply
+         * a shield to the choices of an agent.
+         * Each path accumulates the state rewards of the states it leaves and the state-action rewards of the actions it
+         * takes until it reaches a terminal state, a deadlock or the step bound.
+         */
+        template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
+        class BatchedSparseModelSimulator {
+        public:
+            /*!
+             * A policy that, given the current state, its number of choices and 64 uniformly distributed random bits,
+             * returns the (local) index of the choice to take. It is called concurrently and must be thread-safe.
+             */
+            typedef std::function<uint64_t(uint64_t state, uint64_t numberOfChoices, uint64_t randomBits)> Policy;
+
+            /*!
+             * A filter that, given the current state, the (local) index of the choice selected by the scheduler or policy
+             * and 64 uniformly distributed random bits, returns the (local) index of the choice that is actually taken.
+             * It is called concurrently and must be thread-safe.
+             */
+            typedef std::function<uint64_t(uint64_t state, uint64_t choice, uint64_t randomBits)> ChoiceFilter;
+
+            BatchedSparseModelSimulator(storm::models::sparse::Model<ValueType, RewardModelType> const& model);
+
+            void setSeed(uint64_t seed);
+
+            /*!
+             * Sets the number of paths that are simulated together (and by one thread).
+             */
+            void setBatchSize(uint64_t batchSize);
+
+            /*!
+             * Resolves the nondeterminism with the given memoryless (possibly randomized) scheduler.
+             */
+            void setScheduler(storm::storage::Scheduler<ValueType> const& scheduler);
+
+            /*!
+             * Resolves the nondeterminism with the given policy. This replaces a previously set scheduler.
+             */
+            void setPolicy(Policy const& policy);
+
+            /*!
+             * Passes the choices that are made in the given states through the given filter.
+             */
+            void setChoiceFilter(ChoiceFilter const& filter, storm::storage::BitVector const& filteredStates);
+
+            /*!
+             * Removes the choice filter.
+             */
+            void clearChoiceFilter();
+
+            /*!
+             * Sets the states in which the paths stop.
+             */
+            void setTerminalStates(storm::storage::BitVector const& terminalStates);
+
+            /*!
+             * Sets the labels for which the number of paths that visit them is counted.
+             */
+            void setObservedLabels(std::vector<std::string> const& labels);
+
+            /*!
+             * Sets the sets of states for which the number of paths that visit them is counted. The counts are reported
+             * as label hits (in the given order), so this replaces the observed labels.
+             */
+            void setObservedStates(std::vector<storm::storage::BitVector> const& states);
+
+            /*!
+             * Simulates the given number of paths from the initial state, each for at most the given number of steps.
+             */
+            BatchedSimulationResult<ValueType> simulate(uint64_t numberOfPaths, uint64_t maximalSteps) const;
+
+        private:
+            BatchedSimulationResult<ValueType> simulateBatch(uint64_t firstPath, uint64_t numberOfPaths, uint64_t maximalSteps) const;
+
+            storm::models::sparse::Model<ValueType, RewardModelType> const& model;
+            uint64_t initialState;
+            storm::utility::PhiloxGenerator generator;
+            uint64_t batchSize;
+
+            // The alias tables of the successor distributions of all rows.
+            AliasTables successorTables;
+            // The successor states of all rows in the order of the alias tables.
+            std::vector<uint64_t> successors;
+
+            // If a scheduler is given, the alias tables of its choice distributions for all states.
+            boost::optional<AliasTables> schedulerTables;
+            // Otherwise, the policy (if given).
+            Policy policy;
+
+            // The choice filter (if given) and the states in which it is applied.
+            ChoiceFilter choiceFilter;
+            storm::storage::BitVector filteredStates;
+
+            storm::storage::BitVector terminalStates;
+            std::vector<storm::storage::BitVector> observedLabelStates;
+
+            // For each reward model, the rewards of the states and of the rows.
+            std::vector<std::vector<ValueType>> stateRewards;
+            std::vector<std::vector<ValueType>> stateActionRewards;
+        };
+    }
+}
@@ -24,10 +24,15 @@ namespace storm {
 
         template<typename ValueType>
         bool DiscreteTimePrismProgramSimulator<ValueType>::step(uint64_t actionNumber) {
-            uint32_t nextState = behavior.getChoices()[actionNumber].sampleFromDistribution(generator.random());
-            lastActionRewards = behavior.getChoices()[actionNumber].getRewards();
+            return step(actionNumber, generator.random());
+        }
+
+        template<typename ValueType>
+        bool DiscreteTimePrismProgramSimulator<ValueType>::step(uint64_t actionNumber, ValueType const& randomValue) {
+            uint32_t nextState = currentBehavior->getChoices()[actionNumber].sampleFromDistribution(randomValue);
+            lastActionRewards = currentBehavior->getChoices()[actionNumber].getRewards();
             STORM_LOG_ASSERT(lastActionRewards.size() == stateGenerator->getNumberOfRewardModels(), "Reward vector should have as many rewards as model.");
-            currentState = idToState[nextState];
+            currentState = currentIdToState->at(nextState);
             // TODO we do not need to do this in every step!
             clearStateCaches();
             explore();
@@ -38,23 +43,50 @@ namespace storm {
         bool DiscreteTimePrismProgramSimulator<ValueType>::explore() {
             // Load the current state into the next state generator.
             stateGenerator->load(currentState);
-            // TODO: This low-level code currently expands all actions, while this is not necessary.
-            // However, using the next state generator ensures compatibliity with the model generator.
-            behavior = stateGenerator->expand(stateToIdCallback);
-            STORM_LOG_ASSERT(behavior.getStateRewards().size() == lastActionRewards.size(), "Reward vectors should have same length.");            
-            for(uint64_t i = 0; i < behavior.getStateRewards().size(); i++) {
-                lastActionRewards[i] += behavior.getStateRewards()[i];
+            if (expansionCacheSize > 0) {
+                auto cacheIt = expansionCacheIndex.find(currentState);
+                if (cacheIt != expansionCacheIndex.end()) {
+                    // Move the entry to the front, it is now the most recently used one.
+                    expansionCache.splice(expansionCache.begin(), expansionCache, cacheIt->second);
+                    ++numberOfCacheHits;
+                } else {
+                    // The indices may refer to the states of a cached expansion, so we start from scratch.
+                    clearStateCaches();
+                    behavior = stateGenerator->expand(stateToIdCallback);
+                    ++numberOfExpansions;
+                    expansionCache.push_front(CachedExpansion{currentState, std::move(behavior), std::move(idToState)});
+                    expansionCacheIndex[currentState] = expansionCache.begin();
+                    clearStateCaches();
+                    if (expansionCache.size() > expansionCacheSize) {
+                        expansionCacheIndex.erase(expansionCache.back().state);
+                        expansionCache.pop_back();
+                    }
+                }
+                // The current entry is the first one, which is not evicted before the next expansion.
+                currentBehavior = &expansionCache.front().behavior;
+                currentIdToState = &expansionCache.front().idToState;
+            } else {
+                // TODO: This low-level code currently expands all actions, while this is not necessary.
+                // However, using the next state generator ensures compatibliity with the model generator.
+                behavior = stateGenerator->expand(stateToIdCallback);
+                ++numberOfExpansions;
+                currentBehavior = &behavior;
+                currentIdToState = &idToState;
+            }
+            STORM_LOG_ASSERT(currentBehavior->getStateRewards().size() == lastActionRewards.size(), "Reward vectors should have same length.");            
+            for(uint64_t i = 0; i < currentBehavior->getStateRewards().size(); i++) {
+                lastActionRewards[i] += currentBehavior->getStateRewards()[i];
             }
             return true;
         }
 
         template<typename ValueType>
         bool DiscreteTimePrismProgramSimulator<ValueType>::isSinkState() const {
-            if(behavior.empty()) {
+            if(currentBehavior->empty()) {
                 return true;
             }
             std::set<uint32_t> successorIds;
-            for (Choice<ValueType,uint32_t> const& choice : behavior.getChoices()) {
+            for (Choice<ValueType,uint32_t> const& choice : currentBehavior->getChoices()) {
                 for (auto it = choice.begin(); it != choice.end(); ++it) {
                     successorIds.insert(it->first);
                     if (successorIds.size() > 1) {
@@ -62,7 +94,7 @@ namespace storm {
                     }
                 }
             }
-            if (idToState.at(*(successorIds.begin())) == currentState) {
+            if (currentIdToState->at(*(successorIds.begin())) == currentState) {
                 return true;
             }
             return false;
@@ -70,7 +102,7 @@ namespace storm {
 
         template<typename ValueType>
         std::vector<generator::Choice<ValueType, uint32_t>> const& DiscreteTimePrismProgramSimulator<ValueType>::getChoices() const {
-            return behavior.getChoices();
+            return currentBehavior->getChoices();
         }
 
         template<typename ValueType>
@@ -134,6 +166,37 @@ namespace storm {
             return names;
         }
 
+        template<typename ValueType>
+        bool DiscreteTimePrismProgramSimulator<ValueType>::satisfies(storm::expressions::Expression const& expression) const {
+            return stateGenerator->satisfies(expression);
+        }
+
+        template<typename ValueType>
+        void DiscreteTimePrismProgramSimulator<ValueType>::setExpansionCacheSize(uint64_t size) {
+            expansionCacheSize = size;
+            if (expansionCacheSize == 0 && !expansionCache.empty()) {
+                // The current state refers to the first entry, which is about to be evicted.
+                behavior = expansionCache.front().behavior;
+                idToState = expansionCache.front().idToState;
+                currentBehavior = &behavior;
+                currentIdToState = &idToState;
+            }
+            while (expansionCache.size() > expansionCacheSize) {
+                expansionCacheIndex.erase(expansionCache.back().state);
+                expansionCache.pop_back();
+            }
+        }
+
+        template<typename ValueType>
+        uint64_t DiscreteTimePrismProgramSimulator<ValueType>::getNumberOfCacheHits() const {
+            return numberOfCacheHits;
+        }
+
+        template<typename ValueType>
+        uint64_t DiscreteTimePrismProgramSimulator<ValueType>::getNumberOfExpansions() const {
+            return numberOfExpansions;
+        }
+
         template<typename ValueType>
         uint32_t DiscreteTimePrismProgramSimulator<ValueType>::getOrAddStateIndex(generator::CompressedState const& state) {
             uint32_t newIndex = static_cast<uint32_t>(stateToId.size());
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <list>
+#include <unordered_map>
+
 #include "storm/storage/prism/Program.h"
 #include "storm/storage/expressions/SimpleValuation.h"
 #include "storm/generator/PrismNextStateGenerator.h"
@@ -52,6 +55,16 @@ namespace storm {
              * @return true, if this action can be taken.
              */
             bool step(uint64_t actionNumber);
+
+            /**
+             * Make a step and select the successor with the given random value. This allows to draw the random numbers
+             * from an external source without reseeding the simulator.
+             *
+             * @param actionNumber The action to select.
+             * @param randomValue A uniformly distributed value in [0, 1).
+             * @return true, if this action can be taken.
+             */
+            bool step(uint64_t actionNumber, ValueType const& randomValue);
             /**
              * Accessor for the last state action reward and the current state reward, added together.
              * @return A vector with te number of rewards.
@@ -80,6 +93,23 @@ namespace storm {
              * The names of the rewards that are returned.
              */
             std::vector<std::string> getRewardNames() const;
+
+            /**
+             * Evaluates the given expression over the variables of the program in the current state.
+             */
+            bool satisfies(storm::expressions::Expression const& expression) const;
+
+            /**
+             * Keeps the expansions of (at most) the given number of recently visited states, such that revisiting them
+             * does not invoke the next state generator again. A size of zero (the default) disables the cache.
+             */
+            void setExpansionCacheSize(uint64_t size);
+
+            /**
+             * The number of states that were found in the expansion cache and the number of states that were expanded.
+             */
+            uint64_t getNumberOfCacheHits() const;
+            uint64_t getNumberOfExpansions() const;
         protected:
             bool explore();
             void clearStateCaches();
@@ -96,6 +126,10 @@ namespace storm {
             std::shared_ptr<storm::generator::PrismNextStateGenerator<ValueType, uint32_t>> stateGenerator;
             /// Obtained behavior of a state
             generator::StateBehavior<ValueType> behavior;
+            /// The behavior of the current state and the states its successor indices refer to. They either point to
+            /// behavior and idToState or to an entry of the expansion cache, so a cache hit does not copy the entry.
+            generator::StateBehavior<ValueType> const* currentBehavior = &behavior;
+            std::unordered_map<uint32_t, generator::CompressedState> const* currentIdToState = &idToState;
             /// Helper for last action reward construction
             std::vector<ValueType> zeroRewards;
             /// Stores the action rewards from the last action.
@@ -107,6 +141,19 @@ namespace storm {
 
             std::unordered_map<uint32_t, generator::CompressedState> idToState;
 
+            /// An expanded state together with the states that the (temporary) successor indices refer to.
+            struct CachedExpansion {
+                generator::CompressedState state;
+                generator::StateBehavior<ValueType> behavior;
+                std::unordered_map<uint32_t, generator::CompressedState> idToState;
+            };
+            /// The cached expansions, the most recently used first, and their positions by state.
+            uint64_t expansionCacheSize = 0;
+            std::list<CachedExpansion> expansionCache;
+            std::unordered_map<generator::CompressedState, typename std::list<CachedExpansion>::iterator> expansionCacheIndex;
+            uint64_t numberOfCacheHits = 0;
+            uint64_t numberOfExpansions = 0;
+
         private:
             // Create a callback for the next-state generator to enable it to request the index of states.
             std::function<uint32_t (generator::CompressedState const&)> stateToIdCallback = std::bind(&DiscreteTimePrismProgramSimulator<ValueType>::getOrAddStateIndex, this, std::placeholders::_1);
@@ -0,0 +1,216 @@
+#include "storm/simulator/ShieldedSparseModelSimulator.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/models/sparse/Smg.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidOperationException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace simulator {
+
+        template<typename ValueType>
+        void ShieldedSimulationResult<ValueType>::add(ShieldedSimulationResult<ValueType> const& other) {
+            numberOfPaths += other.numberOfPaths;
+            violatingPaths += other.violatingPaths;
+            decisions += other.decisions;
+            interferences += other.interferences;
+            rewardSums.resize(other.rewardSums.size(), storm::utility::zero<ValueType>());
+            rewardSquareSums.resize(other.rewardSquareSums.size(), storm::utility::zero<ValueType>());
+            for (uint64_t index = 0; index < other.rewardSums.size(); ++index) {
+                rewardSums[index] += other.rewardSums[index];
+                rewardSquareSums[index] += other.rewardSquareSums[index];
+            }
+        }
+
+        template<typename ValueType>
+        double ShieldedSimulationResult<ValueType>::getInterferenceRate() const {
+            if (decisions == 0) {
+                return 0.0;
+            }
+            return static_cast<double>(interferences) / static_cast<double>(decisions);
+        }
+
+        template<typename ValueType>
+        double ShieldedSimulationResult<ValueType>::getViolationProbability() const {
+            STORM_LOG_THROW(numberOfPaths > 0, storm::exceptions::InvalidArgumentException, "No paths were simulated.");
+            return static_cast<double>(violatingPaths) / static_cast<double>(numberOfPaths);
+        }
+
+        template<typename ValueType>
+        std::pair<double, double> ShieldedSimulationResult<ValueType>::getViolationConfidenceInterval(double confidence) const {
+            STORM_LOG_THROW(confidence > 0.0 && confidence < 1.0, storm::exceptions::InvalidArgumentException, "The confidence must be strictly between 0 and 1.");
+            double estimate = getViolationProbability();
+            // By the Chernoff-Hoeffding bound, P(|estimate - p| >= epsilon) <= 2 exp(-2 n epsilon^2).
+            double epsilon = std::sqrt(std::log(2.0 / (1.0 - confidence)) / (2.0 * static_cast<double>(numberOfPaths)));
+            return std::make_pair(std::max(0.0, estimate - epsilon), std::min(1.0, estimate + epsilon));
+        }
+
+        template<typename ValueType>
+        ValueType ShieldedSimulationResult<ValueType>::getAverageReward(uint64_t rewardModelIndex) const {
+            STORM_LOG_THROW(numberOfPaths > 0, storm::exceptions::InvalidArgumentException, "No paths were simulated.");
+            return rewardSums[rewardModelIndex] / storm::utility::convertNumber<ValueType>(numberOfPaths);
+        }
+
+        template<typename ValueType>
+        ValueType ShieldedSimulationResult<ValueType>::getRewardVariance(uint64_t rewardModelIndex) const {
+            STORM_LOG_THROW(numberOfPaths > 1, storm::exceptions::InvalidArgumentException, "The variance requires at least two paths.");
+            ValueType n = storm::utility::convertNumber<ValueType>(numberOfPaths);
+            ValueType const& sum = rewardSums[rewardModelIndex];
+            return std::max(storm::utility::zero<ValueType>(), (rewardSquareSums[rewardModelIndex] - sum * sum / n) / (n - storm::utility::one<ValueType>()));
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        ShieldedSparseModelSimulator<ValueType, RewardModelType>::ShieldedSparseModelSimulator(storm::models::sparse::Model<ValueType, RewardModelType> const& model) : model(model), simulator(model), isPreShield(true), unsafeStates(model.getNumberOfStates(), false), terminalStates(model.getNumberOfStates(), false) {
+            if (!model.isOfType(storm::models::ModelType::Smg)) {
+                shieldedStates = storm::storage::BitVector(model.getNumberOfStates(), true);
+            }
+            clearShield();
+            updateStoppingStates();
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void ShieldedSparseModelSimulator<ValueType, RewardModelType>::setSeed(uint64_t seed) {
+            simulator.setSeed(seed);
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void ShieldedSparseModelSimulator<ValueType, RewardModelType>::setBatchSize(uint64_t newBatchSize) {
+            simulator.setBatchSize(newBatchSize);
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void ShieldedSparseModelSimulator<ValueType, RewardModelType>::setAgentPolicy(AgentPolicy const& policy) {
+            simulator.setPolicy(policy);
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void ShieldedSparseModelSimulator<ValueType, RewardModelType>::setShield(storm::storage::PreScheduler<ValueType> const& shield) {
+            STORM_LOG_THROW(shield.isMemorylessScheduler(), storm::exceptions::NotSupportedException, "The shielded simulator only supports memoryless shields.");
+            STORM_LOG_THROW(shield.getNumberOfModelStates() == model.getNumberOfStates(), storm::exceptions::InvalidArgumentException, "The shield does not match the number of states of the model.");
+            auto const& rowGroupIndices = model.getTransitionMatrix().getRowGroupIndices();
+            isPreShield = true;
+            shieldIndices.assign(1, 0);
+            shieldChoices.clear();
+            for (uint64_t state = 0; state < model.getNumberOfStates(); ++state) {
+                for (auto const& choice : shield.getChoice(state).getChoiceMap()) {
+                    STORM_LOG_THROW(std::get<1>(choice) < rowGroupIndices[state + 1] - rowGroupIndices[state], storm::exceptions::InvalidArgumentException, "The shield allows a choice that state " << state << " does not have.");
+                    shieldChoices.push_back(std::get<1>(choice));
+                }
+                shieldIndices.push_back(shieldChoices.size());
+            }
+            updateChoiceFilter();
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void ShieldedSparseModelSimulator<ValueType, RewardModelType>::setShield(storm::storage::PostScheduler<ValueType> const& shield) {
+            STORM_LOG_THROW(shield.getNumberOfModelStates() == model.getNumberOfStates(), storm::exceptions::InvalidArgumentException, "The shield does not match the number of states of the model.");
+            auto const& rowGroupIndices = model.getTransitionMatrix().getRowGroupIndices();
+            isPreShield = false;
+            shieldIndices.assign(1, 0);
+            shieldChoices.clear();
+            for (uint64_t state = 0; state < model.getNumberOfStates(); ++state) {
+                auto const& choiceMap = shield.getChoice(state).getChoiceMap();
+                if (!choiceMap.empty()) {
+                    uint64_t numberOfChoices = rowGroupIndices[state + 1] - rowGroupIndices[state];
+                    // Choices without a correction are kept.
+                    uint64_t offset = shieldChoices.size();
+                    for (uint64_t choice = 0; choice < numberOfChoices; ++choice) {
+                        shieldChoices.push_back(choice);
+                    }
+                    for (auto const& choice : choiceMap) {
+                        STORM_LOG_THROW(std::get<0>(choice) < numberOfChoices && std::get<1>(choice) < numberOfChoices, storm::exceptions::InvalidArgumentException, "The shield corrects a choice that state " << state << " does not have.");
+                        shieldChoices[offset + std::get<0>(choice)] = std::get<1>(choice);
+                    }
+                }
+                shieldIndices.push_back(shieldChoices.size());
+            }
+            updateChoiceFilter();
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void ShieldedSparseModelSimulator<ValueType, RewardModelType>::clearShield() {
+            isPreShield = true;
+            shieldIndices.assign(model.getNumberOfStates() + 1, 0);
+            shieldChoices.clear();
+            updateChoiceFilter();
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void ShieldedSparseModelSimulator<ValueType, RewardModelType>::setShieldedCoalition(storm::logic::PlayerCoalition const& coalition) {
+            STORM_LOG_THROW(model.isOfType(storm::models::ModelType::Smg), storm::exceptions::InvalidOperationException, "Shielded coalitions can only be set for games.");
+            shieldedStates = dynamic_cast<storm::models::sparse::Smg<ValueType, RewardModelType> const&>(model).computeStatesOfCoalition(coalition);
+            updateChoiceFilter();
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void ShieldedSparseModelSimulator<ValueType, RewardModelType>::setUnsafeStates(storm::storage::BitVector const& newUnsafeStates) {
+            STORM_LOG_THROW(newUnsafeStates.size() == model.getNumberOfStates(), storm::exceptions::InvalidArgumentException, "The number of unsafe states does not match the number of states.");
+            unsafeStates = newUnsafeStates;
+            updateStoppingStates();
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void ShieldedSparseModelSimulator<ValueType, RewardModelType>::setTerminalStates(storm::storage::BitVector const& newTerminalStates) {
+            STORM_LOG_THROW(newTerminalStates.size() == model.getNumberOfStates(), storm::exceptions::InvalidArgumentException, "The number of terminal states does not match the number of states.");
+            terminalStates = newTerminalStates;
+            updateStoppingStates();
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void ShieldedSparseModelSimulator<ValueType, RewardModelType>::updateChoiceFilter() {
+            if (!shieldedStates) {
+                simulator.clearChoiceFilter();
+                return;
+            }
+            // Without a shield, the filter keeps every choice, so the decisions of the shielded states are still counted.
+            bool preShield = isPreShield;
+            std::vector<uint64_t> indices = shieldIndices;
+            std::vector<uint64_t> choices = shieldChoices;
+            simulator.setChoiceFilter([preShield, indices, choices] (uint64_t state, uint64_t proposedChoice, uint64_t randomBits) {
+                uint64_t first = indices[state];
+                uint64_t last = indices[state + 1];
+                if (first == last) {
+                    return proposedChoice;
+                }
+                if (!preShield) {
+                    return choices[first + proposedChoice];
+                }
+                if (std::find(choices.begin() + first, choices.begin() + last, proposedChoice) != choices.begin() + last) {
+                    return proposedChoice;
+                }
+                return choices[first + (((randomBits & 0xFFFFFFFFull) * (last - first)) >> 32)];
+            }, shieldedStates.get());
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void ShieldedSparseModelSimulator<ValueType, RewardModelType>::updateStoppingStates() {
+            simulator.setTerminalStates(terminalStates | unsafeStates);
+            simulator.setObservedStates({unsafeStates});
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        ShieldedSimulationResult<ValueType> ShieldedSparseModelSimulator<ValueType, RewardModelType>::simulate(uint64_t numberOfPaths, uint64_t maximalSteps) const {
+            STORM_LOG_THROW(shieldedStates.is_initialized(), storm::exceptions::InvalidOperationException, "The shielded coalition of the game has to be set before simulating.");
+            auto batchedResult = simulator.simulate(numberOfPaths, maximalSteps);
+
+            ShieldedSimulationResult<ValueType> result;
+            result.numberOfPaths = batchedResult.numberOfPaths;
+            result.violatingPaths = batchedResult.labelHits[0];
+            result.decisions = batchedResult.filteredChoices;
+            result.interferences = batchedResult.changedChoices;
+            result.rewardSums = std::move(batchedResult.rewardSums);
+            result.rewardSquareSums = std::move(batchedResult.rewardSquareSums);
+            return result;
+        }
+
+        template struct ShieldedSimulationResult<double>;
+        template class ShieldedSparseModelSimulator<double>;
+
+    }
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "storm/logic/PlayerCoalition.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/simulator/BatchedSparseModelSimulator.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/PostScheduler.h"
+#include "storm/storage/PreScheduler.h"
+
+namespace storm {
+    namespace simulator {
+
+        /*!
+         * Aggregated statistics of a set of paths simulated under a shield.
+         */
+        template<typename ValueType>
+        struct ShieldedSimulationResult {
+            uint64_t numberOfPaths = 0;
+            // The number of paths that visited an unsafe state within the step bound.
+            uint64_t violatingPaths = 0;
+            // The number of actions proposed by the agent and the number of these actions the shield changed.
+            uint64_t decisions = 0;
+            uint64_t interferences = 0;
+            // For each reward model, the sum and the sum of squares of the rewards that the paths accumulated.
+            std::vector<ValueType> rewardSums;
+            std::vector<ValueType> rewardSquareSums;
+
+            void add(ShieldedSimulationResult<ValueType> const& other);
+
+            /*!
+             * Retrieves the fraction of the proposed actions that the shield changed.
+             */
+            double getInterferenceRate() const;
+
+            double getViolationProbability() const;
+
+            /*!
+             * Retrieves an interval that contains the violation probability with (at least) the given confidence,
+             * obtained from the Chernoff-Hoeffding bound.
+             */
+            std::pair<double, double> getViolationConfidenceInterval(double confidence) const;
+
+            ValueType getAverageReward(uint64_t rewardModelIndex) const;
+            ValueType getRewardVariance(uint64_t rewardModelIndex) const;
+        };
+
+        /*!
+         * Simulates an agent that acts in a discrete-time model stored as sparse model while a shield restricts (pre-shield)
+         * or corrects (post-shield) its actions. In every step, the agent proposes an action. If a pre-shield does not allow
+         * the action, one of the allowed actions is taken instead (uniformly at random). If a post-shield maps the action to
+         * a different action, the latter is taken. States in which the shield is undefined are not restricted.
+         * For stochastic multiplayer games, only the states of the shielded coalition are shielded (and counted as
+         * decisions), the other players act according to the agent policy.
+         *
+         * The paths are simulated by a BatchedSparseModelSimulator, to which the shield is passed as choice filter.
+         */
+        template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
+        class ShieldedSparseModelSimulator {
+        public:
+            /*!
+             * The policy of the agent. Given the current state, its number of choices and 64 uniformly distributed random
+             * bits, it returns the (local) index of the proposed choice. It is called concurrently and must be thread-safe.
+             */
+            typedef typename BatchedSparseModelSimulator<ValueType, RewardModelType>::Policy AgentPolicy;
+
+            ShieldedSparseModelSimulator(storm::models::sparse::Model<ValueType, RewardModelType> const& model);
+
+            void setSeed(uint64_t seed);
+
+            /*!
+             * Sets the number of paths that are simulated together (and by one thread).
+             */
+            void setBatchSize(uint64_t batchSize);
+
+            /*!
+             * Sets the policy of the agent. By default, the agent chooses uniformly at random.
+             */
+            void setAgentPolicy(AgentPolicy const& policy);
+
+            /*!
+             * Restricts the actions of the agent with the given (memoryless) pre-shield.
+             */
+            void setShield(storm::storage::PreScheduler<ValueType> const& shield);
+
+            /*!
+             * Corrects the actions of the agent with the given post-shield.
+             */
+            void setShield(storm::storage::PostScheduler<ValueType> const& shield);
+
+            /*!
+             * Removes the shield, e.g. to compare the statistics with the unshielded agent.
+             */
+            void clearShield();
+
+            /*!
+             * Sets the coalition whose states are shielded. This is required for (and only applicable to) games.
+             */
+            void setShieldedCoalition(storm::logic::PlayerCoalition const& coalition);
+
+            /*!
+             * Sets the states whose visit counts as a violation. Paths stop in these states.
+             */
+            void setUnsafeStates(storm::storage::BitVector const& unsafeStates);
+
+            /*!
+             * Sets the states in which the paths stop without a violation.
+             */
+            void setTerminalStates(storm::storage::BitVector const& terminalStates);
+
+            /*!
+             * Simulates the given number of paths from the initial state, each for at most the given number of steps.
+             */
+            ShieldedSimulationResult<ValueType> simulate(uint64_t numberOfPaths, uint64_t maximalSteps) const;
+
+        private:
+            /*!
+             * Passes the current shield (or none) and the shielded states to the simulator.
+             */
+            void updateChoiceFilter();
+
+            /*!
+             * Passes the unsafe and the terminal states to the simulator.
+             */
+            void updateStoppingStates();
+
+            storm::models::sparse::Model<ValueType, RewardModelType> const& model;
+            BatchedSparseModelSimulator<ValueType, RewardModelType> simulator;
+
+            // The shield, given as the allowed choices (for a pre-shield) or as the corrected choices (for a post-shield)
+            // of every choice. The choices of state s are stored from shieldIndices[s] to shieldIndices[s + 1]. States
+            // without entries are not shielded. The filter only holds a copy, so the simulator does not refer to this object.
+            bool isPreShield;
+            std::vector<uint64_t> shieldIndices;
+            std::vector<uint64_t> shieldChoices;
+
+            // The states in which the agent is shielded, or none if the coalition of a game is not set yet.
+            boost::optional<storm::storage::BitVector> shieldedStates;
+
+            storm::storage::BitVector unsafeStates;
+            storm::storage::BitVector terminalStates;
+        };
+    }
+}
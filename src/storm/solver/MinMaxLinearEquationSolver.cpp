@@ -6,6 +6,7 @@
 #include "storm/solver/IterativeMinMaxLinearEquationSolver.h"
 #include "storm/solver/TopologicalMinMaxLinearEquationSolver.h"
 #include "storm/solver/TopologicalCudaMinMaxLinearEquationSolver.h"
+#include "storm/solver/TopologicalSimdMinMaxLinearEquationSolver.h"
 #include "storm/solver/LpMinMaxLinearEquationSolver.h"
 #include "storm/solver/AcyclicMinMaxLinearEquationSolver.h"
 
@@ -225,6 +226,8 @@ namespace storm {
                 result = std::make_unique<TopologicalMinMaxLinearEquationSolver<ValueType>>();
             } else if (method == MinMaxMethod::TopologicalCuda) {
                 result = std::make_unique<TopologicalCudaMinMaxLinearEquationSolver<ValueType>>();
+            } else if (method == MinMaxMethod::TopologicalSimd) {
+                result = std::make_unique<TopologicalSimdMinMaxLinearEquationSolver<ValueType>>();
             } else if (method == MinMaxMethod::LinearProgramming) {
                 result = std::make_unique<LpMinMaxLinearEquationSolver<ValueType>>(std::make_unique<storm::utility::solver::LpSolverFactory<ValueType>>());
             } else if (method == MinMaxMethod::Acyclic) {
@@ -248,6 +251,8 @@ namespace storm {
                 result = std::make_unique<AcyclicMinMaxLinearEquationSolver<storm::RationalNumber>>();
             } else if (method == MinMaxMethod::Topological) {
                 result = std::make_unique<TopologicalMinMaxLinearEquationSolver<storm::RationalNumber>>();
+            } else if (method == MinMaxMethod::TopologicalSimd) {
+                result = std::make_unique<TopologicalSimdMinMaxLinearEquationSolver<storm::RationalNumber>>();
             } else {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Unsupported technique.");
             }
@@ -22,6 +22,8 @@ namespace storm {
                     return "optimisticvalueiteration";
                 case MinMaxMethod::TopologicalCuda:
                     return "topologicalcuda";
+                case MinMaxMethod::TopologicalSimd:
+                    return "topologicalsimd";
                 case MinMaxMethod::ViToPi:
                     return "vi-to-pi";
                 case MinMaxMethod::Acyclic:
@@ -0,0 +1,361 @@
+#include "storm/solver/TopologicalSimdMinMaxLinearEquationSolver.h"
+
+#include <atomic>
+
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/utility/vector.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/exceptions/InvalidEnvironmentException.h"
+
+namespace storm {
+    namespace solver {
+
+        namespace {
+            // SCCs with fewer states are not worth distributing over multiple threads.
+            uint64_t const minimalNumberOfStatesForParallelization = 1000;
+
+            template<typename ValueType>
+            ValueType computeRowValue(uint64_t row, std::vector<uint64_t> const& rowIndices, uint64_t const* columns, ValueType const* values, ValueType const* x, std::vector<ValueType> const& b) {
+                uint64_t entry = rowIndices[row];
+                uint64_t const entryEnd = rowIndices[row + 1];
+                // Four independent partial sums break up the dependency chain of the accumulation, which allows the
+                // compiler to map the loop onto SIMD lanes.
+                ValueType sum0 = b[row];
+                ValueType sum1 = storm::utility::zero<ValueType>();
+                ValueType sum2 = storm::utility::zero<ValueType>();
+                ValueType sum3 = storm::utility::zero<ValueType>();
+                for (; entry + 4 <= entryEnd; entry += 4) {
+                    sum0 += values[entry] * x[columns[entry]];
+                    sum1 += values[entry + 1] * x[columns[entry + 1]];
+                    sum2 += values[entry + 2] * x[columns[entry + 2]];
+                    sum3 += values[entry + 3] * x[columns[entry + 3]];
+                }
+                for (; entry < entryEnd; ++entry) {
+                    sum0 += values[entry] * x[columns[entry]];
+                }
+                return (sum0 + sum1) + (sum2 + sum3);
+            }
+
+            /*!
+             * Performs one Jacobi iteration step for a range of row groups.
+             */
+            template<typename ValueType>
+            class MvReduceKernel {
+            public:
+                MvReduceKernel(OptimizationDirection dir, ValueType const& precision, bool relative, std::vector<uint64_t> const& rowIndices, std::vector<uint64_t> const& columns, std::vector<ValueType> const& values, std::vector<ValueType> const& xOld, std::vector<ValueType>& xNew, std::vector<ValueType> const& b, std::vector<uint64_t> const& rowGroupIndices, storm::storage::BitVector const* dirOverride) : dir(dir), precision(precision), relative(relative), rowIndices(rowIndices), columns(columns), values(values), xOld(xOld), xNew(xNew), b(b), rowGroupIndices(rowGroupIndices), dirOverride(dirOverride) {
+                    // Intentionally left empty.
+                }
+
+                /*!
+                 * Updates the values of the given row groups and returns true iff none of them changed by more than the precision.
+                 */
+                bool operator()(uint64_t firstGroup, uint64_t lastGroup) const {
+                    bool converged = true;
+                    for (uint64_t group = firstGroup; group < lastGroup; ++group) {
+                        uint64_t row = rowGroupIndices[group];
+                        uint64_t const rowEnd = rowGroupIndices[group + 1];
+                        ValueType best = storm::utility::zero<ValueType>();
+                        if (row < rowEnd) {
+                            bool minimize = (dir == OptimizationDirection::Minimize) != (dirOverride != nullptr && dirOverride->get(group));
+                            best = computeRowValue(row, rowIndices, columns.data(), values.data(), xOld.data(), b);
+                            for (++row; row < rowEnd; ++row) {
+                                ValueType value = computeRowValue(row, rowIndices, columns.data(), values.data(), xOld.data(), b);
+                                if (minimize ? value < best : value > best) {
+                                    best = value;
+                                }
+                            }
+                        }
+                        if (converged && !storm::utility::vector::equalModuloPrecision<ValueType>(xOld[group], best, precision, relative)) {
+                            converged = false;
+                        }
+                        xNew[group] = best;
+                    }
+                    return converged;
+                }
+
+            private:
+                OptimizationDirection dir;
+                ValueType const& precision;
+                bool relative;
+                std::vector<uint64_t> const& rowIndices;
+                std::vector<uint64_t> const& columns;
+                std::vector<ValueType> const& values;
+                std::vector<ValueType> const& xOld;
+                std::vector<ValueType>& xNew;
+                std::vector<ValueType> const& b;
+                std::vector<uint64_t> const& rowGroupIndices;
+                storm::storage::BitVector const* dirOverride;
+            };
+
+#ifdef STORM_HAVE_INTELTBB
+            template<typename ValueType>
+            class TbbMvReduceFunctor {
+            public:
+                TbbMvReduceFunctor(MvReduceKernel<ValueType> const& kernel, std::atomic<bool>& converged) : kernel(kernel), converged(converged) {
+                    // Intentionally left empty.
+                }
+
+                void operator()(tbb::blocked_range<uint64_t> const& range) const {
+                    if (!kernel(range.begin(), range.end())) {
+                        converged.store(false, std::memory_order_relaxed);
+                    }
+                }
+
+            private:
+                MvReduceKernel<ValueType> const& kernel;
+                std::atomic<bool>& converged;
+            };
+#endif
+        }
+
+        template<typename ValueType>
+        bool basicValueIteration_mvReduce(OptimizationDirection dir, uint64_t maxIterationCount, ValueType const& precision, bool relativePrecisionCheck, std::vector<uint64_t> const& matrixRowIndices, std::vector<uint64_t> const& columnIndices, std::vector<ValueType> const& values, std::vector<ValueType>& x, std::vector<ValueType> const& b, std::vector<uint64_t> const& nondeterministicChoiceIndices, storm::storage::BitVector const* dirOverride, bool parallel, uint64_t& iterationCount) {
+            STORM_LOG_ASSERT(x.size() + 1 == nondeterministicChoiceIndices.size(), "Vector size does not match the number of row groups.");
+            STORM_LOG_ASSERT(b.size() + 1 == matrixRowIndices.size(), "Vector size does not match the number of rows.");
+            uint64_t const numberOfRowGroups = x.size();
+
+            std::vector<ValueType> swap(numberOfRowGroups);
+            std::vector<ValueType>* currentX = &x;
+            std::vector<ValueType>* newX = &swap;
+
+            bool converged = false;
+            iterationCount = 0;
+            while (!converged && iterationCount < maxIterationCount) {
+                MvReduceKernel<ValueType> kernel(dir, precision, relativePrecisionCheck, matrixRowIndices, columnIndices, values, *currentX, *newX, b, nondeterministicChoiceIndices, dirOverride);
+#ifdef STORM_HAVE_INTELTBB
+                if (parallel) {
+                    std::atomic<bool> allConverged(true);
+                    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfRowGroups, 100), TbbMvReduceFunctor<ValueType>(kernel, allConverged));
+                    converged = allConverged.load();
+                } else {
+                    converged = kernel(0, numberOfRowGroups);
+                }
+#else
+                (void)parallel;
+                converged = kernel(0, numberOfRowGroups);
+#endif
+                std::swap(currentX, newX);
+                ++iterationCount;
+
+                if (storm::utility::resources::isTerminate()) {
+                    break;
+                }
+            }
+
+            // Make sure that the most recent values end up in x.
+            if (currentX != &x) {
+                x.swap(swap);
+            }
+            return converged;
+        }
+
+        template<typename ValueType>
+        TopologicalSimdMinMaxLinearEquationSolver<ValueType>::TopologicalSimdMinMaxLinearEquationSolver() : A(nullptr) {
+            // Intentionally left empty.
+        }
+
+        template<typename ValueType>
+        TopologicalSimdMinMaxLinearEquationSolver<ValueType>::TopologicalSimdMinMaxLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A) : TopologicalSimdMinMaxLinearEquationSolver() {
+            this->setMatrix(A);
+        }
+
+        template<typename ValueType>
+        TopologicalSimdMinMaxLinearEquationSolver<ValueType>::TopologicalSimdMinMaxLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A) : TopologicalSimdMinMaxLinearEquationSolver() {
+            this->setMatrix(std::move(A));
+        }
+
+        template<typename ValueType>
+        void TopologicalSimdMinMaxLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType> const& matrix) {
+            this->localA = nullptr;
+            this->A = &matrix;
+            clearCache();
+        }
+
+        template<typename ValueType>
+        void TopologicalSimdMinMaxLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType>&& matrix) {
+            this->localA = std::make_unique<storm::storage::SparseMatrix<ValueType>>(std::move(matrix));
+            this->A = this->localA.get();
+            clearCache();
+        }
+
+        template<typename ValueType>
+        void TopologicalSimdMinMaxLinearEquationSolver<ValueType>::setDirectionOverride(storm::storage::BitVector const& states) {
+            this->directionOverride = states;
+        }
+
+        template<typename ValueType>
+        void TopologicalSimdMinMaxLinearEquationSolver<ValueType>::clearDirectionOverride() {
+            this->directionOverride = boost::none;
+        }
+
+        template<typename ValueType>
+        void TopologicalSimdMinMaxLinearEquationSolver<ValueType>::clearCache() const {
+            sortedSccDecomposition.reset();
+            MinMaxLinearEquationSolver<ValueType>::clearCache();
+        }
+
+        template<typename ValueType>
+        uint64_t TopologicalSimdMinMaxLinearEquationSolver<ValueType>::getNumberOfIterations() const {
+            return numberOfIterations;
+        }
+
+        template<typename ValueType>
+        bool TopologicalSimdMinMaxLinearEquationSolver<ValueType>::parallelize() const {
+#ifdef STORM_HAVE_INTELTBB
+            return storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+#else
+            return false;
+#endif
+        }
+
+        template<typename ValueType>
+        MinMaxLinearEquationSolverRequirements TopologicalSimdMinMaxLinearEquationSolver<ValueType>::getRequirements(Environment const&, boost::optional<storm::solver::OptimizationDirection> const& direction, bool const&) const {
+            // The requirements coincide with the ones of (non-topological) value iteration.
+            MinMaxLinearEquationSolverRequirements requirements;
+            if (!this->hasUniqueSolution()) {
+                if (this->isTrackSchedulerSet()) {
+                    requirements.requireUniqueSolution();
+                } else if (this->directionOverride) {
+                    // With mixed directions (games), the values are approached from below in all states.
+                    requirements.requireLowerBounds();
+                } else {
+                    if (!direction || direction.get() == OptimizationDirection::Maximize) {
+                        requirements.requireLowerBounds();
+                    }
+                    if (!direction || direction.get() == OptimizationDirection::Minimize) {
+                        requirements.requireUpperBounds();
+                    }
+                }
+            }
+            return requirements;
+        }
+
+        template<typename ValueType>
+        bool TopologicalSimdMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            STORM_LOG_THROW(env.solver().minMax().getMethod() == MinMaxMethod::TopologicalSimd, storm::exceptions::InvalidEnvironmentException, "This min max solver does not support the selected technique.");
+            STORM_LOG_THROW(!this->directionOverride || this->directionOverride->size() == this->A->getRowGroupCount(), storm::exceptions::IllegalArgumentException, "The direction override does not match the number of row groups.");
+
+            ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+            uint64_t maxIters = env.solver().minMax().getMaximalNumberOfIterations();
+            bool relative = env.solver().minMax().getRelativeTerminationCriterion();
+            storm::storage::BitVector const* dirOverride = this->directionOverride ? &this->directionOverride.get() : nullptr;
+
+            // Approach the solution from below (above) when maximizing (minimizing), as done by value iteration. Games
+            // are always solved from below.
+            if (!this->hasUniqueSolution()) {
+                if ((dir == OptimizationDirection::Maximize || dirOverride) && this->hasLowerBound()) {
+                    this->createLowerBoundsVector(x);
+                } else if (dir == OptimizationDirection::Minimize && this->hasUpperBound()) {
+                    this->createUpperBoundsVector(x);
+                }
+            }
+
+            if (!this->sortedSccDecomposition) {
+                this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(*this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort());
+                STORM_LOG_INFO("Found " << this->sortedSccDecomposition->size() << " SCC(s) for the SIMD topological solver.");
+            }
+
+            std::vector<uint64_t> const& rowGroupIndices = this->A->getRowGroupIndices();
+            storm::storage::BitVector sccStates(this->A->getRowGroupCount(), false);
+            std::vector<uint64_t> localIndices(this->A->getRowGroupCount());
+            bool const parallel = parallelize();
+
+            bool converged = true;
+            uint64_t maxLocalIterations = 0;
+            numberOfIterations = 0;
+            // Iterate over the SCCs in topological order. This guarantees that an SCC is only solved after all SCCs it depends on have been solved.
+            for (auto const& scc : *this->sortedSccDecomposition) {
+                uint64_t localIndex = 0;
+                for (auto state : scc) {
+                    sccStates.set(state, true);
+                    localIndices[state] = localIndex++;
+                }
+
+                // Copy the SCC into separate column and value arrays and fold the transitions leaving the SCC into b.
+                std::vector<uint64_t> sccRowIndices = {0};
+                std::vector<uint64_t> sccColumns;
+                std::vector<ValueType> sccValues;
+                std::vector<uint64_t> sccRowGroupIndices = {0};
+                std::vector<ValueType> sccB;
+                std::vector<ValueType> sccX;
+                sccX.reserve(scc.size());
+                boost::optional<storm::storage::BitVector> sccDirOverride;
+                if (dirOverride) {
+                    sccDirOverride = storm::storage::BitVector(scc.size(), false);
+                }
+                for (auto state : scc) {
+                    sccX.push_back(x[state]);
+                    if (dirOverride && dirOverride->get(state)) {
+                        sccDirOverride->set(localIndices[state], true);
+                    }
+                    for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                        ValueType rowB = b[row];
+                        for (auto const& entry : this->A->getRow(row)) {
+                            if (sccStates.get(entry.getColumn())) {
+                                sccColumns.push_back(localIndices[entry.getColumn()]);
+                                sccValues.push_back(entry.getValue());
+                            } else {
+                                rowB += entry.getValue() * x[entry.getColumn()];
+                            }
+                        }
+                        sccB.push_back(rowB);
+                        sccRowIndices.push_back(sccColumns.size());
+                    }
+                    sccRowGroupIndices.push_back(sccB.size());
+                }
+
+                uint64_t localIterations = 0;
+                if (sccColumns.empty()) {
+                    // Without transitions inside the SCC, a single step yields the exact values.
+                    basicValueIteration_mvReduce(dir, 1, precision, relative, sccRowIndices, sccColumns, sccValues, sccX, sccB, sccRowGroupIndices, dirOverride ? &sccDirOverride.get() : nullptr, false, localIterations);
+                } else {
+                    converged &= basicValueIteration_mvReduce(dir, maxIters, precision, relative, sccRowIndices, sccColumns, sccValues, sccX, sccB, sccRowGroupIndices, dirOverride ? &sccDirOverride.get() : nullptr, parallel && scc.size() >= minimalNumberOfStatesForParallelization, localIterations);
+                }
+                maxLocalIterations = std::max(maxLocalIterations, localIterations);
+                numberOfIterations += localIterations;
+
+                // Write the results of this SCC back to the global result vector.
+                for (auto state : scc) {
+                    x[state] = sccX[localIndices[state]];
+                    sccStates.set(state, false);
+                }
+
+                if (storm::utility::resources::isTerminate()) {
+                    STORM_LOG_WARN("SIMD topological solver aborted.");
+                    converged = false;
+                    break;
+                }
+            }
+
+            if (converged) {
+                STORM_LOG_INFO("Iterative solver converged after " << maxLocalIterations << " iterations.");
+            } else {
+                STORM_LOG_WARN("Iterative solver did not converge after " << maxLocalIterations << " iterations.");
+            }
+
+            if (this->isTrackSchedulerSet()) {
+                this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount(), 0);
+                std::vector<ValueType> reducedValues(x.size());
+                this->A->multiplyAndReduce(dir, rowGroupIndices, x, &b, reducedValues, &this->schedulerChoices.get(), dirOverride);
+            }
+
+            return converged;
+        }
+
+        // Explicitly instantiate the solver.
+        template bool basicValueIteration_mvReduce<double>(OptimizationDirection dir, uint64_t maxIterationCount, double const& precision, bool relativePrecisionCheck, std::vector<uint64_t> const& matrixRowIndices, std::vector<uint64_t> const& columnIndices, std::vector<double> const& values, std::vector<double>& x, std::vector<double> const& b, std::vector<uint64_t> const& nondeterministicChoiceIndices, storm::storage::BitVector const* dirOverride, bool parallel, uint64_t& iterationCount);
+        template class TopologicalSimdMinMaxLinearEquationSolver<double>;
+
+#ifdef STORM_HAVE_CARL
+        template bool basicValueIteration_mvReduce<storm::RationalNumber>(OptimizationDirection dir, uint64_t maxIterationCount, storm::RationalNumber const& precision, bool relativePrecisionCheck, std::vector<uint64_t> const& matrixRowIndices, std::vector<uint64_t> const& columnIndices, std::vector<storm::RationalNumber> const& values, std::vector<storm::RationalNumber>& x, std::vector<storm::RationalNumber> const& b, std::vector<uint64_t> const& nondeterministicChoiceIndices, storm::storage::BitVector const* dirOverride, bool parallel, uint64_t& iterationCount);
+        template class TopologicalSimdMinMaxLinearEquationSolver<storm::RationalNumber>;
+#endif
+    } // namespace solver
+} // namespace storm
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace solver {
+
+        /*!
+         * A CPU port of the topological CUDA solver. The SCCs of the system are solved in topological order using a
+         * value iteration kernel that operates on a structure-of-arrays copy of the SCC's matrix. The row groups are
+         * processed in parallel (if Intel TBB is available and enabled) and the inner products are written such that
+         * the compiler can vectorize them.
+         *
+         * The solver can be used for stochastic games by setting a direction override: all states in the override
+         * use the opposite optimization direction.
+         */
+        template<class ValueType>
+        class TopologicalSimdMinMaxLinearEquationSolver : public MinMaxLinearEquationSolver<ValueType> {
+        public:
+            TopologicalSimdMinMaxLinearEquationSolver();
+            TopologicalSimdMinMaxLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A);
+            TopologicalSimdMinMaxLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A);
+
+            virtual void setMatrix(storm::storage::SparseMatrix<ValueType> const& matrix) override;
+            virtual void setMatrix(storm::storage::SparseMatrix<ValueType>&& matrix) override;
+
+            /*!
+             * Sets the states whose optimization direction is the opposite of the one given to the solve call.
+             */
+            void setDirectionOverride(storm::storage::BitVector const& states);
+
+            /*!
+             * Removes a previously set direction override.
+             */
+            void clearDirectionOverride();
+
+            virtual void clearCache() const override;
+
+            /*!
+             * Retrieves the number of iterations of the last solve call, summed over all SCCs.
+             */
+            uint64_t getNumberOfIterations() const;
+
+            virtual MinMaxLinearEquationSolverRequirements getRequirements(Environment const& env, boost::optional<storm::solver::OptimizationDirection> const& direction = boost::none, bool const& hasInitialScheduler = false) const override;
+
+        protected:
+            virtual bool internalSolveEquations(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
+
+        private:
+            bool parallelize() const;
+
+            storm::storage::SparseMatrix<ValueType> const* A;
+            std::unique_ptr<storm::storage::SparseMatrix<ValueType>> localA;
+            boost::optional<storm::storage::BitVector> directionOverride;
+
+            // The SCC decomposition (in topological order) is cached, as it does not depend on the right-hand side.
+            mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
+
+            mutable uint64_t numberOfIterations = 0;
+        };
+
+        /*!
+         * Performs value iteration on the given system until the values converge or the maximal number of iterations is
+         * reached. This is the CPU counterpart of the CUDA kernels: The matrix is given in CSR format with separate
+         * column and value arrays.
+         *
+         * @param dir The optimization direction.
+         * @param dirOverride If given, the row groups (states) in which the opposite direction is to be used.
+         * @param parallel Whether the row groups are to be processed in parallel.
+         * @param iterationCount Is set to the number of performed iterations.
+         * @return True iff the values converged.
+         */
+        template<typename ValueType>
+        bool basicValueIteration_mvReduce(OptimizationDirection dir, uint64_t maxIterationCount, ValueType const& precision, bool relativePrecisionCheck, std::vector<uint64_t> const& matrixRowIndices, std::vector<uint64_t> const& columnIndices, std::vector<ValueType> const& values, std::vector<ValueType>& x, std::vector<ValueType> const& b, std::vector<uint64_t> const& nondeterministicChoiceIndices, storm::storage::BitVector const* dirOverride, bool parallel, uint64_t& iterationCount);
+
+    } // namespace solver
+} // namespace storm
@@ -58,7 +58,7 @@ namespace storm {
 
 		Z3SmtSolver::Z3SmtSolver(storm::expressions::ExpressionManager& manager) : SmtSolver(manager)
 #ifdef STORM_HAVE_Z3
-        , context(nullptr), solver(nullptr), expressionAdapter(nullptr), lastCheckAssumptions(false), lastResult(CheckResult::Unknown)
+        , context(nullptr), solver(nullptr), expressionAdapter(nullptr), lastCheckAssumptions(false), lastResult(CheckResult::Unknown), interrupted(false)
 #endif
 		{
 #ifdef STORM_HAVE_Z3
@@ -123,6 +123,10 @@ namespace storm {
 		{
 #ifdef STORM_HAVE_Z3
 			lastCheckAssumptions = false;
+			if (interrupted) {
+				this->lastResult = SmtSolver::CheckResult::Unknown;
+				return this->lastResult;
+			}
 			switch (this->solver->check()) {
 				case z3::sat:
 					this->lastResult = SmtSolver::CheckResult::Sat;
@@ -144,6 +148,10 @@ namespace storm {
 		{
 #ifdef STORM_HAVE_Z3
 			lastCheckAssumptions = true;
+			if (interrupted) {
+				this->lastResult = SmtSolver::CheckResult::Unknown;
+				return this->lastResult;
+			}
 			z3::expr_vector z3Assumptions(*this->context);
 
 			for (storm::expressions::Expression assumption : assumptions) {
@@ -172,6 +180,10 @@ namespace storm {
 		{
 #ifdef STORM_HAVE_Z3
 			lastCheckAssumptions = true;
+			if (interrupted) {
+				this->lastResult = SmtSolver::CheckResult::Unknown;
+				return this->lastResult;
+			}
 			z3::expr_vector z3Assumptions(*this->context);
 
 			for (storm::expressions::Expression assumption : assumptions) {
@@ -372,6 +384,34 @@ namespace storm {
 #endif
         }
 		
+        void Z3SmtSolver::setRandomSeed(uint64_t seed) {
+#ifdef STORM_HAVE_Z3
+            z3::params paramObject(*context);
+            paramObject.set(":random_seed", static_cast<unsigned>(seed));
+            solver->set(paramObject);
+#else
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Storm is compiled without Z3 support.");
+#endif
+        }
+
+        void Z3SmtSolver::interrupt() {
+#ifdef STORM_HAVE_Z3
+            // The flag is set first, so a check that starts after this call does not run at all.
+            interrupted = true;
+            context->interrupt();
+#else
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Storm is compiled without Z3 support.");
+#endif
+        }
+
+        void Z3SmtSolver::resetInterrupt() {
+#ifdef STORM_HAVE_Z3
+            interrupted = false;
+#else
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Storm is compiled without Z3 support.");
+#endif
+        }
+		
 		std::string Z3SmtSolver::getSmtLibString() const {
 #ifdef STORM_HAVE_Z3
 			return solver->to_smt2();
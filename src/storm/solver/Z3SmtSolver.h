@@ -1,6 +1,8 @@
 #ifndef STORM_SOLVER_Z3SMTSOLVER
 #define STORM_SOLVER_Z3SMTSOLVER
 
+#include <atomic>
+
 #include "storm-config.h"
 #include "storm/solver/SmtSolver.h"
 #include "storm/adapters/Z3ExpressionAdapter.h"
@@ -71,6 +73,27 @@ namespace storm {
             virtual bool setTimeout(uint_fast64_t milliseconds) override;
             
             virtual bool unsetTimeout() override;
+
+            /*!
+             * Sets the seed of the random number generator that Z3 uses, e.g., for case splits and restarts. Solvers with
+             * different seeds typically explore the search space in different orders.
+             *
+             * @param seed The seed to use.
+             */
+            void setRandomSeed(uint64_t seed);
+
+            /*!
+             * Interrupts a check that is currently running. This may be called from a thread other than the one that
+             * runs the check. The interrupted check returns CheckResult::Unknown. The interrupt is sticky, i.e., all
+             * subsequent checks immediately return CheckResult::Unknown until resetInterrupt is called. Note that Z3
+             * might miss an interrupt that arrives while a check is being started, so it may need to be re-issued.
+             */
+            void interrupt();
+
+            /*!
+             * Allows checks again after the solver was interrupted.
+             */
+            void resetInterrupt();
 			
 			virtual std::string getSmtLibString() const override;
             
@@ -98,6 +121,9 @@ namespace storm {
             
             // The last result that was returned by any of the check methods.
             CheckResult lastResult;
+
+            // Set as long as the solver is interrupted.
+            std::atomic<bool> interrupted;
 #endif
 		};
 	}
@@ -0,0 +1,357 @@
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace storage {
+
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::ConcurrentBitVectorHashMapIterator(ConcurrentBitVectorHashMap const& map, uint64_t bucket) : map(map), bucket(bucket) {
+            skipUnoccupiedBuckets();
+        }
+
+        template<class ValueType, class Hash>
+        bool ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator==(ConcurrentBitVectorHashMapIterator const& other) const {
+            return &map == &other.map && bucket == other.bucket;
+        }
+
+        template<class ValueType, class Hash>
+        bool ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator!=(ConcurrentBitVectorHashMapIterator const& other) const {
+            return !(*this == other);
+        }
+
+        template<class ValueType, class Hash>
+        typename ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator& ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator++() {
+            ++bucket;
+            skipUnoccupiedBuckets();
+            return *this;
+        }
+
+        template<class ValueType, class Hash>
+        std::pair<storm::storage::BitVector, ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator*() const {
+            return map.getBucketAndValue(bucket);
+        }
+
+        template<class ValueType, class Hash>
+        void ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::skipUnoccupiedBuckets() {
+            uint64_t numberOfBuckets = map.numberOfAllocatedEntries.load(std::memory_order_acquire);
+            // Entries of insertions that lost against an insertion of the same key are not part of the map.
+            for (; bucket < numberOfBuckets; ++bucket) {
+                uint64_t offset;
+                Segment const& segment = map.getSegment(bucket, offset);
+                if (segment.published[offset].load(std::memory_order_acquire)) {
+                    break;
+                }
+            }
+        }
+
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::Segment::Segment(uint64_t numberOfEntries, uint64_t wordsPerKey) : keys(new uint64_t[numberOfEntries * wordsPerKey]), hashes(new uint64_t[numberOfEntries]), values(new ValueType[numberOfEntries]), published(new std::atomic<bool>[numberOfEntries]) {
+            for (uint64_t entry = 0; entry < numberOfEntries; ++entry) {
+                published[entry].store(false, std::memory_order_relaxed);
+            }
+        }
+
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::Table::Table(uint64_t sizeLog) : sizeLog(sizeLog), slots(new std::atomic<uint64_t>[1ull << sizeLog]), numberOfElements(0), next(nullptr), nextChunkToMigrate(0), numberOfMigratedChunks(0) {
+            for (uint64_t slot = 0; slot < (1ull << sizeLog); ++slot) {
+                slots[slot].store(0, std::memory_order_relaxed);
+            }
+        }
+
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::Table::~Table() {
+            delete next.load();
+        }
+
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor) : loadFactor(loadFactor), bucketSize(bucketSize), wordsPerKey(bucketSize / 64), numberOfAllocatedEntries(0), numberOfElements(0) {
+            STORM_LOG_THROW(bucketSize % 64 == 0, storm::exceptions::InvalidArgumentException, "Bucket size must be a multiple of 64.");
+            // Concurrent insertions may exceed the load factor until the resizing starts, so some space is left.
+            STORM_LOG_THROW(loadFactor > 0.0 && loadFactor <= 0.9, storm::exceptions::InvalidArgumentException, "The load factor must be in (0, 0.9].");
+
+            uint64_t sizeLog = 10;
+            while ((1ull << sizeLog) * loadFactor < initialSize) {
+                ++sizeLog;
+            }
+            firstTable = std::make_unique<Table>(sizeLog);
+            currentTable.store(firstTable.get());
+            for (auto& segment : segments) {
+                segment.store(nullptr);
+            }
+        }
+
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::~ConcurrentBitVectorHashMap() {
+            for (auto& segment : segments) {
+                delete segment.load();
+            }
+        }
+
+        template<class ValueType, class Hash>
+        typename ConcurrentBitVectorHashMap<ValueType, Hash>::Segment& ConcurrentBitVectorHashMap<ValueType, Hash>::getSegment(uint64_t entry, uint64_t& offset) const {
+            uint64_t segmentIndex = 63 - __builtin_clzll((entry >> firstSegmentSizeLog) + 1);
+            offset = entry - (((1ull << segmentIndex) - 1) << firstSegmentSizeLog);
+
+            Segment* segment = segments[segmentIndex].load(std::memory_order_acquire);
+            if (segment == nullptr) {
+                // Allocate the segment, unless some other thread is faster.
+                Segment* newSegment = new Segment(1ull << (firstSegmentSizeLog + segmentIndex), wordsPerKey);
+                if (segments[segmentIndex].compare_exchange_strong(segment, newSegment, std::memory_order_acq_rel)) {
+                    segment = newSegment;
+                } else {
+                    delete newSegment;
+                }
+            }
+            return *segment;
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::allocateEntry(storm::storage::BitVector const& key, uint64_t hash, ValueType const& value) {
+            uint64_t entry = numberOfAllocatedEntries.fetch_add(1, std::memory_order_acq_rel);
+            STORM_LOG_ASSERT(entry < ((1ull << numberOfSegments) - 1) << firstSegmentSizeLog, "Arena of hash map is full.");
+            uint64_t offset;
+            Segment& segment = getSegment(entry, offset);
+            for (uint64_t word = 0; word < wordsPerKey; ++word) {
+                segment.keys[offset * wordsPerKey + word] = key.getAsInt(word * 64, 64);
+            }
+            segment.hashes[offset] = hash;
+            segment.values[offset] = value;
+            return entry;
+        }
+
+        template<class ValueType, class Hash>
+        bool ConcurrentBitVectorHashMap<ValueType, Hash>::keyMatches(uint64_t entry, storm::storage::BitVector const& key) const {
+            uint64_t offset;
+            Segment const& segment = getSegment(entry, offset);
+            for (uint64_t word = 0; word < wordsPerKey; ++word) {
+                if (segment.keys[offset * wordsPerKey + word] != key.getAsInt(word * 64, 64)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::getSlotIndex(uint64_t hash, Table const& table) const {
+            return hash >> (sizeof(decltype(hasher(storm::storage::BitVector()))) * 8 - table.sizeLog);
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::find(storm::storage::BitVector const& key, uint64_t hash) const {
+            Table* table = currentTable.load(std::memory_order_acquire);
+            while (true) {
+                // A migrated slot is marked as moved before its entry is inserted into the successor, so the successor
+                // is only searched once the migration is complete. Like insertions, queries help with the migration.
+                if (table->next.load(std::memory_order_acquire) != nullptr) {
+                    migrate(*table);
+                    table = table->next.load(std::memory_order_acquire);
+                    continue;
+                }
+
+                uint64_t mask = (1ull << table->sizeLog) - 1;
+                uint64_t slot = getSlotIndex(hash, *table);
+                while (true) {
+                    uint64_t content = table->slots[slot].load(std::memory_order_acquire);
+                    if (content == 0) {
+                        return 0;
+                    } else if (content == movedSlot) {
+                        break;
+                    }
+                    uint64_t offset;
+                    Segment const& segment = getSegment(content - 1, offset);
+                    if (segment.hashes[offset] == hash && keyMatches(content - 1, key)) {
+                        return content;
+                    }
+                    slot = (slot + 1) & mask;
+                }
+                // The slot was migrated in the meantime, so the table has a successor that is searched after helping
+                // with the migration.
+            }
+        }
+
+        template<class ValueType, class Hash>
+        ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector const& key, ValueType const& value) {
+            return findOrAddAndGetBucket(key, value).first;
+        }
+
+        template<class ValueType, class Hash>
+        std::pair<ValueType, uint64_t> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAddAndGetBucket(storm::storage::BitVector const& key, ValueType const& value) {
+            STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+            uint64_t hash = hasher(key);
+            // The entry is only allocated once an empty slot is found and it is reused if the insertion is retried.
+            uint64_t ownEntry = 0;
+            bool hasOwnEntry = false;
+
+            Table* table = currentTable.load(std::memory_order_acquire);
+            while (true) {
+                // If the table is being resized, we help and continue in the new table.
+                if (table->next.load(std::memory_order_acquire) != nullptr) {
+                    migrate(*table);
+                    table = table->next.load(std::memory_order_acquire);
+                    continue;
+                }
+
+                uint64_t mask = (1ull << table->sizeLog) - 1;
+                uint64_t slot = getSlotIndex(hash, *table);
+                while (true) {
+                    uint64_t content = table->slots[slot].load(std::memory_order_acquire);
+                    if (content == 0) {
+                        if (!hasOwnEntry) {
+                            ownEntry = allocateEntry(key, hash, value);
+                            hasOwnEntry = true;
+                        }
+                        if (table->slots[slot].compare_exchange_strong(content, ownEntry + 1, std::memory_order_acq_rel)) {
+                            uint64_t offset;
+                            Segment& segment = getSegment(ownEntry, offset);
+                            segment.published[offset].store(true, std::memory_order_release);
+                            numberOfElements.fetch_add(1, std::memory_order_relaxed);
+                            table->numberOfElements.fetch_add(1, std::memory_order_relaxed);
+                            checkIncreaseSize(*table);
+                            return std::make_pair(value, ownEntry);
+                        }
+                        // Otherwise, the slot was filled or migrated in the meantime and its new content is checked.
+                    }
+                    if (content == movedSlot) {
+                        break;
+                    }
+                    uint64_t offset;
+                    Segment const& segment = getSegment(content - 1, offset);
+                    if (segment.hashes[offset] == hash && keyMatches(content - 1, key)) {
+                        return std::make_pair(segment.values[offset], content - 1);
+                    }
+                    slot = (slot + 1) & mask;
+                }
+            }
+        }
+
+        template<class ValueType, class Hash>
+        void ConcurrentBitVectorHashMap<ValueType, Hash>::checkIncreaseSize(Table& table) {
+            if (table.numberOfElements.load(std::memory_order_relaxed) >= loadFactor * (1ull << table.sizeLog) && table.next.load(std::memory_order_acquire) == nullptr) {
+                Table* newTable = new Table(table.sizeLog + 1);
+                Table* expected = nullptr;
+                if (table.next.compare_exchange_strong(expected, newTable, std::memory_order_acq_rel)) {
+                    STORM_LOG_TRACE("Increasing size of concurrent hash map from " << (1ull << table.sizeLog) << " to " << (1ull << newTable->sizeLog) << ".");
+                } else {
+                    delete newTable;
+                }
+            }
+        }
+
+        template<class ValueType, class Hash>
+        void ConcurrentBitVectorHashMap<ValueType, Hash>::migrate(Table& table) const {
+            Table* next = table.next.load(std::memory_order_acquire);
+            uint64_t numberOfSlots = 1ull << table.sizeLog;
+            uint64_t numberOfChunks = (numberOfSlots + migrationChunkSize - 1) / migrationChunkSize;
+
+            uint64_t chunk = table.nextChunkToMigrate.fetch_add(1, std::memory_order_acq_rel);
+            for (; chunk < numberOfChunks; chunk = table.nextChunkToMigrate.fetch_add(1, std::memory_order_acq_rel)) {
+                uint64_t chunkEnd = std::min((chunk + 1) * migrationChunkSize, numberOfSlots);
+                for (uint64_t slot = chunk * migrationChunkSize; slot < chunkEnd; ++slot) {
+                    // Marking the slot as moved prevents all further insertions into it.
+                    uint64_t content = table.slots[slot].load(std::memory_order_acquire);
+                    while (!table.slots[slot].compare_exchange_weak(content, movedSlot, std::memory_order_acq_rel)) {
+                        // Intentionally left empty.
+                    }
+                    if (content != 0) {
+                        insertMigratedEntry(*next, content - 1);
+                    }
+                }
+                if (table.numberOfMigratedChunks.fetch_add(1, std::memory_order_acq_rel) + 1 == numberOfChunks) {
+                    Table* expected = &table;
+                    currentTable.compare_exchange_strong(expected, next, std::memory_order_acq_rel);
+                }
+            }
+
+            // Wait for the chunks that are migrated by other threads.
+            while (table.numberOfMigratedChunks.load(std::memory_order_acquire) < numberOfChunks) {
+                std::this_thread::yield();
+            }
+        }
+
+        template<class ValueType, class Hash>
+        void ConcurrentBitVectorHashMap<ValueType, Hash>::insertMigratedEntry(Table& table, uint64_t entry) const {
+            uint64_t offset;
+            Segment const& segment = getSegment(entry, offset);
+            uint64_t mask = (1ull << table.sizeLog) - 1;
+            uint64_t slot = getSlotIndex(segment.hashes[offset], table);
+            while (true) {
+                uint64_t expected = 0;
+                if (table.slots[slot].compare_exchange_strong(expected, entry + 1, std::memory_order_acq_rel)) {
+                    table.numberOfElements.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+                slot = (slot + 1) & mask;
+            }
+        }
+
+        template<class ValueType, class Hash>
+        ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::getValue(storm::storage::BitVector const& key) const {
+            uint64_t content = find(key, hasher(key));
+            STORM_LOG_ASSERT(content != 0, "Unknown key.");
+            return getValue(content - 1);
+        }
+
+        template<class ValueType, class Hash>
+        ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::getValue(uint64_t bucket) const {
+            uint64_t offset;
+            Segment const& segment = getSegment(bucket, offset);
+            return segment.values[offset];
+        }
+
+        template<class ValueType, class Hash>
+        std::pair<storm::storage::BitVector, ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::getBucketAndValue(uint64_t bucket) const {
+            uint64_t offset;
+            Segment const& segment = getSegment(bucket, offset);
+            storm::storage::BitVector key(bucketSize);
+            for (uint64_t word = 0; word < wordsPerKey; ++word) {
+                key.setFromInt(word * 64, 64, segment.keys[offset * wordsPerKey + word]);
+            }
+            return std::make_pair(std::move(key), segment.values[offset]);
+        }
+
+        template<class ValueType, class Hash>
+        bool ConcurrentBitVectorHashMap<ValueType, Hash>::contains(storm::storage::BitVector const& key) const {
+            return find(key, hasher(key)) != 0;
+        }
+
+        template<class ValueType, class Hash>
+        typename ConcurrentBitVectorHashMap<ValueType, Hash>::const_iterator ConcurrentBitVectorHashMap<ValueType, Hash>::begin() const {
+            return const_iterator(*this, 0);
+        }
+
+        template<class ValueType, class Hash>
+        typename ConcurrentBitVectorHashMap<ValueType, Hash>::const_iterator ConcurrentBitVectorHashMap<ValueType, Hash>::end() const {
+            return const_iterator(*this, numberOfAllocatedEntries.load(std::memory_order_acquire));
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::size() const {
+            return numberOfElements.load(std::memory_order_acquire);
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::capacity() const {
+            return 1ull << currentTable.load(std::memory_order_acquire)->sizeLog;
+        }
+
+        template<class ValueType, class Hash>
+        void ConcurrentBitVectorHashMap<ValueType, Hash>::remap(std::function<ValueType(ValueType const&)> const& remapping) {
+            uint64_t numberOfBuckets = numberOfAllocatedEntries.load(std::memory_order_acquire);
+            for (uint64_t bucket = 0; bucket < numberOfBuckets; ++bucket) {
+                uint64_t offset;
+                Segment& segment = getSegment(bucket, offset);
+                if (segment.published[offset].load(std::memory_order_relaxed)) {
+                    segment.values[offset] = remapping(segment.values[offset]);
+                }
+            }
+        }
+
+        template class ConcurrentBitVectorHashMap<uint64_t>;
+        template class ConcurrentBitVectorHashMap<uint32_t>;
+    }
+}
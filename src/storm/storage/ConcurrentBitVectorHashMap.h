@@ -0,0 +1,225 @@
+#ifndef STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_
+#define STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * A variant of the BitVectorHashMap that supports concurrent queries and insertions. Keys and values are stored
+         * in an append-only arena whose segments are never moved, so the bucket of a key (its position in the arena)
+         * never changes. The open-addressing table only stores references to the arena that are inserted by a CAS on
+         * the slot, so insertions do not take locks.
+         *
+         * If the load of the table exceeds the load factor, a table of twice the size is created and all threads that
+         * access the map help to migrate the slots of the old table in chunks. Threads only continue in the new table
+         * once the migration is complete. The tables are kept until the map is destroyed, as other threads may still
+         * read from them.
+         *
+         * All methods except for remap may be called concurrently. Note that if several threads insert the same key at
+         * the same time with different values, exactly one of the values is stored and returned to all of them.
+         *
+         * The map is currently not used by the model builders, which explore the state space sequentially.
+         */
+        template<typename ValueType, typename Hash = Murmur3BitVectorHash<ValueType>>
+        class ConcurrentBitVectorHashMap {
+        public:
+            class ConcurrentBitVectorHashMapIterator {
+            public:
+                /*!
+                 * Creates an iterator that points to the given bucket (or the next occupied one) in the given map.
+                 */
+                ConcurrentBitVectorHashMapIterator(ConcurrentBitVectorHashMap const& map, uint64_t bucket);
+
+                // Methods to compare two iterators.
+                bool operator==(ConcurrentBitVectorHashMapIterator const& other) const;
+                bool operator!=(ConcurrentBitVectorHashMapIterator const& other) const;
+
+                // Method to move iterator forward.
+                ConcurrentBitVectorHashMapIterator& operator++();
+
+                // Method to retrieve the currently pointed-to bit vector and its mapped-to value.
+                std::pair<storm::storage::BitVector, ValueType> operator*() const;
+
+            private:
+                void skipUnoccupiedBuckets();
+
+                ConcurrentBitVectorHashMap const& map;
+                uint64_t bucket;
+            };
+
+            typedef ConcurrentBitVectorHashMapIterator const_iterator;
+
+            /*!
+             * Creates a new hash map with the given bucket size and initial size.
+             *
+             * @param bucketSize The size of the keys that this map can hold. This value must be a multiple of 64.
+             * @param initialSize The number of elements that can be stored before the table is resized for the first time.
+             * @param loadFactor The load factor that determines at which point the size of the table is increased.
+             */
+            ConcurrentBitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, double loadFactor = 0.75);
+
+            ~ConcurrentBitVectorHashMap();
+
+            ConcurrentBitVectorHashMap(ConcurrentBitVectorHashMap const&) = delete;
+            ConcurrentBitVectorHashMap& operator=(ConcurrentBitVectorHashMap const&) = delete;
+
+            /*!
+             * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+             * key is inserted with the given value.
+             *
+             * @param key The key to search or insert.
+             * @param value The value that is inserted if the key is not already found in the map.
+             * @return The found value if the key is already contained in the map and the provided new value otherwise.
+             */
+            ValueType findOrAdd(storm::storage::BitVector const& key, ValueType const& value);
+
+            /*!
+             * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+             * key is inserted with the given value.
+             *
+             * @param key The key to search or insert.
+             * @param value The value that is inserted if the key is not already found in the map.
+             * @return A pair whose first component is the found value if the key is already contained in the map and
+             * the provided new value otherwise and whose second component is the (stable) index of the bucket that
+             * holds the key.
+             */
+            std::pair<ValueType, uint64_t> findOrAddAndGetBucket(storm::storage::BitVector const& key, ValueType const& value);
+
+            /*!
+             * Retrieves the key stored in the given bucket and the value it is mapped to.
+             */
+            std::pair<storm::storage::BitVector, ValueType> getBucketAndValue(uint64_t bucket) const;
+
+            /*!
+             * Retrieves the value associated with the given key. If the key does not exist, the behaviour is undefined.
+             */
+            ValueType getValue(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Retrieves the value associated with the given bucket.
+             */
+            ValueType getValue(uint64_t bucket) const;
+
+            /*!
+             * Checks if the given key is already contained in the map.
+             */
+            bool contains(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Retrieves an iterator to the elements of the map (in the order of their buckets). The map must not be
+             * modified while iterating.
+             */
+            const_iterator begin() const;
+
+            /*!
+             * Retrieves an iterator that points one past the elements of the map.
+             */
+            const_iterator end() const;
+
+            /*!
+             * Retrieves the size of the map in terms of the number of key-value pairs it stores.
+             */
+            uint64_t size() const;
+
+            /*!
+             * Retrieves the number of slots of the current table.
+             */
+            uint64_t capacity() const;
+
+            /*!
+             * Performs a remapping of all values stored by applying the given remapping. This must not be called
+             * concurrently with other methods.
+             *
+             * @param remapping The remapping to apply.
+             */
+            void remap(std::function<ValueType(ValueType const&)> const& remapping);
+
+        private:
+            // The arena consists of segments whose sizes double, so there is no need to ever move an entry.
+            static const uint64_t numberOfSegments = 48;
+            static const uint64_t firstSegmentSizeLog = 10;
+
+            struct Segment {
+                Segment(uint64_t numberOfEntries, uint64_t wordsPerKey);
+
+                std::unique_ptr<uint64_t[]> keys;
+                std::unique_ptr<uint64_t[]> hashes;
+                std::unique_ptr<ValueType[]> values;
+                // Whether the entry was published in a table, i.e., whether it is part of the map.
+                std::unique_ptr<std::atomic<bool>[]> published;
+            };
+
+            struct Table {
+                Table(uint64_t sizeLog);
+                ~Table();
+
+                uint64_t sizeLog;
+                // A slot holds zero if it is empty, movedSlot if it was migrated and the entry index plus one otherwise.
+                std::unique_ptr<std::atomic<uint64_t>[]> slots;
+                std::atomic<uint64_t> numberOfElements;
+
+                // The successor of this table (if it is being resized or was resized). It is owned by this table.
+                std::atomic<Table*> next;
+                std::atomic<uint64_t> nextChunkToMigrate;
+                std::atomic<uint64_t> numberOfMigratedChunks;
+            };
+
+            static const uint64_t movedSlot = ~0ull;
+            static const uint64_t migrationChunkSize = 1024;
+
+            uint64_t allocateEntry(storm::storage::BitVector const& key, uint64_t hash, ValueType const& value);
+            Segment& getSegment(uint64_t entry, uint64_t& offset) const;
+            bool keyMatches(uint64_t entry, storm::storage::BitVector const& key) const;
+            uint64_t getSlotIndex(uint64_t hash, Table const& table) const;
+
+            /*!
+             * Searches for the key in the given table and possibly its successors.
+             *
+             * @return The index of the entry holding the key plus one or zero if the key is not contained.
+             */
+            uint64_t find(storm::storage::BitVector const& key, uint64_t hash) const;
+
+            /*!
+             * Helps migrating the given table to its successor and waits until the migration is complete. This is also
+             * called by queries, as the migration does not change the content of the map.
+             */
+            void migrate(Table& table) const;
+
+            /*!
+             * Inserts the given entry (whose key is known not to be contained) into the given table. This is only used
+             * during migration.
+             */
+            void insertMigratedEntry(Table& table, uint64_t entry) const;
+
+            /*!
+             * Creates the successor of the given table if its load is too high.
+             */
+            void checkIncreaseSize(Table& table);
+
+            double loadFactor;
+            uint64_t bucketSize;
+            uint64_t wordsPerKey;
+
+            // The first table owns all other tables.
+            std::unique_ptr<Table> firstTable;
+            mutable std::atomic<Table*> currentTable;
+
+            mutable std::array<std::atomic<Segment*>, numberOfSegments> segments;
+            std::atomic<uint64_t> numberOfAllocatedEntries;
+            std::atomic<uint64_t> numberOfElements;
+
+            Hash hasher;
+        };
+
+    }
+}
+
+#endif /* STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_ */
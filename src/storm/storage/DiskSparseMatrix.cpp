@@ -0,0 +1,352 @@
+#include "storm/storage/DiskSparseMatrix.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidOperationException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+#ifndef WINDOWS
+#include <fcntl.h>
+#include <sys/stat.h>
+#endif
+
+namespace storm {
+    namespace storage {
+
+        namespace {
+            const char diskSparseMatrixMagic[8] = {'S', 'T', 'O', 'R', 'M', 'C', 'S', 'R'};
+            const uint64_t diskSparseMatrixVersion = 1;
+
+            struct DiskSparseMatrixHeader {
+                char magic[8];
+                uint64_t version;
+                uint64_t valueSize;
+                uint64_t hasCustomRowGrouping;
+                uint64_t rowCount;
+                uint64_t columnCount;
+                uint64_t entryCount;
+                uint64_t rowGroupCount;
+            };
+
+            template<typename T>
+            void writeChunk(std::ofstream& stream, std::vector<T>& chunk) {
+                stream.write(reinterpret_cast<char const*>(chunk.data()), chunk.size() * sizeof(T));
+                chunk.clear();
+            }
+
+            void appendFile(std::ofstream& target, std::string const& sourceFilename) {
+                std::ifstream source(sourceFilename, std::ios::binary);
+                STORM_LOG_THROW(source, storm::exceptions::FileIoException, "Could not open file " << sourceFilename << ".");
+                // The stream buffer is copied in blocks, so the file is not loaded into memory as a whole.
+                if (source.peek() != std::ifstream::traits_type::eof()) {
+                    target << source.rdbuf();
+                }
+                source.close();
+            }
+        }
+
+        template<typename ValueType>
+        DiskSparseMatrixWriter<ValueType>::DiskSparseMatrixWriter(std::string const& filename, bool hasCustomRowGrouping, uint64_t chunkSize) : filename(filename), hasCustomRowGrouping(hasCustomRowGrouping), chunkSize(std::max<uint64_t>(chunkSize, 1)), finalized(false), currentRow(0), numberOfEntries(0), lastColumn(0), rowIndicationsChunk({0}), numberOfRowGroups(0) {
+            rowGroupIndicesStream.open(filename + ".rowgroups.tmp", std::ios::binary | std::ios::trunc);
+            rowIndicationsStream.open(filename + ".rows.tmp", std::ios::binary | std::ios::trunc);
+            columnsStream.open(filename + ".columns.tmp", std::ios::binary | std::ios::trunc);
+            valuesStream.open(filename + ".values.tmp", std::ios::binary | std::ios::trunc);
+            STORM_LOG_THROW(rowGroupIndicesStream && rowIndicationsStream && columnsStream && valuesStream, storm::exceptions::FileIoException, "Could not open the temporary files for writing matrix " << filename << ".");
+        }
+
+        template<typename ValueType>
+        DiskSparseMatrixWriter<ValueType>::~DiskSparseMatrixWriter() {
+            if (!finalized) {
+                removeTemporaryFiles();
+            }
+        }
+
+        template<typename ValueType>
+        void DiskSparseMatrixWriter<ValueType>::addNextValue(uint64_t row, uint64_t column, ValueType const& value) {
+            STORM_LOG_THROW(!finalized, storm::exceptions::InvalidOperationException, "Cannot add entries to a finalized matrix.");
+            STORM_LOG_THROW(row >= currentRow, storm::exceptions::InvalidArgumentException, "Adding an element in row " << row << ", but an element in row " << currentRow << " has already been added.");
+            if (row > currentRow) {
+                advanceToRow(row);
+            } else if (numberOfEntries > rowIndicationsChunk.back()) {
+                // The current row already has entries.
+                STORM_LOG_THROW(column > lastColumn, storm::exceptions::InvalidArgumentException, "Adding an element in column " << column << " of row " << row << ", but an element in column " << lastColumn << " has already been added.");
+            }
+            columnsChunk.push_back(column);
+            valuesChunk.push_back(value);
+            lastColumn = column;
+            ++numberOfEntries;
+            if (columnsChunk.size() >= chunkSize) {
+                flushChunks();
+            }
+        }
+
+        template<typename ValueType>
+        void DiskSparseMatrixWriter<ValueType>::newRowGroup(uint64_t startingRow) {
+            STORM_LOG_THROW(!finalized, storm::exceptions::InvalidOperationException, "Cannot add row groups to a finalized matrix.");
+            STORM_LOG_THROW(hasCustomRowGrouping, storm::exceptions::InvalidOperationException, "Matrix writer was not created to have a custom row grouping.");
+            STORM_LOG_THROW(startingRow >= currentRow, storm::exceptions::InvalidArgumentException, "Illegal row group starting at row " << startingRow << " as rows up to " << currentRow << " have already been added.");
+            rowGroupIndicesChunk.push_back(startingRow);
+            ++numberOfRowGroups;
+            if (rowGroupIndicesChunk.size() >= chunkSize) {
+                flushChunks();
+            }
+        }
+
+        template<typename ValueType>
+        uint64_t DiskSparseMatrixWriter<ValueType>::getCurrentRowGroupCount() const {
+            return numberOfRowGroups;
+        }
+
+        template<typename ValueType>
+        uint64_t DiskSparseMatrixWriter<ValueType>::getLastRow() const {
+            return currentRow;
+        }
+
+        template<typename ValueType>
+        uint64_t DiskSparseMatrixWriter<ValueType>::getEntryCount() const {
+            return numberOfEntries;
+        }
+
+        template<typename ValueType>
+        void DiskSparseMatrixWriter<ValueType>::advanceToRow(uint64_t row) {
+            for (; currentRow < row; ++currentRow) {
+                rowIndicationsChunk.push_back(numberOfEntries);
+                if (rowIndicationsChunk.size() >= chunkSize) {
+                    flushChunks();
+                }
+            }
+        }
+
+        template<typename ValueType>
+        void DiskSparseMatrixWriter<ValueType>::flushChunks() {
+            // The last row indication is the start of the current row, which is needed to detect whether it already has
+            // entries. It is therefore only written with the next chunk.
+            uint64_t lastRowIndication = rowIndicationsChunk.empty() ? 0 : rowIndicationsChunk.back();
+            bool keepLastRowIndication = !rowIndicationsChunk.empty();
+            if (keepLastRowIndication) {
+                rowIndicationsChunk.pop_back();
+            }
+            writeChunk(rowGroupIndicesStream, rowGroupIndicesChunk);
+            writeChunk(rowIndicationsStream, rowIndicationsChunk);
+            writeChunk(columnsStream, columnsChunk);
+            writeChunk(valuesStream, valuesChunk);
+            if (keepLastRowIndication) {
+                rowIndicationsChunk.push_back(lastRowIndication);
+            }
+            STORM_LOG_THROW(rowGroupIndicesStream && rowIndicationsStream && columnsStream && valuesStream, storm::exceptions::FileIoException, "Could not write to the temporary files of matrix " << filename << ".");
+        }
+
+        template<typename ValueType>
+        void DiskSparseMatrixWriter<ValueType>::finalize(uint64_t rowCount, uint64_t columnCount, uint64_t rowGroupCount) {
+            STORM_LOG_THROW(!finalized, storm::exceptions::InvalidOperationException, "The matrix was already finalized.");
+            bool currentRowHasEntries = numberOfEntries > rowIndicationsChunk.back();
+            STORM_LOG_THROW(rowCount > currentRow || (rowCount == currentRow && !currentRowHasEntries), storm::exceptions::InvalidArgumentException, "Cannot finalize a matrix with " << rowCount << " rows as there are entries in row " << currentRow << ".");
+            advanceToRow(rowCount);
+
+            if (hasCustomRowGrouping) {
+                STORM_LOG_THROW(numberOfRowGroups <= rowGroupCount, storm::exceptions::InvalidArgumentException, "Cannot finalize a matrix with " << rowGroupCount << " row groups as " << numberOfRowGroups << " row groups have been opened.");
+                // Groups that were not opened are empty.
+                for (; numberOfRowGroups < rowGroupCount; ++numberOfRowGroups) {
+                    rowGroupIndicesChunk.push_back(rowCount);
+                }
+                rowGroupIndicesChunk.push_back(rowCount);
+            } else {
+                rowGroupCount = rowCount;
+                for (uint64_t row = 0; row <= rowCount; ++row) {
+                    rowGroupIndicesChunk.push_back(row);
+                    if (rowGroupIndicesChunk.size() >= chunkSize) {
+                        writeChunk(rowGroupIndicesStream, rowGroupIndicesChunk);
+                    }
+                }
+            }
+            flushChunks();
+            writeChunk(rowIndicationsStream, rowIndicationsChunk);
+            rowGroupIndicesStream.close();
+            rowIndicationsStream.close();
+            columnsStream.close();
+            valuesStream.close();
+
+            DiskSparseMatrixHeader header;
+            std::memcpy(header.magic, diskSparseMatrixMagic, sizeof(diskSparseMatrixMagic));
+            header.version = diskSparseMatrixVersion;
+            header.valueSize = sizeof(ValueType);
+            header.hasCustomRowGrouping = hasCustomRowGrouping ? 1 : 0;
+            header.rowCount = rowCount;
+            header.columnCount = columnCount;
+            header.entryCount = numberOfEntries;
+            header.rowGroupCount = rowGroupCount;
+
+            std::ofstream target(filename, std::ios::binary | std::ios::trunc);
+            STORM_LOG_THROW(target, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+            target.write(reinterpret_cast<char const*>(&header), sizeof(header));
+            appendFile(target, filename + ".rowgroups.tmp");
+            appendFile(target, filename + ".rows.tmp");
+            appendFile(target, filename + ".columns.tmp");
+            appendFile(target, filename + ".values.tmp");
+            STORM_LOG_THROW(target, storm::exceptions::FileIoException, "Could not write matrix to file " << filename << ".");
+            target.close();
+
+            removeTemporaryFiles();
+            finalized = true;
+        }
+
+        template<typename ValueType>
+        void DiskSparseMatrixWriter<ValueType>::removeTemporaryFiles() {
+            rowGroupIndicesStream.close();
+            rowIndicationsStream.close();
+            columnsStream.close();
+            valuesStream.close();
+            std::remove((filename + ".rowgroups.tmp").c_str());
+            std::remove((filename + ".rows.tmp").c_str());
+            std::remove((filename + ".columns.tmp").c_str());
+            std::remove((filename + ".values.tmp").c_str());
+        }
+
+        template<typename ValueType>
+        DiskSparseMatrix<ValueType>::DiskSparseMatrix(std::string const& filename) : filename(filename), mappedData(nullptr), mappedSize(0) {
+#ifdef WINDOWS
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Mapping matrices from disk is not supported on this platform.");
+#else
+            int fileDescriptor = open(filename.c_str(), O_RDONLY);
+            STORM_LOG_THROW(fileDescriptor >= 0, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+            struct stat fileStatus;
+            if (fstat(fileDescriptor, &fileStatus) != 0 || static_cast<uint64_t>(fileStatus.st_size) < sizeof(DiskSparseMatrixHeader)) {
+                close(fileDescriptor);
+                STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "File " << filename << " does not contain a matrix.");
+            }
+            mappedSize = fileStatus.st_size;
+            mappedData = mmap(nullptr, mappedSize, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+            // The mapping remains valid after closing the file.
+            close(fileDescriptor);
+            STORM_LOG_THROW(mappedData != MAP_FAILED, storm::exceptions::FileIoException, "Could not map file " << filename << " into memory.");
+            // The operations traverse the matrix from the first to the last row.
+            madvise(mappedData, mappedSize, MADV_SEQUENTIAL);
+#endif
+
+            DiskSparseMatrixHeader const& header = *reinterpret_cast<DiskSparseMatrixHeader const*>(mappedData);
+            rowCount = header.rowCount;
+            columnCount = header.columnCount;
+            entryCount = header.entryCount;
+            rowGroupCount = header.rowGroupCount;
+            uint64_t expectedSize = sizeof(DiskSparseMatrixHeader) + (rowGroupCount + 1 + rowCount + 1 + entryCount) * sizeof(uint64_t) + entryCount * sizeof(ValueType);
+            if (std::memcmp(header.magic, diskSparseMatrixMagic, sizeof(diskSparseMatrixMagic)) != 0 || header.version != diskSparseMatrixVersion || header.valueSize != sizeof(ValueType) || mappedSize != expectedSize) {
+#ifndef WINDOWS
+                munmap(mappedData, mappedSize);
+#endif
+                mappedData = nullptr;
+                STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "File " << filename << " does not contain a matrix of the expected format.");
+            }
+
+            rowGroupIndices = reinterpret_cast<uint64_t const*>(static_cast<char const*>(mappedData) + sizeof(DiskSparseMatrixHeader));
+            rowIndications = rowGroupIndices + rowGroupCount + 1;
+            columns = rowIndications + rowCount + 1;
+            values = reinterpret_cast<ValueType const*>(columns + entryCount);
+        }
+
+        template<typename ValueType>
+        DiskSparseMatrix<ValueType>::~DiskSparseMatrix() {
+#ifndef WINDOWS
+            if (mappedData != nullptr) {
+                munmap(mappedData, mappedSize);
+            }
+#endif
+        }
+
+        template<typename ValueType>
+        uint64_t DiskSparseMatrix<ValueType>::getRowCount() const {
+            return rowCount;
+        }
+
+        template<typename ValueType>
+        uint64_t DiskSparseMatrix<ValueType>::getColumnCount() const {
+            return columnCount;
+        }
+
+        template<typename ValueType>
+        uint64_t DiskSparseMatrix<ValueType>::getEntryCount() const {
+            return entryCount;
+        }
+
+        template<typename ValueType>
+        uint64_t DiskSparseMatrix<ValueType>::getRowGroupCount() const {
+            return rowGroupCount;
+        }
+
+        template<typename ValueType>
+        uint64_t DiskSparseMatrix<ValueType>::getRowGroupStart(uint64_t rowGroup) const {
+            STORM_LOG_ASSERT(rowGroup <= rowGroupCount, "Row group " << rowGroup << " is out of range.");
+            return rowGroupIndices[rowGroup];
+        }
+
+        template<typename ValueType>
+        void DiskSparseMatrix<ValueType>::multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint64_t>* choices, storm::storage::BitVector const* dirOverride) const {
+            STORM_LOG_ASSERT(vector.size() >= columnCount, "Vector has insufficient size.");
+            STORM_LOG_ASSERT(result.size() >= rowGroupCount, "Result vector has insufficient size.");
+            STORM_LOG_ASSERT(!summand || summand->size() >= rowCount, "Summand has insufficient size.");
+            STORM_LOG_ASSERT(!choices || choices->size() >= rowGroupCount, "Choice vector has insufficient size.");
+            bool const minimize = storm::solver::minimize(dir);
+            bool const dirOverridden = dirOverride && !dirOverride->empty();
+
+            for (uint64_t rowGroup = 0; rowGroup < rowGroupCount; ++rowGroup) {
+                uint64_t const groupStart = rowGroupIndices[rowGroup];
+                uint64_t const groupEnd = rowGroupIndices[rowGroup + 1];
+                if (groupStart == groupEnd) {
+                    result[rowGroup] = storm::utility::zero<ValueType>();
+                    if (choices) {
+                        (*choices)[rowGroup] = 0;
+                    }
+                    continue;
+                }
+                bool const groupMinimizes = (dirOverridden && dirOverride->get(rowGroup)) ? !minimize : minimize;
+
+                ValueType bestValue = storm::utility::zero<ValueType>();
+                uint64_t bestRow = groupStart;
+                for (uint64_t row = groupStart; row < groupEnd; ++row) {
+                    ValueType currentValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+                    for (uint64_t entry = rowIndications[row], entryEnd = rowIndications[row + 1]; entry < entryEnd; ++entry) {
+                        currentValue += values[entry] * vector[columns[entry]];
+                    }
+                    if (row == groupStart || (groupMinimizes ? currentValue < bestValue : currentValue > bestValue)) {
+                        bestValue = currentValue;
+                        bestRow = row;
+                    }
+                }
+                result[rowGroup] = bestValue;
+                if (choices) {
+                    (*choices)[rowGroup] = bestRow - groupStart;
+                }
+            }
+        }
+
+        template<typename ValueType>
+        storm::storage::SparseMatrix<ValueType> DiskSparseMatrix<ValueType>::toSparseMatrix() const {
+            DiskSparseMatrixHeader const& header = *reinterpret_cast<DiskSparseMatrixHeader const*>(mappedData);
+            bool hasCustomRowGrouping = header.hasCustomRowGrouping != 0;
+            storm::storage::SparseMatrixBuilder<ValueType> builder(rowCount, columnCount, entryCount, true, hasCustomRowGrouping, hasCustomRowGrouping ? rowGroupCount : 0);
+            for (uint64_t rowGroup = 0; rowGroup < rowGroupCount; ++rowGroup) {
+                if (hasCustomRowGrouping) {
+                    builder.newRowGroup(rowGroupIndices[rowGroup]);
+                }
+                for (uint64_t row = rowGroupIndices[rowGroup]; row < rowGroupIndices[rowGroup + 1]; ++row) {
+                    for (uint64_t entry = rowIndications[row]; entry < rowIndications[row + 1]; ++entry) {
+                        builder.addNextValue(row, columns[entry], values[entry]);
+                    }
+                }
+            }
+            return builder.build();
+        }
+
+        template class DiskSparseMatrixWriter<double>;
+        template class DiskSparseMatrix<double>;
+    }
+}
@@ -0,0 +1,177 @@
+#ifndef STORM_STORAGE_DISKSPARSEMATRIX_H_
+#define STORM_STORAGE_DISKSPARSEMATRIX_H_
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+
+        template<typename ValueType>
+        class SparseMatrix;
+
+        /*!
+         * Writes a sparse matrix in compressed row storage (CSR) format to a file without keeping the matrix in memory.
+         * Rows need to be added in ascending order (and the entries of a row in ascending column order). The entries,
+         * row and row group indications are buffered in chunks of the given size and appended to temporary files next to
+         * the target file. Once the matrix is finalized, the target file is assembled from the temporary files.
+         *
+         * The file consists of a header (a magic string, the format version, the size of a value, whether the matrix has
+         * a custom row grouping and the number of rows, columns, entries and row groups as 64 bit integers), the row
+         * group indices (row group count + 1), the row indications (row count + 1),
+         * the columns (entry count, each 64 bit) and the values (entry count). It can be read with a DiskSparseMatrix.
+         */
+        template<typename ValueType>
+        class DiskSparseMatrixWriter {
+        public:
+            /*!
+             * Creates a writer for the given file.
+             *
+             * @param filename The name of the file the matrix is written to.
+             * @param hasCustomRowGrouping If set, row groups are opened with newRowGroup. Otherwise, every row is its own group.
+             * @param chunkSize The number of entries (and rows) that are buffered before they are written to disk.
+             */
+            DiskSparseMatrixWriter(std::string const& filename, bool hasCustomRowGrouping, uint64_t chunkSize = 1ull << 20);
+
+            ~DiskSparseMatrixWriter();
+
+            DiskSparseMatrixWriter(DiskSparseMatrixWriter const&) = delete;
+            DiskSparseMatrixWriter& operator=(DiskSparseMatrixWriter const&) = delete;
+
+            /*!
+             * Adds the given entry to the matrix. The row must not be smaller than the row of the previous entry.
+             */
+            void addNextValue(uint64_t row, uint64_t column, ValueType const& value);
+
+            /*!
+             * Starts a new row group at the given row, which must not be smaller than the start of the previous group.
+             */
+            void newRowGroup(uint64_t startingRow);
+
+            /*!
+             * Retrieves the number of row groups that were opened so far.
+             */
+            uint64_t getCurrentRowGroupCount() const;
+
+            /*!
+             * Retrieves the most recently used row.
+             */
+            uint64_t getLastRow() const;
+
+            /*!
+             * Retrieves the number of entries that were added so far.
+             */
+            uint64_t getEntryCount() const;
+
+            /*!
+             * Writes the remaining buffered data and assembles the file. Afterwards, no more entries can be added.
+             *
+             * @param rowCount The number of rows of the matrix. It must not be smaller than the number of rows seen so far.
+             * @param columnCount The number of columns of the matrix.
+             * @param rowGroupCount The number of row groups of the matrix (only used with custom row groupings).
+             */
+            void finalize(uint64_t rowCount, uint64_t columnCount, uint64_t rowGroupCount);
+
+        private:
+            /*!
+             * Closes all rows up to (excluding) the given one.
+             */
+            void advanceToRow(uint64_t row);
+
+            void flushChunks();
+            void removeTemporaryFiles();
+
+            std::string filename;
+            bool hasCustomRowGrouping;
+            uint64_t chunkSize;
+            bool finalized;
+
+            // The row whose entries are currently added and the number of entries added so far.
+            uint64_t currentRow;
+            uint64_t numberOfEntries;
+            uint64_t lastColumn;
+
+            // The buffered parts of the matrix that are not written to the temporary files yet.
+            std::vector<uint64_t> rowGroupIndicesChunk;
+            std::vector<uint64_t> rowIndicationsChunk;
+            std::vector<uint64_t> columnsChunk;
+            std::vector<ValueType> valuesChunk;
+            uint64_t numberOfRowGroups;
+
+            std::ofstream rowGroupIndicesStream;
+            std::ofstream rowIndicationsStream;
+            std::ofstream columnsStream;
+            std::ofstream valuesStream;
+        };
+
+        /*!
+         * A read-only sparse matrix that is stored in a file written by a DiskSparseMatrixWriter. The file is mapped into
+         * memory, so the operating system only keeps the pages that are currently accessed in memory. As the operations
+         * traverse the matrix row by row, the matrix is streamed from disk if it does not fit in memory.
+         */
+        template<typename ValueType>
+        class DiskSparseMatrix {
+        public:
+            /*!
+             * Maps the given file into memory.
+             */
+            DiskSparseMatrix(std::string const& filename);
+
+            ~DiskSparseMatrix();
+
+            DiskSparseMatrix(DiskSparseMatrix const&) = delete;
+            DiskSparseMatrix& operator=(DiskSparseMatrix const&) = delete;
+
+            uint64_t getRowCount() const;
+            uint64_t getColumnCount() const;
+            uint64_t getEntryCount() const;
+            uint64_t getRowGroupCount() const;
+
+            /*!
+             * Retrieves the first row of the given row group. The group after the last one starts at the row count.
+             */
+            uint64_t getRowGroupStart(uint64_t rowGroup) const;
+
+            /*!
+             * Multiplies the matrix with the given vector, adds the summand (if given) and reduces every row group to the
+             * minimal or maximal value. This behaves like SparseMatrix::multiplyAndReduce.
+             *
+             * @param dir The direction of the reduction.
+             * @param vector The vector with which to multiply the matrix.
+             * @param summand If given, this summand (with one value per row) is added to the result of the multiplication.
+             * @param result The vector that is supposed to hold the result (with one value per row group).
+             * @param choices If given, the selected (local) row of every row group is stored in this vector.
+             * @param dirOverride If given, the row groups whose bit is set are reduced in the opposite direction.
+             */
+            void multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr, storm::storage::BitVector const* dirOverride = nullptr) const;
+
+            /*!
+             * Loads the matrix into memory.
+             */
+            storm::storage::SparseMatrix<ValueType> toSparseMatrix() const;
+
+        private:
+            std::string filename;
+            void* mappedData;
+            uint64_t mappedSize;
+
+            uint64_t rowCount;
+            uint64_t columnCount;
+            uint64_t entryCount;
+            uint64_t rowGroupCount;
+
+            uint64_t const* rowGroupIndices;
+            uint64_t const* rowIndications;
+            uint64_t const* columns;
+            ValueType const* values;
+        };
+
+    }
+}
+
+#endif /* STORM_STORAGE_DISKSPARSEMATRIX_H_ */
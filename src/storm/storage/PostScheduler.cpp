@@ -40,6 +40,18 @@ namespace storm {
             schedulerChoiceMapping[memoryState][modelState] = choice;
         }
 
+        template <typename ValueType>
+        PostSchedulerChoice<ValueType> const& PostScheduler<ValueType>::getChoice(uint_fast64_t modelState, uint_fast64_t memoryState) const {
+            STORM_LOG_ASSERT(memoryState == 0, "Currently we do not support PostScheduler with memory");
+            STORM_LOG_ASSERT(modelState < schedulerChoiceMapping[memoryState].size(), "Illegal model state index");
+            return schedulerChoiceMapping[memoryState][modelState];
+        }
+
+        template <typename ValueType>
+        uint_fast64_t PostScheduler<ValueType>::getNumberOfModelStates() const {
+            return schedulerChoiceMapping.front().size();
+        }
+
         template <typename ValueType>
         bool PostScheduler<ValueType>::isDeterministicScheduler() const {
             return true;
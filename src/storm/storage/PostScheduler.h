@@ -37,6 +37,19 @@ namespace storm {
              */
             void setChoice(PostSchedulerChoice<ValueType> const& newChoice, uint_fast64_t modelState, uint_fast64_t memoryState = 0);
 
+            /*!
+             * Retrieves the choice correction defined by the scheduler for the given state.
+             *
+             * @param modelState The state of the model for which to retrieve the choice.
+             * @param memoryState The state of the memoryStructure for which to retrieve the choice.
+             */
+            PostSchedulerChoice<ValueType> const& getChoice(uint_fast64_t modelState, uint_fast64_t memoryState = 0) const;
+
+            /*!
+             * Retrieves the number of model states this scheduler considers.
+             */
+            uint_fast64_t getNumberOfModelStates() const;
+
             /*!
              * Is the scheduler defined on the states indicated by the selected-states bitvector?
              */
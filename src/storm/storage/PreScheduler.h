@@ -31,6 +31,16 @@ namespace storm {
 
             void setChoice(PreSchedulerChoice<ValueType> const& choice, uint_fast64_t modelState, uint_fast64_t memoryState);
 
+            /*!
+             * Retrieves the choices allowed by the scheduler in the given state.
+             */
+            PreSchedulerChoice<ValueType> const& getChoice(uint_fast64_t modelState, uint_fast64_t memoryState = 0) const;
+
+            /*!
+             * Retrieves the number of model states this scheduler considers.
+             */
+            uint_fast64_t getNumberOfModelStates() const;
+
             /*!
              * Prints the scheduler to the given output stream.
              */
@@ -1,6 +1,10 @@
 #include "storm/storage/bisimulation/NondeterministicModelBisimulationDecomposition.h"
 
+#include <algorithm>
+#include <iterator>
+
 #include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/Smg.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/utility/graph.h"
@@ -18,6 +22,23 @@ namespace storm {
         template<typename ModelType>
         NondeterministicModelBisimulationDecomposition<ModelType>::NondeterministicModelBisimulationDecomposition(ModelType const& model, typename BisimulationDecomposition<ModelType, NondeterministicModelBisimulationDecomposition::BlockDataType>::Options const& options) : BisimulationDecomposition<ModelType, NondeterministicModelBisimulationDecomposition::BlockDataType>(model, model.getTransitionMatrix().transpose(false), options), choiceToStateMapping(model.getNumberOfChoices()), quotientDistributions(model.getNumberOfChoices()), orderedQuotientDistributions(model.getNumberOfChoices()) {
             STORM_LOG_THROW(options.getType() == BisimulationType::Strong, storm::exceptions::IllegalFunctionCallException, "Weak bisimulation is currently not supported for nondeterministic models.");
+            if (model.isOfType(storm::models::ModelType::Smg) && this->options.measureDrivenInitialPartition) {
+                // The probability 0/1 states are computed for a single optimizing player, which is unsound for games.
+                STORM_LOG_INFO("Measure-driven initial partition is not supported for games. Falling back to label-based initial partition.");
+                this->options.measureDrivenInitialPartition = false;
+            }
+        }
+        
+        template<typename ModelType>
+        std::vector<storm::storage::sparse::state_type> const& NondeterministicModelBisimulationDecomposition<ModelType>::getQuotientStateMapping() const {
+            STORM_LOG_THROW(this->quotient != nullptr, storm::exceptions::IllegalFunctionCallException, "Unable to retrieve quotient state mapping, because the quotient was not built.");
+            return quotientStateMapping;
+        }
+        
+        template<typename ModelType>
+        std::vector<uint_fast64_t> const& NondeterministicModelBisimulationDecomposition<ModelType>::getQuotientChoiceMapping() const {
+            STORM_LOG_THROW(this->quotient != nullptr, storm::exceptions::IllegalFunctionCallException, "Unable to retrieve quotient choice mapping, because the quotient was not built.");
+            return quotientChoiceMapping;
         }
         
         template<typename ModelType>
@@ -32,10 +53,23 @@ namespace storm {
         
         template<typename ModelType>
         void NondeterministicModelBisimulationDecomposition<ModelType>::initialize() {
+            this->splitInitialPartitionBasedOnPlayers();
             this->createChoiceToStateMapping();
             this->initializeQuotientDistributions();
         }
         
+        template<typename ModelType>
+        void NondeterministicModelBisimulationDecomposition<ModelType>::splitInitialPartitionBasedOnPlayers() {
+            auto const* game = dynamic_cast<storm::models::sparse::Smg<ValueType, RewardModelType> const*>(&this->model);
+            if (game == nullptr) {
+                return;
+            }
+            
+            // States of different players must never be merged, as this would change who resolves the nondeterminism.
+            std::vector<storm::storage::PlayerIndex> const& statePlayerIndications = game->getStatePlayerIndications();
+            this->partition.split([&statePlayerIndications] (storm::storage::sparse::state_type const& a, storm::storage::sparse::state_type const& b) { return statePlayerIndications[a] < statePlayerIndications[b]; });
+        }
+        
         template<typename ModelType>
         void NondeterministicModelBisimulationDecomposition<ModelType>::createChoiceToStateMapping() {
             std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
@@ -99,7 +133,8 @@ namespace storm {
             // In order to create the quotient model, we need to construct
             // (a) the new transition matrix,
             // (b) the new labeling,
-            // (c) the new reward structures.
+            // (c) the new reward structures,
+            // (d) the new player indications (if the model is a game).
             
             // Prepare a matrix builder for (a).
             storm::storage::SparseMatrixBuilder<ValueType> builder(0, this->size(), 0, false, true, this->size());
@@ -127,7 +162,18 @@ namespace storm {
                 }
             }
             
-            // Now build (a) and (b) by traversing all blocks.
+            // Prepare the player indications for (d).
+            auto const* game = dynamic_cast<storm::models::sparse::Smg<ValueType, RewardModelType> const*>(&this->model);
+            boost::optional<std::vector<storm::storage::PlayerIndex>> statePlayerIndications;
+            if (game != nullptr) {
+                statePlayerIndications = std::vector<storm::storage::PlayerIndex>(this->size(), storm::storage::INVALID_PLAYER_INDEX);
+            }
+            
+            // Keep track of where the states and choices of the original model end up.
+            quotientStateMapping.resize(this->model.getNumberOfStates());
+            quotientChoiceMapping.resize(this->model.getNumberOfChoices());
+            
+            // Now build (a), (b) and (d) by traversing all blocks.
             uint_fast64_t currentRow = 0;
             std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
             for (uint_fast64_t blockIndex = 0; blockIndex < this->blocks.size(); ++blockIndex) {
@@ -141,9 +187,22 @@ namespace storm {
                 storm::storage::sparse::state_type representativeState = *block.begin();
                 Block<BlockDataType> const& oldBlock = this->partition.getBlock(representativeState);
                 
+                // All states of a block are owned by the same player.
+                if (statePlayerIndications) {
+                    statePlayerIndications.get()[blockIndex] = game->getPlayerOfState(representativeState);
+                }
+                for (auto state : block) {
+                    quotientStateMapping[state] = blockIndex;
+                }
+                
                 // If the block is absorbing, we simply add a self-loop.
                 if (oldBlock.data().absorbing()) {
                     builder.addNextValue(currentRow, blockIndex, storm::utility::one<ValueType>());
+                    for (auto state : block) {
+                        for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
+                            quotientChoiceMapping[choice] = currentRow;
+                        }
+                    }
                     ++currentRow;
                     
                     // If the block has a special representative state, we retrieve it now.
@@ -165,6 +224,7 @@ namespace storm {
                     }
                 } else {
                     // Add the outgoing choices of the block.
+                    uint_fast64_t firstRowOfBlock = currentRow;
                     for (uint_fast64_t choice = nondeterministicChoiceIndices[representativeState]; choice < nondeterministicChoiceIndices[representativeState + 1]; ++choice) {
                         // If the choice is the same as the last one, we do not need to add it.
                         if (choice > nondeterministicChoiceIndices[representativeState] && quotientDistributions[choice - 1].equals(quotientDistributions[choice], this->comparator)) {
@@ -180,6 +240,22 @@ namespace storm {
                         ++currentRow;
                     }
                     
+                    // Map the choices of all states in the block to the quotient choice with the same distribution.
+                    // As all states in the block are bisimilar, such a choice is guaranteed to exist.
+                    std::vector<storm::storage::DistributionWithReward<ValueType> const*> quotientRowDistributions;
+                    for (uint_fast64_t choice = nondeterministicChoiceIndices[representativeState]; choice < nondeterministicChoiceIndices[representativeState + 1]; ++choice) {
+                        if (choice == nondeterministicChoiceIndices[representativeState] || !quotientDistributions[choice - 1].equals(quotientDistributions[choice], this->comparator)) {
+                            quotientRowDistributions.push_back(&quotientDistributions[choice]);
+                        }
+                    }
+                    for (auto state : block) {
+                        for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
+                            auto rowIt = std::find_if(quotientRowDistributions.begin(), quotientRowDistributions.end(), [&] (storm::storage::DistributionWithReward<ValueType> const* distribution) { return distribution->equals(quotientDistributions[choice], this->comparator); });
+                            STORM_LOG_ASSERT(rowIt != quotientRowDistributions.end(), "Unable to find quotient choice for choice " << choice << " of state " << state << ".");
+                            quotientChoiceMapping[choice] = firstRowOfBlock + std::distance(quotientRowDistributions.begin(), rowIt);
+                        }
+                    }
+                    
                     // Otherwise add all atomic propositions to the equivalence class that the representative state
                     // satisfies.
                     for (auto const& ap : atomicPropositions) {
@@ -211,7 +287,12 @@ namespace storm {
             }
             
             // Finally construct the quotient model.
-            this->quotient = std::make_shared<ModelType>(builder.build(0,this->size(), this->size()), std::move(newLabeling), std::move(rewardModels));
+            storm::storage::sparse::ModelComponents<ValueType, RewardModelType> components(builder.build(0,this->size(), this->size()), std::move(newLabeling), std::move(rewardModels));
+            if (statePlayerIndications) {
+                components.statePlayerIndications = std::move(statePlayerIndications.get());
+                components.playerNameToIndexMap = game->getPlayerNameToIndexMap();
+            }
+            this->quotient = std::make_shared<ModelType>(std::move(components));
         }
         
         template<typename ModelType>
@@ -426,10 +507,13 @@ namespace storm {
         }
         
         template class NondeterministicModelBisimulationDecomposition<storm::models::sparse::Mdp<double>>;
+        template class NondeterministicModelBisimulationDecomposition<storm::models::sparse::Smg<double>>;
 
 #ifdef STORM_HAVE_CARL
         template class NondeterministicModelBisimulationDecomposition<storm::models::sparse::Mdp<storm::RationalNumber>>;
         template class NondeterministicModelBisimulationDecomposition<storm::models::sparse::Mdp<storm::RationalFunction>>;
+        template class NondeterministicModelBisimulationDecomposition<storm::models::sparse::Smg<storm::RationalNumber>>;
+        template class NondeterministicModelBisimulationDecomposition<storm::models::sparse::Smg<storm::RationalFunction>>;
 #endif
     }
 }
@@ -10,7 +10,9 @@ namespace storm {
     namespace storage {
         
         /*!
-         * This class represents the decomposition of a nondeterministic model into its bisimulation quotient.
+         * This class represents the decomposition of a nondeterministic model into its bisimulation quotient. If the
+         * model is a stochastic multiplayer game, only states that are controlled by the same player are considered
+         * equivalent and the quotient is again a game.
          */
         template<typename ModelType>
         class NondeterministicModelBisimulationDecomposition : public BisimulationDecomposition<ModelType, bisimulation::DeterministicBlockData> {
@@ -28,6 +30,21 @@ namespace storm {
              */
             NondeterministicModelBisimulationDecomposition(ModelType const& model, typename BisimulationDecomposition<ModelType, BlockDataType>::Options const& options = typename BisimulationDecomposition<ModelType, BlockDataType>::Options());
             
+            /*!
+             * Retrieves a mapping from the states of the original model to the states of the quotient.
+             *
+             * @pre The quotient has been built.
+             */
+            std::vector<storm::storage::sparse::state_type> const& getQuotientStateMapping() const;
+            
+            /*!
+             * Retrieves a mapping from the choices (rows) of the original model to the choices (rows) of the quotient.
+             * As equal choices of a state are merged in the quotient, several choices may be mapped to the same row.
+             *
+             * @pre The quotient has been built.
+             */
+            std::vector<uint_fast64_t> const& getQuotientChoiceMapping() const;
+            
         protected:
             virtual std::pair<storm::storage::BitVector, storm::storage::BitVector> getStatesWithProbability01() override;
             
@@ -41,6 +58,10 @@ namespace storm {
             // Creates the mapping from the choice indices to the states.
             void createChoiceToStateMapping();
             
+            // Splits the initial partition such that each block only contains states of a single player. This has no
+            // effect if the model is not a game.
+            void splitInitialPartitionBasedOnPlayers();
+            
             // Initializes the quotient distributions wrt. to the current partition.
             void initializeQuotientDistributions();
             
@@ -73,6 +94,12 @@ namespace storm {
             
             // A vector that stores for each state the ordered list of quotient distributions.
             std::vector<storm::storage::DistributionWithReward<ValueType> const*> orderedQuotientDistributions;
+            
+            // A mapping from the states of the model to the states of the quotient (if it was built).
+            std::vector<storm::storage::sparse::state_type> quotientStateMapping;
+            
+            // A mapping from the choices of the model to the choices of the quotient (if it was built).
+            std::vector<uint_fast64_t> quotientChoiceMapping;
         };
     }
 }
@@ -1,5 +1,8 @@
 #include "storm/storage/expressions/ToCppVisitor.h"
 
+#include <iomanip>
+#include <limits>
+
 #include "storm/storage/expressions/Expressions.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -327,7 +330,7 @@ namespace storm {
                     stream << "(static_cast<double>(" << carl::getNum(expression.getValue()) << ")/" << carl::getDenom(expression.getValue()) << ")";
                     break;
                 case ToCppTranslationMode::CastDouble:
-                    stream << "static_cast<double>(" << expression.getValueAsDouble() << ")";
+                    stream << "static_cast<double>(" << std::setprecision(std::numeric_limits<double>::max_digits10) << expression.getValueAsDouble() << ")";
                     break;
                 case ToCppTranslationMode::CastRationalNumber:
                     stream << "carl::rationalize<storm::RationalNumber>(\"" << expression.getValue() << "\")";
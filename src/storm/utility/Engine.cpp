@@ -7,6 +7,7 @@
 #include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
 #include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
 #include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
+#include "storm/modelchecker/smc/StatisticalModelChecker.h"
 
 #include "storm/modelchecker/prctl/HybridDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/HybridMdpPrctlModelChecker.h"
@@ -52,6 +53,8 @@ namespace storm {
                     return "expl";
                 case Engine::AbstractionRefinement:
                     return "abs";
+                case Engine::Statistical:
+                    return "smc";
                 case Engine::Automatic:
                     return "automatic";
                 case Engine::Unknown:
@@ -97,6 +100,8 @@ namespace storm {
                 return storm::builder::BuilderType::Explicit;
                 case Engine::AbstractionRefinement:
                     return storm::builder::BuilderType::Dd;
+                case Engine::Statistical:
+                    return storm::builder::BuilderType::Explicit;
                 default:
                     STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "The given engine has no builder type to it.");
                     return storm::builder::BuilderType::Explicit;
@@ -157,6 +162,20 @@ namespace storm {
                             return false;
                     }
                     break;
+                case Engine::Statistical:
+                    switch (modelType) {
+                        case ModelType::DTMC:
+                            return storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<ValueType>>::canHandleStatic(checkTask);
+                        case ModelType::MDP:
+                            return storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Mdp<ValueType>>::canHandleStatic(checkTask);
+                        case ModelType::SMG:
+                            return storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Smg<ValueType>>::canHandleStatic(checkTask);
+                        case ModelType::CTMC:
+                        case ModelType::MA:
+                        case ModelType::POMDP:
+                            return false;
+                    }
+                    break;
                 default:
                     STORM_LOG_ERROR("The selected engine " << engine << " is not considered.");
             }
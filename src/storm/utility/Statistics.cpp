@@ -0,0 +1,188 @@
+#include "storm/utility/Statistics.h"
+
+#include <algorithm>
+#include <fstream>
+
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/macros.h"
+#include "storm/io/file.h"
+
+namespace storm {
+    namespace utility {
+        namespace statistics {
+
+            namespace {
+                uint64_t getPeakResidentMemoryInBytes() {
+#if defined LINUX || defined MACOS
+                    struct rusage ru;
+                    getrusage(RUSAGE_SELF, &ru);
+#ifdef MACOS
+                    // For Mac OS, this is returned in bytes.
+                    return ru.ru_maxrss;
+#else
+                    // For Linux, this is returned in kilobytes.
+                    return static_cast<uint64_t>(ru.ru_maxrss) * 1024;
+#endif
+#else
+                    return 0;
+#endif
+                }
+            }
+
+            StatisticsRecorder::StatisticsRecorder() : enabled(false), generation(0) {
+                reset();
+            }
+
+            StatisticsRecorder& StatisticsRecorder::recorder() {
+                static StatisticsRecorder recorder;
+                return recorder;
+            }
+
+            void StatisticsRecorder::setEnabled(bool enabled) {
+                this->enabled.store(enabled, std::memory_order_relaxed);
+            }
+
+            void StatisticsRecorder::reset() {
+                std::lock_guard<std::mutex> lock(mutex);
+                startTime = std::chrono::high_resolution_clock::now();
+                root.name = "total";
+                root.time = std::chrono::nanoseconds::zero();
+                root.calls = 1;
+                root.peakResidentMemory = 0;
+                root.counters.clear();
+                root.children.clear();
+                activePhases.assign(1, &root);
+                mainThread = std::this_thread::get_id();
+                ++generation;
+            }
+
+            std::vector<StatisticsRecorder::Phase*>& StatisticsRecorder::getActivePhases() {
+                if (std::this_thread::get_id() == mainThread) {
+                    return activePhases;
+                }
+                thread_local ThreadPhases threadPhases;
+                if (threadPhases.generation != generation) {
+                    threadPhases.generation = generation;
+                    threadPhases.phases.clear();
+                }
+                return threadPhases.phases;
+            }
+
+            StatisticsRecorder::Phase& StatisticsRecorder::getCurrentPhase() {
+                std::vector<Phase*>& phases = getActivePhases();
+                // Threads without an active phase report to the active phase of the main thread.
+                return phases.empty() ? *activePhases.back() : *phases.back();
+            }
+
+            void StatisticsRecorder::enterPhase(std::string const& name) {
+                std::lock_guard<std::mutex> lock(mutex);
+                Phase& parent = getCurrentPhase();
+                std::vector<Phase*>& phases = getActivePhases();
+                auto childIt = std::find_if(parent.children.begin(), parent.children.end(), [&name] (std::unique_ptr<Phase> const& child) { return child->name == name; });
+                if (childIt == parent.children.end()) {
+                    parent.children.push_back(std::make_unique<Phase>());
+                    Phase& child = *parent.children.back();
+                    child.name = name;
+                    child.time = std::chrono::nanoseconds::zero();
+                    child.calls = 0;
+                    child.peakResidentMemory = 0;
+                    phases.push_back(&child);
+                } else {
+                    phases.push_back(childIt->get());
+                }
+            }
+
+            void StatisticsRecorder::leavePhase(std::chrono::nanoseconds duration) {
+                uint64_t peakResidentMemory = getPeakResidentMemoryInBytes();
+                std::lock_guard<std::mutex> lock(mutex);
+                std::vector<Phase*>& phases = getActivePhases();
+                // The root phase of the main thread is never left.
+                bool hasPhaseToLeave = &phases == &activePhases ? phases.size() > 1 : !phases.empty();
+                STORM_LOG_ASSERT(hasPhaseToLeave, "No phase to leave.");
+                if (hasPhaseToLeave) {
+                    Phase& phase = *phases.back();
+                    phase.time += duration;
+                    ++phase.calls;
+                    phase.peakResidentMemory = std::max(phase.peakResidentMemory, peakResidentMemory);
+                    phases.pop_back();
+                }
+            }
+
+            void StatisticsRecorder::addToCounter(std::string const& name, double value) {
+                std::lock_guard<std::mutex> lock(mutex);
+                getCurrentPhase().counters[name] += value;
+            }
+
+            void StatisticsRecorder::setCounter(std::string const& name, double value) {
+                std::lock_guard<std::mutex> lock(mutex);
+                getCurrentPhase().counters[name] = value;
+            }
+
+            void StatisticsRecorder::sampleMemory() {
+                uint64_t peakResidentMemory = getPeakResidentMemoryInBytes();
+                std::lock_guard<std::mutex> lock(mutex);
+                for (auto phase : activePhases) {
+                    phase->peakResidentMemory = std::max(phase->peakResidentMemory, peakResidentMemory);
+                }
+                std::vector<Phase*>& phases = getActivePhases();
+                if (&phases != &activePhases) {
+                    for (auto phase : phases) {
+                        phase->peakResidentMemory = std::max(phase->peakResidentMemory, peakResidentMemory);
+                    }
+                }
+            }
+
+            storm::json<double> StatisticsRecorder::phaseToJson(Phase const& phase) {
+                storm::json<double> result;
+                result["name"] = phase.name;
+                result["time-ms"] = std::chrono::duration<double, std::milli>(phase.time).count();
+                result["calls"] = phase.calls;
+                result["peak-rss-bytes"] = phase.peakResidentMemory;
+                result["counters"] = storm::json<double>::object();
+                for (auto const& counter : phase.counters) {
+                    result["counters"][counter.first] = counter.second;
+                }
+                result["phases"] = storm::json<double>::array();
+                for (auto const& child : phase.children) {
+                    result["phases"].push_back(phaseToJson(*child));
+                }
+                return result;
+            }
+
+            storm::json<double> StatisticsRecorder::toJson() const {
+                uint64_t peakResidentMemory = getPeakResidentMemoryInBytes();
+                std::lock_guard<std::mutex> lock(mutex);
+                storm::json<double> result = phaseToJson(root);
+                // The root phase is still running.
+                result["time-ms"] = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+                result["peak-rss-bytes"] = std::max(root.peakResidentMemory, peakResidentMemory);
+                return result;
+            }
+
+            void StatisticsRecorder::exportToFile(std::string const& filename) const {
+                std::ofstream stream;
+                storm::utility::openFile(filename, stream);
+                stream << toJson().dump(4) << std::endl;
+                storm::utility::closeFile(stream);
+            }
+
+            ScopedTimer::ScopedTimer(std::string const& name) : active(isEnabled()) {
+                if (active) {
+                    StatisticsRecorder::recorder().enterPhase(name);
+                    start = std::chrono::high_resolution_clock::now();
+                }
+            }
+
+            ScopedTimer::~ScopedTimer() {
+                stop();
+            }
+
+            void ScopedTimer::stop() {
+                if (active) {
+                    StatisticsRecorder::recorder().leavePhase(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start));
+                    active = false;
+                }
+            }
+        }
+    }
+}
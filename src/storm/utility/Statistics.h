@@ -0,0 +1,158 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "storm/adapters/JsonAdapter.h"
+
+namespace storm {
+    namespace utility {
+        namespace statistics {
+
+            /*!
+             * Collects structured statistics of a run: a tree of named phases (with their accumulated time, number of
+             * calls and peak resident memory) and counters that are attached to the phase that is active when they are
+             * reported. Recording is disabled by default, in which case all operations return right away.
+             *
+             * Phases are entered and left by ScopedTimer objects. Each thread has its own stack of active phases. The
+             * phases that another thread enters are nested in the phase that is active on the main thread (the thread that
+             * created or last reset the recorder), and the times of concurrent calls of the same phase add up. Counters
+             * are attached to the active phase of the reporting thread.
+             */
+            class StatisticsRecorder {
+            public:
+                StatisticsRecorder(StatisticsRecorder const&) = delete;
+                void operator=(StatisticsRecorder const&) = delete;
+
+                /*!
+                 * Retrieves the only existing instance of the statistics recorder.
+                 */
+                static StatisticsRecorder& recorder();
+
+                inline bool isEnabled() const {
+                    return enabled.load(std::memory_order_relaxed);
+                }
+
+                void setEnabled(bool enabled);
+
+                /*!
+                 * Discards all recorded phases and counters and makes the calling thread the main thread. This must not be
+                 * called while other threads are in a phase.
+                 */
+                void reset();
+
+                void enterPhase(std::string const& name);
+                void leavePhase(std::chrono::nanoseconds duration);
+
+                void addToCounter(std::string const& name, double value);
+                void setCounter(std::string const& name, double value);
+
+                /*!
+                 * Samples the peak resident memory and attributes it to all active phases.
+                 */
+                void sampleMemory();
+
+                /*!
+                 * Retrieves the recorded statistics, where the root phase spans the whole run (so far).
+                 */
+                storm::json<double> toJson() const;
+
+                /*!
+                 * Writes the recorded statistics as JSON to the given file.
+                 */
+                void exportToFile(std::string const& filename) const;
+
+            private:
+                struct Phase {
+                    std::string name;
+                    std::chrono::nanoseconds time;
+                    uint64_t calls;
+                    uint64_t peakResidentMemory;
+                    std::map<std::string, double> counters;
+                    // The subphases in the order in which they were first entered.
+                    std::vector<std::unique_ptr<Phase>> children;
+                };
+
+                // The active phases of a thread other than the main thread, valid as long as the generation matches.
+                struct ThreadPhases {
+                    uint64_t generation = 0;
+                    std::vector<Phase*> phases;
+                };
+
+                StatisticsRecorder();
+
+                /*!
+                 * Retrieves the active phases of the calling thread. The mutex needs to be held.
+                 */
+                std::vector<Phase*>& getActivePhases();
+
+                /*!
+                 * Retrieves the innermost active phase of the calling thread. The mutex needs to be held.
+                 */
+                Phase& getCurrentPhase();
+
+                static storm::json<double> phaseToJson(Phase const& phase);
+
+                std::atomic<bool> enabled;
+                mutable std::mutex mutex;
+                std::chrono::high_resolution_clock::time_point startTime;
+                Phase root;
+                // The currently active phases of the main thread, starting with the root.
+                std::vector<Phase*> activePhases;
+                std::thread::id mainThread;
+                // Incremented upon reset, which invalidates the active phases of the other threads.
+                uint64_t generation;
+            };
+
+            inline bool isEnabled() {
+                return StatisticsRecorder::recorder().isEnabled();
+            }
+
+            /*!
+             * Adds the given value to the counter with the given name of the active phase.
+             */
+            inline void addToCounter(std::string const& name, double value) {
+                if (isEnabled()) {
+                    StatisticsRecorder::recorder().addToCounter(name, value);
+                }
+            }
+
+            /*!
+             * Sets the counter with the given name of the active phase.
+             */
+            inline void setCounter(std::string const& name, double value) {
+                if (isEnabled()) {
+                    StatisticsRecorder::recorder().setCounter(name, value);
+                }
+            }
+
+            /*!
+             * Records the lifetime of this object as (a call of) the phase with the given name, nested in the phase that
+             * is active upon construction.
+             */
+            class ScopedTimer {
+            public:
+                explicit ScopedTimer(std::string const& name);
+                ~ScopedTimer();
+
+                /*!
+                 * Leaves the phase before the end of the scope. Subsequent calls have no effect.
+                 */
+                void stop();
+
+                ScopedTimer(ScopedTimer const&) = delete;
+                ScopedTimer& operator=(ScopedTimer const&) = delete;
+
+            private:
+                bool active;
+                std::chrono::high_resolution_clock::time_point start;
+            };
+        }
+    }
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <random>
 #include <boost/random.hpp>
 #include "storm/adapters/RationalNumberAdapter.h"
@@ -44,6 +46,46 @@ namespace storm {
         };
 
 
+        /*!
+         * The counter-based random number generator Philox4x32-10 (Salmon et al., "Parallel random numbers: as easy as
+         * 1, 2, 3", SC 2011). The random bits only depend on the seed and the counter. Independent streams, e.g. one
+         * stream per simulated path, can thus be generated in any order and on any thread without sharing a state.
+         */
+        class PhiloxGenerator {
+        public:
+            typedef std::array<uint32_t, 4> Counter;
+
+            PhiloxGenerator(uint64_t seed = 0) : key{{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)}} {
+                // Intentionally left empty.
+            }
+
+            /*!
+             * Computes the random bits for the given counter.
+             */
+            Counter operator()(Counter counter) const {
+                std::array<uint32_t, 2> roundKey = key;
+                for (uint_fast64_t round = 0; round < 10; ++round) {
+                    uint64_t product0 = static_cast<uint64_t>(0xD2511F53u) * counter[0];
+                    uint64_t product1 = static_cast<uint64_t>(0xCD9E8D57u) * counter[2];
+                    counter = {static_cast<uint32_t>(product1 >> 32) ^ counter[1] ^ roundKey[0], static_cast<uint32_t>(product1), static_cast<uint32_t>(product0 >> 32) ^ counter[3] ^ roundKey[1], static_cast<uint32_t>(product0)};
+                    roundKey[0] += 0x9E3779B9u;
+                    roundKey[1] += 0xBB67AE85u;
+                }
+                return counter;
+            }
+
+            /*!
+             * Computes 128 random bits for the given index of the given stream.
+             */
+            std::array<uint64_t, 2> random(uint64_t stream, uint64_t index) const {
+                Counter bits = (*this)({static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32), static_cast<uint32_t>(index), static_cast<uint32_t>(index >> 32)});
+                return {bits[0] | (static_cast<uint64_t>(bits[1]) << 32), bits[2] | (static_cast<uint64_t>(bits[3]) << 32)};
+            }
+
+        private:
+            std::array<uint32_t, 2> key;
+        };
+
         class BernoulliDistributionGenerator {
         public:
             BernoulliDistributionGenerator(double prob);
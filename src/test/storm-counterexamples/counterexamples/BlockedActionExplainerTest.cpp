@@ -0,0 +1,48 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm-counterexamples/counterexamples/BlockedActionExplainer.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+TEST(BlockedActionExplainerTest, MaxUntilPathsEndInPsiStates) {
+    // In state 0, the action 0 leads to the psi state 1 and the action 1 leads to state 2, which moves to state 1 with
+    // probability 0.8 and to the sink 3 otherwise. The psi state 1 moves to the sink 3, from which psi is not reachable.
+    storm::storage::SparseMatrixBuilder<double> builder(5, 4, 6, true, true, 4);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 1, 1.0);
+    builder.addNextValue(1, 2, 1.0);
+    builder.newRowGroup(2);
+    builder.addNextValue(2, 3, 1.0);
+    builder.newRowGroup(3);
+    builder.addNextValue(3, 1, 0.8);
+    builder.addNextValue(3, 3, 0.2);
+    builder.newRowGroup(4);
+    builder.addNextValue(4, 3, 1.0);
+
+    storm::models::sparse::StateLabeling labeling(4);
+    storm::storage::BitVector initialStates(4);
+    initialStates.set(0);
+    labeling.addLabel("init", initialStates);
+    auto model = std::make_shared<storm::models::sparse::Mdp<double>>(builder.build(), std::move(labeling));
+
+    // The values of Pmax [phi U psi] and the corresponding strategy.
+    std::vector<double> choiceValues = {1.0, 0.8, 1.0, 0.8, 0.0};
+    storm::storage::Scheduler<double> scheduler(4);
+    for (uint64_t state = 0; state < 4; ++state) {
+        scheduler.setChoice(0, state);
+    }
+    storm::storage::BitVector phiStates(4, std::vector<uint_fast64_t>({0, 2}));
+    storm::storage::BitVector psiStates(4, std::vector<uint_fast64_t>({1}));
+    auto shieldingExpression = std::make_shared<storm::logic::ShieldExpression>(storm::logic::ShieldingType::PreSafety, "blockedActionShield", storm::logic::ShieldComparison::Absolute, 0.9);
+
+    storm::counterexamples::BlockedActionExplainer<double> explainer(model, choiceValues, scheduler, shieldingExpression, storm::OptimizationDirection::Maximize, phiStates, psiStates, false);
+    EXPECT_FALSE(explainer.isBlocked(0, 0));
+    EXPECT_TRUE(explainer.isBlocked(0, 1));
+
+    // The action violates the shield as the sink is reached with probability 0.2 > 1 - 0.9. Paths that reach the sink
+    // via the psi state satisfy the formula and must not be part of the explanation.
+    auto counterexample = explainer.computePathExplanation(0, 1, 10);
+    ASSERT_EQ(1ul, counterexample->getPaths().size());
+    EXPECT_EQ(std::vector<storm::storage::sparse::state_type>({3, 2, 0}), counterexample->getPaths().front());
+}
@@ -0,0 +1,42 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm-counterexamples/counterexamples/SMTMinimalLabelSetGenerator.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/storm.h"
+#include "storm/environment/Environment.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/storage/jani/Property.h"
+
+#ifdef STORM_HAVE_Z3
+
+TEST(SMTMinimalLabelSetGeneratorTest, PortfolioFindsMinimalCommandSet) {
+    typedef storm::counterexamples::SMTMinimalLabelSetGenerator<double> Generator;
+
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P<=0.1 [F \"one\"]", program));
+    storm::builder::BuilderOptions builderOptions(formulas);
+    builderOptions.setBuildChoiceOrigins(true);
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::api::buildSparseModel<double>(program, builderOptions);
+
+    storm::Environment env;
+    Generator::CexInput input = Generator::precompute(env, program, *model, formulas.front());
+    Generator::Options options(true);
+    options.silent = true;
+    Generator::GeneratorStats stats;
+
+    options.portfolioWorkers = 1;
+    auto sequentialLabelSets = Generator::computeCounterexampleLabelSet(env, stats, program, *model, input, {}, options);
+    ASSERT_EQ(1ul, sequentialLabelSets.size());
+
+    // The winner of the portfolio interrupts the other workers, which must not prevent them from terminating.
+    // Several runs make it likely that interrupts arrive at different points of the other workers' searches.
+    options.portfolioWorkers = 4;
+    for (uint64_t run = 0; run < 10; ++run) {
+        auto portfolioLabelSets = Generator::computeCounterexampleLabelSet(env, stats, program, *model, input, {}, options);
+        ASSERT_EQ(1ul, portfolioLabelSets.size());
+        EXPECT_EQ(sequentialLabelSets.front().size(), portfolioLabelSets.front().size());
+    }
+}
+
+#endif
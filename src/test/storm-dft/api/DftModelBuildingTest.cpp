@@ -90,4 +90,41 @@ namespace {
         EXPECT_EQ(13ul, model->getNumberOfTransitions());
     }
 
+
+    TEST(DftModelBuildingTest, BatchedAndSpilledExploration) {
+        std::string file = STORM_TEST_RESOURCES_DIR "/dft/dont_care.dft";
+        std::shared_ptr<storm::storage::DFT<double>> dft = storm::api::loadDFTGalileoFile<double>(file);
+        EXPECT_TRUE(storm::api::isWellFormed(*dft).first);
+        std::map<size_t, std::vector<std::vector<size_t>>> emptySymmetry;
+        storm::storage::DFTIndependentSymmetries symmetries(emptySymmetry);
+        dft->setRelevantEvents(storm::utility::RelevantEvents({"all"}), false);
+
+        // Expand several states at once
+        storm::builder::ExplicitDFTModelBuilder<double> builder(*dft, symmetries);
+        builder.setExpansionBatchSize(16);
+        builder.buildModel(0, 0.0);
+        std::shared_ptr<storm::models::sparse::Model<double>> model = builder.getModel();
+        EXPECT_EQ(512ul, model->getNumberOfStates());
+        EXPECT_EQ(2305ul, model->getNumberOfTransitions());
+        uint64_t nrFailedStates = model->getStates("failed").getNumberOfSetBits();
+
+        // Keep only few unexplored states in memory
+        storm::builder::ExplicitDFTModelBuilder<double> builder2(*dft, symmetries);
+        builder2.setMaxUnexploredStatesInMemory(4);
+        builder2.buildModel(0, 0.0);
+        model = builder2.getModel();
+        EXPECT_EQ(512ul, model->getNumberOfStates());
+        EXPECT_EQ(2305ul, model->getNumberOfTransitions());
+
+        // Both
+        storm::builder::ExplicitDFTModelBuilder<double> builder3(*dft, symmetries);
+        builder3.setExpansionBatchSize(7);
+        builder3.setMaxUnexploredStatesInMemory(1);
+        builder3.buildModel(0, 0.0);
+        model = builder3.getModel();
+        EXPECT_EQ(512ul, model->getNumberOfStates());
+        EXPECT_EQ(2305ul, model->getNumberOfTransitions());
+        EXPECT_EQ(nrFailedStates, model->getStates("failed").getNumberOfSetBits());
+    }
+
 }
@@ -99,6 +99,43 @@ namespace {
         EXPECT_EQ(storm::modelchecker::RegionResult::AllViolated, regionChecker->analyzeRegion(this->env(), allVioRegion, storm::modelchecker::RegionResultHypothesis::Unknown,storm::modelchecker::RegionResult::Unknown, true));
     }
 
+    TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_ParallelRefinement) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+        std::string formulaAsString = "P<=0.84 [F s=5 ]";
+
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+        auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+        auto task = storm::api::createTask<storm::RationalFunction>(formulas[0], true);
+        auto region = storm::api::parseRegion<storm::RationalFunction>("0.1<=pL<=0.9,0.1<=pK<=0.9", modelParameters);
+        auto createChecker = [&] () { return storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task); };
+
+        auto sequentialResult = createChecker()->performRegionRefinement(this->env(), region, storm::utility::zero<storm::RationalFunction>(), 3);
+
+        auto parallelChecker = createChecker();
+        parallelChecker->setParallelRefinement(4, createChecker);
+        auto parallelResult = parallelChecker->performRegionRefinement(this->env(), region, storm::utility::zero<storm::RationalFunction>(), 3);
+
+        // Parallel refinement yields the same regions in the same order.
+        ASSERT_EQ(sequentialResult->getRegionResults().size(), parallelResult->getRegionResults().size());
+        for (uint64_t i = 0; i < sequentialResult->getRegionResults().size(); ++i) {
+            EXPECT_EQ(sequentialResult->getRegionResults()[i].first.toString(true), parallelResult->getRegionResults()[i].first.toString(true));
+            EXPECT_EQ(sequentialResult->getRegionResults()[i].second, parallelResult->getRegionResults()[i].second);
+        }
+
+        // Limiting the pending regions changes the order in which regions are refined but not the refinement itself.
+        auto limitedChecker = createChecker();
+        limitedChecker->setMaxNumberOfPendingRegions(2);
+        auto limitedResult = limitedChecker->performRegionRefinement(this->env(), region, storm::utility::zero<storm::RationalFunction>(), 3);
+        EXPECT_EQ(sequentialResult->getRegionResults().size(), limitedResult->getRegionResults().size());
+        EXPECT_EQ(sequentialResult->getSatFraction(), limitedResult->getSatFraction());
+        EXPECT_EQ(sequentialResult->getUnsatFraction(), limitedResult->getUnsatFraction());
+    }
+
     TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_no_simplification) {
         typedef typename TestFixture::ValueType ValueType;
 
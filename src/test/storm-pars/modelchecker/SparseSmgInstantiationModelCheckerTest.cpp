@@ -0,0 +1,101 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm-pars/api/storm-pars.h"
+#include "storm-pars/modelchecker/instantiation/SparseSmgInstantiationModelChecker.h"
+#include "storm/api/storm.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+
+#include "storm/environment/solver/GameSolverEnvironment.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/storage/jani/Property.h"
+
+namespace {
+    class SparseSmgInstantiationModelCheckerTest : public ::testing::Test {
+    protected:
+        virtual void SetUp() { carl::VariablePool::getInstance().clear(); }
+        virtual void TearDown() { carl::VariablePool::getInstance().clear(); }
+    };
+
+    TEST_F(SparseSmgInstantiationModelCheckerTest, robot) {
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/psmg/robot.nm";
+        std::string formulaAsString = "<<robot>> Pmax=? [F \"goal\"]";
+
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Smg<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Smg<storm::RationalFunction>>();
+        auto parameters = storm::models::sparse::getProbabilityParameters(*model);
+        ASSERT_EQ(1ull, parameters.size());
+
+        storm::Environment env;
+        env.solver().game().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+
+        storm::modelchecker::SparseSmgInstantiationModelChecker<storm::models::sparse::Smg<storm::RationalFunction>, double> modelChecker(*model);
+        modelChecker.specifyFormula(storm::api::createTask<storm::RationalFunction>(formulas[0], true));
+        modelChecker.setInstantiationsAreGraphPreserving(true);
+
+        std::vector<double> parameterValues = {0.1, 0.3, 0.6, 0.9, 0.55};
+        std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> valuations;
+        for (auto const& value : parameterValues) {
+            storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+            valuation.emplace(*parameters.begin(), storm::utility::convertNumber<storm::RationalFunctionCoefficient>(value));
+            valuations.push_back(std::move(valuation));
+        }
+
+        uint64_t initialState = *model->getInitialStates().begin();
+        auto results = modelChecker.check(env, valuations);
+        ASSERT_EQ(valuations.size(), results.size());
+        for (uint64_t i = 0; i < valuations.size(); ++i) {
+            EXPECT_NEAR(std::max(0.5, parameterValues[i]), results[i]->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+        }
+
+        // Checking single instantiations (with a warm start from the previous point) yields the same values.
+        for (uint64_t i = 0; i < valuations.size(); ++i) {
+            auto result = modelChecker.check(env, valuations[i]);
+            EXPECT_NEAR(std::max(0.5, parameterValues[i]), result->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+        }
+    }
+
+    TEST_F(SparseSmgInstantiationModelCheckerTest, robotMultipleThreads) {
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/psmg/robot.nm";
+        std::string formulaAsString = "<<robot>> Pmax=? [F \"goal\"]";
+
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Smg<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Smg<storm::RationalFunction>>();
+        auto parameters = storm::models::sparse::getProbabilityParameters(*model);
+        ASSERT_EQ(1ull, parameters.size());
+
+        storm::Environment env;
+        env.solver().game().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+
+        // Each of the threads checks several valuations on its own copy of the model.
+        storm::modelchecker::SparseSmgInstantiationModelChecker<storm::models::sparse::Smg<storm::RationalFunction>, double> modelChecker(*model);
+        modelChecker.specifyFormula(storm::api::createTask<storm::RationalFunction>(formulas[0], true));
+        modelChecker.setInstantiationsAreGraphPreserving(true);
+        modelChecker.setNumberOfThreads(4);
+
+        std::vector<double> parameterValues;
+        std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> valuations;
+        for (uint64_t i = 1; i < 40; ++i) {
+            parameterValues.push_back(i / 40.0);
+            storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+            valuation.emplace(*parameters.begin(), storm::utility::convertNumber<storm::RationalFunctionCoefficient>(parameterValues.back()));
+            valuations.push_back(std::move(valuation));
+        }
+
+        uint64_t initialState = *model->getInitialStates().begin();
+        auto results = modelChecker.check(env, valuations);
+        ASSERT_EQ(valuations.size(), results.size());
+        for (uint64_t i = 0; i < valuations.size(); ++i) {
+            EXPECT_NEAR(std::max(0.5, parameterValues[i]), results[i]->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+        }
+    }
+}
+
+#endif
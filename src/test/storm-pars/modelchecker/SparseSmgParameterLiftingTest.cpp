@@ -0,0 +1,142 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#ifdef STORM_HAVE_CARL
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm-pars/api/storm-pars.h"
+#include "storm/api/storm.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+
+#include "storm/environment/solver/GameSolverEnvironment.h"
+#include "storm/shields/ShieldHandling.h"
+#include "storm/storage/jani/Property.h"
+
+
+namespace {
+    class DoubleViEnvironment {
+    public:
+        typedef double ValueType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().game().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            return env;
+        }
+    };
+    class RationalViEnvironment {
+    public:
+        typedef storm::RationalNumber ValueType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().game().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            return env;
+        }
+    };
+    template<typename TestType>
+    class SparseSmgParameterLiftingTest : public ::testing::Test {
+    public:
+        typedef typename TestType::ValueType ValueType;
+        SparseSmgParameterLiftingTest() : _environment(TestType::createEnvironment()) {}
+        storm::Environment const& env() const { return _environment; }
+
+        // Reads the choices that the shield in the given file allows in the given state and removes the file.
+        std::vector<uint64_t> getAllowedChoices(std::string const& filename, uint64_t state) const {
+            std::vector<uint64_t> result;
+            std::ifstream shieldFile(filename);
+            std::string line;
+            while (std::getline(shieldFile, line)) {
+                std::istringstream lineStream(line);
+                uint64_t lineState;
+                if (!(lineStream >> lineState) || lineState != state) {
+                    continue;
+                }
+                // The choices are given as "<value>: (<choice>)".
+                for (auto position = line.find('('); position != std::string::npos; position = line.find('(', position + 1)) {
+                    result.push_back(std::stoull(line.substr(position + 1)));
+                }
+            }
+            shieldFile.close();
+            std::remove(filename.c_str());
+            return result;
+        }
+
+        virtual void SetUp() { carl::VariablePool::getInstance().clear(); }
+        virtual void TearDown() { carl::VariablePool::getInstance().clear(); }
+    private:
+        storm::Environment _environment;
+    };
+
+    typedef ::testing::Types<
+            DoubleViEnvironment,
+            RationalViEnvironment
+    > TestingTypes;
+
+   TYPED_TEST_SUITE(SparseSmgParameterLiftingTest, TestingTypes,);
+
+    TYPED_TEST(SparseSmgParameterLiftingTest, robot_Prob) {
+
+        typedef typename TestFixture::ValueType ValueType;
+
+        // The maximal probability of the robot to reach its goal is max(1/2, p).
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/psmg/robot.nm";
+        std::string formulaFile = "<<robot>> Pmax>=0.55 [ F \"goal\" ]";
+
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaFile, program));
+        std::shared_ptr<storm::models::sparse::Smg<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Smg<storm::RationalFunction>>();
+
+        auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+
+        auto regionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, storm::api::createTask<storm::RationalFunction>(formulas[0], true));
+
+        auto allSatRegion = storm::api::parseRegion<storm::RationalFunction>("0.6<=p<=0.9", modelParameters);
+        auto exBothRegion = storm::api::parseRegion<storm::RationalFunction>("0.4<=p<=0.8", modelParameters);
+        auto allVioRegion = storm::api::parseRegion<storm::RationalFunction>("0.1<=p<=0.4", modelParameters);
+
+        EXPECT_EQ(storm::modelchecker::RegionResult::AllSat, regionChecker->analyzeRegion(this->env(), allSatRegion, storm::modelchecker::RegionResultHypothesis::Unknown, storm::modelchecker::RegionResult::Unknown, true));
+        EXPECT_EQ(storm::modelchecker::RegionResult::ExistsBoth, regionChecker->analyzeRegion(this->env(), exBothRegion, storm::modelchecker::RegionResultHypothesis::Unknown, storm::modelchecker::RegionResult::Unknown, true));
+        EXPECT_EQ(storm::modelchecker::RegionResult::AllViolated, regionChecker->analyzeRegion(this->env(), allVioRegion, storm::modelchecker::RegionResultHypothesis::Unknown, storm::modelchecker::RegionResult::Unknown, true));
+
+        EXPECT_NEAR(0.6, storm::utility::convertNumber<double>(regionChecker->getBoundAtInitState(this->env(), allSatRegion, storm::solver::OptimizationDirection::Minimize)), 1e-6);
+        EXPECT_NEAR(0.9, storm::utility::convertNumber<double>(regionChecker->getBoundAtInitState(this->env(), allSatRegion, storm::solver::OptimizationDirection::Maximize)), 1e-6);
+    }
+
+    TYPED_TEST(SparseSmgParameterLiftingTest, robot_Shield) {
+
+        typedef typename TestFixture::ValueType ValueType;
+
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/psmg/robot.nm";
+        std::string formulaFile = "<<robot>> Pmax=? [ F \"goal\" ]";
+
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaFile, program));
+        std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas);
+        auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+        uint64_t initialState = *model->getInitialStates().begin();
+
+        // The environment always pushes the robot away, so the risky action (choice 1) reaches the goal with probability p
+        // while the safe action (choice 0) reaches it with probability 1/2.
+        auto computeAllowedChoices = [&] (std::string const& regionString, double gamma) {
+            auto shieldingExpression = std::make_shared<storm::logic::ShieldExpression>(storm::logic::ShieldingType::PreSafety, "robotRegionShield", storm::logic::ShieldComparison::Absolute, gamma);
+            auto task = storm::api::createTask<storm::RationalFunction>(formulas[0], true);
+            task.setShieldingExpression(shieldingExpression);
+            storm::api::createShieldForRegion<storm::RationalFunction, ValueType>(this->env(), model, task, storm::api::parseRegion<storm::RationalFunction>(regionString, modelParameters));
+            return this->getAllowedChoices(tempest::shields::shieldFilename(shieldingExpression), initialState);
+        };
+
+        // The values of the actions are sound for the complete region, i.e. the risky action has at least value 0.6 (or 0.1).
+        EXPECT_EQ(std::vector<uint64_t>({1}), computeAllowedChoices("0.6<=p<=0.9", 0.55));
+        EXPECT_EQ(std::vector<uint64_t>({0, 1}), computeAllowedChoices("0.6<=p<=0.9", 0.45));
+        EXPECT_EQ(std::vector<uint64_t>({0}), computeAllowedChoices("0.1<=p<=0.4", 0.45));
+        // In the region 0.4<=p<=0.8, the risky action only satisfies the threshold for some of the instantiations.
+        EXPECT_EQ(std::vector<uint64_t>({0}), computeAllowedChoices("0.4<=p<=0.8", 0.45));
+    }
+}
+
+#endif
@@ -123,6 +123,36 @@ namespace {
         static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {options.refine = true; options.refinePrecision = precision();}
     };
     
+    class ParallelDoubleVIEnvironment {
+    public:
+        typedef double ValueType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+            return env;
+        }
+        static bool const isExactModelChecking = false;
+        static ValueType precision() { return storm::utility::convertNumber<ValueType>(0.12); } // there actually aren't any precision guarantees, but we still want to detect if results are weird.
+        static PreprocessingType const preprocessingType = PreprocessingType::None;
+        static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {options.parallelApproximations = true; options.expansionBatchSize = 8;}
+    };
+
+    class ParallelRefineDoubleVIEnvironment {
+    public:
+        typedef double ValueType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+            return env;
+        }
+        static bool const isExactModelChecking = false;
+        static ValueType precision() { return storm::utility::convertNumber<ValueType>(0.005); }
+        static PreprocessingType const preprocessingType = PreprocessingType::None;
+        static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {options.refine = true; options.refinePrecision = precision(); options.parallelApproximations = true; options.expansionBatchSize = 8;}
+    };
+    
     class DefaultDoubleOVIEnvironment {
     public:
         typedef double ValueType;
@@ -241,6 +271,8 @@ namespace {
             FineDoubleVIEnvironment,
             RefineDoubleVIEnvironment,
             PreprocessedRefineDoubleVIEnvironment,
+            ParallelDoubleVIEnvironment,
+            ParallelRefineDoubleVIEnvironment,
             DefaultDoubleOVIEnvironment,
             DefaultRationalPIEnvironment,
             PreprocessedDefaultRationalPIEnvironment
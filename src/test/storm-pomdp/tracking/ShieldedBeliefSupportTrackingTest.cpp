@@ -0,0 +1,127 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <cstdio>
+
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/api/storm.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-pomdp/analysis/WinningRegion.h"
+#include "storm-pomdp/analysis/WinningRegionQueryInterface.h"
+#include "storm-pomdp/transformer/MakePOMDPCanonic.h"
+#include "storm-pomdp/generator/ShieldedBeliefSupportTracker.h"
+#include "storm-pomdp/shields/BeliefSupportShield.h"
+
+namespace {
+    std::shared_ptr<storm::models::sparse::Pomdp<double>> buildMaze() {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism");
+        program = storm::utility::prism::preprocess(program, "sl=0.4");
+        std::shared_ptr<storm::logic::Formula const> formula = storm::api::parsePropertiesForPrismProgram("Pmax=? [F \"goal\" ]", program).front().getRawFormula();
+        std::shared_ptr<storm::models::sparse::Pomdp<double>> pomdp = storm::api::buildSparseModel<double>(program, {formula})->as<storm::models::sparse::Pomdp<double>>();
+        storm::transformer::MakePOMDPCanonic<double> makeCanonic(*pomdp);
+        return makeCanonic.transform();
+    }
+
+    // A winning region in which every observation except the given one is winning (with arbitrary belief supports).
+    storm::pomdp::WinningRegion allButOneObservation(storm::models::sparse::Pomdp<double> const& pomdp, uint64_t losingObservation) {
+        std::vector<uint64_t> observationSizes(pomdp.getNrObservations(), 0);
+        for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
+            ++observationSizes[pomdp.getObservation(state)];
+        }
+        storm::pomdp::WinningRegion winningRegion(observationSizes);
+        for (uint64_t observation = 0; observation < pomdp.getNrObservations(); ++observation) {
+            if (observation != losingObservation) {
+                winningRegion.setObservationIsWinning(observation);
+            }
+        }
+        return winningRegion;
+    }
+
+    // Whether the given action surely avoids the losing observation from every state of the given support.
+    bool avoidsObservation(storm::models::sparse::Pomdp<double> const& pomdp, storm::storage::BitVector const& support, uint64_t action, uint64_t losingObservation) {
+        for (uint64_t state : support) {
+            for (auto const& entry : pomdp.getTransitionMatrix().getRow(state, action)) {
+                if (pomdp.getObservation(entry.getColumn()) == losingObservation) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+}
+
+TEST(ShieldedBeliefSupportTracking, Maze) {
+    auto pomdp = buildMaze();
+    uint64_t losingObservation = pomdp->getNrObservations() - 1;
+    storm::pomdp::WinningRegion winningRegion = allButOneObservation(*pomdp, losingObservation);
+    storm::pomdp::WinningRegionQueryInterface<double> queryInterface(*pomdp, winningRegion);
+    tempest::shields::BeliefSupportShield shield = tempest::shields::BeliefSupportShield::create(*pomdp, queryInterface);
+    ASSERT_EQ(pomdp->getNrObservations(), shield.getNumberOfObservations());
+    EXPECT_EQ(0ul, shield.getNumberOfSupports(losingObservation));
+
+    // For the maximal supports, the shield allows exactly the actions that surely avoid the losing observation.
+    for (uint64_t observation = 0; observation < pomdp->getNrObservations(); ++observation) {
+        if (observation == losingObservation) {
+            continue;
+        }
+        auto const& states = queryInterface.getStatesWithObservation(observation);
+        storm::storage::BitVector fullSupport(pomdp->getNumberOfStates());
+        for (uint64_t state : states) {
+            fullSupport.set(state);
+        }
+        storm::storage::BitVector allowed = shield.getAllowedActions(observation, storm::storage::BitVector(states.size(), true));
+        for (uint64_t action = 0; action < shield.getNumberOfActions(observation); ++action) {
+            EXPECT_EQ(avoidsObservation(*pomdp, fullSupport, action, losingObservation), allowed.get(action)) << "observation " << observation << ", action " << action;
+        }
+    }
+
+    // Along a run, every allowed action is safe for the tracked belief support.
+    storm::generator::ShieldedBeliefSupportTracker<double> tracker(*pomdp, shield);
+    EXPECT_EQ(pomdp->getInitialStates(), tracker.getCurrentBeliefSupport());
+    std::vector<std::pair<uint64_t, uint64_t>> run = {{0, 0}, {1, 0}, {2, 1}, {3, 0}, {3, 0}};
+    for (auto const& step : run) {
+        storm::storage::BitVector const& allowed = tracker.getAllowedActions();
+        for (uint64_t action : allowed) {
+            EXPECT_TRUE(avoidsObservation(*pomdp, tracker.getCurrentBeliefSupport(), action, losingObservation));
+            EXPECT_TRUE(tracker.isAllowed(action));
+        }
+        tracker.track(step.first, step.second);
+        if (tracker.getCurrentBeliefSupport().empty()) {
+            EXPECT_TRUE(tracker.getAllowedActions().empty());
+            break;
+        }
+    }
+    tracker.reset();
+    EXPECT_EQ(pomdp->getInitialStates(), tracker.getCurrentBeliefSupport());
+    storm::storage::BitVector initialOffsets(shield.getObservationSize(tracker.getCurrentObservation()));
+    auto const& initialObservationStates = queryInterface.getStatesWithObservation(tracker.getCurrentObservation());
+    for (uint64_t offset = 0; offset < initialObservationStates.size(); ++offset) {
+        initialOffsets.set(offset, pomdp->getInitialStates().get(initialObservationStates[offset]));
+    }
+    EXPECT_EQ(shield.getAllowedActions(tracker.getCurrentObservation(), initialOffsets), tracker.getAllowedActions());
+}
+
+TEST(ShieldedBeliefSupportTracking, StoreAndLoad) {
+    auto pomdp = buildMaze();
+    uint64_t losingObservation = pomdp->getNrObservations() - 1;
+    storm::pomdp::WinningRegion winningRegion = allButOneObservation(*pomdp, losingObservation);
+    storm::pomdp::WinningRegionQueryInterface<double> queryInterface(*pomdp, winningRegion);
+    tempest::shields::BeliefSupportShield shield = tempest::shields::BeliefSupportShield::create(*pomdp, queryInterface);
+
+    std::string path = "test_beliefsupportshield.txt";
+    shield.storeToFile(path, "maze2");
+    auto loaded = tempest::shields::BeliefSupportShield::loadFromFile(path);
+    std::remove(path.c_str());
+
+    EXPECT_EQ("maze2\n", loaded.second);
+    ASSERT_EQ(shield.getNumberOfObservations(), loaded.first.getNumberOfObservations());
+    for (uint64_t observation = 0; observation < shield.getNumberOfObservations(); ++observation) {
+        EXPECT_EQ(shield.getObservationSize(observation), loaded.first.getObservationSize(observation));
+        EXPECT_EQ(shield.getNumberOfActions(observation), loaded.first.getNumberOfActions(observation));
+        EXPECT_EQ(shield.getNumberOfSupports(observation), loaded.first.getNumberOfSupports(observation));
+        storm::storage::BitVector support(shield.getObservationSize(observation), true);
+        EXPECT_EQ(shield.getAllowedActions(observation, support), loaded.first.getAllowedActions(observation, support));
+    }
+}
@@ -1,11 +1,25 @@
 #include <storm/generator/PrismNextStateGenerator.h>
+#include <boost/filesystem.hpp>
+#include <cstdio>
+#include "storm/generator/CompiledPrismExpressions.h"
+#include "storm/generator/PrismGuardIndex.h"
+#include "storm/generator/VariableInformation.h"
 #include "test/storm_gtest.h"
 #include "storm-config.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/models/sparse/Smg.h"
+#include "storm/storage/DiskSparseMatrix.h"
 #include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/api/properties.h"
+#include "storm-parsers/api/properties.h"
+#include "storm/environment/Environment.h"
+#include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/logic/ShieldExpression.h"
+#include "storm/shields/PreShield.h"
 
 
 TEST(ExplicitPrismModelBuilderTest, Dtmc) {
@@ -172,6 +186,194 @@ TEST(ExplicitPrismModelBuilderTest, ExportExplicitLookup) {
 }
 
 
+#ifdef STORM_HAVE_Z3
+TEST(ExplicitPrismModelBuilderTest, SymmetryReduction) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/smg/symmetricRobots.nm");
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(192ul, model->getNumberOfStates());
+
+    generatorOptions.setSymmetryReduction();
+    auto generator = std::make_shared<storm::generator::PrismNextStateGenerator<double>>(program, generatorOptions);
+    ASSERT_TRUE(generator->getSymmetryReduction() != nullptr);
+    EXPECT_EQ(1ul, generator->getSymmetryReduction()->getSymmetricModuleGroups().size());
+    EXPECT_EQ(3ul, generator->getSymmetryReduction()->getSymmetricModuleGroups().front().moduleIndices.size());
+
+    auto builder = storm::builder::ExplicitModelBuilder<double>(generator);
+    std::shared_ptr<storm::models::sparse::Model<double>> reducedModel = builder.build();
+    EXPECT_EQ(60ul, reducedModel->getNumberOfStates());
+
+    // Permuted valuations of the robots are mapped to the same state.
+    auto lookup = builder.exportExplicitStateLookup();
+    auto& manager = program.getManager();
+    auto r1 = program.getModule("robot1").getIntegerVariable("r1").getExpressionVariable();
+    auto r2 = program.getModule("robot2").getIntegerVariable("r2").getExpressionVariable();
+    auto r3 = program.getModule("robot3").getIntegerVariable("r3").getExpressionVariable();
+    auto move = program.getGlobalIntegerVariable("move").getExpressionVariable();
+    auto slowed = program.getGlobalBooleanVariable("slowed").getExpressionVariable();
+    uint64_t state = lookup.lookup({{r1, manager.integer(3)}, {r2, manager.integer(0)}, {r3, manager.integer(1)}, {move, manager.integer(0)}, {slowed, manager.boolean(false)}});
+    EXPECT_TRUE(state < reducedModel->getNumberOfStates());
+    EXPECT_EQ(state, lookup.lookup({{r1, manager.integer(0)}, {r2, manager.integer(1)}, {r3, manager.integer(3)}, {move, manager.integer(0)}, {slowed, manager.boolean(false)}}));
+    EXPECT_EQ(state, lookup.lookup({{r1, manager.integer(1)}, {r2, manager.integer(3)}, {r3, manager.integer(0)}, {move, manager.integer(0)}, {slowed, manager.boolean(false)}}));
+    EXPECT_TRUE(reducedModel->getStates("goal").get(state));
+
+    // The reduced game preserves the values of symmetric properties.
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("<<robots>> Pmax=? [ F<=5 \"goal\" ]; <<robots>> Pmin=? [ F<=7 \"goal\" ]; <<environment>> Pmin=? [ F \"goal\" ]", program));
+    storm::Environment env;
+    storm::modelchecker::SparseSmgRpatlModelChecker<storm::models::sparse::Smg<double>> checker(*model->as<storm::models::sparse::Smg<double>>());
+    storm::modelchecker::SparseSmgRpatlModelChecker<storm::models::sparse::Smg<double>> reducedChecker(*reducedModel->as<storm::models::sparse::Smg<double>>());
+    for (auto const& formula : formulas) {
+        storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formula, true);
+        auto result = checker.check(env, task);
+        auto reducedResult = reducedChecker.check(env, task);
+        EXPECT_NEAR(result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()], reducedResult->asExplicitQuantitativeCheckResult<double>()[*reducedModel->getInitialStates().begin()], 1e-6) << *formula;
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, SymmetryReductionShieldQuery) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/smg/symmetricRobots.nm");
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels().setBuildChoiceLabels().setSymmetryReduction();
+    auto builder = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions);
+    std::shared_ptr<storm::models::sparse::Model<double>> reducedModel = builder.build();
+    auto const& transitionMatrix = reducedModel->getTransitionMatrix();
+
+    // A shield on the reduced game that only allows the moves that reach the goal with maximal probability in one step.
+    std::vector<double> goalValues(reducedModel->getNumberOfStates(), 0.0);
+    for (auto state : reducedModel->getStates("goal")) {
+        goalValues[state] = 1.0;
+    }
+    std::vector<double> choiceValues(transitionMatrix.getRowCount());
+    transitionMatrix.multiplyWithVector(goalValues, choiceValues);
+    auto shieldingExpression = std::make_shared<storm::logic::ShieldExpression const>(storm::logic::ShieldingType::PreSafety, "symmetricRobots", storm::logic::ShieldComparison::Relative, 0.5);
+    tempest::shields::PreShield<double, uint_fast64_t> preShield(transitionMatrix.getRowGroupIndices(), choiceValues, shieldingExpression, storm::OptimizationDirection::Maximize, storm::storage::BitVector(reducedModel->getNumberOfStates(), true), boost::none);
+    auto shield = preShield.construct();
+
+    // Robot 2 is the one that is about to reach the goal, but it is at the position of robot 3 in the representative.
+    auto lookup = builder.exportExplicitStateLookup();
+    auto& manager = program.getManager();
+    auto r1 = program.getModule("robot1").getIntegerVariable("r1").getExpressionVariable();
+    auto r2 = program.getModule("robot2").getIntegerVariable("r2").getExpressionVariable();
+    auto r3 = program.getModule("robot3").getIntegerVariable("r3").getExpressionVariable();
+    auto move = program.getGlobalIntegerVariable("move").getExpressionVariable();
+    auto slowed = program.getGlobalBooleanVariable("slowed").getExpressionVariable();
+    std::vector<std::vector<uint64_t>> permutation;
+    uint64_t state = lookup.lookup({{r1, manager.integer(0)}, {r2, manager.integer(2)}, {r3, manager.integer(1)}, {move, manager.integer(0)}, {slowed, manager.boolean(false)}}, permutation);
+    ASSERT_TRUE(state < reducedModel->getNumberOfStates());
+
+    auto const& allowedChoices = shield.getChoice(state).getChoiceMap();
+    ASSERT_EQ(1ul, allowedChoices.size());
+    auto labels = reducedModel->getChoiceLabeling().getLabelsOfChoice(transitionMatrix.getRowGroupIndices()[state] + std::get<1>(allowedChoices.front()));
+    ASSERT_EQ(1ul, labels.size());
+    EXPECT_EQ("step3", *labels.begin());
+    uint64_t actionIndex = lookup.translateActionIndex(program.getActionIndex(*labels.begin()), permutation);
+    EXPECT_EQ("step2", program.getActionName(actionIndex));
+
+    // Actions of unpermuted modules are not renamed.
+    EXPECT_EQ(program.getActionIndex("wait"), lookup.translateActionIndex(program.getActionIndex("wait"), permutation));
+}
+#endif
+
+TEST(ExplicitPrismModelBuilderTest, CompiledExpressions) {
+    boost::filesystem::path cacheDirectory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("storm-test-%%%%-%%%%");
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setCompileExpressions().setCompiledExpressionsCacheDirectory(cacheDirectory.string());
+
+    for (std::string const& file : {"/dtmc/brp-16-2.pm", "/dtmc/crowds-5-5.pm", "/mdp/two_dice.nm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file).substituteConstantsFormulas();
+        std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+        std::shared_ptr<storm::models::sparse::Model<double>> compiledModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+        EXPECT_EQ(model->getTransitionMatrix(), compiledModel->getTransitionMatrix());
+
+        // The second compilation of the same program is found in the cache.
+        storm::generator::VariableInformation variableInformation(program, 32, false);
+        auto compiledExpressions = storm::generator::CompiledPrismExpressions::create(program, variableInformation, cacheDirectory.string());
+        ASSERT_TRUE(compiledExpressions != nullptr);
+        EXPECT_TRUE(compiledExpressions->wasLoadedFromCache());
+    }
+
+    // Shared objects are not loaded from a directory that other users can write to.
+    boost::filesystem::permissions(cacheDirectory, boost::filesystem::all_all);
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm").substituteConstantsFormulas();
+    storm::generator::VariableInformation variableInformation(program, 32, false);
+    EXPECT_TRUE(storm::generator::CompiledPrismExpressions::create(program, variableInformation, cacheDirectory.string()) == nullptr);
+    boost::filesystem::remove_all(cacheDirectory);
+}
+
+TEST(ExplicitPrismModelBuilderTest, GuardIndex) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm").substituteConstantsFormulas();
+    storm::generator::VariableInformation variableInformation(program, 32, false);
+    storm::generator::PrismGuardIndex guardIndex(program, variableInformation);
+    EXPECT_EQ(1ul, guardIndex.getNumberOfIndexedModules());
+
+    // Each command of the die is only a candidate for its value of s.
+    auto sIt = std::find_if(variableInformation.integerVariables.begin(), variableInformation.integerVariables.end(), [] (storm::generator::IntegerVariableInformation const& variable) { return variable.variable.getName() == "s"; });
+    ASSERT_TRUE(sIt != variableInformation.integerVariables.end());
+    auto const& s = *sIt;
+    storm::generator::CompressedState state(variableInformation.getTotalBitOffset(true));
+    for (uint64_t value = 0; value < 8; ++value) {
+        state.setFromInt(s.bitOffset, s.bitWidth, value);
+        guardIndex.loadState(state);
+        ASSERT_EQ(1ul, guardIndex.getCandidateCommandIndices(0).size());
+        EXPECT_EQ(value, guardIndex.getCandidateCommandIndices(0).front());
+    }
+
+    // Without selecting keys, all commands are candidates.
+    storm::generator::PrismGuardIndex unindexedGuardIndex(program, variableInformation, false);
+    EXPECT_EQ(0ul, unindexedGuardIndex.getNumberOfIndexedModules());
+    unindexedGuardIndex.loadState(state);
+    EXPECT_EQ(program.getModule(0).getNumberOfCommands(), unindexedGuardIndex.getCandidateCommandIndices(0).size());
+}
+
+TEST(ExplicitPrismModelBuilderTest, GuardIndexSkipsLargeTables) {
+    // Copying the command that does not fix x to all 1024 entries would make the table much larger than the module.
+    std::string input = "dtmc\n"
+                        "module counter\n"
+                        "    x : [0..1000] init 0;\n"
+                        "    [] x=0 -> (x'=1);\n"
+                        "    [] x=1 -> (x'=2);\n"
+                        "    [] x>1 & x<1000 -> (x'=x+1);\n"
+                        "    [] x=1000 -> true;\n"
+                        "endmodule\n";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(input, "guardIndex.pm").substituteConstantsFormulas();
+    storm::generator::VariableInformation variableInformation(program, 32, false);
+    storm::generator::PrismGuardIndex guardIndex(program, variableInformation);
+    EXPECT_EQ(0ul, guardIndex.getNumberOfIndexedModules());
+
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setGuardIndex(false);
+    std::shared_ptr<storm::models::sparse::Model<double>> unindexedModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(1001ul, model->getNumberOfStates());
+    EXPECT_EQ(model->getTransitionMatrix(), unindexedModel->getTransitionMatrix());
+}
+
+TEST(ExplicitPrismModelBuilderTest, OutOfCore) {
+    for (std::string const& file : {"/dtmc/die.pm", "/mdp/two_dice.nm", "/smg/walker.nm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file);
+        std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+
+        // A small chunk size makes sure that the matrix is written in several chunks.
+        storm::builder::OutOfCoreModelComponents components = storm::builder::ExplicitModelBuilder<double>(program).buildOutOfCore("explicitPrismModelBuilderTest.bin", 16);
+        {
+            storm::storage::DiskSparseMatrix<double> transitionMatrix(components.transitionMatrixFilename);
+            EXPECT_EQ(model->getNumberOfStates(), transitionMatrix.getRowGroupCount());
+            EXPECT_EQ(model->getNumberOfChoices(), transitionMatrix.getRowCount());
+            EXPECT_EQ(model->getNumberOfTransitions(), transitionMatrix.getEntryCount());
+            EXPECT_EQ(model->getTransitionMatrix(), transitionMatrix.toSparseMatrix());
+        }
+        EXPECT_EQ(model->getStateLabeling(), components.stateLabeling);
+        if (model->isOfType(storm::models::ModelType::Smg)) {
+            ASSERT_TRUE(components.statePlayerIndications.is_initialized());
+            EXPECT_EQ(model->as<storm::models::sparse::Smg<double>>()->getStatePlayerIndications(), components.statePlayerIndications.get());
+        } else {
+            EXPECT_FALSE(components.statePlayerIndications.is_initialized());
+        }
+        std::remove(components.transitionMatrixFilename.c_str());
+    }
+}
+
 bool trivial_true_mask(storm::expressions::SimpleValuation const&, uint64_t) {
     return true;
 }
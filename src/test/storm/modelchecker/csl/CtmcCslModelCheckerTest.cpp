@@ -2,6 +2,8 @@
 #include "test/storm_gtest.h"
 #include "storm-config.h"
 
+#include <boost/algorithm/string/replace.hpp>
+
 #include "storm/api/builder.h"
 #include "storm-parsers/api/model_descriptions.h"
 #include "storm/api/properties.h"
@@ -18,6 +20,7 @@
 #include "storm/modelchecker/csl/HybridCtmcCslModelChecker.h"
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 #include "storm/modelchecker/results/QualitativeCheckResult.h"
@@ -447,6 +450,42 @@ namespace {
         EXPECT_NEAR(0.595957, result[1], 1e-6);
     }
 
+    TEST(CtmcCslModelCheckerTest, TimeSeries) {
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ctmc/tandem5.sm", true);
+        program = storm::utility::prism::preprocess(program, "");
+        std::vector<std::string> formulasAsStrings = {"P=? [ F<=T \"network_full\" ]", "P=? [ \"second_queue_full\" U<=T !\"second_queue_full\" ]", "R=? [ I=T ]"};
+        std::vector<double> timePoints = {10.0, 0.0, 0.5, 1.0, 2.5, 10.0};
+
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P=? [ F<=10 \"network_full\" ]; P=? [ \"second_queue_full\" U<=1 !\"second_queue_full\" ]; R=? [ I=10 ]", program));
+        auto model = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Ctmc<double>>();
+        storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<double>> checker(*model);
+        storm::Environment env;
+
+        for (auto const& formulaAsString : formulasAsStrings) {
+            auto formula = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(boost::replace_all_copy(formulaAsString, "T", "10"), program)).front();
+            auto timeSeries = checker.computeTimeSeries(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formula, true), timePoints);
+            ASSERT_EQ(timePoints.size(), timeSeries.size());
+
+            // The values need to coincide with the values obtained by checking each time point separately.
+            for (uint64_t index = 0; index < timePoints.size(); ++index) {
+                std::stringstream timePointAsString;
+                timePointAsString << timePoints[index];
+                auto formulaForTimePoint = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(boost::replace_all_copy(formulaAsString, "T", timePointAsString.str()), program)).front();
+                auto expected = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulaForTimePoint, true));
+                auto const& expectedValues = expected->asExplicitQuantitativeCheckResult<double>().getValueVector();
+                auto const& actualValues = timeSeries[index]->asExplicitQuantitativeCheckResult<double>().getValueVector();
+                for (auto state : model->getInitialStates()) {
+                    EXPECT_NEAR(expectedValues[state], actualValues[state], 1e-6);
+                }
+            }
+        }
+
+        auto timeSeries = checker.computeTimeSeries(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[0], true), timePoints);
+        EXPECT_NEAR(0.015446370562428037, timeSeries.back()->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()], 1e-6);
+        timeSeries = checker.computeTimeSeries(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[2], true), timePoints);
+        EXPECT_NEAR(5.679243850315877, timeSeries.back()->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()], 1e-6);
+    }
+
 
     TYPED_TEST(CtmcCslModelCheckerTest, LtlProbabilitiesEmbedded) {
 #ifdef STORM_HAVE_LTL_MODELCHECKING_SUPPORT
@@ -0,0 +1,156 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <cstdio>
+#include <fstream>
+
+#include "storm/modelchecker/rpatl/helper/internal/GameViHelper.h"
+#include "storm/modelchecker/rpatl/helper/internal/DiskGameViHelper.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/GameSolverEnvironment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/storage/DiskSparseMatrix.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/BitVector.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace {
+
+    // The first state reaches the target with probability 0.5 in each step and stays put otherwise. The second state is a sink.
+    storm::storage::SparseMatrix<double> createSlowlyConvergingGame() {
+        storm::storage::SparseMatrixBuilder<double> builder(2, 2, 2, true, true, 2);
+        builder.newRowGroup(0);
+        builder.addNextValue(0, 0, 0.5);
+        builder.newRowGroup(1);
+        builder.addNextValue(1, 1, 1.0);
+        return builder.build();
+    }
+
+    TEST(GameViHelperTest, TraceAndConvergence) {
+        storm::Environment env;
+        env.solver().game().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        env.solver().game().setTraceFile("gameViHelperTest.csv");
+
+        storm::modelchecker::helper::internal::GameViHelper<double> viHelper(createSlowlyConvergingGame(), storm::storage::BitVector(2, false));
+        std::vector<double> x = {0.0, 0.0};
+        std::vector<double> b = {0.5, 0.0};
+        std::vector<double> choiceValues;
+        viHelper.performValueIteration(env, x, b, storm::OptimizationDirection::Maximize, choiceValues);
+        EXPECT_FALSE(viHelper.isResultApproximate());
+        EXPECT_NEAR(1.0, x[0], 1e-5);
+        EXPECT_EQ(0.0, x[1]);
+
+        std::ifstream traceStream("gameViHelperTest.csv");
+        std::string line;
+        ASSERT_TRUE(static_cast<bool>(std::getline(traceStream, line)));
+        EXPECT_EQ("iteration,time-s,max-diff,min-diff,changing-states,iterations-per-second", line);
+        uint64_t rows = 0;
+        while (std::getline(traceStream, line)) {
+            ++rows;
+        }
+        // The difference halves in each iteration.
+        EXPECT_LE(19ul, rows);
+        EXPECT_GE(22ul, rows);
+        traceStream.close();
+        std::remove("gameViHelperTest.csv");
+    }
+
+    TEST(GameViHelperTest, TimeBudget) {
+        storm::Environment env;
+        env.solver().game().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        env.solver().game().setTimeBudget(1e-12);
+
+        storm::modelchecker::helper::internal::GameViHelper<double> viHelper(createSlowlyConvergingGame(), storm::storage::BitVector(2, false));
+        std::vector<double> x = {0.0, 0.0};
+        std::vector<double> b = {0.5, 0.0};
+        std::vector<double> choiceValues;
+        viHelper.performValueIteration(env, x, b, storm::OptimizationDirection::Maximize, choiceValues);
+        EXPECT_TRUE(viHelper.isResultApproximate());
+        // The iteration stops after the first step, whose value is a lower bound of the actual value.
+        EXPECT_NEAR(0.5, x[0], 1e-12);
+        ASSERT_EQ(2ul, choiceValues.size());
+        EXPECT_NEAR(0.75, choiceValues[0], 1e-12);
+        EXPECT_EQ(0.0, choiceValues[1]);
+    }
+
+    TEST(GameViHelperTest, IterationLimit) {
+        storm::Environment env;
+        env.solver().game().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        env.solver().game().setMaximalNumberOfIterations(3);
+
+        storm::modelchecker::helper::internal::GameViHelper<double> viHelper(createSlowlyConvergingGame(), storm::storage::BitVector(2, false));
+        std::vector<double> x = {0.0, 0.0};
+        std::vector<double> b = {0.5, 0.0};
+        std::vector<double> choiceValues;
+        viHelper.performValueIteration(env, x, b, storm::OptimizationDirection::Maximize, choiceValues);
+        EXPECT_TRUE(viHelper.isResultApproximate());
+        EXPECT_NEAR(0.875, x[0], 1e-12);
+
+        // For a step-bounded property, the values after the last step are exact.
+        viHelper.setStepBounded(true);
+        x = {0.0, 0.0};
+        viHelper.performValueIteration(env, x, b, storm::OptimizationDirection::Maximize, choiceValues);
+        EXPECT_FALSE(viHelper.isResultApproximate());
+        EXPECT_NEAR(0.875, x[0], 1e-12);
+    }
+
+    TEST(GameViHelperTest, TopologicalSimdConvergence) {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::TopologicalSimd);
+        env.solver().game().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+
+        storm::modelchecker::helper::internal::GameViHelper<double> viHelper(createSlowlyConvergingGame(), storm::storage::BitVector(2, false));
+        std::vector<double> x = {0.0, 0.0};
+        std::vector<double> b = {0.5, 0.0};
+        std::vector<double> choiceValues;
+        viHelper.performValueIteration(env, x, b, storm::OptimizationDirection::Maximize, choiceValues);
+        EXPECT_FALSE(viHelper.isResultApproximate());
+        EXPECT_NEAR(1.0, x[0], 1e-5);
+
+        // The solver is stopped before the values converge.
+        env.solver().game().setMaximalNumberOfIterations(3);
+        x = {0.0, 0.0};
+        viHelper.performValueIteration(env, x, b, storm::OptimizationDirection::Maximize, choiceValues);
+        EXPECT_TRUE(viHelper.isResultApproximate());
+        EXPECT_GT(0.9, x[0]);
+
+        // The time budget and the trace are not supported by this method.
+        env.solver().game().setTimeBudget(1.0);
+        STORM_SILENT_EXPECT_THROW(viHelper.performValueIteration(env, x, b, storm::OptimizationDirection::Maximize, choiceValues), storm::exceptions::NotSupportedException);
+    }
+
+    TEST(GameViHelperTest, DiskMatrix) {
+        storm::Environment env;
+        env.solver().game().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/smg/walker.nm");
+        storm::generator::NextStateGeneratorOptions generatorOptions;
+        generatorOptions.setBuildAllLabels();
+        storm::builder::OutOfCoreModelComponents components = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).buildOutOfCore("gameViHelperTest.bin");
+        {
+            storm::storage::DiskSparseMatrix<double> transitionMatrix(components.transitionMatrixFilename);
+            uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
+            ASSERT_EQ(5ul, numberOfStates);
+
+            // As in the model checker, the states that are not owned by the coalition optimize in the opposite direction.
+            ASSERT_TRUE(components.statePlayerIndications.is_initialized() && components.playerNameToIndexMap.is_initialized());
+            storm::storage::PlayerIndex walker = components.playerNameToIndexMap->at("walker");
+            storm::storage::BitVector statesOfCoalition(numberOfStates, false);
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                statesOfCoalition.set(state, components.statePlayerIndications.get()[state] != walker);
+            }
+            uint64_t initialState = *components.stateLabeling.getStates("init").begin();
+
+            // <<walker>> P=? [F "s3"]
+            storm::modelchecker::helper::internal::DiskGameViHelper<double> viHelper(transitionMatrix, statesOfCoalition);
+            std::vector<double> x = viHelper.computeUntilProbabilities(env, storm::OptimizationDirection::Maximize, storm::storage::BitVector(numberOfStates, true), components.stateLabeling.getStates("s3"));
+            EXPECT_FALSE(viHelper.isResultApproximate());
+            EXPECT_NEAR(0.34545435, x[initialState], 1e-6);
+            x = viHelper.computeUntilProbabilities(env, storm::OptimizationDirection::Minimize, storm::storage::BitVector(numberOfStates, true), components.stateLabeling.getStates("s3"));
+            EXPECT_NEAR(0.0, x[initialState], 1e-6);
+        }
+        std::remove(components.transitionMatrixFilename.c_str());
+    }
+}
@@ -0,0 +1,204 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <cstdio>
+#include <fstream>
+
+#include "storm/api/builder.h"
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm/api/properties.h"
+#include "storm-parsers/api/properties.h"
+
+#include "storm/models/sparse/Smg.h"
+#include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
+#include "storm/modelchecker/rpatl/helper/SparseSmgMultiObjectiveHelper.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitParetoCurveCheckResult.h"
+#include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
+#include "storm/environment/solver/GameSolverEnvironment.h"
+#include "storm/logic/Formulas.h"
+#include "storm/shields/ShieldHandling.h"
+#include "storm/utility/vector.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace {
+    class DoubleViEnvironment {
+    public:
+        typedef double ValueType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().game().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            env.modelchecker().multi().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-4));
+            return env;
+        }
+    };
+
+    template<typename TestType>
+    class MultiObjectiveSmgRpatlModelCheckerTest : public ::testing::Test {
+    public:
+        typedef typename TestType::ValueType ValueType;
+        MultiObjectiveSmgRpatlModelCheckerTest() : _environment(TestType::createEnvironment()) {}
+        storm::Environment const& env() const { return _environment; }
+
+        std::pair<std::shared_ptr<storm::models::sparse::Smg<ValueType>>, std::vector<std::shared_ptr<storm::logic::Formula const>>> buildModelFormulas(std::string const& pathToPrismFile, std::string const& formulasAsString, std::string const& constantDefinitionString = "") const {
+            std::pair<std::shared_ptr<storm::models::sparse::Smg<ValueType>>, std::vector<std::shared_ptr<storm::logic::Formula const>>> result;
+            storm::prism::Program program = storm::api::parseProgram(pathToPrismFile);
+            program = storm::utility::prism::preprocess(program, constantDefinitionString);
+            result.second = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+            result.first = storm::api::buildSparseModel<ValueType>(program, result.second)->template as<storm::models::sparse::Smg<ValueType>>();
+            return result;
+        }
+
+        std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> getTasks(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) const {
+            std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> result;
+            for (auto const& f : formulas) {
+                result.emplace_back(*f, true);
+            }
+            return result;
+        }
+
+        bool containsPoint(std::vector<std::vector<ValueType>> const& points, std::vector<ValueType> const& expected) const {
+            for (auto const& point : points) {
+                bool close = true;
+                for (uint64_t i = 0; i < expected.size(); ++i) {
+                    close &= std::abs(point[i] - expected[i]) < 1e-4;
+                }
+                if (close) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Reads the choices that the shield in the given file allows at the given state and removes the file.
+        std::vector<uint64_t> getAllowedChoices(std::string const& filename, uint64_t state) const {
+            std::vector<uint64_t> result;
+            std::ifstream shieldFile(filename);
+            std::string line;
+            while (std::getline(shieldFile, line)) {
+                std::istringstream lineStream(line);
+                uint64_t lineState;
+                if (!(lineStream >> lineState) || lineState != state) {
+                    continue;
+                }
+                // The choices are given as "<value>: (<choice>)".
+                for (auto position = line.find('('); position != std::string::npos; position = line.find('(', position + 1)) {
+                    result.push_back(std::stoull(line.substr(position + 1)));
+                }
+            }
+            shieldFile.close();
+            std::remove(filename.c_str());
+            return result;
+        }
+
+    private:
+        storm::Environment _environment;
+    };
+
+    typedef ::testing::Types<
+            DoubleViEnvironment
+    > TestingTypes;
+
+    TYPED_TEST_SUITE(MultiObjectiveSmgRpatlModelCheckerTest, TestingTypes,);
+
+    TYPED_TEST(MultiObjectiveSmgRpatlModelCheckerTest, Achievability) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        std::string formulasString = "<<ctrl>> multi(P>=0.4 [F \"a\"], P>=0.1 [F \"b\"])";
+        formulasString += "; <<ctrl>> multi(P>=0.5 [F \"a\"], P>=0.1 [F \"b\"])";
+        formulasString += "; <<ctrl>> multi(P>=0.4 [F \"a\"], R{\"cost\"}<=0.9 [C])";
+        formulasString += "; <<ctrl>> multi(P>=0.4 [F \"a\"], R{\"cost\"}<=0.7 [C])";
+        formulasString += "; <<ctrl, env>> multi(P>=1 [F \"a\"], P<=0 [G !\"a\"])";
+
+        auto modelFormulas = this->buildModelFormulas(STORM_TEST_RESOURCES_DIR "/smg/multiObjective.nm", formulasString);
+        auto smg = std::move(modelFormulas.first);
+        auto tasks = this->getTasks(modelFormulas.second);
+        EXPECT_EQ(8ul, smg->getNumberOfStates());
+        ASSERT_EQ(smg->getType(), storm::models::ModelType::Smg);
+
+        storm::modelchecker::SparseSmgRpatlModelChecker<storm::models::sparse::Smg<ValueType>> checker(*smg);
+        ASSERT_TRUE(checker.canHandle(tasks[0]));
+
+        auto result = checker.check(this->env(), tasks[0]);
+        EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[*smg->getInitialStates().begin()]);
+        result = checker.check(this->env(), tasks[1]);
+        EXPECT_FALSE(result->asExplicitQualitativeCheckResult()[*smg->getInitialStates().begin()]);
+        result = checker.check(this->env(), tasks[2]);
+        EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[*smg->getInitialStates().begin()]);
+        result = checker.check(this->env(), tasks[3]);
+        EXPECT_FALSE(result->asExplicitQualitativeCheckResult()[*smg->getInitialStates().begin()]);
+        // If the environment cooperates, goal "a" is reached almost surely.
+        result = checker.check(this->env(), tasks[4]);
+        EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[*smg->getInitialStates().begin()]);
+    }
+
+    TYPED_TEST(MultiObjectiveSmgRpatlModelCheckerTest, Pareto) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        std::string formulasString = "<<ctrl>> multi(Pmax=? [F \"a\"], Pmax=? [F \"b\"])";
+        formulasString += "; <<ctrl>> multi(Pmax=? [F \"a\"], R{\"cost\"}min=? [C])";
+
+        auto modelFormulas = this->buildModelFormulas(STORM_TEST_RESOURCES_DIR "/smg/multiObjective.nm", formulasString);
+        auto smg = std::move(modelFormulas.first);
+        auto tasks = this->getTasks(modelFormulas.second);
+
+        storm::modelchecker::SparseSmgRpatlModelChecker<storm::models::sparse::Smg<ValueType>> checker(*smg);
+
+        auto result = checker.check(this->env(), tasks[0]);
+        ASSERT_TRUE(result->isParetoCurveCheckResult());
+        auto points = result->template asExplicitParetoCurveCheckResult<ValueType>().getPoints();
+        EXPECT_TRUE(this->containsPoint(points, {0.5, 0.0}));
+        EXPECT_TRUE(this->containsPoint(points, {0.0, 1.0}));
+        // Both goals can not be reached at the same time.
+        EXPECT_FALSE(this->containsPoint(points, {0.5, 1.0}));
+
+        result = checker.check(this->env(), tasks[1]);
+        ASSERT_TRUE(result->isParetoCurveCheckResult());
+        points = result->template asExplicitParetoCurveCheckResult<ValueType>().getPoints();
+        EXPECT_TRUE(this->containsPoint(points, {0.5, 1.0}));
+        EXPECT_TRUE(this->containsPoint(points, {0.0, 0.0}));
+    }
+
+    TYPED_TEST(MultiObjectiveSmgRpatlModelCheckerTest, WeightedSumShield) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        std::string formulasString = "<<ctrl>> multi(Pmax=? [F \"a\"], Pmax=? [F \"b\"])";
+        formulasString += "; <<ctrl>> multi(Pmax=? [F \"a\"], R{\"cost\"}min=? [C])";
+
+        auto modelFormulas = this->buildModelFormulas(STORM_TEST_RESOURCES_DIR "/smg/multiObjective.nm", formulasString);
+        auto smg = std::move(modelFormulas.first);
+        auto const& gameFormula = modelFormulas.second[0]->asGameFormula();
+        storm::modelchecker::helper::SparseSmgMultiObjectiveHelper<ValueType> helper(*smg, gameFormula.getSubformula().asMultiObjectiveFormula(), smg->computeStatesOfCoalition(gameFormula.getCoalition()));
+        helper.check(this->env());
+        uint64_t initialState = *helper.getProductModel()->getInitialStates().begin();
+
+        // The thresholds of the shield apply to the weighted sum of the objectives. In the initial state, going left
+        // (choice 0) reaches "a" with probability 0.5 (if the environment blocks) and going right (choice 1) reaches "b".
+        auto computeAllowedChoices = [&] (std::vector<storm::RationalNumber> const& weights, storm::logic::ShieldComparison comparison, double value) {
+            storm::Environment env = this->env();
+            env.modelchecker().multi().setShieldWeightVector(weights);
+            auto shieldingExpression = std::make_shared<storm::logic::ShieldExpression>(storm::logic::ShieldingType::PreSafety, "multiObjectiveWeightedSumShield", comparison, value);
+            helper.createShield(env, shieldingExpression);
+            return this->getAllowedChoices(tempest::shields::shieldFilename(shieldingExpression), initialState);
+        };
+        storm::RationalNumber zero = storm::utility::zero<storm::RationalNumber>();
+        storm::RationalNumber one = storm::utility::one<storm::RationalNumber>();
+        EXPECT_EQ(std::vector<uint64_t>({0}), computeAllowedChoices({one, zero}, storm::logic::ShieldComparison::Relative, 0.9));
+        EXPECT_EQ(std::vector<uint64_t>({1}), computeAllowedChoices({zero, one}, storm::logic::ShieldComparison::Relative, 0.9));
+        // With equal weights, the choices have the values 0.25 and 0.5.
+        EXPECT_EQ(std::vector<uint64_t>({1}), computeAllowedChoices({one, one}, storm::logic::ShieldComparison::Relative, 0.9));
+        EXPECT_EQ(std::vector<uint64_t>({0, 1}), computeAllowedChoices({one, one}, storm::logic::ShieldComparison::Relative, 0.4));
+        EXPECT_EQ(std::vector<uint64_t>({1}), computeAllowedChoices({one, one}, storm::logic::ShieldComparison::Absolute, 0.3));
+        EXPECT_EQ(std::vector<uint64_t>({0, 1}), computeAllowedChoices({one, one}, storm::logic::ShieldComparison::Absolute, 0.2));
+
+        // Minimizing objectives enter the weighted sum negatively, so they can only be shielded with absolute comparisons.
+        auto const& costGameFormula = modelFormulas.second[1]->asGameFormula();
+        storm::modelchecker::helper::SparseSmgMultiObjectiveHelper<ValueType> costHelper(*smg, costGameFormula.getSubformula().asMultiObjectiveFormula(), smg->computeStatesOfCoalition(costGameFormula.getCoalition()));
+        costHelper.check(this->env());
+        storm::Environment env = this->env();
+        env.modelchecker().multi().setShieldWeightVector({one, one});
+        auto relativeExpression = std::make_shared<storm::logic::ShieldExpression>(storm::logic::ShieldingType::PreSafety, "multiObjectiveCostShield", storm::logic::ShieldComparison::Relative, 0.9);
+        STORM_SILENT_EXPECT_THROW(costHelper.createShield(env, relativeExpression), storm::exceptions::NotSupportedException);
+        std::remove(tempest::shields::shieldFilename(relativeExpression).c_str());
+    }
+}
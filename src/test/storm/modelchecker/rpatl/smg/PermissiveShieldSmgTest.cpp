@@ -0,0 +1,81 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_GLPK
+#include <algorithm>
+
+#include "storm/shields/PermissivePreShield.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/logic/ShieldExpression.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace {
+    // Two states of the coalition. Each of the choices of both states satisfies the bound locally, but the second choice
+    // of state 0 relies on state 1 picking its first choice.
+    storm::storage::SparseMatrix<double> buildMatrix() {
+        storm::storage::SparseMatrixBuilder<double> builder(7, 4, 11, true, true, 4);
+        builder.newRowGroup(0);
+        builder.addNextValue(0, 2, 0.2);
+        builder.addNextValue(0, 3, 0.8);
+        builder.addNextValue(1, 1, 0.9);
+        builder.addNextValue(1, 2, 0.1);
+        builder.newRowGroup(2);
+        builder.addNextValue(2, 3, 1.0);
+        builder.addNextValue(3, 2, 0.2);
+        builder.addNextValue(3, 3, 0.8);
+        builder.addNextValue(4, 2, 0.2);
+        builder.addNextValue(4, 3, 0.8);
+        builder.newRowGroup(5);
+        builder.addNextValue(5, 2, 1.0);
+        builder.newRowGroup(6);
+        builder.addNextValue(6, 3, 1.0);
+        return builder.build();
+    }
+
+    std::vector<uint64_t> getAllowedChoices(storm::storage::PreScheduler<double> const& shield, uint64_t state) {
+        std::vector<uint64_t> result;
+        for (auto const& choice : shield.getChoice(state).getChoiceMap()) {
+            result.push_back(std::get<1>(choice));
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    TEST(PermissiveShieldSmgTest, GloballyConsistent) {
+        auto matrix = buildMatrix();
+        std::vector<double> stateValues = {0.9, 1.0, 0.0, 1.0};
+        std::vector<double> choiceValues = {0.8, 0.9, 1.0, 0.8, 0.8, 0.0, 1.0};
+        storm::storage::BitVector badStates(4, std::vector<uint_fast64_t>({2}));
+        storm::storage::BitVector goodStates(4, std::vector<uint_fast64_t>({3}));
+        storm::storage::BitVector allStates(4, true);
+
+        // Allowing every locally safe choice guarantees a probability of 0.72 in state 0.
+        auto shieldingExpression = std::make_shared<storm::logic::ShieldExpression const>(storm::logic::ShieldingType::PermissivePre, "permissive", storm::logic::ShieldComparison::Absolute, 0.7);
+        tempest::shields::PermissivePreShield<double, uint_fast64_t> soundShield(matrix, stateValues, choiceValues, badStates, goodStates, shieldingExpression, storm::OptimizationDirection::Maximize, allStates, boost::none, 1e-6);
+        auto shield = soundShield.construct();
+        EXPECT_EQ(std::vector<uint64_t>({0, 1}), getAllowedChoices(shield, 0));
+        EXPECT_EQ(std::vector<uint64_t>({0, 1, 2}), getAllowedChoices(shield, 1));
+
+        // Now, either the second choice of state 0 or the last two choices of state 1 need to be blocked.
+        shieldingExpression = std::make_shared<storm::logic::ShieldExpression const>(storm::logic::ShieldingType::PermissivePre, "permissive", storm::logic::ShieldComparison::Absolute, 0.75);
+        tempest::shields::PermissivePreShield<double, uint_fast64_t> milpShield(matrix, stateValues, choiceValues, badStates, goodStates, shieldingExpression, storm::OptimizationDirection::Maximize, allStates, boost::none, 1e-6);
+        shield = milpShield.construct();
+        EXPECT_EQ(std::vector<uint64_t>({0}), getAllowedChoices(shield, 0));
+        EXPECT_EQ(std::vector<uint64_t>({0, 1, 2}), getAllowedChoices(shield, 1));
+    }
+
+    TEST(PermissiveShieldSmgTest, NoCandidateChoice) {
+        auto matrix = buildMatrix();
+        // The value of state 1 is not attained by any of its choices.
+        std::vector<double> stateValues = {0.9, 1.0, 0.0, 1.0};
+        std::vector<double> choiceValues = {0.8, 0.9, 0.8, 0.8, 0.8, 0.0, 1.0};
+        storm::storage::BitVector badStates(4, std::vector<uint_fast64_t>({2}));
+        storm::storage::BitVector goodStates(4, std::vector<uint_fast64_t>({3}));
+        storm::storage::BitVector allStates(4, true);
+
+        auto shieldingExpression = std::make_shared<storm::logic::ShieldExpression const>(storm::logic::ShieldingType::PermissivePre, "permissive", storm::logic::ShieldComparison::Absolute, 0.85);
+        tempest::shields::PermissivePreShield<double, uint_fast64_t> shield(matrix, stateValues, choiceValues, badStates, goodStates, shieldingExpression, storm::OptimizationDirection::Maximize, allStates, boost::none, 1e-6);
+        STORM_SILENT_EXPECT_THROW(shield.construct(), storm::exceptions::InvalidArgumentException);
+    }
+}
+#endif
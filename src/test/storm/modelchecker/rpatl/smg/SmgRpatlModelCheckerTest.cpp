@@ -12,6 +12,7 @@
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/QualitativeCheckResult.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/GameSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/settings/modules/CoreSettings.h"
@@ -86,6 +87,20 @@ namespace {
         }
     };
 
+    class SparseDoubleTopologicalSimdEnvironment {
+    public:
+        static const SmgEngine engine = SmgEngine::PrismSparse;
+        static const bool isExact = false;
+        typedef double ValueType;
+        typedef storm::models::sparse::Smg<ValueType> ModelType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::TopologicalSimd);
+            env.solver().game().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+            return env;
+        }
+    };
+
     template<typename TestType>
     class SmgRpatlModelCheckerTest : public ::testing::Test {
     public:
@@ -153,7 +168,8 @@ namespace {
     SparseDoubleValueIterationGmmxxGaussSeidelMultEnvironment,
     SparseDoubleValueIterationGmmxxRegularMultEnvironment,
     SparseDoubleValueIterationNativeGaussSeidelMultEnvironment,
-    SparseDoubleValueIterationNativeRegularMultEnvironment
+    SparseDoubleValueIterationNativeRegularMultEnvironment,
+    SparseDoubleTopologicalSimdEnvironment
     > TestingTypes;
 
     TYPED_TEST_SUITE(SmgRpatlModelCheckerTest, TestingTypes,);
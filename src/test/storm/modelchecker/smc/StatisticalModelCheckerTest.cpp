@@ -0,0 +1,81 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/smc/StatisticalModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm-parsers/parser/FormulaParser.h"
+
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/Smg.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+TEST(StatisticalModelCheckerTest, Die) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser(program);
+
+    storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<double>>::Options options;
+    options.precision = 0.01;
+    options.confidence = 0.99;
+    options.indifference = 0.01;
+    options.seed = 42;
+    storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<double>> checker(program, options);
+
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F<=100 \"one\"]");
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    double estimate = result->asExplicitQuantitativeCheckResult<double>()[0];
+    EXPECT_NEAR(1.0 / 6.0, estimate, options.precision);
+
+    // The same seed yields the same paths.
+    result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_EQ(estimate, result->asExplicitQuantitativeCheckResult<double>()[0]);
+
+    // The die needs at least three steps to be rolled.
+    formula = formulaParser.parseSingleFormulaFromString("P=? [F<=2 \"done\"]");
+    result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_EQ(0.0, result->asExplicitQuantitativeCheckResult<double>()[0]);
+
+    formula = formulaParser.parseSingleFormulaFromString("P>=0.1 [F<=100 \"one\"]");
+    result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[0]);
+
+    formula = formulaParser.parseSingleFormulaFromString("P>=0.25 [F<=100 \"one\"]");
+    result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_FALSE(result->asExplicitQualitativeCheckResult()[0]);
+
+    formula = formulaParser.parseSingleFormulaFromString("P<0.25 [G<=100 !\"two\"]");
+    result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_FALSE(result->asExplicitQualitativeCheckResult()[0]);
+}
+
+TEST(StatisticalModelCheckerTest, FixedStrategy) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/die_selection.nm");
+    storm::parser::FormulaParser formulaParser(program);
+
+    storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Mdp<double>>::Options options;
+    options.precision = 0.01;
+    options.confidence = 0.99;
+    options.strategy = storm::settings::modules::StatisticalModelCheckingSettings::Strategy::First;
+    options.seed = 42;
+    storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Mdp<double>> checker(program, options);
+
+    // The first choice always flips a fair coin.
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F<=100 s=7&d=1]");
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_NEAR(1.0 / 6.0, result->asExplicitQuantitativeCheckResult<double>()[0], options.precision);
+
+    // Optimal probabilities cannot be obtained with a fixed strategy.
+    formula = formulaParser.parseSingleFormulaFromString("Pmax=? [F<=100 s=7&d=1]");
+    EXPECT_FALSE(checker.canHandle(storm::modelchecker::CheckTask<>(*formula, true)));
+
+    storm::prism::Program gameProgram = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/smg/walker.nm");
+    storm::parser::FormulaParser gameFormulaParser(gameProgram);
+    storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Smg<double>> gameChecker(gameProgram);
+    formula = gameFormulaParser.parseSingleFormulaFromString("<<walker>> Pmax=? [F<=5 \"s1\"]");
+    EXPECT_FALSE(gameChecker.canHandle(storm::modelchecker::CheckTask<>(*formula, true)));
+}
@@ -78,3 +78,28 @@ TEST(GameShieldingParserTest, OptimalShieldTest) {
     EXPECT_TRUE(shieldExpression->isOptimalShield());
     EXPECT_EQ(filename, shieldExpression->getFilename());
 }
+
+TEST(GameShieldingParserTest, PermissivePreSafetyShieldTest) {
+    storm::parser::FormulaParser formulaParser;
+
+    std::string filename = "permissiveShieldFileName";
+    std::string value = "0.8";
+    std::string input = "<" + filename + ", PermissivePreSafety, gamma=" + value + "> <<p1>> Pmax=? [G !\"label\"]";
+
+    std::shared_ptr<storm::logic::Formula const> formula(nullptr);
+    ASSERT_NO_THROW(formula = formulaParser.parseSingleFormulaFromString(input));
+    EXPECT_TRUE(formula->isGameFormula());
+
+    std::vector<storm::jani::Property> property;
+    ASSERT_NO_THROW(property = formulaParser.parseFromString(input));
+    EXPECT_TRUE(property.at(0).isShieldingProperty());
+
+    std::shared_ptr<storm::logic::ShieldExpression const> shieldExpression(nullptr);
+    ASSERT_NO_THROW(shieldExpression = property.at(0).getShieldingExpression());
+    EXPECT_TRUE(shieldExpression->isPermissivePreShield());
+    EXPECT_FALSE(shieldExpression->isPreSafetyShield());
+    EXPECT_FALSE(shieldExpression->isOptimalShield());
+    EXPECT_FALSE(shieldExpression->isRelative());
+    EXPECT_EQ(std::stod(value), shieldExpression->getValue());
+    EXPECT_EQ(filename, shieldExpression->getFilename());
+}
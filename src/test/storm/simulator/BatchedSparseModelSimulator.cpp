@@ -0,0 +1,50 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/simulator/BatchedSparseModelSimulator.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/api/storm.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/PrismParser.h"
+
+TEST(BatchedSparseModelSimulatorTest, PhiloxKnownAnswer) {
+    // Known answer test of the reference implementation (Random123).
+    storm::utility::PhiloxGenerator generator(0);
+    storm::utility::PhiloxGenerator::Counter result = generator({0, 0, 0, 0});
+    EXPECT_EQ(0x6627e8d5u, result[0]);
+    EXPECT_EQ(0xe169c58du, result[1]);
+    EXPECT_EQ(0xbc57ac4cu, result[2]);
+    EXPECT_EQ(0x9b00dbd8u, result[3]);
+}
+
+TEST(BatchedSparseModelSimulatorTest, KnuthYaoDie) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("R=? [F \"done\"];P=? [F \"one\"]", program));
+    auto dtmc = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Dtmc<double>>();
+
+    storm::simulator::BatchedSparseModelSimulator<double> simulator(*dtmc);
+    simulator.setSeed(42);
+    simulator.setTerminalStates(dtmc->getStates("done"));
+    simulator.setObservedLabels({"one", "done"});
+
+    uint64_t numberOfPaths = 20000;
+    auto result = simulator.simulate(numberOfPaths, 1000);
+    EXPECT_EQ(numberOfPaths, result.numberOfPaths);
+    EXPECT_EQ(numberOfPaths, result.terminatedPaths);
+    EXPECT_EQ(numberOfPaths, result.labelHits[1]);
+    EXPECT_NEAR(1.0 / 6.0, result.getLabelFrequency(0), 0.02);
+    EXPECT_NEAR(11.0 / 3.0, result.getAverageReward(0), 0.1);
+    // Every step corresponds to one coin flip.
+    EXPECT_EQ(static_cast<double>(result.totalSteps), result.rewardSums[0]);
+
+    // The paths only depend on the seed.
+    simulator.setBatchSize(77);
+    auto otherResult = simulator.simulate(numberOfPaths, 1000);
+    EXPECT_EQ(result.labelHits, otherResult.labelHits);
+    EXPECT_EQ(result.totalSteps, otherResult.totalSteps);
+
+    // Without enough steps, no path terminates.
+    auto boundedResult = simulator.simulate(100, 1);
+    EXPECT_EQ(0ul, boundedResult.terminatedPaths);
+    EXPECT_EQ(100ul, boundedResult.totalSteps);
+}
@@ -0,0 +1,125 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/simulator/ShieldedSparseModelSimulator.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/Smg.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/exceptions/InvalidOperationException.h"
+
+namespace {
+    // In state 0, the first choice safely leads to state 1 and the second choice (with reward 1) leads to the unsafe
+    // state 2 with probability 0.5.
+    storm::models::sparse::Mdp<double> buildMdp() {
+        storm::storage::SparseMatrixBuilder<double> builder(4, 3, 5, true, true, 3);
+        builder.newRowGroup(0);
+        builder.addNextValue(0, 1, 1.0);
+        builder.addNextValue(1, 1, 0.5);
+        builder.addNextValue(1, 2, 0.5);
+        builder.newRowGroup(2);
+        builder.addNextValue(2, 1, 1.0);
+        builder.newRowGroup(3);
+        builder.addNextValue(3, 2, 1.0);
+
+        storm::models::sparse::StateLabeling labeling(3);
+        labeling.addLabel("init", storm::storage::BitVector(3, std::vector<uint_fast64_t>({0})));
+        std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<double>> rewardModels;
+        rewardModels.emplace("risk", storm::models::sparse::StandardRewardModel<double>(boost::none, std::vector<double>({0.0, 1.0, 0.0, 0.0})));
+        return storm::models::sparse::Mdp<double>(builder.build(), labeling, rewardModels);
+    }
+
+    TEST(ShieldedSparseModelSimulatorTest, InterferenceAndViolations) {
+        auto mdp = buildMdp();
+        storm::simulator::ShieldedSparseModelSimulator<double> simulator(mdp);
+        simulator.setSeed(7);
+        simulator.setUnsafeStates(storm::storage::BitVector(3, std::vector<uint_fast64_t>({2})));
+        simulator.setTerminalStates(storm::storage::BitVector(3, std::vector<uint_fast64_t>({1})));
+
+        uint64_t numberOfPaths = 20000;
+        auto unshielded = simulator.simulate(numberOfPaths, 10);
+        EXPECT_EQ(numberOfPaths, unshielded.decisions);
+        EXPECT_EQ(0ul, unshielded.interferences);
+        EXPECT_NEAR(0.25, unshielded.getViolationProbability(), 0.02);
+        EXPECT_NEAR(0.5, unshielded.getAverageReward(0), 0.02);
+        auto interval = unshielded.getViolationConfidenceInterval(0.99);
+        EXPECT_LE(interval.first, unshielded.getViolationProbability());
+        EXPECT_GE(interval.second, unshielded.getViolationProbability());
+        EXPECT_LT(interval.second - interval.first, 0.05);
+
+        storm::storage::PreScheduler<double> preShield(3);
+        storm::storage::PreSchedulerChoice<double> allowed;
+        allowed.addChoice(0, 1.0);
+        preShield.setChoice(allowed, 0, 0);
+        simulator.setShield(preShield);
+        auto preShielded = simulator.simulate(numberOfPaths, 10);
+        EXPECT_EQ(0ul, preShielded.violatingPaths);
+        EXPECT_NEAR(0.5, preShielded.getInterferenceRate(), 0.02);
+        EXPECT_EQ(0.0, preShielded.getAverageReward(0));
+
+        storm::storage::PostScheduler<double> postShield(3, {2, 1, 1});
+        storm::storage::PostSchedulerChoice<double> correction;
+        correction.addChoice(0, 0);
+        correction.addChoice(1, 0);
+        postShield.setChoice(correction, 0, 0);
+        simulator.setShield(postShield);
+        // An agent that always takes the risky choice is corrected in every step.
+        simulator.setAgentPolicy([] (uint64_t, uint64_t numberOfChoices, uint64_t) { return numberOfChoices - 1; });
+        auto postShielded = simulator.simulate(numberOfPaths, 10);
+        EXPECT_EQ(0ul, postShielded.violatingPaths);
+        EXPECT_EQ(1.0, postShielded.getInterferenceRate());
+
+        // The statistics only depend on the seed.
+        simulator.clearShield();
+        simulator.setAgentPolicy([] (uint64_t, uint64_t numberOfChoices, uint64_t randomBits) { return ((randomBits & 0xFFFFFFFFull) * numberOfChoices) >> 32; });
+        simulator.setBatchSize(99);
+        auto otherUnshielded = simulator.simulate(numberOfPaths, 10);
+        EXPECT_EQ(unshielded.violatingPaths, otherUnshielded.violatingPaths);
+        EXPECT_EQ(unshielded.rewardSums, otherUnshielded.rewardSums);
+    }
+
+    TEST(ShieldedSparseModelSimulatorTest, OnlyCoalitionStatesAreShielded) {
+        // The agent decides in state 0 whether to move to the unsafe state 2 or to state 3, in which the environment
+        // decides whether to move to the safe state 1 or to state 2.
+        storm::storage::SparseMatrixBuilder<double> builder(6, 4, 6, true, true, 4);
+        builder.newRowGroup(0);
+        builder.addNextValue(0, 3, 1.0);
+        builder.addNextValue(1, 2, 1.0);
+        builder.newRowGroup(2);
+        builder.addNextValue(2, 1, 1.0);
+        builder.newRowGroup(3);
+        builder.addNextValue(3, 2, 1.0);
+        builder.newRowGroup(4);
+        builder.addNextValue(4, 1, 1.0);
+        builder.addNextValue(5, 2, 1.0);
+
+        storm::models::sparse::StateLabeling labeling(4);
+        labeling.addLabel("init", storm::storage::BitVector(4, std::vector<uint_fast64_t>({0})));
+        storm::storage::sparse::ModelComponents<double> components(builder.build(), std::move(labeling));
+        components.statePlayerIndications = std::vector<storm::storage::PlayerIndex>({0, 1, 1, 1});
+        components.playerNameToIndexMap = std::map<std::string, storm::storage::PlayerIndex>({{"agent", 0}, {"env", 1}});
+        storm::models::sparse::Smg<double> smg(std::move(components));
+
+        storm::storage::PreScheduler<double> preShield(4);
+        storm::storage::PreSchedulerChoice<double> allowed;
+        allowed.addChoice(0, 1.0);
+        preShield.setChoice(allowed, 0, 0);
+        preShield.setChoice(allowed, 3, 0);
+
+        storm::simulator::ShieldedSparseModelSimulator<double> simulator(smg);
+        simulator.setSeed(3);
+        simulator.setUnsafeStates(storm::storage::BitVector(4, std::vector<uint_fast64_t>({2})));
+        simulator.setTerminalStates(storm::storage::BitVector(4, std::vector<uint_fast64_t>({1})));
+        simulator.setShield(preShield);
+        STORM_SILENT_EXPECT_THROW(simulator.simulate(10, 10), storm::exceptions::InvalidOperationException);
+
+        simulator.setShieldedCoalition(storm::logic::PlayerCoalition({std::string("agent")}));
+        uint64_t numberOfPaths = 20000;
+        auto result = simulator.simulate(numberOfPaths, 10);
+        // Only the decision of the agent is shielded, the environment still moves to the unsafe state in half of the paths.
+        EXPECT_EQ(numberOfPaths, result.decisions);
+        EXPECT_NEAR(0.5, result.getInterferenceRate(), 0.02);
+        EXPECT_NEAR(0.5, result.getViolationProbability(), 0.02);
+    }
+}
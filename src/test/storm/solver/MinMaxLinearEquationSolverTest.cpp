@@ -87,6 +87,17 @@ namespace {
             return env;
         }
     };
+    class DoubleTopologicalSimdViEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::TopologicalSimd);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            return env;
+        }
+    };
     class DoublePIEnvironment {
     public:
         typedef double ValueType;
@@ -141,6 +152,7 @@ namespace {
             DoubleOptimisticViEnvironment,
             DoubleTopologicalViEnvironment,
             DoubleTopologicalCudaViEnvironment,
+            DoubleTopologicalSimdViEnvironment,
             DoublePIEnvironment,
             RationalPIEnvironment,
             RationalRationalSearchEnvironment
@@ -0,0 +1,137 @@
+#include "test/storm_gtest.h"
+
+#include <atomic>
+#include <cstdint>
+#include <set>
+#include <thread>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+namespace {
+    storm::storage::BitVector createKey(uint64_t index) {
+        storm::storage::BitVector key(128);
+        key.setFromInt(0, 64, index * 7919);
+        key.setFromInt(64, 64, index);
+        return key;
+    }
+}
+
+TEST(ConcurrentBitVectorHashMapTest, FindOrAdd) {
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(128, 3);
+    uint64_t initialCapacity = map.capacity();
+
+    // Insert enough keys to resize the table several times.
+    for (uint64_t index = 0; index < 10000; ++index) {
+        auto valueAndBucket = map.findOrAddAndGetBucket(createKey(index), index);
+        EXPECT_EQ(index, valueAndBucket.first);
+        EXPECT_EQ(index, valueAndBucket.second);
+    }
+    EXPECT_EQ(10000ul, map.size());
+    EXPECT_LT(initialCapacity, map.capacity());
+
+    for (uint64_t index = 0; index < 10000; ++index) {
+        EXPECT_EQ(index, map.findOrAdd(createKey(index), 0));
+        EXPECT_TRUE(map.contains(createKey(index)));
+        EXPECT_EQ(index, map.getValue(createKey(index)));
+        auto keyAndValue = map.getBucketAndValue(index);
+        EXPECT_EQ(createKey(index), keyAndValue.first);
+        EXPECT_EQ(index, keyAndValue.second);
+    }
+    EXPECT_FALSE(map.contains(createKey(10000)));
+    EXPECT_EQ(10000ul, map.size());
+
+    map.remap([] (uint64_t const& value) { return value + 1; });
+    uint64_t numberOfElements = 0;
+    for (auto const& keyAndValue : map) {
+        EXPECT_EQ(keyAndValue.first.getAsInt(64, 64) + 1, keyAndValue.second);
+        ++numberOfElements;
+    }
+    EXPECT_EQ(10000ul, numberOfElements);
+}
+
+TEST(ConcurrentBitVectorHashMapTest, ConcurrentInsertion) {
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(128, 16);
+    uint64_t const numberOfThreads = 4;
+    uint64_t const numberOfKeys = 50000;
+
+    // All threads insert all keys (in different orders), each with its own value.
+    std::vector<std::thread> threads;
+    std::vector<std::vector<uint64_t>> foundValues(numberOfThreads, std::vector<uint64_t>(numberOfKeys));
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        threads.emplace_back([&map, &foundValues, thread, numberOfKeys] () {
+            for (uint64_t step = 0; step < numberOfKeys; ++step) {
+                uint64_t index = (thread % 2 == 0) ? step : numberOfKeys - 1 - step;
+                foundValues[thread][index] = map.findOrAdd(createKey(index), thread);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Every key was inserted exactly once and all threads agree on its value.
+    EXPECT_EQ(numberOfKeys, map.size());
+    for (uint64_t index = 0; index < numberOfKeys; ++index) {
+        uint64_t value = map.getValue(createKey(index));
+        EXPECT_GT(numberOfThreads, value);
+        for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+            EXPECT_EQ(value, foundValues[thread][index]);
+        }
+    }
+    std::set<uint64_t> keys;
+    for (auto const& keyAndValue : map) {
+        keys.insert(keyAndValue.first.getAsInt(64, 64));
+    }
+    EXPECT_EQ(numberOfKeys, keys.size());
+}
+
+TEST(ConcurrentBitVectorHashMapTest, ContainsDuringResize) {
+    // The small initial size makes sure that the table is resized many times while it is queried.
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(128, 16);
+    uint64_t const numberOfReaders = 3;
+    uint64_t const numberOfKeys = 50000;
+
+    // The writer inserts the keys in order and announces how many of them are inserted. Readers check that all
+    // announced keys are found.
+    std::atomic<uint64_t> numberOfInsertedKeys(0);
+    std::atomic<uint64_t> numberOfMissedKeys(0);
+    std::vector<std::thread> threads;
+    threads.emplace_back([&map, &numberOfInsertedKeys, numberOfKeys] () {
+        for (uint64_t index = 0; index < numberOfKeys; ++index) {
+            map.findOrAdd(createKey(index), index);
+            numberOfInsertedKeys.store(index + 1, std::memory_order_release);
+        }
+    });
+    for (uint64_t reader = 0; reader < numberOfReaders; ++reader) {
+        threads.emplace_back([&map, &numberOfInsertedKeys, &numberOfMissedKeys, reader, numberOfKeys] () {
+            uint64_t index = reader;
+            while (true) {
+                uint64_t inserted = numberOfInsertedKeys.load(std::memory_order_acquire);
+                if (inserted == 0) {
+                    continue;
+                }
+                // Query recently inserted keys, which are the ones most likely to be migrated.
+                for (uint64_t offset = 0; offset < 8 && offset < inserted; ++offset) {
+                    if (!map.contains(createKey(inserted - 1 - offset))) {
+                        numberOfMissedKeys.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+                index = index * 6364136223846793005ull + 1442695040888963407ull;
+                if (!map.contains(createKey(index % inserted))) {
+                    numberOfMissedKeys.fetch_add(1, std::memory_order_relaxed);
+                }
+                if (inserted == numberOfKeys) {
+                    break;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(0ul, numberOfMissedKeys.load());
+    EXPECT_EQ(numberOfKeys, map.size());
+    EXPECT_FALSE(map.contains(createKey(numberOfKeys)));
+}
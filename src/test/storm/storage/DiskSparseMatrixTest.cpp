@@ -0,0 +1,68 @@
+#include "test/storm_gtest.h"
+
+#include <cstdio>
+
+#include "storm/storage/DiskSparseMatrix.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/BitVector.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+TEST(DiskSparseMatrixTest, WriteAndRead) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, 0, 0, false, true, 0);
+    {
+        // A chunk size of two makes sure that every part of the matrix is written in several chunks.
+        storm::storage::DiskSparseMatrixWriter<double> matrixWriter("diskSparseMatrixTest.bin", true, 2);
+        auto addNextValue = [&] (uint64_t row, uint64_t column, double value) {
+            matrixBuilder.addNextValue(row, column, value);
+            matrixWriter.addNextValue(row, column, value);
+        };
+        auto newRowGroup = [&] (uint64_t startingRow) {
+            matrixBuilder.newRowGroup(startingRow);
+            matrixWriter.newRowGroup(startingRow);
+        };
+        newRowGroup(0);
+        addNextValue(0, 1, 0.5);
+        addNextValue(0, 3, 0.5);
+        addNextValue(1, 0, 1.0);
+        newRowGroup(2);
+        addNextValue(2, 2, 0.2);
+        addNextValue(2, 3, 0.8);
+        // Row 3 is empty.
+        newRowGroup(4);
+        addNextValue(4, 0, 0.1);
+        addNextValue(4, 1, 0.2);
+        addNextValue(4, 2, 0.3);
+        addNextValue(4, 3, 0.4);
+        newRowGroup(5);
+        addNextValue(5, 3, 1.0);
+        STORM_SILENT_EXPECT_THROW(matrixWriter.addNextValue(4, 0, 1.0), storm::exceptions::InvalidArgumentException);
+        STORM_SILENT_EXPECT_THROW(matrixWriter.addNextValue(5, 2, 1.0), storm::exceptions::InvalidArgumentException);
+        EXPECT_EQ(4ul, matrixWriter.getCurrentRowGroupCount());
+        matrixWriter.finalize(6, 4, 4);
+    }
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build(6, 4, 4);
+
+    storm::storage::DiskSparseMatrix<double> diskMatrix("diskSparseMatrixTest.bin");
+    EXPECT_EQ(6ul, diskMatrix.getRowCount());
+    EXPECT_EQ(4ul, diskMatrix.getColumnCount());
+    EXPECT_EQ(10ul, diskMatrix.getEntryCount());
+    EXPECT_EQ(4ul, diskMatrix.getRowGroupCount());
+    EXPECT_EQ(4ul, diskMatrix.getRowGroupStart(2));
+    EXPECT_EQ(matrix, diskMatrix.toSparseMatrix());
+
+    std::vector<double> x = {1.0, 0.5, 0.25, 0.0};
+    std::vector<double> b = {0.0, 0.1, 0.2, 0.3, 0.4, 0.5};
+    storm::storage::BitVector dirOverride(4);
+    dirOverride.set(1);
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> expected(4), result(4);
+        std::vector<uint64_t> expectedChoices(4), choices(4);
+        matrix.multiplyAndReduce(dir, matrix.getRowGroupIndices(), x, &b, expected, &expectedChoices, &dirOverride);
+        diskMatrix.multiplyAndReduce(dir, x, &b, result, &choices, &dirOverride);
+        for (uint64_t rowGroup = 0; rowGroup < 4; ++rowGroup) {
+            EXPECT_NEAR(expected[rowGroup], result[rowGroup], 1e-12);
+            EXPECT_EQ(expectedChoices[rowGroup], choices[rowGroup]);
+        }
+    }
+    std::remove("diskSparseMatrixTest.bin");
+}
@@ -5,9 +5,19 @@
 #include "storm-parsers/parser/FormulaParser.h"
 
 #include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/api/builder.h"
+#include "storm/api/bisimulation.h"
+#include "storm/api/properties.h"
+#include "storm-parsers/api/properties.h"
+
+#include "storm/environment/Environment.h"
+#include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/shields/ShieldHandling.h"
 
 #include "storm/storage/bisimulation/NondeterministicModelBisimulationDecomposition.h"
 #include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/Smg.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
 TEST(NondeterministicModelBisimulationDecomposition, TwoDice) {
@@ -56,3 +66,75 @@ TEST(NondeterministicModelBisimulationDecomposition, TwoDice) {
     EXPECT_EQ(26ul, result->getNumberOfTransitions());
     EXPECT_EQ(14ul, result->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices());
 }
+
+TEST(NondeterministicModelBisimulationDecomposition, RobotCircleSmg) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/smg/robotCircle.nm");
+
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+
+    ASSERT_EQ(model->getType(), storm::models::ModelType::Smg);
+    std::shared_ptr<storm::models::sparse::Smg<double>> smg = model->as<storm::models::sparse::Smg<double>>();
+
+    typename storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Smg<double>>::Options options;
+    options.respectedAtomicPropositions = std::set<std::string>({"crash"});
+
+    storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Smg<double>> bisim(*smg, options);
+    ASSERT_NO_THROW(bisim.computeBisimulationDecomposition());
+    std::shared_ptr<storm::models::sparse::Model<double>> result;
+    ASSERT_NO_THROW(result = bisim.getQuotient());
+
+    ASSERT_EQ(storm::models::ModelType::Smg, result->getType());
+    std::shared_ptr<storm::models::sparse::Smg<double>> quotient = result->as<storm::models::sparse::Smg<double>>();
+    EXPECT_EQ(81ul, smg->getNumberOfStates());
+    EXPECT_EQ(21ul, quotient->getNumberOfStates());
+    EXPECT_EQ(36ul, quotient->getNumberOfChoices());
+
+    // Every state is mapped to a quotient state of the same player and every choice to a choice of that quotient state.
+    auto const& stateMapping = bisim.getQuotientStateMapping();
+    auto const& choiceMapping = bisim.getQuotientChoiceMapping();
+    ASSERT_EQ(smg->getNumberOfStates(), stateMapping.size());
+    ASSERT_EQ(smg->getNumberOfChoices(), choiceMapping.size());
+    for (uint64_t state = 0; state < smg->getNumberOfStates(); ++state) {
+        uint64_t quotientState = stateMapping[state];
+        EXPECT_EQ(smg->getPlayerOfState(state), quotient->getPlayerOfState(quotientState));
+        for (uint64_t choice = smg->getTransitionMatrix().getRowGroupIndices()[state]; choice < smg->getTransitionMatrix().getRowGroupIndices()[state + 1]; ++choice) {
+            EXPECT_LE(quotient->getTransitionMatrix().getRowGroupIndices()[quotientState], choiceMapping[choice]);
+            EXPECT_GT(quotient->getTransitionMatrix().getRowGroupIndices()[quotientState + 1], choiceMapping[choice]);
+        }
+    }
+}
+
+TEST(NondeterministicModelBisimulationDecomposition, RobotCircleSmgShield) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/smg/robotCircle.nm");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("<<friendlyRobot>> Pmax=? [ G<=8 !\"crash\" ]", program));
+    std::shared_ptr<storm::models::sparse::Smg<double>> smg = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Smg<double>>();
+    std::shared_ptr<storm::models::sparse::Smg<double>> quotient = storm::api::performBisimulationMinimization<double>(smg, formulas)->as<storm::models::sparse::Smg<double>>();
+    EXPECT_EQ(81ul, smg->getNumberOfStates());
+    EXPECT_EQ(21ul, quotient->getNumberOfStates());
+    ASSERT_TRUE(quotient->hasQuotientInformation());
+    EXPECT_EQ(smg, quotient->getQuotientInformation().originalModel);
+
+    storm::Environment env;
+    auto shieldingExpression = std::make_shared<storm::logic::ShieldExpression>(storm::logic::ShieldingType::PreSafety, "robotCircleBisimulationShield", storm::logic::ShieldComparison::Relative, 0.9);
+    auto checkAndExportShield = [&] (std::shared_ptr<storm::models::sparse::Smg<double>> const& model, std::string& shieldString) {
+        storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formulas.front());
+        task.setShieldingExpression(shieldingExpression);
+        storm::modelchecker::SparseSmgRpatlModelChecker<storm::models::sparse::Smg<double>> checker(*model);
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, task);
+        std::ifstream shieldFile(tempest::shields::shieldFilename(shieldingExpression));
+        std::stringstream shieldBuffer;
+        shieldBuffer << shieldFile.rdbuf();
+        shieldString = shieldBuffer.str();
+        std::remove(tempest::shields::shieldFilename(shieldingExpression).c_str());
+        return result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()];
+    };
+
+    // The quotient yields the same value and its shield is exported for the states and choices of the original game.
+    std::string shieldOfOriginal, shieldOfQuotient;
+    double valueOfOriginal = checkAndExportShield(smg, shieldOfOriginal);
+    double valueOfQuotient = checkAndExportShield(quotient, shieldOfQuotient);
+    EXPECT_NEAR(0.975, valueOfOriginal, 1e-6);
+    EXPECT_NEAR(valueOfOriginal, valueOfQuotient, 1e-6);
+    EXPECT_FALSE(shieldOfOriginal.empty());
+    EXPECT_EQ(shieldOfOriginal, shieldOfQuotient);
+}
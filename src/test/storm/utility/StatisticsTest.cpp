@@ -0,0 +1,100 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <thread>
+
+#include "storm/utility/Statistics.h"
+
+TEST(StatisticsTest, Disabled) {
+    auto& recorder = storm::utility::statistics::StatisticsRecorder::recorder();
+    recorder.reset();
+    recorder.setEnabled(false);
+    {
+        storm::utility::statistics::ScopedTimer timer("phase");
+        storm::utility::statistics::addToCounter("iterations", 3);
+    }
+    auto json = recorder.toJson();
+    EXPECT_TRUE(json["phases"].empty());
+    EXPECT_TRUE(json["counters"].empty());
+}
+
+TEST(StatisticsTest, NestedPhases) {
+    auto& recorder = storm::utility::statistics::StatisticsRecorder::recorder();
+    recorder.reset();
+    recorder.setEnabled(true);
+    for (uint64_t call = 0; call < 2; ++call) {
+        storm::utility::statistics::ScopedTimer outerTimer("verification");
+        storm::utility::statistics::setCounter("states", 10);
+        {
+            storm::utility::statistics::ScopedTimer innerTimer("game-value-iteration");
+            storm::utility::statistics::addToCounter("iterations", 5);
+        }
+        storm::utility::statistics::ScopedTimer exportTimer("shield-export");
+        exportTimer.stop();
+        // Stopping twice has no effect.
+        exportTimer.stop();
+    }
+    storm::utility::statistics::setCounter("properties", 2);
+    recorder.setEnabled(false);
+
+    auto json = recorder.toJson();
+    EXPECT_EQ("total", json["name"].get<std::string>());
+    EXPECT_EQ(2.0, json["counters"]["properties"].get<double>());
+    ASSERT_EQ(1ul, json["phases"].size());
+
+    auto const& verification = json["phases"][0];
+    EXPECT_EQ("verification", verification["name"].get<std::string>());
+    EXPECT_EQ(2ul, verification["calls"].get<uint64_t>());
+    EXPECT_EQ(10.0, verification["counters"]["states"].get<double>());
+    EXPECT_LE(verification["time-ms"].get<double>(), json["time-ms"].get<double>());
+    ASSERT_EQ(2ul, verification["phases"].size());
+
+    auto const& valueIteration = verification["phases"][0];
+    EXPECT_EQ("game-value-iteration", valueIteration["name"].get<std::string>());
+    EXPECT_EQ(2ul, valueIteration["calls"].get<uint64_t>());
+    EXPECT_EQ(10.0, valueIteration["counters"]["iterations"].get<double>());
+    EXPECT_EQ("shield-export", verification["phases"][1]["name"].get<std::string>());
+    EXPECT_EQ(2ul, verification["phases"][1]["calls"].get<uint64_t>());
+
+    recorder.reset();
+}
+
+TEST(StatisticsTest, WorkerThreads) {
+    auto& recorder = storm::utility::statistics::StatisticsRecorder::recorder();
+    recorder.reset();
+    recorder.setEnabled(true);
+    {
+        storm::utility::statistics::ScopedTimer outerTimer("verification");
+        std::vector<std::thread> workers;
+        for (uint64_t worker = 0; worker < 4; ++worker) {
+            workers.emplace_back([] () {
+                for (uint64_t call = 0; call < 100; ++call) {
+                    storm::utility::statistics::ScopedTimer workerTimer("worker");
+                    storm::utility::statistics::addToCounter("items", 1);
+                }
+            });
+        }
+        // The workers do not change the active phase of the main thread.
+        for (uint64_t call = 0; call < 100; ++call) {
+            storm::utility::statistics::addToCounter("items", 1);
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+    recorder.setEnabled(false);
+
+    auto json = recorder.toJson();
+    EXPECT_TRUE(json["counters"].empty());
+    ASSERT_EQ(1ul, json["phases"].size());
+    auto const& verification = json["phases"][0];
+    EXPECT_EQ(1ul, verification["calls"].get<uint64_t>());
+    EXPECT_EQ(100.0, verification["counters"]["items"].get<double>());
+    ASSERT_EQ(1ul, verification["phases"].size());
+    auto const& worker = verification["phases"][0];
+    EXPECT_EQ("worker", worker["name"].get<std::string>());
+    EXPECT_EQ(400ul, worker["calls"].get<uint64_t>());
+    EXPECT_EQ(400.0, worker["counters"]["items"].get<double>());
+
+    recorder.reset();
+}